@@ -32,6 +32,8 @@
  */
 
 #include <arvbufferprivate.h>
+#include <arvgendcprivate.h>
+#include <arvdebugprivate.h>
 
 static gboolean
 arv_buffer_part_is_image (ArvBuffer *buffer, guint part_id)
@@ -947,6 +949,99 @@ arv_buffer_set_n_parts (ArvBuffer* buffer, guint n_parts)
         buffer->priv->n_parts = n_parts;
 }
 
+/*
+ * Parses the GenDC container descriptor at the start of the buffer data, and updates the GenDC informations and the
+ * first part from the first valid intensity component. Only the first @size bytes of the data are considered, which
+ * allows the call on a partially received container. Returns %TRUE if the descriptor is complete and valid.
+ */
+
+gboolean
+arv_buffer_update_gendc_infos (ArvBuffer *buffer, size_t size)
+{
+        const ArvGenDCContainerHeader *container;
+        const unsigned char *data;
+        guint32 descriptor_size;
+        guint32 component_count;
+        guint i;
+
+        g_return_val_if_fail (ARV_IS_BUFFER (buffer), FALSE);
+
+        buffer->priv->has_gendc = FALSE;
+
+        data = buffer->priv->data;
+        size = MIN (size, buffer->priv->allocated_size);
+
+        if (data == NULL || size < sizeof (ArvGenDCContainerHeader))
+                return FALSE;
+
+        container = (const ArvGenDCContainerHeader *) data;
+        if (GUINT32_FROM_LE (container->signature) != ARV_GENDC_SIGNATURE) {
+                arv_warning_sp ("Invalid GenDC Container: Signature shows %.4s which is supposed to be GNDC", data);
+                return FALSE;
+        }
+
+        descriptor_size = GUINT32_FROM_LE (container->descriptorsize);
+        component_count = GUINT32_FROM_LE (container->component_count);
+
+        if (descriptor_size > size ||
+            sizeof (ArvGenDCContainerHeader) + (guint64) component_count * sizeof (guint64) > descriptor_size)
+                return FALSE;
+
+        buffer->priv->has_gendc = TRUE;
+        buffer->priv->gendc_descriptor_size = descriptor_size;
+        buffer->priv->gendc_data_offset = GUINT64_FROM_LE (container->dataoffset);
+        buffer->priv->gendc_data_size = GUINT64_FROM_LE (container->datasize);
+
+        for (i = 0; i < component_count; i++) {
+                const ArvGenDCComponentHeader *component;
+                const ArvGenDCPartHeader *part;
+                guint64 component_offset;
+                guint64 part_offset;
+
+                memcpy (&component_offset, data + sizeof (ArvGenDCContainerHeader) + i * sizeof (guint64),
+                        sizeof (guint64));
+                component_offset = GUINT64_FROM_LE (component_offset);
+                if (component_offset + sizeof (ArvGenDCComponentHeader) + sizeof (guint64) > descriptor_size)
+                        continue;
+
+                component = (const ArvGenDCComponentHeader *) (data + component_offset);
+
+                /* only if the component is valid and have an image data (GDC_INTENSITY from SFNC) */
+                if (GUINT16_FROM_LE (component->flags) != 0 ||
+                    GUINT64_FROM_LE (component->type_id) != ARV_GENDC_COMPONENT_TYPE_INTENSITY ||
+                    GUINT16_FROM_LE (component->part_count) == 0)
+                        continue;
+
+                memcpy (&part_offset, data + component_offset + sizeof (ArvGenDCComponentHeader), sizeof (guint64));
+                part_offset = GUINT64_FROM_LE (part_offset);
+                if (part_offset + sizeof (ArvGenDCPartHeader) > descriptor_size)
+                        continue;
+
+                part = (const ArvGenDCPartHeader *) (data + part_offset);
+                if (GUINT64_FROM_LE (part->dataoffset) > buffer->priv->allocated_size)
+                        continue;
+
+                if (buffer->priv->n_parts < 1)
+                        arv_buffer_set_n_parts (buffer, 1);
+
+                buffer->priv->parts[0].data_offset = GUINT64_FROM_LE (part->dataoffset);
+                buffer->priv->parts[0].size = MIN (GUINT64_FROM_LE (part->datasize),
+                                                   buffer->priv->allocated_size - GUINT64_FROM_LE (part->dataoffset));
+                buffer->priv->parts[0].component_id = i;
+                buffer->priv->parts[0].data_type = ARV_BUFFER_PART_DATA_TYPE_2D_IMAGE;
+                buffer->priv->parts[0].pixel_format = GUINT32_FROM_LE (component->format);
+                buffer->priv->parts[0].width = GUINT32_FROM_LE (part->dimension_x);
+                buffer->priv->parts[0].height = GUINT32_FROM_LE (part->dimension_y);
+                buffer->priv->parts[0].x_offset = 0;
+                buffer->priv->parts[0].y_offset = 0;
+                buffer->priv->parts[0].x_padding = GUINT16_FROM_LE (part->padding_x);
+                buffer->priv->parts[0].y_padding = GUINT16_FROM_LE (part->padding_y);
+                break;
+        }
+
+        return TRUE;
+}
+
 G_DEFINE_TYPE_WITH_CODE (ArvBuffer, arv_buffer, G_TYPE_OBJECT, G_ADD_PRIVATE (ArvBuffer))
 
 static void
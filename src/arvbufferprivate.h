@@ -83,6 +83,7 @@ struct _ArvBufferClass {
 };
 
 void            arv_buffer_set_n_parts                  (ArvBuffer* buffer, guint n_parts);
+ARV_API gboolean arv_buffer_update_gendc_infos          (ArvBuffer *buffer, size_t size);
 
 G_END_DECLS
 
@@ -51,6 +51,7 @@
 #include <arvgentldeviceprivate.h>
 #include <arvenums.h>
 #include <arvstr.h>
+#include <arvmiscprivate.h>
 
 static void arv_camera_get_integer_bounds_as_gint (ArvCamera *camera, const char *feature, gint *min, gint *max, GError **error);
 static void arv_camera_get_integer_bounds_as_guint (ArvCamera *camera, const char *feature, guint *min, guint *max, GError **error);
@@ -3307,6 +3308,72 @@ arv_camera_set_access_check_policy (ArvCamera *camera, ArvAccessCheckPolicy poli
 	arv_device_set_access_check_policy (priv->device, policy);
 }
 
+/**
+ * arv_camera_begin_transaction:
+ * @camera: a #ArvCamera
+ * @error: a #GError placeholder
+ *
+ * Starts a feature transaction. Until [method@Aravis.Camera.commit_transaction], the register writes are deferred, and
+ * the feature reads return the pending values. It allows a fast reconfiguration of the camera, for example of the
+ * region of interest, the binning and the pixel format in a single step. See [method@Aravis.Device.begin_transaction].
+ *
+ * Returns: %TRUE on success.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_camera_begin_transaction (ArvCamera *camera, GError **error)
+{
+	ArvCameraPrivate *priv = arv_camera_get_instance_private (camera);
+
+	g_return_val_if_fail (ARV_IS_CAMERA (camera), FALSE);
+
+	return arv_device_begin_transaction (priv->device, error);
+}
+
+/**
+ * arv_camera_commit_transaction:
+ * @camera: a #ArvCamera
+ * @error: a #GError placeholder
+ *
+ * Sends the register writes deferred since [method@Aravis.Camera.begin_transaction]. On failure, the error message
+ * lists the applied and the not applied features.
+ *
+ * Returns: %TRUE on success.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_camera_commit_transaction (ArvCamera *camera, GError **error)
+{
+	ArvCameraPrivate *priv = arv_camera_get_instance_private (camera);
+
+	g_return_val_if_fail (ARV_IS_CAMERA (camera), FALSE);
+
+	return arv_device_commit_transaction (priv->device, error);
+}
+
+/**
+ * arv_camera_abort_transaction:
+ * @camera: a #ArvCamera
+ *
+ * Discards the register writes deferred since [method@Aravis.Camera.begin_transaction].
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_camera_abort_transaction (ArvCamera *camera)
+{
+	ArvCameraPrivate *priv = arv_camera_get_instance_private (camera);
+
+	g_return_if_fail (ARV_IS_CAMERA (camera));
+
+	arv_device_abort_transaction (priv->device);
+}
+
 
 
 /**
@@ -3978,6 +4045,31 @@ arv_camera_uv_set_maximum_transfer_size (ArvCamera *camera, guint64 size)
 #endif
 }
 
+/**
+ * arv_camera_uv_set_transfer_tuning:
+ * @camera: a #ArvCamera
+ * @enable: enable transfer tuning
+ *
+ * Enables the runtime adjustment of the USB bulk transfer size and of the number of queued transfers, instead of
+ * relying on a manually chosen maximum transfer size. See [method@Aravis.UvDevice.set_transfer_tuning].
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_camera_uv_set_transfer_tuning (ArvCamera *camera, gboolean enable)
+{
+#if ARAVIS_HAS_USB
+	ArvCameraPrivate *priv = arv_camera_get_instance_private (camera);
+#endif
+
+	g_return_if_fail (arv_camera_is_uv_device (camera));
+
+#if ARAVIS_HAS_USB
+	arv_uv_device_set_transfer_tuning (ARV_UV_DEVICE (priv->device), enable);
+#endif
+}
+
 /**
  * arv_camera_is_gentl_device:
  * @camera: a #ArvCamera
@@ -4271,6 +4363,35 @@ arv_camera_new (const char *name, GError **error)
 	return g_initable_new (ARV_TYPE_CAMERA, NULL, error, "name", name, NULL);
 }
 
+static GObject *
+_camera_new (const char *name, GError **error)
+{
+	return (GObject *) arv_camera_new (name, error);
+}
+
+/**
+ * arv_camera_new_multiple:
+ * @names: (array zero-terminated=1): a %NULL terminated list of camera names
+ * @error: a #GError placeholder, %NULL to ignore
+ *
+ * Creates the #ArvCamera objects corresponding to @names, see [ctor@Aravis.Camera.new] for the name format. The
+ * cameras are created concurrently, which overlaps the device discovery, the Genicam data download and parsing, and
+ * the initial feature reads of each camera. If any of the cameras can't be created, the already created ones are
+ * released, and the error of the first failing name is returned.
+ *
+ * Returns: (transfer full) (element-type ArvCamera): an array of new #ArvCamera, in @names order.
+ *
+ * Since: 0.10.0
+ */
+
+GPtrArray *
+arv_camera_new_multiple (const char **names, GError **error)
+{
+	g_return_val_if_fail (names != NULL, NULL);
+
+	return arv_open_in_parallel (names, _camera_new, error);
+}
+
 /**
  * arv_camera_new_with_device:
  * @device: (transfer none): a #ArvDevice
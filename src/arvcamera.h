@@ -55,6 +55,7 @@ struct _ArvCameraClass {
 
 ARV_API ArvCamera *	arv_camera_new			(const char *name, GError **error);
 ARV_API ArvCamera *	arv_camera_new_with_device	(ArvDevice *device, GError **error);
+ARV_API GPtrArray *	arv_camera_new_multiple		(const char **names, GError **error);
 ARV_API ArvDevice *	arv_camera_get_device		(ArvCamera *camera);
 
 ARV_API ArvStream *	arv_camera_create_stream	(ArvCamera *camera, ArvStreamCallback callback, void *user_data,
@@ -230,6 +231,12 @@ ARV_API void		arv_camera_set_register_cache_policy		(ArvCamera *camera, ArvRegis
 ARV_API void		arv_camera_set_range_check_policy		(ArvCamera *camera, ArvRangeCheckPolicy policy);
 ARV_API void            arv_camera_set_access_check_policy	        (ArvCamera *camera, ArvAccessCheckPolicy policy);
 
+/* Feature transactions */
+
+ARV_API gboolean	arv_camera_begin_transaction			(ArvCamera *camera, GError **error);
+ARV_API gboolean	arv_camera_commit_transaction			(ArvCamera *camera, GError **error);
+ARV_API void		arv_camera_abort_transaction			(ArvCamera *camera);
+
 /* GigEVision specific API */
 
 ARV_API gboolean	arv_camera_is_gv_device				(ArvCamera *camera);
@@ -273,6 +280,7 @@ ARV_API guint		arv_camera_uv_get_bandwidth			(ArvCamera *camera, GError **error)
 ARV_API void		arv_camera_uv_get_bandwidth_bounds		(ArvCamera *camera, guint *min, guint *max, GError **error);
 ARV_API void            arv_camera_uv_set_usb_mode			(ArvCamera *camera, ArvUvUsbMode usb_mode);
 ARV_API void            arv_camera_uv_set_maximum_transfer_size         (ArvCamera *camera, guint64 size);
+ARV_API void            arv_camera_uv_set_transfer_tuning               (ArvCamera *camera, gboolean enable);
 
 ARV_API gboolean	arv_camera_is_gentl_device			(ArvCamera *camera);
 
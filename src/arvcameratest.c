@@ -6,6 +6,7 @@
 #include <stdio.h>
 
 #define N_BUFFERS       5
+#define N_PUSH_TIMES	64
 
 static char *arv_option_camera_name = NULL;
 static char *arv_option_debug_domains = NULL;
@@ -32,6 +33,7 @@ static int arv_option_gv_packet_size = -1;
 static gboolean arv_option_realtime = FALSE;
 static gboolean arv_option_high_priority = FALSE;
 static gboolean arv_option_no_packet_socket = FALSE;
+static gboolean arv_option_xdp = FALSE;
 static gboolean arv_option_multipart = FALSE;
 static char *arv_option_chunks = NULL;
 static int arv_option_bandwidth_limit = -1;
@@ -41,10 +43,12 @@ static char *arv_option_access_check = NULL;
 static int arv_option_duration_s = -1;
 static char *arv_option_uv_usb_mode = NULL;
 static guint arv_option_uv_usb_maximum_transfer_size = 0;
+static gboolean arv_option_uv_usb_transfer_tuning = FALSE;
 static gboolean arv_option_show_version = FALSE;
 static gboolean arv_option_gv_allow_broadcast_discovery_ack = FALSE;
 static char *arv_option_gv_port_range = NULL;
 static gboolean arv_option_native_buffers = FALSE;
+static gboolean arv_option_buffer_latency = FALSE;
 static char *arv_option_gv_discovery_interface = NULL;
 
 /* clang-format off */
@@ -167,6 +171,12 @@ static const GOptionEntry arv_option_entries[] =
                 "USB maximum transfer size",
 		"<n_bytes>}"
 	},
+	{
+		"usb-transfer-tuning",			'\0', 0, G_OPTION_ARG_NONE,
+		&arv_option_uv_usb_transfer_tuning,
+		"USB transfer size and queue depth tuning",
+		NULL
+	},
 	{
 		"chunks", 				'u', 0, G_OPTION_ARG_STRING,
 		&arv_option_chunks,	 		"Chunks",
@@ -187,6 +197,11 @@ static const GOptionEntry arv_option_entries[] =
 		&arv_option_no_packet_socket,		"Disable use of packet socket",
 		NULL
 	},
+	{
+		"xdp",					'\0', 0, G_OPTION_ARG_NONE,
+		&arv_option_xdp,			"Enable use of AF_XDP socket",
+		NULL
+	},
 	{
 		"multipart",    			'\0', 0, G_OPTION_ARG_NONE,
 		&arv_option_multipart,		        "Enable multipart payload",
@@ -238,6 +253,11 @@ static const GOptionEntry arv_option_entries[] =
 		&arv_option_native_buffers, 		"Enable native buffers",
                 NULL
 	},
+	{
+		"buffer-latency", 			'\0', 0, G_OPTION_ARG_NONE,
+		&arv_option_buffer_latency, 		"Measure the buffer resubmission latency",
+                NULL
+	},
 	{
 		"debug", 				'd', 0, G_OPTION_ARG_STRING,
 		&arv_option_debug_domains, 		"Debug output selection",
@@ -267,6 +287,16 @@ typedef struct {
 	char **chunks;
 
         gint64 start_time;
+
+	/* Buffer resubmission latency, from the push of a buffer to the start of its filling. The input queue being a
+	 * FIFO, the n-th START_BUFFER callback corresponds to the n-th pushed buffer. */
+	gint64 push_times[N_PUSH_TIMES];
+	guint n_pushed;
+	guint n_started;
+	GMutex latency_mutex;
+	gint64 latency_sum;
+	gint64 latency_max;
+	guint n_latencies;
 } ApplicationData;
 
 static gboolean cancel = FALSE;
@@ -277,6 +307,17 @@ set_cancel (int signal)
 	cancel = TRUE;
 }
 
+static void
+push_buffer (ArvStream *stream, ApplicationData *data, ArvBuffer *buffer)
+{
+	/* The input queue push is a full barrier, the time is visible to the stream thread before the buffer */
+	if (arv_option_buffer_latency)
+		data->push_times[data->n_pushed % N_PUSH_TIMES] = g_get_monotonic_time ();
+	data->n_pushed++;
+
+	arv_stream_push_buffer (stream, buffer);
+}
+
 static void
 new_buffer_cb (ArvStream *stream, ApplicationData *data)
 {
@@ -320,14 +361,30 @@ new_buffer_cb (ArvStream *stream, ApplicationData *data)
 
 		/* Image processing here */
 
-		arv_stream_push_buffer (stream, buffer);
+		push_buffer (stream, data, buffer);
 	}
 }
 
 static void
 stream_cb (void *user_data, ArvStreamCallbackType type, ArvBuffer *buffer)
 {
-	if (type == ARV_STREAM_CALLBACK_TYPE_INIT) {
+	ApplicationData *data = user_data;
+
+	if (type == ARV_STREAM_CALLBACK_TYPE_START_BUFFER && arv_option_buffer_latency) {
+		/* The initial buffers are pushed before the acquisition start */
+		if (data->n_started >= N_BUFFERS) {
+			gint64 latency;
+
+			latency = g_get_monotonic_time () - data->push_times[data->n_started % N_PUSH_TIMES];
+
+			g_mutex_lock (&data->latency_mutex);
+			data->latency_sum += latency;
+			data->latency_max = MAX (data->latency_max, latency);
+			data->n_latencies++;
+			g_mutex_unlock (&data->latency_mutex);
+		}
+		data->n_started++;
+	} else if (type == ARV_STREAM_CALLBACK_TYPE_INIT) {
 		if (arv_option_realtime) {
 			if (!arv_make_thread_realtime (10))
 				printf ("Failed to make stream thread realtime\n");
@@ -348,9 +405,18 @@ periodic_task_cb (void *abstract_data)
 		data->buffer_count > 1 ? "s/s" : "/s ",
 		(double) data->transferred / 1e6);
 	if (data->error_count > 0)
-		printf (" - %d error%s\n", data->error_count, data->error_count > 1 ? "s" : "");
-	else
-		printf ("\n");
+		printf (" - %d error%s", data->error_count, data->error_count > 1 ? "s" : "");
+	if (arv_option_buffer_latency) {
+		g_mutex_lock (&data->latency_mutex);
+		if (data->n_latencies > 0)
+			printf (" - latency %.1f µs (max %" G_GINT64_FORMAT " µs)",
+				(double) data->latency_sum / data->n_latencies, data->latency_max);
+		data->latency_sum = 0;
+		data->latency_max = 0;
+		data->n_latencies = 0;
+		g_mutex_unlock (&data->latency_mutex);
+	}
+	printf ("\n");
 	data->buffer_count = 0;
 	data->error_count = 0;
 	data->transferred = 0;
@@ -403,6 +469,12 @@ main (int argc, char **argv)
 	data.transferred = 0;
 	data.chunks = NULL;
 	data.chunk_parser = NULL;
+	data.n_pushed = 0;
+	data.n_started = 0;
+	data.latency_sum = 0;
+	data.latency_max = 0;
+	data.n_latencies = 0;
+	g_mutex_init (&data.latency_mutex);
 
 	context = g_option_context_new (NULL);
 	g_option_context_set_summary (context, "Small utility for basic device checks.");
@@ -588,6 +660,8 @@ main (int argc, char **argv)
                                 arv_camera_uv_set_usb_mode (camera, usb_mode);
                         if (error == NULL && arv_option_uv_usb_maximum_transfer_size > 0)
                                 arv_camera_uv_set_maximum_transfer_size (camera, arv_option_uv_usb_maximum_transfer_size);
+                        if (error == NULL && arv_option_uv_usb_transfer_tuning)
+                                arv_camera_uv_set_transfer_tuning (camera, TRUE);
 			if (error == NULL && arv_option_bandwidth_limit >= 0)
                                 arv_camera_uv_set_bandwidth (camera, arv_option_bandwidth_limit, &error);
 		}
@@ -596,9 +670,13 @@ main (int argc, char **argv)
 			if (error == NULL) arv_camera_gv_select_stream_channel (camera, arv_option_gv_stream_channel, &error);
 			if (error == NULL) arv_camera_gv_set_packet_delay (camera, arv_option_gv_packet_delay, &error);
 			if (error == NULL) arv_camera_gv_set_packet_size (camera, arv_option_gv_packet_size, &error);
-                        arv_camera_gv_set_stream_options (camera, arv_option_no_packet_socket ?
-                                                          ARV_GV_STREAM_OPTION_PACKET_SOCKET_DISABLED :
-                                                          ARV_GV_STREAM_OPTION_NONE);
+                        arv_camera_gv_set_stream_options (camera,
+                                                          (arv_option_no_packet_socket ?
+                                                           ARV_GV_STREAM_OPTION_PACKET_SOCKET_DISABLED :
+                                                           ARV_GV_STREAM_OPTION_NONE) |
+                                                          (arv_option_xdp ?
+                                                           ARV_GV_STREAM_OPTION_XDP_ENABLED :
+                                                           ARV_GV_STREAM_OPTION_NONE));
                         if (arv_option_packet_size_adjustment != NULL)
                                 arv_camera_gv_set_packet_size_adjustment (camera, adjustment);
                         if (error == NULL) arv_camera_gv_set_multipart (camera, TRUE,
@@ -678,7 +756,7 @@ main (int argc, char **argv)
 		}
 
 		if (success) {
-		    stream = arv_camera_create_stream (camera, stream_cb, NULL, NULL, &error);
+		    stream = arv_camera_create_stream (camera, stream_cb, &data, NULL, &error);
 
                     if (arv_camera_is_gv_device (camera)) {
                             guint gv_packet_size;
@@ -710,11 +788,12 @@ main (int argc, char **argv)
 						  NULL);
 			    }
 
-                            if (arv_option_native_buffers)
+                            if (arv_option_native_buffers) {
                                     arv_stream_create_buffers(stream, N_BUFFERS, NULL, NULL, NULL);
-                            else {
+                                    data.n_pushed = N_BUFFERS;
+                            } else {
                                     for (i = 0; i < N_BUFFERS; i++)
-                                            arv_stream_push_buffer (stream, arv_buffer_new_allocate (payload));
+                                            push_buffer (stream, &data, arv_buffer_new_allocate (payload));
                             }
 
 			    arv_camera_set_acquisition_mode (camera, ARV_ACQUISITION_MODE_CONTINUOUS, NULL);
@@ -800,6 +879,7 @@ main (int argc, char **argv)
 		g_strfreev (data.chunks);
 
 	g_clear_object (&data.chunk_parser);
+	g_mutex_clear (&data.latency_mutex);
 
 	return 0;
 }
@@ -40,11 +40,15 @@
 #include <arvgcenumeration.h>
 #include <arvgcregister.h>
 #include <arvgcstring.h>
+#include <arvgcregisternodeprivate.h>
+#include <arvgcprivate.h>
 #include <arvstream.h>
-#include <arvdebug.h>
+#include <arvdebugprivate.h>
+#include <string.h>
 
 enum {
 	ARV_DEVICE_SIGNAL_CONTROL_LOST,
+	ARV_DEVICE_SIGNAL_FEATURE_CHANGED,
 #if ARAVIS_HAS_EVENT
 	ARV_DEVICE_SIGNAL_DEVICE_EVENT,
 #endif
@@ -62,6 +66,15 @@ arv_device_error_quark (void)
 typedef struct {
 	GError *init_error;
         GSList *streams;
+
+	GMutex poller_mutex;
+	GCond poller_cond;
+	GThread *poller_thread;
+	GMainContext *poller_context;
+	gboolean poller_cancel;
+	guint poller_serial;
+	GPtrArray *polled_features;	/* ArvDevicePolledFeature */
+	GPtrArray *polled_registers;	/* ArvDevicePolledRegister */
 } ArvDevicePrivate;
 
 static void arv_device_initable_iface_init (GInitableIface *iface);
@@ -267,6 +280,416 @@ arv_device_write_register (ArvDevice *device, guint64 address, guint32 value, GE
 	return ARV_DEVICE_GET_CLASS (device)->write_register (device, address, value, error);
 }
 
+/**
+ * arv_device_read_registers:
+ * @device: a #ArvDevice
+ * @addresses: (array length=n_registers): register addresses
+ * @values: (out caller-allocates) (array length=n_registers): a placeholder for the read values
+ * @n_registers: number of registers
+ * @error: (out) (allow-none): a #GError placeholder
+ *
+ * Reads the value of several device registers. When the device protocol allows it, the registers are read using a
+ * minimal number of commands, instead of a command per register.
+ *
+ * Return value: (skip): TRUE on success.
+ *
+ * Since: 0.10.0
+ **/
+
+gboolean
+arv_device_read_registers (ArvDevice *device, const guint64 *addresses, guint32 *values, guint n_registers,
+			   GError **error)
+{
+	guint i;
+
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+	g_return_val_if_fail (addresses != NULL || n_registers == 0, FALSE);
+	g_return_val_if_fail (values != NULL || n_registers == 0, FALSE);
+	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
+
+	if (n_registers == 0)
+		return TRUE;
+
+	if (ARV_DEVICE_GET_CLASS (device)->read_registers != NULL)
+		return ARV_DEVICE_GET_CLASS (device)->read_registers (device, addresses, values, n_registers, error);
+
+	for (i = 0; i < n_registers; i++)
+		if (!ARV_DEVICE_GET_CLASS (device)->read_register (device, addresses[i], &values[i], error))
+			return FALSE;
+
+	return TRUE;
+}
+
+/**
+ * arv_device_write_registers:
+ * @device: a #ArvDevice
+ * @addresses: (array length=n_registers): register addresses
+ * @values: (array length=n_registers): values to write
+ * @n_registers: number of registers
+ * @error: (out) (allow-none): a #GError placeholder
+ *
+ * Writes @values to several device registers, in order. When the device protocol allows it, the registers are
+ * written using a minimal number of commands, instead of a command per register.
+ *
+ * Return value: (skip): TRUE on success.
+ *
+ * Since: 0.10.0
+ **/
+
+gboolean
+arv_device_write_registers (ArvDevice *device, const guint64 *addresses, const guint32 *values, guint n_registers,
+			    GError **error)
+{
+	guint i;
+
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+	g_return_val_if_fail (addresses != NULL || n_registers == 0, FALSE);
+	g_return_val_if_fail (values != NULL || n_registers == 0, FALSE);
+	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
+
+	if (n_registers == 0)
+		return TRUE;
+
+	if (ARV_DEVICE_GET_CLASS (device)->write_registers != NULL)
+		return ARV_DEVICE_GET_CLASS (device)->write_registers (device, addresses, values, n_registers, error);
+
+	for (i = 0; i < n_registers; i++)
+		if (!ARV_DEVICE_GET_CLASS (device)->write_register (device, addresses[i], values[i], error))
+			return FALSE;
+
+	return TRUE;
+}
+
+typedef struct {
+	guint64 address;
+	guint32 size;
+	void *buffer;
+	const void *write_buffer;
+	guint32 value;
+} ArvDeviceAsyncData;
+
+static void
+_read_memory_thread (GTask *task, gpointer source_object, gpointer task_data, GCancellable *cancellable)
+{
+	ArvDeviceAsyncData *data = task_data;
+	GError *error = NULL;
+
+	if (ARV_DEVICE_GET_CLASS (source_object)->read_memory (source_object, data->address, data->size, data->buffer,
+							       &error))
+		g_task_return_boolean (task, TRUE);
+	else
+		g_task_return_error (task, error);
+}
+
+static void
+_write_memory_thread (GTask *task, gpointer source_object, gpointer task_data, GCancellable *cancellable)
+{
+	ArvDeviceAsyncData *data = task_data;
+	GError *error = NULL;
+
+	if (ARV_DEVICE_GET_CLASS (source_object)->write_memory (source_object, data->address, data->size,
+								data->write_buffer, &error))
+		g_task_return_boolean (task, TRUE);
+	else
+		g_task_return_error (task, error);
+}
+
+static void
+_read_register_thread (GTask *task, gpointer source_object, gpointer task_data, GCancellable *cancellable)
+{
+	ArvDeviceAsyncData *data = task_data;
+	GError *error = NULL;
+	guint32 value = 0;
+
+	if (ARV_DEVICE_GET_CLASS (source_object)->read_register (source_object, data->address, &value, &error))
+		g_task_return_int (task, value);
+	else
+		g_task_return_error (task, error);
+}
+
+static void
+_write_register_thread (GTask *task, gpointer source_object, gpointer task_data, GCancellable *cancellable)
+{
+	ArvDeviceAsyncData *data = task_data;
+	GError *error = NULL;
+
+	if (ARV_DEVICE_GET_CLASS (source_object)->write_register (source_object, data->address, data->value, &error))
+		g_task_return_boolean (task, TRUE);
+	else
+		g_task_return_error (task, error);
+}
+
+static void
+_run_in_thread (ArvDevice *device, gpointer source_tag, ArvDeviceAsyncData *data, GTaskThreadFunc thread_func,
+		GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data)
+{
+	ArvDeviceAsyncData *task_data;
+	GTask *task;
+
+	task_data = g_new (ArvDeviceAsyncData, 1);
+	*task_data = *data;
+
+	task = g_task_new (device, cancellable, callback, user_data);
+	g_task_set_source_tag (task, source_tag);
+	g_task_set_task_data (task, task_data, g_free);
+	g_task_run_in_thread (task, thread_func);
+	g_object_unref (task);
+}
+
+/**
+ * arv_device_read_memory_async:
+ * @device: a #ArvDevice
+ * @address: memory address
+ * @size: number of bytes to read
+ * @buffer: (array length=size) (element-type guint8): a buffer for the storage of the read data, which must stay
+ * valid until @callback is called
+ * @cancellable: (nullable): a #GCancellable, or %NULL
+ * @callback: (scope async): a #GAsyncReadyCallback to call when the data is read
+ * @user_data: (closure): data to pass to @callback
+ *
+ * Asynchronously reads @size bytes from the device memory. When the operation is finished, @callback is called from
+ * the thread default main context of the calling thread, and [method@Aravis.Device.read_memory_finish] must be used
+ * to get the result.
+ *
+ * Several asynchronous operations may be pending at the same time. Devices supporting it, like GigEVision devices,
+ * keep several commands in flight, instead of waiting for each command completion before sending the next one.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_device_read_memory_async (ArvDevice *device, guint64 address, guint32 size, void *buffer,
+			      GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data)
+{
+	ArvDeviceAsyncData data = {0};
+
+	g_return_if_fail (ARV_IS_DEVICE (device));
+	g_return_if_fail (buffer != NULL);
+	g_return_if_fail (size > 0);
+
+	if (ARV_DEVICE_GET_CLASS (device)->read_memory_async != NULL) {
+		ARV_DEVICE_GET_CLASS (device)->read_memory_async (device, address, size, buffer,
+								  cancellable, callback, user_data);
+		return;
+	}
+
+	data.address = address;
+	data.size = size;
+	data.buffer = buffer;
+
+	_run_in_thread (device, arv_device_read_memory_async, &data, _read_memory_thread,
+			cancellable, callback, user_data);
+}
+
+/**
+ * arv_device_read_memory_finish:
+ * @device: a #ArvDevice
+ * @result: a #GAsyncResult
+ * @error: a #GError placeholder
+ *
+ * Finishes an operation started with [method@Aravis.Device.read_memory_async].
+ *
+ * Return value: %TRUE on success, %FALSE if an error occurred
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_device_read_memory_finish (ArvDevice *device, GAsyncResult *result, GError **error)
+{
+	g_return_val_if_fail (g_task_is_valid (result, device), FALSE);
+
+	return g_task_propagate_boolean (G_TASK (result), error);
+}
+
+/**
+ * arv_device_write_memory_async:
+ * @device: a #ArvDevice
+ * @address: memory address
+ * @size: size of the content to write buffer
+ * @buffer: (array length=size) (element-type guint8): the content to write, which must stay valid until @callback
+ * is called
+ * @cancellable: (nullable): a #GCancellable, or %NULL
+ * @callback: (scope async): a #GAsyncReadyCallback to call when the data is written
+ * @user_data: (closure): data to pass to @callback
+ *
+ * Asynchronously writes @size bytes to the device memory. [method@Aravis.Device.write_memory_finish] must be used in
+ * @callback to get the result.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_device_write_memory_async (ArvDevice *device, guint64 address, guint32 size, const void *buffer,
+			       GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data)
+{
+	ArvDeviceAsyncData data = {0};
+
+	g_return_if_fail (ARV_IS_DEVICE (device));
+	g_return_if_fail (buffer != NULL);
+	g_return_if_fail (size > 0);
+
+	if (ARV_DEVICE_GET_CLASS (device)->write_memory_async != NULL) {
+		ARV_DEVICE_GET_CLASS (device)->write_memory_async (device, address, size, buffer,
+								   cancellable, callback, user_data);
+		return;
+	}
+
+	data.address = address;
+	data.size = size;
+	data.write_buffer = buffer;
+
+	_run_in_thread (device, arv_device_write_memory_async, &data, _write_memory_thread,
+			cancellable, callback, user_data);
+}
+
+/**
+ * arv_device_write_memory_finish:
+ * @device: a #ArvDevice
+ * @result: a #GAsyncResult
+ * @error: a #GError placeholder
+ *
+ * Finishes an operation started with [method@Aravis.Device.write_memory_async].
+ *
+ * Return value: %TRUE on success, %FALSE if an error occurred
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_device_write_memory_finish (ArvDevice *device, GAsyncResult *result, GError **error)
+{
+	g_return_val_if_fail (g_task_is_valid (result, device), FALSE);
+
+	return g_task_propagate_boolean (G_TASK (result), error);
+}
+
+/**
+ * arv_device_read_register_async:
+ * @device: a #ArvDevice
+ * @address: register address
+ * @cancellable: (nullable): a #GCancellable, or %NULL
+ * @callback: (scope async): a #GAsyncReadyCallback to call when the register is read
+ * @user_data: (closure): data to pass to @callback
+ *
+ * Asynchronously reads the value of a device register. [method@Aravis.Device.read_register_finish] must be used in
+ * @callback to get the value.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_device_read_register_async (ArvDevice *device, guint64 address,
+				GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data)
+{
+	ArvDeviceAsyncData data = {0};
+
+	g_return_if_fail (ARV_IS_DEVICE (device));
+
+	if (ARV_DEVICE_GET_CLASS (device)->read_register_async != NULL) {
+		ARV_DEVICE_GET_CLASS (device)->read_register_async (device, address,
+								    cancellable, callback, user_data);
+		return;
+	}
+
+	data.address = address;
+
+	_run_in_thread (device, arv_device_read_register_async, &data, _read_register_thread,
+			cancellable, callback, user_data);
+}
+
+/**
+ * arv_device_read_register_finish:
+ * @device: a #ArvDevice
+ * @result: a #GAsyncResult
+ * @value: (out): a placeholder for the read value
+ * @error: a #GError placeholder
+ *
+ * Finishes an operation started with [method@Aravis.Device.read_register_async].
+ *
+ * Return value: %TRUE on success, %FALSE if an error occurred
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_device_read_register_finish (ArvDevice *device, GAsyncResult *result, guint32 *value, GError **error)
+{
+	GError *local_error = NULL;
+	gssize task_value;
+
+	g_return_val_if_fail (g_task_is_valid (result, device), FALSE);
+	g_return_val_if_fail (value != NULL, FALSE);
+
+	task_value = g_task_propagate_int (G_TASK (result), &local_error);
+	if (local_error != NULL) {
+		*value = 0;
+		g_propagate_error (error, local_error);
+		return FALSE;
+	}
+
+	*value = (guint32) task_value;
+
+	return TRUE;
+}
+
+/**
+ * arv_device_write_register_async:
+ * @device: a #ArvDevice
+ * @address: register address
+ * @value: value to write
+ * @cancellable: (nullable): a #GCancellable, or %NULL
+ * @callback: (scope async): a #GAsyncReadyCallback to call when the register is written
+ * @user_data: (closure): data to pass to @callback
+ *
+ * Asynchronously writes @value to a device register. [method@Aravis.Device.write_register_finish] must be used in
+ * @callback to get the result.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_device_write_register_async (ArvDevice *device, guint64 address, guint32 value,
+				 GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data)
+{
+	ArvDeviceAsyncData data = {0};
+
+	g_return_if_fail (ARV_IS_DEVICE (device));
+
+	if (ARV_DEVICE_GET_CLASS (device)->write_register_async != NULL) {
+		ARV_DEVICE_GET_CLASS (device)->write_register_async (device, address, value,
+								     cancellable, callback, user_data);
+		return;
+	}
+
+	data.address = address;
+	data.value = value;
+
+	_run_in_thread (device, arv_device_write_register_async, &data, _write_register_thread,
+			cancellable, callback, user_data);
+}
+
+/**
+ * arv_device_write_register_finish:
+ * @device: a #ArvDevice
+ * @result: a #GAsyncResult
+ * @error: a #GError placeholder
+ *
+ * Finishes an operation started with [method@Aravis.Device.write_register_async].
+ *
+ * Return value: %TRUE on success, %FALSE if an error occurred
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_device_write_register_finish (ArvDevice *device, GAsyncResult *result, GError **error)
+{
+	g_return_val_if_fail (g_task_is_valid (result, device), FALSE);
+
+	return g_task_propagate_boolean (G_TASK (result), error);
+}
+
 #if ARAVIS_HAS_EVENT
 /**
  * arv_device_read_event_data:
@@ -461,6 +884,19 @@ arv_device_is_feature_implemented (ArvDevice *device, const char *feature, GErro
 	return ARV_IS_GC_FEATURE_NODE (node) && arv_gc_feature_node_is_implemented (ARV_GC_FEATURE_NODE (node), error);
 }
 
+/* Groups the register writes of a feature assignment, if a transaction is open */
+
+static void
+_set_transaction_feature (ArvDevice *device, ArvGcNode *node)
+{
+	ArvGc *genicam;
+
+	genicam = arv_device_get_genicam (device);
+	if (ARV_IS_GC (genicam))
+		arv_gc_set_transaction_feature (genicam, ARV_IS_GC_FEATURE_NODE (node) ?
+						ARV_GC_FEATURE_NODE (node) : NULL);
+}
+
 static ArvGcNode *
 _get_feature (ArvDevice *device, GType node_type, const char *feature, GError **error)
 {
@@ -535,8 +971,11 @@ arv_device_execute_command (ArvDevice *device, const char *feature, GError **err
         GError *local_error = NULL;
 
 	node = _get_feature (device, ARV_TYPE_GC_COMMAND, feature, &local_error);
-	if (node != NULL)
+	if (node != NULL) {
+		_set_transaction_feature (device, node);
 		arv_gc_command_execute (ARV_GC_COMMAND (node), &local_error);
+		_set_transaction_feature (device, NULL);
+	}
 
         if (local_error != NULL) {
                 g_propagate_error (error, local_error);
@@ -621,6 +1060,8 @@ arv_device_set_feature_value (ArvDevice *device, const char *feature, const GVal
 		return;
 	}
 
+	_set_transaction_feature (device, node);
+
 	if (ARV_IS_GC_FLOAT (node)) {
 		g_value_init(&value_copy, G_TYPE_DOUBLE);
 		if (g_value_transform(value, &value_copy))
@@ -664,6 +1105,8 @@ arv_device_set_feature_value (ArvDevice *device, const char *feature, const GVal
 		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
 			     "[%s:%s] Not a feature", feature, G_OBJECT_TYPE_NAME (node));
 	}
+
+	_set_transaction_feature (device, NULL);
 }
 
 /**
@@ -684,8 +1127,11 @@ arv_device_set_boolean_feature_value (ArvDevice *device, const char *feature, gb
 	ArvGcNode *node;
 
 	node = _get_feature (device, ARV_TYPE_GC_BOOLEAN, feature, error);
-	if (node != NULL)
+	if (node != NULL) {
+		_set_transaction_feature (device, node);
 		arv_gc_boolean_set_value (ARV_GC_BOOLEAN (node), value, error);
+		_set_transaction_feature (device, NULL);
+	}
 }
 
 /**
@@ -749,8 +1195,11 @@ arv_device_set_string_feature_value (ArvDevice *device, const char *feature, con
 	ArvGcNode *node;
 
 	node = _get_feature (device, ARV_TYPE_GC_STRING, feature, error);
-	if (node != NULL)
+	if (node != NULL) {
+		_set_transaction_feature (device, node);
 		arv_gc_string_set_value (ARV_GC_STRING (node), value, error);
+		_set_transaction_feature (device, NULL);
+	}
 }
 
 /**
@@ -794,8 +1243,11 @@ arv_device_set_integer_feature_value (ArvDevice *device, const char *feature, gi
 	ArvGcNode *node;
 
 	node = _get_feature (device, ARV_TYPE_GC_INTEGER, feature, error);
-	if (node != NULL)
+	if (node != NULL) {
+		_set_transaction_feature (device, node);
 		arv_gc_integer_set_value (ARV_GC_INTEGER (node), value, error);
+		_set_transaction_feature (device, NULL);
+	}
 }
 
 /**
@@ -931,8 +1383,11 @@ arv_device_set_float_feature_value (ArvDevice *device, const char *feature, doub
 	ArvGcNode *node;
 
 	node = _get_feature (device, ARV_TYPE_GC_FLOAT, feature, error);
-	if (node != NULL)
+	if (node != NULL) {
+		_set_transaction_feature (device, node);
 		arv_gc_float_set_value (ARV_GC_FLOAT (node), value, error);
+		_set_transaction_feature (device, NULL);
+	}
 }
 
 /**
@@ -1068,8 +1523,11 @@ arv_device_set_register_feature_value (ArvDevice *device, const char *feature, g
 	ArvGcNode *node;
 
 	node = _get_feature (device, ARV_TYPE_GC_REGISTER, feature, error);
-	if (node != NULL)
+	if (node != NULL) {
+		_set_transaction_feature (device, node);
 		arv_gc_register_set (ARV_GC_REGISTER (node), value, length, error);
+		_set_transaction_feature (device, NULL);
+	}
 }
 
 /**
@@ -1233,11 +1691,28 @@ arv_device_is_enumeration_entry_available (ArvDevice *device, const char *featur
         return is_available;
 }
 
-/**
- * arv_device_set_features_from_string:
- * @device: a #ArvDevice
- * @string: a space separated list of features assignments
- * @error: a #GError placeholder, %NULL to ignore
+/* Inside a transaction, the register write is deferred like the feature ones. The staged data uses the big endian
+ * layout of the register write command. */
+
+static gboolean
+_write_register (ArvDevice *device, guint64 address, guint32 value, GError **error)
+{
+	ArvGc *genicam;
+	guint32 be_value = GUINT32_TO_BE (value);
+
+	genicam = arv_device_get_genicam (device);
+	if (ARV_IS_GC (genicam) &&
+	    arv_gc_stage_write (genicam, address, &be_value, sizeof (be_value), TRUE))
+		return TRUE;
+
+	return arv_device_write_register (device, address, value, error);
+}
+
+/**
+ * arv_device_set_features_from_string:
+ * @device: a #ArvDevice
+ * @string: a space separated list of features assignments
+ * @error: a #GError placeholder, %NULL to ignore
  *
  * Set features from a string containing a list of space separated feature assignments or command names. For example:
  *
@@ -1245,6 +1720,9 @@ arv_device_is_enumeration_entry_available (ArvDevice *device, const char *featur
  * arv_device_set_features_from_string (device, "Width=256 Height=256 PixelFormat='Mono8' TriggerStart", &error);
  * ]|
  *
+ * Between [method@Aravis.Device.begin_transaction] and [method@Aravis.Device.commit_transaction], the register writes,
+ * including the `R[address]=value` ones, are deferred until the commit.
+ *
  * Since: 0.8.0
  */
 
@@ -1296,8 +1774,8 @@ arv_device_set_features_from_string (ArvDevice *device, const char *string, GErr
                                                                      ARV_DEVICE_ERROR_INVALID_PARAMETER,
                                                                      "Invalid %s value for %s", value, key);
                                                 } else {
-                                                        arv_device_write_register (device, address, int_value,
-                                                                                   &local_error);
+                                                        _write_register (device, address, int_value,
+                                                                         &local_error);
                                                 }
                                         }
                                 }
@@ -1307,8 +1785,10 @@ arv_device_set_features_from_string (ArvDevice *device, const char *string, GErr
                                         if (ARV_IS_GC_COMMAND (feature)) {
                                                 arv_device_execute_command (device, key, &local_error);
                                         } else if (value != NULL) {
+                                                _set_transaction_feature (device, feature);
                                                 arv_gc_feature_node_set_value_from_string (ARV_GC_FEATURE_NODE (feature),
                                                                                            value, &local_error);
+                                                _set_transaction_feature (device, NULL);
                                         } else {
                                                 g_set_error (&local_error,
                                                              ARV_DEVICE_ERROR,
@@ -1364,6 +1844,97 @@ arv_device_set_register_cache_policy (ArvDevice *device, ArvRegisterCachePolicy
 	arv_gc_set_register_cache_policy (genicam, policy);
 }
 
+/**
+ * arv_device_prefetch_features:
+ * @device: a #ArvDevice
+ * @features: (array zero-terminated=1): a %NULL terminated list of feature names
+ * @error: a #GError placeholder
+ *
+ * Reads in a single batch the registers the given features depend on, in order to speed up the subsequent reads of
+ * these features. It requires the register cache to be enabled, see [method@Aravis.Gc.prefetch_features].
+ *
+ * Returns: %TRUE on success.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_device_prefetch_features (ArvDevice *device, const char **features, GError **error)
+{
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+
+	return arv_gc_prefetch_features (arv_device_get_genicam (device), features, error);
+}
+
+/**
+ * arv_device_begin_transaction:
+ * @device: a #ArvDevice
+ * @error: a #GError placeholder
+ *
+ * Starts a feature transaction. The register writes of the subsequent feature assignments are deferred until
+ * [method@Aravis.Device.commit_transaction], and the feature reads return the assigned values. The usual range and
+ * access checks are done against this pending state. See [method@Aravis.Gc.begin_transaction].
+ *
+ * |[<!-- language="C" -->
+ * arv_device_begin_transaction (device, NULL);
+ * arv_device_set_integer_feature_value (device, "Width", 256, NULL);
+ * arv_device_set_integer_feature_value (device, "OffsetX", 64, NULL);
+ * if (!arv_device_commit_transaction (device, &error))
+ *         g_warning ("%s", error->message);
+ * ]|
+ *
+ * Returns: %TRUE on success.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_device_begin_transaction (ArvDevice *device, GError **error)
+{
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+
+	return arv_gc_begin_transaction (arv_device_get_genicam (device), error);
+}
+
+/**
+ * arv_device_commit_transaction:
+ * @device: a #ArvDevice
+ * @error: a #GError placeholder
+ *
+ * Sends the register writes deferred since [method@Aravis.Device.begin_transaction], ordered by dependency, and
+ * coalesced into as few commands as possible. On failure, the error message reports which features were applied.
+ * See [method@Aravis.Gc.commit_transaction].
+ *
+ * Returns: %TRUE on success.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_device_commit_transaction (ArvDevice *device, GError **error)
+{
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+
+	return arv_gc_commit_transaction (arv_device_get_genicam (device), error);
+}
+
+/**
+ * arv_device_abort_transaction:
+ * @device: a #ArvDevice
+ *
+ * Discards the register writes deferred since [method@Aravis.Device.begin_transaction].
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_device_abort_transaction (ArvDevice *device)
+{
+	g_return_if_fail (ARV_IS_DEVICE (device));
+
+	arv_gc_abort_transaction (arv_device_get_genicam (device));
+}
+
 /**
  * arv_device_set_range_check_policy:
  * @device: a #ArvDevice
@@ -1520,6 +2091,573 @@ arv_device_stop_acquisition (ArvDevice *device, GError **error)
         return success;
 }
 
+/* Feature polling
+ *
+ * The polled registers are read by a worker thread, which gathers the registers due at the same time into blocks of
+ * contiguous addresses, in order to use a single memory read per block. The changed register contents are handed over
+ * to the main context the polling was started from, where the register caches are updated and the feature values
+ * compared, as the Genicam tree is not thread safe. */
+
+#define ARV_DEVICE_POLLER_BLOCK_SIZE_MAX	1024
+
+typedef struct {
+	char *name;
+	char *value;
+} ArvDevicePolledFeature;
+
+typedef struct {
+	ArvGcRegisterNode *node;
+	guint64 address;
+	guint32 length;
+	guint period_ms;
+	gint64 next_time;
+
+	/* Last read content, only accessed from the poller thread */
+	guint8 *data;
+	gboolean has_data;
+
+	GPtrArray *features;		/* ArvDevicePolledFeature, not owned */
+} ArvDevicePolledRegister;
+
+typedef struct {
+	ArvDevicePolledRegister *polled_register;
+	guint8 *data;
+} ArvDevicePollerChange;
+
+typedef struct {
+	ArvDevice *device;
+	guint serial;
+	GArray *changes;		/* ArvDevicePollerChange */
+} ArvDevicePollerUpdate;
+
+static void
+arv_device_polled_feature_free (ArvDevicePolledFeature *polled_feature)
+{
+	g_free (polled_feature->name);
+	g_free (polled_feature->value);
+	g_free (polled_feature);
+}
+
+static void
+arv_device_polled_register_free (ArvDevicePolledRegister *polled_register)
+{
+	g_object_unref (polled_register->node);
+	g_ptr_array_unref (polled_register->features);
+	g_free (polled_register->data);
+	g_free (polled_register);
+}
+
+static void
+arv_device_poller_update_free (ArvDevicePollerUpdate *update)
+{
+	guint i;
+
+	for (i = 0; i < update->changes->len; i++)
+		g_free (g_array_index (update->changes, ArvDevicePollerChange, i).data);
+	g_array_unref (update->changes);
+	g_object_unref (update->device);
+	g_free (update);
+}
+
+static char *
+_dup_polled_feature_value (ArvDevice *device, const char *feature)
+{
+	ArvGcNode *node;
+	GError *local_error = NULL;
+	const char *value;
+
+	node = arv_device_get_feature (device, feature);
+	if (!ARV_IS_GC_FEATURE_NODE (node))
+		return NULL;
+
+	value = arv_gc_feature_node_get_value_as_string (ARV_GC_FEATURE_NODE (node), &local_error);
+	if (local_error != NULL) {
+		arv_debug_device ("[Device::poller] Failed to read '%s' (%s)", feature, local_error->message);
+		g_clear_error (&local_error);
+		return NULL;
+	}
+
+	return g_strdup (value);
+}
+
+static gboolean
+_add_polled_feature (ArvDevice *device, const char *feature, guint period_ms, GError **error)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	ArvDevicePolledFeature *polled_feature = NULL;
+	ArvGcNode *node;
+	GPtrArray *registers;
+	GError *local_error = NULL;
+	char *value;
+	guint i, j;
+
+	node = arv_device_get_feature (device, feature);
+	if (!ARV_IS_GC_FEATURE_NODE (node)) {
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_FEATURE_NOT_FOUND,
+			     "[%s] Not found", feature);
+		return FALSE;
+	}
+
+	registers = arv_gc_dup_feature_registers (arv_device_get_genicam (device), feature);
+	if (registers->len == 0) {
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
+			     "[%s] Not backed by device registers", feature);
+		g_ptr_array_unref (registers);
+		return FALSE;
+	}
+
+	/* Read before taking the poller lock, the device access may be slow */
+	value = _dup_polled_feature_value (device, feature);
+
+	g_mutex_lock (&priv->poller_mutex);
+
+	for (i = 0; i < priv->polled_features->len && polled_feature == NULL; i++) {
+		ArvDevicePolledFeature *candidate = g_ptr_array_index (priv->polled_features, i);
+
+		if (g_strcmp0 (candidate->name, feature) == 0)
+			polled_feature = candidate;
+	}
+
+	if (polled_feature == NULL) {
+		polled_feature = g_new0 (ArvDevicePolledFeature, 1);
+		polled_feature->name = g_strdup (feature);
+		polled_feature->value = g_steal_pointer (&value);
+		g_ptr_array_add (priv->polled_features, polled_feature);
+	}
+
+	for (i = 0; i < registers->len && local_error == NULL; i++) {
+		ArvGcRegisterNode *register_node = g_ptr_array_index (registers, i);
+		ArvDevicePolledRegister *polled_register = NULL;
+		gint64 address;
+		gint64 length;
+
+		for (j = 0; j < priv->polled_registers->len && polled_register == NULL; j++) {
+			ArvDevicePolledRegister *candidate = g_ptr_array_index (priv->polled_registers, j);
+
+			if (candidate->node == register_node)
+				polled_register = candidate;
+		}
+
+		if (polled_register == NULL) {
+			address = arv_gc_register_get_address (ARV_GC_REGISTER (register_node), &local_error);
+			if (local_error == NULL)
+				length = arv_gc_register_get_length (ARV_GC_REGISTER (register_node), &local_error);
+			if (local_error != NULL)
+				break;
+
+			if (length <= 0 || length > ARV_DEVICE_POLLER_BLOCK_SIZE_MAX) {
+				arv_warning_device ("[Device::add_polled_feature] Ignore register '%s' of '%s' "
+						    "(invalid length %" G_GINT64_FORMAT ")",
+						    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (register_node)),
+						    feature, length);
+				continue;
+			}
+
+			polled_register = g_new0 (ArvDevicePolledRegister, 1);
+			polled_register->node = g_object_ref (register_node);
+			polled_register->address = address;
+			polled_register->length = length;
+			polled_register->period_ms = period_ms;
+			polled_register->data = g_malloc0 (length);
+			polled_register->features = g_ptr_array_new ();
+			g_ptr_array_add (priv->polled_registers, polled_register);
+		}
+
+		polled_register->period_ms = MIN (polled_register->period_ms, period_ms);
+		polled_register->next_time = 0;
+
+		for (j = 0; j < polled_register->features->len; j++)
+			if (g_ptr_array_index (polled_register->features, j) == polled_feature)
+				break;
+		if (j == polled_register->features->len)
+			g_ptr_array_add (polled_register->features, polled_feature);
+	}
+
+	g_cond_signal (&priv->poller_cond);
+
+	g_mutex_unlock (&priv->poller_mutex);
+
+	g_free (value);
+	g_ptr_array_unref (registers);
+
+	if (local_error != NULL) {
+		g_propagate_prefixed_error (error, local_error, "[%s] ", feature);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+static gint
+_compare_polled_register_address (gconstpointer a, gconstpointer b)
+{
+	const ArvDevicePolledRegister *register_a = *((const ArvDevicePolledRegister **) a);
+	const ArvDevicePolledRegister *register_b = *((const ArvDevicePolledRegister **) b);
+
+	if (register_a->address < register_b->address)
+		return -1;
+	if (register_a->address > register_b->address)
+		return 1;
+	return 0;
+}
+
+static void
+_check_polled_register (ArvDevicePolledRegister *polled_register, const guint8 *data, GArray *changes)
+{
+	ArvDevicePollerChange change;
+
+	if (polled_register->has_data && memcmp (polled_register->data, data, polled_register->length) == 0)
+		return;
+
+	memcpy (polled_register->data, data, polled_register->length);
+	polled_register->has_data = TRUE;
+
+	change.polled_register = polled_register;
+	change.data = g_malloc (polled_register->length);
+	memcpy (change.data, data, polled_register->length);
+	g_array_append_val (changes, change);
+}
+
+/* Reads the due registers, sorted by address, using one memory read per block of overlapping or adjacent registers.
+ * If the read of a block fails, its registers are read one by one, such that a single faulty register does not prevent
+ * the polling of its neighbours. */
+
+static void
+_read_polled_registers (ArvDevice *device, GPtrArray *due_registers, GArray *changes)
+{
+	guint8 *buffer;
+	guint first, last;
+	guint i;
+
+	buffer = g_malloc (ARV_DEVICE_POLLER_BLOCK_SIZE_MAX);
+
+	for (first = 0; first < due_registers->len; first = last) {
+		ArvDevicePolledRegister *polled_register = g_ptr_array_index (due_registers, first);
+		guint64 block_address = polled_register->address;
+		guint64 block_end = polled_register->address + polled_register->length;
+		GError *local_error = NULL;
+
+		for (last = first + 1; last < due_registers->len; last++) {
+			polled_register = g_ptr_array_index (due_registers, last);
+
+			if (polled_register->address > block_end ||
+			    MAX (block_end, polled_register->address + polled_register->length) - block_address >
+			    ARV_DEVICE_POLLER_BLOCK_SIZE_MAX)
+				break;
+
+			block_end = MAX (block_end, polled_register->address + polled_register->length);
+		}
+
+		if (arv_device_read_memory (device, block_address, block_end - block_address, buffer, &local_error)) {
+			for (i = first; i < last; i++) {
+				polled_register = g_ptr_array_index (due_registers, i);
+				_check_polled_register (polled_register,
+							buffer + (polled_register->address - block_address), changes);
+			}
+			continue;
+		}
+
+		arv_debug_device ("[Device::poller] Failed to read 0x%" G_GINT64_MODIFIER "x-0x%"
+				  G_GINT64_MODIFIER "x (%s)", block_address, block_end, local_error->message);
+		g_clear_error (&local_error);
+
+		if (last - first < 2)
+			continue;
+
+		for (i = first; i < last; i++) {
+			polled_register = g_ptr_array_index (due_registers, i);
+			if (arv_device_read_memory (device, polled_register->address, polled_register->length,
+						    buffer, NULL))
+				_check_polled_register (polled_register, buffer, changes);
+		}
+	}
+
+	g_free (buffer);
+}
+
+static gboolean
+_dispatch_poller_update (gpointer user_data)
+{
+	ArvDevicePollerUpdate *update = user_data;
+	ArvDevicePrivate *priv = arv_device_get_instance_private (update->device);
+	GPtrArray *features;
+	guint i, j;
+
+	g_mutex_lock (&priv->poller_mutex);
+	if (update->serial != priv->poller_serial) {
+		g_mutex_unlock (&priv->poller_mutex);
+		return G_SOURCE_REMOVE;
+	}
+	g_mutex_unlock (&priv->poller_mutex);
+
+	for (i = 0; i < update->changes->len; i++) {
+		ArvDevicePollerChange *change = &g_array_index (update->changes, ArvDevicePollerChange, i);
+
+		arv_gc_register_node_set_polled_data (change->polled_register->node,
+						      change->polled_register->address,
+						      change->data, change->polled_register->length);
+	}
+
+	features = g_ptr_array_new ();
+
+	g_mutex_lock (&priv->poller_mutex);
+	for (i = 0; i < update->changes->len; i++) {
+		ArvDevicePolledRegister *polled_register;
+
+		polled_register = g_array_index (update->changes, ArvDevicePollerChange, i).polled_register;
+		for (j = 0; j < polled_register->features->len; j++) {
+			gpointer polled_feature = g_ptr_array_index (polled_register->features, j);
+
+			if (!g_ptr_array_find (features, polled_feature, NULL))
+				g_ptr_array_add (features, polled_feature);
+		}
+	}
+	g_mutex_unlock (&priv->poller_mutex);
+
+	for (i = 0; i < features->len; i++) {
+		ArvDevicePolledFeature *polled_feature = g_ptr_array_index (features, i);
+		char *value;
+
+		value = _dup_polled_feature_value (update->device, polled_feature->name);
+		if (value == NULL || g_strcmp0 (value, polled_feature->value) == 0) {
+			g_free (value);
+			continue;
+		}
+
+		g_free (polled_feature->value);
+		polled_feature->value = value;
+
+		g_signal_emit (update->device, arv_device_signals[ARV_DEVICE_SIGNAL_FEATURE_CHANGED],
+			       g_quark_from_string (polled_feature->name), polled_feature->name);
+	}
+
+	g_ptr_array_unref (features);
+
+	return G_SOURCE_REMOVE;
+}
+
+static void *
+arv_device_poller_thread (void *data)
+{
+	ArvDevice *device = data;
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	GPtrArray *due_registers;
+	guint i;
+
+	due_registers = g_ptr_array_new ();
+
+	g_mutex_lock (&priv->poller_mutex);
+
+	while (!priv->poller_cancel) {
+		ArvDevicePollerUpdate *update;
+		GArray *changes;
+		gint64 now = g_get_monotonic_time ();
+		gint64 next_time = G_MAXINT64;
+		guint serial = priv->poller_serial;
+
+		g_ptr_array_set_size (due_registers, 0);
+
+		for (i = 0; i < priv->polled_registers->len; i++) {
+			ArvDevicePolledRegister *polled_register = g_ptr_array_index (priv->polled_registers, i);
+			gint64 period = (gint64) MAX (polled_register->period_ms, 1) * 1000;
+
+			if (polled_register->next_time <= now) {
+				g_ptr_array_add (due_registers, polled_register);
+
+				/* Don't try to catch up with the missed periods */
+				polled_register->next_time += period;
+				if (polled_register->next_time <= now)
+					polled_register->next_time = now + period;
+			}
+
+			next_time = MIN (next_time, polled_register->next_time);
+		}
+
+		if (due_registers->len == 0) {
+			if (next_time == G_MAXINT64)
+				g_cond_wait (&priv->poller_cond, &priv->poller_mutex);
+			else
+				g_cond_wait_until (&priv->poller_cond, &priv->poller_mutex, next_time);
+			continue;
+		}
+
+		g_mutex_unlock (&priv->poller_mutex);
+
+		/* The register geometry is immutable, and their content is only accessed from this thread */
+		g_ptr_array_sort (due_registers, _compare_polled_register_address);
+		changes = g_array_new (FALSE, FALSE, sizeof (ArvDevicePollerChange));
+		_read_polled_registers (device, due_registers, changes);
+
+		g_mutex_lock (&priv->poller_mutex);
+
+		update = g_new0 (ArvDevicePollerUpdate, 1);
+		update->serial = serial;
+		update->changes = changes;
+
+		if (changes->len > 0 && !priv->poller_cancel) {
+			update->device = g_object_ref (device);
+			g_main_context_invoke_full (priv->poller_context, G_PRIORITY_DEFAULT,
+						    _dispatch_poller_update, update,
+						    (GDestroyNotify) arv_device_poller_update_free);
+		} else {
+			for (i = 0; i < changes->len; i++)
+				g_free (g_array_index (changes, ArvDevicePollerChange, i).data);
+			g_array_unref (changes);
+			g_free (update);
+		}
+	}
+
+	g_mutex_unlock (&priv->poller_mutex);
+
+	g_ptr_array_unref (due_registers);
+
+	return NULL;
+}
+
+/**
+ * arv_device_add_polled_feature:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @period_ms: polling period, in milliseconds
+ * @error: a #GError placeholder, %NULL to ignore
+ *
+ * Adds @feature to the list of the features checked by the poller, in addition to the ones having a PollingTime
+ * property in the Genicam data. The registers shared with other polled features are read at the shortest of their
+ * periods. The feature may be added while the polling is running.
+ *
+ * Returns: %TRUE on success, %FALSE if @feature does not exist or does not depend on any device register.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_device_add_polled_feature (ArvDevice *device, const char *feature, guint period_ms, GError **error)
+{
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+	g_return_val_if_fail (feature != NULL, FALSE);
+	g_return_val_if_fail (period_ms > 0, FALSE);
+
+	return _add_polled_feature (device, feature, period_ms, error);
+}
+
+/**
+ * arv_device_start_polling:
+ * @device: a #ArvDevice
+ * @error: a #GError placeholder, %NULL to ignore
+ *
+ * Starts a worker thread that periodically reads the registers of the features having a PollingTime property, and
+ * of the ones added by arv_device_add_polled_feature(). The registers due at the same time and sharing a register
+ * block are read using a single memory read.
+ *
+ * When a register content changes, its cache is updated and the #ArvDevice::feature-changed signal is emitted for the
+ * features whose value differs from the previous one. This happens in the thread default main context of the caller,
+ * which must be running for the changes to be processed. Enabling the register cache, using
+ * arv_device_set_register_cache_policy(), saves the device access needed for the new feature values.
+ *
+ * Returns: %TRUE on success.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_device_start_polling (ArvDevice *device, GError **error)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	ArvGc *genicam;
+	GPtrArray *registers;
+	guint i;
+
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+
+	if (priv->poller_thread != NULL)
+		return TRUE;
+
+	genicam = arv_device_get_genicam (device);
+	if (!ARV_IS_GC (genicam)) {
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_GENICAM_NOT_FOUND,
+			     "Genicam data not found");
+		return FALSE;
+	}
+
+	registers = arv_gc_dup_polled_registers (genicam);
+	for (i = 0; i < registers->len; i++) {
+		const char *name = arv_gc_feature_node_get_name (g_ptr_array_index (registers, i));
+		guint64 polling_time = arv_gc_register_node_get_polling_time (g_ptr_array_index (registers, i));
+		GError *local_error = NULL;
+
+		/* The period is stored in a guint, in milliseconds */
+		if (!_add_polled_feature (device, name, MIN (polling_time, G_MAXUINT), &local_error)) {
+			arv_warning_device ("[Device::start_polling] %s", local_error->message);
+			g_clear_error (&local_error);
+		}
+	}
+	g_ptr_array_unref (registers);
+
+	for (i = 0; i < priv->polled_features->len; i++) {
+		ArvDevicePolledFeature *polled_feature = g_ptr_array_index (priv->polled_features, i);
+
+		g_free (polled_feature->value);
+		polled_feature->value = _dup_polled_feature_value (device, polled_feature->name);
+	}
+
+	arv_info_device ("[Device::start_polling] Poll %u feature(s), using %u register(s)",
+			 priv->polled_features->len, priv->polled_registers->len);
+
+	g_mutex_lock (&priv->poller_mutex);
+
+	for (i = 0; i < priv->polled_registers->len; i++) {
+		ArvDevicePolledRegister *polled_register = g_ptr_array_index (priv->polled_registers, i);
+
+		polled_register->next_time = 0;
+		polled_register->has_data = FALSE;
+	}
+
+	priv->poller_cancel = FALSE;
+	priv->poller_serial++;
+	priv->poller_context = g_main_context_ref_thread_default ();
+	priv->poller_thread = g_thread_new ("arv_device_poller", arv_device_poller_thread, device);
+
+	g_mutex_unlock (&priv->poller_mutex);
+
+	return TRUE;
+}
+
+/**
+ * arv_device_stop_polling:
+ * @device: a #ArvDevice
+ *
+ * Stops the feature polling started by arv_device_start_polling(). The changes not yet dispatched are dropped. The
+ * list of polled features is kept for the next start.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_device_stop_polling (ArvDevice *device)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	GThread *thread;
+
+	g_return_if_fail (ARV_IS_DEVICE (device));
+
+	g_mutex_lock (&priv->poller_mutex);
+
+	thread = priv->poller_thread;
+	priv->poller_thread = NULL;
+	priv->poller_cancel = TRUE;
+	priv->poller_serial++;
+	g_cond_signal (&priv->poller_cond);
+
+	g_mutex_unlock (&priv->poller_mutex);
+
+	if (thread == NULL)
+		return;
+
+	g_thread_join (thread);
+
+	g_clear_pointer (&priv->poller_context, g_main_context_unref);
+}
+
 void
 arv_device_emit_control_lost_signal (ArvDevice *device)
 {
@@ -1551,6 +2689,20 @@ void arv_device_take_init_error (ArvDevice *device, GError *error)
 static void
 arv_device_init (ArvDevice *device)
 {
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+
+	g_mutex_init (&priv->poller_mutex);
+	g_cond_init (&priv->poller_cond);
+	priv->polled_features = g_ptr_array_new_with_free_func ((GDestroyNotify) arv_device_polled_feature_free);
+	priv->polled_registers = g_ptr_array_new_with_free_func ((GDestroyNotify) arv_device_polled_register_free);
+}
+
+static void
+arv_device_dispose (GObject *object)
+{
+	arv_device_stop_polling (ARV_DEVICE (object));
+
+	G_OBJECT_CLASS (arv_device_parent_class)->dispose (object);
 }
 
 static void
@@ -1561,6 +2713,11 @@ arv_device_finalize (GObject *object)
 
 	g_clear_error (&priv->init_error);
 
+	g_ptr_array_unref (priv->polled_registers);
+	g_ptr_array_unref (priv->polled_features);
+	g_cond_clear (&priv->poller_cond);
+	g_mutex_clear (&priv->poller_mutex);
+
         for (iter = priv->streams; iter != NULL; iter= iter->next) {
                 g_weak_ref_clear(iter->data);
                 g_free (iter->data);
@@ -1575,6 +2732,7 @@ arv_device_class_init (ArvDeviceClass *device_class)
 {
 	GObjectClass *object_class = G_OBJECT_CLASS (device_class);
 
+	object_class->dispose = arv_device_dispose;
 	object_class->finalize = arv_device_finalize;
 
 	/**
@@ -1597,6 +2755,28 @@ arv_device_class_init (ArvDeviceClass *device_class)
 			      NULL, NULL,
 			      g_cclosure_marshal_VOID__VOID, G_TYPE_NONE, 0, G_TYPE_NONE);
 
+	/**
+	 * ArvDevice::feature-changed:
+	 * @device:a #ArvDevice
+	 * @feature: the name of the changed feature
+	 *
+	 * Signal that the value of a polled feature changed, see arv_device_start_polling(). The signal detail is
+	 * the feature name, allowing to connect to the changes of a single feature, for example using
+	 * "feature-changed::DeviceTemperature".
+	 *
+	 * This signal is emitted from the main context the polling was started from.
+	 *
+	 * Since: 0.10.0
+	 */
+
+	arv_device_signals[ARV_DEVICE_SIGNAL_FEATURE_CHANGED] =
+		g_signal_new ("feature-changed",
+			      G_TYPE_FROM_CLASS (device_class),
+			      G_SIGNAL_RUN_LAST | G_SIGNAL_DETAILED,
+			      G_STRUCT_OFFSET (ArvDeviceClass, feature_changed),
+			      NULL, NULL,
+			      g_cclosure_marshal_VOID__STRING, G_TYPE_NONE, 1, G_TYPE_STRING);
+
 #if ARAVIS_HAS_EVENT
 	/**
 	 * ArvDevice::device-event:
@@ -32,6 +32,7 @@
 #include <arvtypes.h>
 #include <arvstream.h>
 #include <arvchunkparser.h>
+#include <gio/gio.h>
 
 G_BEGIN_DECLS
 
@@ -94,6 +95,7 @@ struct _ArvDeviceClass {
 	gboolean	(*write_memory)		(ArvDevice *device, guint64 address, guint32 size, const void *buffer, GError **error);
 	gboolean	(*read_register)	(ArvDevice *device, guint64 address, guint32 *value, GError **error);
 	gboolean	(*write_register)	(ArvDevice *device, guint64 address, guint32 value, GError **error);
+
 #if ARAVIS_HAS_EVENT
 	gboolean	(*read_event_data)	(ArvDevice *device, int event_id, guint64 address, guint32 size,
                                                  void *buffer, GError **error);
@@ -105,8 +107,22 @@ struct _ArvDeviceClass {
 	void		(*device_event)		(ArvDevice *device);
 #endif
 
+	void		(*read_memory_async)	(ArvDevice *device, guint64 address, guint32 size, void *buffer,
+						 GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+	void		(*write_memory_async)	(ArvDevice *device, guint64 address, guint32 size, const void *buffer,
+						 GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+	void		(*read_register_async)	(ArvDevice *device, guint64 address,
+						 GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+	void		(*write_register_async)	(ArvDevice *device, guint64 address, guint32 value,
+						 GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+	gboolean	(*read_registers)	(ArvDevice *device, const guint64 *addresses, guint32 *values,
+						 guint n_registers, GError **error);
+	gboolean	(*write_registers)	(ArvDevice *device, const guint64 *addresses, const guint32 *values,
+						 guint n_registers, GError **error);
+	void		(*feature_changed)	(ArvDevice *device, const char *feature);
+
         /* Padding for future expansion */
-        gpointer padding[10];
+        gpointer padding[3];
 };
 
 ARV_API ArvStream *	arv_device_create_stream        	(ArvDevice *device,
@@ -122,6 +138,28 @@ ARV_API GByteArray *    arv_device_read_bytes                   (ArvDevice *devi
 ARV_API gboolean	arv_device_write_bytes			(ArvDevice *device, guint64 address, GByteArray *bytes, GError **error);
 ARV_API gboolean	arv_device_read_register		(ArvDevice *device, guint64 address, guint32 *value, GError **error);
 ARV_API gboolean	arv_device_write_register		(ArvDevice *device, guint64 address, guint32 value, GError **error);
+ARV_API gboolean	arv_device_read_registers		(ArvDevice *device, const guint64 *addresses, guint32 *values,
+								 guint n_registers, GError **error);
+ARV_API gboolean	arv_device_write_registers		(ArvDevice *device, const guint64 *addresses,
+								 const guint32 *values, guint n_registers, GError **error);
+
+ARV_API void		arv_device_read_memory_async		(ArvDevice *device, guint64 address, guint32 size, void *buffer,
+								 GCancellable *cancellable,
+								 GAsyncReadyCallback callback, gpointer user_data);
+ARV_API gboolean	arv_device_read_memory_finish		(ArvDevice *device, GAsyncResult *result, GError **error);
+ARV_API void		arv_device_write_memory_async		(ArvDevice *device, guint64 address, guint32 size,
+								 const void *buffer, GCancellable *cancellable,
+								 GAsyncReadyCallback callback, gpointer user_data);
+ARV_API gboolean	arv_device_write_memory_finish		(ArvDevice *device, GAsyncResult *result, GError **error);
+ARV_API void		arv_device_read_register_async		(ArvDevice *device, guint64 address,
+								 GCancellable *cancellable,
+								 GAsyncReadyCallback callback, gpointer user_data);
+ARV_API gboolean	arv_device_read_register_finish		(ArvDevice *device, GAsyncResult *result, guint32 *value,
+								 GError **error);
+ARV_API void		arv_device_write_register_async		(ArvDevice *device, guint64 address, guint32 value,
+								 GCancellable *cancellable,
+								 GAsyncReadyCallback callback, gpointer user_data);
+ARV_API gboolean	arv_device_write_register_finish	(ArvDevice *device, GAsyncResult *result, GError **error);
 #if ARAVIS_HAS_EVENT
 ARV_API gboolean	arv_device_read_event_data		(ArvDevice *device, int event_id,
                                                                  guint64 address, guint32 size, void *buffer,
@@ -179,6 +217,16 @@ ARV_API gboolean	arv_device_is_enumeration_entry_available				(ArvDevice *device
 ARV_API gboolean	arv_device_set_features_from_string	(ArvDevice *device, const char *string, GError **error);
 
 ARV_API void		arv_device_set_register_cache_policy	(ArvDevice *device, ArvRegisterCachePolicy policy);
+ARV_API gboolean	arv_device_prefetch_features		(ArvDevice *device, const char **features, GError **error);
+
+ARV_API gboolean	arv_device_begin_transaction		(ArvDevice *device, GError **error);
+ARV_API gboolean	arv_device_commit_transaction		(ArvDevice *device, GError **error);
+ARV_API void		arv_device_abort_transaction		(ArvDevice *device);
+
+ARV_API gboolean	arv_device_add_polled_feature		(ArvDevice *device, const char *feature, guint period_ms,
+								 GError **error);
+ARV_API gboolean	arv_device_start_polling		(ArvDevice *device, GError **error);
+ARV_API void		arv_device_stop_polling			(ArvDevice *device);
 ARV_API void		arv_device_set_range_check_policy	(ArvDevice *device, ArvRangeCheckPolicy policy);
 ARV_API void            arv_device_set_access_check_policy      (ArvDevice *device, ArvAccessCheckPolicy policy);
 
@@ -120,6 +120,41 @@ arv_dom_document_create_text_node (ArvDomDocument *self, const char *data)
 	return ARV_DOM_DOCUMENT_GET_CLASS (self)->create_text_node (self, data);
 }
 
+static void
+arv_dom_document_append_text_base (ArvDomDocument *document, ArvDomNode *parent, const char *data, gsize length)
+{
+	ArvDomText *text_node;
+	char *text;
+
+	text = g_strndup (data, length);
+	text_node = arv_dom_document_create_text_node (document, text);
+	g_free (text);
+
+	arv_dom_node_append_child (parent, ARV_DOM_NODE (text_node));
+}
+
+/**
+ * arv_dom_document_append_text:
+ * @self: a #ArvDomDocument
+ * @parent: the node receiving the text
+ * @data: (array length=length): text data
+ * @length: size of @data
+ *
+ * Appends a chunk of character data to the content of @parent. The default implementation appends a new text node
+ * to the children of @parent, but documents may store the text in a more compact way.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_dom_document_append_text (ArvDomDocument *self, ArvDomNode *parent, const char *data, gsize length)
+{
+	g_return_if_fail (ARV_IS_DOM_DOCUMENT (self));
+	g_return_if_fail (ARV_IS_DOM_NODE (parent));
+
+	ARV_DOM_DOCUMENT_GET_CLASS (self)->append_text (self, parent, data, length);
+}
+
 const char *
 arv_dom_document_get_url (ArvDomDocument *self)
 {
@@ -237,4 +272,5 @@ arv_dom_document_class_init (ArvDomDocumentClass *klass)
 	node_class->get_node_type = arv_dom_document_get_node_type;
 
 	klass->create_text_node = arv_dom_document_create_text_node_base;
+	klass->append_text = arv_dom_document_append_text_base;
 }
@@ -43,14 +43,18 @@ struct _ArvDomDocumentClass {
 	ArvDomElement *	(*get_document_element) (ArvDomDocument* self);
 	ArvDomElement *	(*create_element) 	(ArvDomDocument* self, const char *tag_name);
 	ArvDomText * 	(*create_text_node) 	(ArvDomDocument* self, const char *data);
+	void		(*append_text)		(ArvDomDocument* self, ArvDomNode *parent, const char *data,
+						 gsize length);
 
         /* Padding for future expansion */
-        gpointer padding[10];
+        gpointer padding[9];
 };
 
 ARV_API ArvDomElement*		arv_dom_document_get_document_element	(ArvDomDocument *self);
 ARV_API ArvDomElement*		arv_dom_document_create_element		(ArvDomDocument *self, const char *tag_name);
 ARV_API ArvDomText*		arv_dom_document_create_text_node	(ArvDomDocument *self, const char *data);
+ARV_API void			arv_dom_document_append_text		(ArvDomDocument *self, ArvDomNode *parent,
+									 const char *data, gsize length);
 
 ARV_API const char *		arv_dom_document_get_url		(ArvDomDocument *self);
 ARV_API void			arv_dom_document_set_url		(ArvDomDocument *self, const char *url);
@@ -143,17 +143,9 @@ arv_dom_parser_characters (void *user_data, const xmlChar *ch, int len)
 {
 	ArvDomSaxParserState *state = user_data;
 
-	if (!state->is_error) {
-		ArvDomNode *node;
-		char *text;
-
-		text = g_strndup ((char *) ch, len);
-		node = ARV_DOM_NODE (arv_dom_document_create_text_node (ARV_DOM_DOCUMENT (state->document), text));
-
-		arv_dom_node_append_child (state->current_node, node);
-
-		g_free (text);
-	}
+	if (!state->is_error)
+		arv_dom_document_append_text (ARV_DOM_DOCUMENT (state->document), state->current_node,
+					      (const char *) ch, len);
 }
 
 static void arv_dom_parser_warning (void *user_data, const char *msg, ...) G_GNUC_PRINTF(2,3);
@@ -222,14 +214,29 @@ typedef enum {
 	ARV_DOM_DOCUMENT_ERROR_INVALID_XML
 } ArvDomDocumentError;
 
+/* libxml2 must be initialized from a single thread before being used concurrently */
+
+static void
+_init_parser (void)
+{
+	static gsize is_initialized = 0;
+
+	if (g_once_init_enter (&is_initialized)) {
+		xmlInitParser ();
+		g_once_init_leave (&is_initialized, 1);
+	}
+}
+
 #if LIBXML_VERSION >= 21100
 static ArvDomDocument *
 _parse_memory (ArvDomDocument *document, ArvDomNode *node,
 	       const void *buffer, int size, GError **error)
 {
-	static ArvDomSaxParserState state;
+	ArvDomSaxParserState state = {0};
         xmlParserCtxt *xml_parser_ctxt;
 
+	_init_parser ();
+
 	state.document = document;
 	if (node != NULL)
 		state.current_node = node;
@@ -272,7 +279,9 @@ static ArvDomDocument *
 _parse_memory (ArvDomDocument *document, ArvDomNode *node,
 	       const void *buffer, int size, GError **error)
 {
-	static ArvDomSaxParserState state;
+	ArvDomSaxParserState state = {0};
+
+	_init_parser ();
 
 	state.document = document;
 	if (node != NULL)
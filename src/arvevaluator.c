@@ -25,7 +25,7 @@
  * @short_description: A math expression evaluator with Genicam syntax
  */
 
-#include <arvevaluator.h>
+#include <arvevaluatorprivate.h>
 #include <arvdebugprivate.h>
 #include <arvmiscprivate.h>
 #include <arvstr.h>
@@ -52,11 +52,28 @@ typedef enum {
 	ARV_EVALUATOR_STATUS_FORBIDDEN_RECUSRION
 } ArvEvaluatorStatus;
 
+typedef struct {
+	char *name;
+	gboolean is_set;
+	ArvValue value;
+} ArvEvaluatorVariable;
+
+/* Compiled expression, in reverse polish notation. Variables are referenced by their slot index in the variable
+ * array, and the operations on constant operands are precomputed. */
+
+typedef struct {
+	struct _ArvEvaluatorInstruction *instructions;
+	guint n_instructions;
+} ArvEvaluatorProgram;
+
 typedef struct {
 	char *expression;
 	GSList *rpn_stack;
 	ArvEvaluatorStatus parsing_status;
-	GHashTable *variables;
+	ArvEvaluatorProgram int64_program;
+	ArvEvaluatorProgram double_program;
+	GArray *variables;		/* ArvEvaluatorVariable array, indexed by slot */
+	GHashTable *variable_slots;	/* name -> slot + 1 */
 	GHashTable *sub_expressions;
 	GHashTable *constants;
 } ArvEvaluatorPrivate;
@@ -216,6 +233,16 @@ typedef struct {
 	} data;
 } ArvEvaluatorToken;
 
+typedef struct _ArvEvaluatorInstruction {
+	ArvEvaluatorTokenId	token_id;
+	gint32 parenthesis_level;
+	union {
+		double		v_double;
+		gint64		v_int64;
+		guint		slot;
+	} data;
+} ArvEvaluatorInstruction;
+
 typedef struct {
 	gint32 parenthesis_level;
 	ArvValue value;
@@ -269,35 +296,33 @@ arv_evaluator_token_free (ArvEvaluatorToken *token)
 }
 
 static void
-arv_evaluator_token_debug (ArvEvaluatorToken *token, GHashTable *variables)
+arv_evaluator_instruction_debug (ArvEvaluatorInstruction *instruction, ArvEvaluatorVariable *variables)
 {
-	ArvValue *value;
-
-	g_return_if_fail (token != NULL);
+	ArvEvaluatorVariable *variable;
 
-	switch (token->token_id) {
+	switch (instruction->token_id) {
 		case ARV_EVALUATOR_TOKEN_VARIABLE:
-			value = g_hash_table_lookup (variables, token->data.name);
-                        if (value != NULL && arv_value_holds_double (value))
+			variable = &variables[instruction->data.slot];
+                        if (variable->is_set && arv_value_holds_double (&variable->value))
                                 arv_debug_evaluator ("(var) %s = %g (double)",
-                                                     token->data.name,
-                                                     arv_value_get_double (value));
-                        else if (value != NULL && arv_value_holds_int64 (value))
+                                                     variable->name,
+                                                     arv_value_get_double (&variable->value));
+                        else if (variable->is_set && arv_value_holds_int64 (&variable->value))
                                 arv_debug_evaluator ("(var) %s = 0x%016" G_GINT64_MODIFIER "x %" G_GINT64_FORMAT" (int64)",
-                                                     token->data.name,
-                                                     arv_value_get_int64 (value),
-                                                     arv_value_get_int64 (value));
+                                                     variable->name,
+                                                     arv_value_get_int64 (&variable->value),
+                                                     arv_value_get_int64 (&variable->value));
                         else
-                                arv_debug_evaluator ("(var) %s not found", token->data.name);
+                                arv_debug_evaluator ("(var) %s not found", variable->name);
                         break;
                 case ARV_EVALUATOR_TOKEN_CONSTANT_INT64:
-                        arv_debug_evaluator ("(int64) %" G_GINT64_FORMAT, token->data.v_int64);
+                        arv_debug_evaluator ("(int64) %" G_GINT64_FORMAT, instruction->data.v_int64);
                         break;
                 case ARV_EVALUATOR_TOKEN_CONSTANT_DOUBLE:
-                        arv_debug_evaluator ("(double) %g", token->data.v_double);
+                        arv_debug_evaluator ("(double) %g", instruction->data.v_double);
                         break;
                 default:
-                        arv_debug_evaluator ("(operator) %s", arv_evaluator_token_infos[token->token_id].tag);
+                        arv_debug_evaluator ("(operator) %s", arv_evaluator_token_infos[instruction->token_id].tag);
         }
 }
 
@@ -553,25 +578,27 @@ get_arguments_count(ArvEvaluatorValuesStackItem * stack, int current_index)
 	return arguments_count;
 }
 
+/* Runs @n_instructions instructions of a compiled program, and returns the remaining item of the value stack in
+ * @result. @variables may be %NULL for programs without variable operand. */
+
 static ArvEvaluatorStatus
-evaluate (GSList *token_stack, GHashTable *variables, gint64 *v_int64, double *v_double)
+evaluate (ArvEvaluatorInstruction *instructions, guint n_instructions, ArvEvaluatorVariable *variables,
+	  gboolean integer_mode, ArvEvaluatorValuesStackItem *result)
 {
-	ArvEvaluatorToken *token;
+	ArvEvaluatorInstruction *token;
+	ArvEvaluatorVariable *variable;
 	ArvEvaluatorStatus status;
-	GSList *iter;
 	ArvEvaluatorValuesStackItem stack[ARV_EVALUATOR_STACK_SIZE];
-	ArvValue *value;
+	gboolean debug;
 	int index = -1;
-	gboolean integer_mode;
-
-	g_assert (v_int64 != NULL || v_double != NULL);
+	guint i;
 
-	integer_mode = v_int64 != NULL;
+	debug = arv_debug_check (ARV_DEBUG_CATEGORY_EVALUATOR, ARV_DEBUG_LEVEL_DEBUG);
 
-	for (iter = token_stack; iter != NULL; iter = iter->next) {
+	for (i = 0; i < n_instructions; i++) {
 		int actual_arguments_count;
 
-		token = iter->data;
+		token = &instructions[i];
 
 		if (index < (arv_evaluator_token_infos[token->token_id].n_args - 1)) {
 			status = ARV_EVALUATOR_STATUS_MISSING_ARGUMENTS;
@@ -588,7 +615,8 @@ evaluate (GSList *token_stack, GHashTable *variables, gint64 *v_int64, double *v
 			goto CLEANUP;
 		}
 
-		arv_evaluator_token_debug (token, variables);
+		if (debug)
+			arv_evaluator_instruction_debug (token, variables);
 
 		actual_arguments_count = arv_evaluator_token_infos[token->token_id].n_args;
 
@@ -936,9 +964,9 @@ evaluate (GSList *token_stack, GHashTable *variables, gint64 *v_int64, double *v
 				stack[index+1].parenthesis_level = token->parenthesis_level;
 				break;
 			case ARV_EVALUATOR_TOKEN_VARIABLE:
-				value = g_hash_table_lookup (variables, token->data.name);
-				if (value != NULL) {
-					arv_value_copy (&stack[index+1].value, value);
+				variable = variables != NULL ? &variables[token->data.slot] : NULL;
+				if (variable != NULL && variable->is_set) {
+					arv_value_copy (&stack[index+1].value, &variable->value);
 					stack[index+1].parenthesis_level = token->parenthesis_level;
 				} else {
 					status = ARV_EVALUATOR_STATUS_UNKNOWN_VARIABLE;
@@ -969,24 +997,12 @@ evaluate (GSList *token_stack, GHashTable *variables, gint64 *v_int64, double *v
 		goto CLEANUP;
 	}
 
-	if (v_double != NULL)
-		*v_double = arv_value_get_double (&stack[0].value);
-
-	if (v_int64 != NULL)
-		*v_int64 = arv_value_get_int64 (&stack[0].value);
-
-	if (arv_value_holds_int64 (&stack[0].value))
-		arv_debug_evaluator ("[Evaluator::evaluate] Result = (int64) %" G_GINT64_FORMAT, arv_value_get_int64 (&stack[0].value));
-	else
-		arv_debug_evaluator ("[Evaluator::evaluate] Result = (double) %g", arv_value_get_double (&stack[0].value));
+	*result = stack[0];
 
 	return ARV_EVALUATOR_STATUS_SUCCESS;
 CLEANUP:
-	if (v_double != NULL)
-		*v_double = 0.0;
-
-	if (v_int64 != NULL)
-		*v_int64 = 0.0;
+	arv_value_set_int64 (&result->value, 0);
+	result->parenthesis_level = 0;
 
 	return status;
 }
@@ -1141,6 +1157,139 @@ free_rpn_stack (ArvEvaluator *evaluator)
 	evaluator->priv->rpn_stack = NULL;
 }
 
+static void
+free_programs (ArvEvaluator *evaluator)
+{
+	g_clear_pointer (&evaluator->priv->int64_program.instructions, g_free);
+	evaluator->priv->int64_program.n_instructions = 0;
+	g_clear_pointer (&evaluator->priv->double_program.instructions, g_free);
+	evaluator->priv->double_program.n_instructions = 0;
+}
+
+static guint
+_get_variable_slot (ArvEvaluator *evaluator, const char *name)
+{
+	ArvEvaluatorVariable variable;
+	gpointer slot;
+
+	slot = g_hash_table_lookup (evaluator->priv->variable_slots, name);
+	if (slot != NULL)
+		return GPOINTER_TO_UINT (slot) - 1;
+
+	variable.name = g_strdup (name);
+	variable.is_set = FALSE;
+	arv_value_set_int64 (&variable.value, 0);
+
+	g_array_append_val (evaluator->priv->variables, variable);
+	g_hash_table_insert (evaluator->priv->variable_slots, variable.name,
+			     GUINT_TO_POINTER (evaluator->priv->variables->len));
+
+	return evaluator->priv->variables->len - 1;
+}
+
+typedef struct {
+	guint start;
+	gboolean is_constant;
+} ArvEvaluatorCompilerStackItem;
+
+/* Converts the token list into an instruction array, and replaces the operations on constant operands by their
+ * result. Integer and floating point evaluations give different results for the same operations, hence a program
+ * for each mode. Operations that fail are left in the program, for the error to be reported at evaluation time. */
+
+static void
+compile_program (ArvEvaluator *evaluator, gboolean integer_mode, ArvEvaluatorProgram *program)
+{
+	ArvEvaluatorCompilerStackItem stack[ARV_EVALUATOR_STACK_SIZE];
+	ArvEvaluatorInstruction *instructions;
+	GSList *iter;
+	guint n_instructions = 0;
+	guint n_folded = 0;
+	gboolean can_fold = TRUE;
+	int index = -1;
+
+	instructions = g_new0 (ArvEvaluatorInstruction, g_slist_length (evaluator->priv->rpn_stack));
+
+	for (iter = evaluator->priv->rpn_stack; iter != NULL; iter = iter->next) {
+		ArvEvaluatorToken *token = iter->data;
+		ArvEvaluatorInstruction *instruction = &instructions[n_instructions];
+		ArvEvaluatorValuesStackItem result;
+		gboolean is_constant;
+		guint start;
+		int n_args;
+		int i;
+
+		instruction->token_id = token->token_id;
+		instruction->parenthesis_level = token->parenthesis_level;
+		if (token->token_id == ARV_EVALUATOR_TOKEN_VARIABLE)
+			instruction->data.slot = _get_variable_slot (evaluator, token->data.name);
+		else if (token->token_id == ARV_EVALUATOR_TOKEN_CONSTANT_INT64)
+			instruction->data.v_int64 = token->data.v_int64;
+		else if (token->token_id == ARV_EVALUATOR_TOKEN_CONSTANT_DOUBLE)
+			instruction->data.v_double = token->data.v_double;
+		n_instructions++;
+
+		if (!can_fold)
+			continue;
+
+		if (arv_evaluator_token_is_operand (token)) {
+			if (index >= ARV_EVALUATOR_STACK_SIZE - 1) {
+				can_fold = FALSE;
+				continue;
+			}
+			index++;
+			stack[index].start = n_instructions - 1;
+			stack[index].is_constant = token->token_id != ARV_EVALUATOR_TOKEN_VARIABLE;
+			continue;
+		}
+
+		n_args = arv_evaluator_token_infos[token->token_id].n_args;
+		if (index < n_args - 1) {
+			/* Missing arguments, reported at evaluation time */
+			can_fold = FALSE;
+			continue;
+		}
+
+		if (token->token_id == ARV_EVALUATOR_TOKEN_FUNCTION_ROUND) {
+			/* The argument count of ROUND is only known at evaluation time */
+			for (i = 0; i <= index; i++)
+				stack[i].is_constant = FALSE;
+			continue;
+		}
+
+		is_constant = TRUE;
+		for (i = 0; i < n_args; i++)
+			is_constant = is_constant && stack[index - i].is_constant;
+		start = stack[index - n_args + 1].start;
+
+		index = index - n_args + 1;
+		stack[index].start = start;
+		stack[index].is_constant = FALSE;
+
+		if (is_constant &&
+		    evaluate (&instructions[start], n_instructions - start, NULL,
+			      integer_mode, &result) == ARV_EVALUATOR_STATUS_SUCCESS) {
+			instruction = &instructions[start];
+			instruction->parenthesis_level = result.parenthesis_level;
+			if (arv_value_holds_int64 (&result.value)) {
+				instruction->token_id = ARV_EVALUATOR_TOKEN_CONSTANT_INT64;
+				instruction->data.v_int64 = arv_value_get_int64 (&result.value);
+			} else {
+				instruction->token_id = ARV_EVALUATOR_TOKEN_CONSTANT_DOUBLE;
+				instruction->data.v_double = arv_value_get_double (&result.value);
+			}
+			n_folded += n_instructions - start - 1;
+			n_instructions = start + 1;
+			stack[index].is_constant = TRUE;
+		}
+	}
+
+	program->instructions = instructions;
+	program->n_instructions = n_instructions;
+
+	arv_debug_evaluator ("[Evaluator::compile_program] %u instructions (%s), %u folded",
+			     n_instructions, integer_mode ? "int64" : "double", n_folded);
+}
+
 static ArvEvaluatorStatus
 parse_expression (ArvEvaluator *evaluator)
 {
@@ -1158,6 +1307,7 @@ parse_expression (ArvEvaluator *evaluator)
 	state.in_sub_expression = FALSE;
 
 	free_rpn_stack (evaluator);
+	free_programs (evaluator);
 
 	arv_debug_evaluator ("[Evaluator::parse_expression] %s", evaluator->priv->expression);
 
@@ -1186,7 +1336,15 @@ parse_expression (ArvEvaluator *evaluator)
 	arv_debug_evaluator ("[Evaluator::parse_expression] %d items in garbage list", count);
 	arv_debug_evaluator ("[Evaluator::parse_expression] %d items in token list", g_slist_length (evaluator->priv->rpn_stack));
 
-	return evaluator->priv->rpn_stack == NULL ? ARV_EVALUATOR_STATUS_EMPTY_EXPRESSION : ARV_EVALUATOR_STATUS_SUCCESS;
+	if (evaluator->priv->rpn_stack == NULL)
+		return ARV_EVALUATOR_STATUS_EMPTY_EXPRESSION;
+
+	compile_program (evaluator, TRUE, &evaluator->priv->int64_program);
+	compile_program (evaluator, FALSE, &evaluator->priv->double_program);
+
+	free_rpn_stack (evaluator);
+
+	return ARV_EVALUATOR_STATUS_SUCCESS;
 
 CLEANUP:
 	for (iter = state.garbage_stack; iter != NULL; iter = iter->next)
@@ -1217,11 +1375,22 @@ arv_evaluator_set_error (GError **error, ArvEvaluatorStatus status)
 								  G_N_ELEMENTS (arv_evaluator_status_strings)-1)]);
 }
 
+static void
+_debug_result (ArvEvaluatorValuesStackItem *result)
+{
+	if (arv_value_holds_int64 (&result->value))
+		arv_debug_evaluator ("[Evaluator::evaluate] Result = (int64) %" G_GINT64_FORMAT,
+				     arv_value_get_int64 (&result->value));
+	else
+		arv_debug_evaluator ("[Evaluator::evaluate] Result = (double) %g",
+				     arv_value_get_double (&result->value));
+}
+
 double
 arv_evaluator_evaluate_as_double (ArvEvaluator *evaluator, GError **error)
 {
+	ArvEvaluatorValuesStackItem result;
 	ArvEvaluatorStatus status;
-	double value;
 
 	g_return_val_if_fail (ARV_IS_EVALUATOR (evaluator), 0.0);
 
@@ -1239,21 +1408,26 @@ arv_evaluator_evaluate_as_double (ArvEvaluator *evaluator, GError **error)
 		return 0.0;
 	}
 
-	status = evaluate (evaluator->priv->rpn_stack, evaluator->priv->variables, NULL, &value);
+	status = evaluate (evaluator->priv->double_program.instructions,
+			   evaluator->priv->double_program.n_instructions,
+			   (ArvEvaluatorVariable *) evaluator->priv->variables->data,
+			   FALSE, &result);
 
 	if (status != ARV_EVALUATOR_STATUS_SUCCESS) {
 		arv_evaluator_set_error (error, status);
 		return 0.0;
 	}
 
-	return value;
+	_debug_result (&result);
+
+	return arv_value_get_double (&result.value);
 }
 
 gint64
 arv_evaluator_evaluate_as_int64 (ArvEvaluator *evaluator, GError **error)
 {
+	ArvEvaluatorValuesStackItem result;
 	ArvEvaluatorStatus status;
-	gint64 value;
 
 	g_return_val_if_fail (ARV_IS_EVALUATOR (evaluator), 0.0);
 
@@ -1271,7 +1445,10 @@ arv_evaluator_evaluate_as_int64 (ArvEvaluator *evaluator, GError **error)
 		return 0.0;
 	}
 
-	status = evaluate (evaluator->priv->rpn_stack, evaluator->priv->variables, &value, NULL);
+	status = evaluate (evaluator->priv->int64_program.instructions,
+			   evaluator->priv->int64_program.n_instructions,
+			   (ArvEvaluatorVariable *) evaluator->priv->variables->data,
+			   TRUE, &result);
 
 	if (status != ARV_EVALUATOR_STATUS_SUCCESS) {
 
@@ -1279,7 +1456,9 @@ arv_evaluator_evaluate_as_int64 (ArvEvaluator *evaluator, GError **error)
 		return 0.0;
 	}
 
-	return value;
+	_debug_result (&result);
+
+	return arv_value_get_int64 (&result.value);
 }
 
 void
@@ -1426,40 +1605,74 @@ arv_evaluator_get_constant (ArvEvaluator *evaluator, const char *name)
 void
 arv_evaluator_set_double_variable (ArvEvaluator *evaluator, const char *name, double v_double)
 {
-	ArvValue *old_value;
+	g_return_if_fail (ARV_IS_EVALUATOR (evaluator));
+	g_return_if_fail (name != NULL);
+
+	arv_evaluator_set_double_variable_by_slot (evaluator, _get_variable_slot (evaluator, name), v_double);
+}
 
+void
+arv_evaluator_set_int64_variable (ArvEvaluator *evaluator, const char *name, gint64 v_int64)
+{
 	g_return_if_fail (ARV_IS_EVALUATOR (evaluator));
 	g_return_if_fail (name != NULL);
 
-	old_value = g_hash_table_lookup (evaluator->priv->variables, name);
-	if (old_value != NULL && (arv_value_get_double (old_value) == v_double))
+	arv_evaluator_set_int64_variable_by_slot (evaluator, _get_variable_slot (evaluator, name), v_int64);
+}
+
+/*
+ * arv_evaluator_get_variable_slot:
+ * @evaluator: a #ArvEvaluator
+ * @name: variable name
+ *
+ * Returns: the index of the variable storage, which can be used for setting the variable value without a name
+ * lookup. It stays valid for the evaluator lifetime. %G_MAXUINT is returned on error.
+ */
+
+guint
+arv_evaluator_get_variable_slot (ArvEvaluator *evaluator, const char *name)
+{
+	g_return_val_if_fail (ARV_IS_EVALUATOR (evaluator), G_MAXUINT);
+	g_return_val_if_fail (name != NULL, G_MAXUINT);
+
+	return _get_variable_slot (evaluator, name);
+}
+
+void
+arv_evaluator_set_double_variable_by_slot (ArvEvaluator *evaluator, guint slot, double v_double)
+{
+	ArvEvaluatorVariable *variable;
+
+	g_return_if_fail (ARV_IS_EVALUATOR (evaluator));
+	g_return_if_fail (slot < evaluator->priv->variables->len);
+
+	variable = &g_array_index (evaluator->priv->variables, ArvEvaluatorVariable, slot);
+	if (variable->is_set && (arv_value_get_double (&variable->value) == v_double))
 		return;
 
-        g_hash_table_replace (evaluator->priv->variables,
-                              g_strdup (name),
-                              arv_value_new_double (v_double));
+	arv_value_set_double (&variable->value, v_double);
+	variable->is_set = TRUE;
 
 	arv_debug_evaluator ("[Evaluator::set_double_variable] %s = %g",
-			   name, v_double);
+			   variable->name, v_double);
 }
 
 void
-arv_evaluator_set_int64_variable (ArvEvaluator *evaluator, const char *name, gint64 v_int64)
+arv_evaluator_set_int64_variable_by_slot (ArvEvaluator *evaluator, guint slot, gint64 v_int64)
 {
-	ArvValue *old_value;
+	ArvEvaluatorVariable *variable;
 
 	g_return_if_fail (ARV_IS_EVALUATOR (evaluator));
-	g_return_if_fail (name != NULL);
+	g_return_if_fail (slot < evaluator->priv->variables->len);
 
-	old_value = g_hash_table_lookup (evaluator->priv->variables, name);
-	if (old_value != NULL && (arv_value_get_int64 (old_value) == v_int64))
+	variable = &g_array_index (evaluator->priv->variables, ArvEvaluatorVariable, slot);
+	if (variable->is_set && (arv_value_get_int64 (&variable->value) == v_int64))
 		return;
 
-        g_hash_table_replace (evaluator->priv->variables,
-                              g_strdup (name),
-                              arv_value_new_int64 (v_int64));
+	arv_value_set_int64 (&variable->value, v_int64);
+	variable->is_set = TRUE;
 
-	arv_debug_evaluator ("[Evaluator::set_int64_variable] %s = %" G_GINT64_FORMAT, name, v_int64);
+	arv_debug_evaluator ("[Evaluator::set_int64_variable] %s = %" G_GINT64_FORMAT, variable->name, v_int64);
 }
 
 /**
@@ -1490,7 +1703,8 @@ arv_evaluator_init (ArvEvaluator *evaluator)
 
 	evaluator->priv->expression = NULL;
 	evaluator->priv->rpn_stack = NULL;
-	evaluator->priv->variables = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) arv_value_free);
+	evaluator->priv->variables = g_array_new (FALSE, FALSE, sizeof (ArvEvaluatorVariable));
+	evaluator->priv->variable_slots = g_hash_table_new (g_str_hash, g_str_equal);
 	evaluator->priv->sub_expressions = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
 	evaluator->priv->constants = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
 
@@ -1502,12 +1716,17 @@ static void
 arv_evaluator_finalize (GObject *object)
 {
 	ArvEvaluator *evaluator = ARV_EVALUATOR (object);
+	guint i;
 
 	arv_evaluator_set_expression (evaluator, NULL);
-	g_hash_table_unref (evaluator->priv->variables);
+	g_hash_table_unref (evaluator->priv->variable_slots);
+	for (i = 0; i < evaluator->priv->variables->len; i++)
+		g_free (g_array_index (evaluator->priv->variables, ArvEvaluatorVariable, i).name);
+	g_array_unref (evaluator->priv->variables);
 	g_hash_table_unref (evaluator->priv->sub_expressions);
 	g_hash_table_unref (evaluator->priv->constants);
 	free_rpn_stack (evaluator);
+	free_programs (evaluator);
 
 	G_OBJECT_CLASS (arv_evaluator_parent_class)->finalize (object);
 }
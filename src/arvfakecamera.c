@@ -509,17 +509,24 @@ static struct {
    {128,     0,   0},
   };
 
+/* The 8 bit patterns only depend on (x + y + frame_id) % 255, which is incremented along the lines, and the
+ * scaled pixel values are precomputed in a lookup table. */
+
+#define ARV_FAKE_CAMERA_RAMP_PERIOD	255
+
 static void
 arv_fake_camera_diagonal_ramp (ArvBuffer *buffer, void *fill_pattern_data,
 			       guint32 exposure_time_us,
 			       guint32 gain,
 			       ArvPixelFormat pixel_format)
 {
+	unsigned char lut[ARV_FAKE_CAMERA_RAMP_PERIOD];
 	double pixel_value;
 	double scale;
 	guint32 x, y;
 	guint32 width;
 	guint32 height;
+	guint index;
 
         g_return_if_fail (buffer != NULL);
         g_return_if_fail (buffer->priv->n_parts == 1);
@@ -529,18 +536,23 @@ arv_fake_camera_diagonal_ramp (ArvBuffer *buffer, void *fill_pattern_data,
 
 	scale = 1.0 + gain + log10 ((double) exposure_time_us / 10000.0);
 
+	for (index = 0; index < ARV_FAKE_CAMERA_RAMP_PERIOD; index++) {
+		pixel_value = index * scale;
+		lut[index] = CLAMP (pixel_value, 0, 255);
+	}
+
 	switch (pixel_format)
 	{
 		case ARV_PIXEL_FORMAT_MONO_8:
 			if (height * width <= buffer->priv->allocated_size) {
 				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned char *pixel = &buffer->priv->data [y * width + x];
-
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
+					unsigned char *pixel = &buffer->priv->data [y * width];
 
-						*pixel = CLAMP (pixel_value, 0, 255);
+					index = (buffer->priv->frame_id + y) % ARV_FAKE_CAMERA_RAMP_PERIOD;
+					for (x = 0; x < width; x++) {
+						pixel[x] = lut[index];
+						if (++index == ARV_FAKE_CAMERA_RAMP_PERIOD)
+							index = 0;
 					}
 				}
                                 buffer->priv->received_size = height * width;
@@ -550,13 +562,16 @@ arv_fake_camera_diagonal_ramp (ArvBuffer *buffer, void *fill_pattern_data,
 		case ARV_PIXEL_FORMAT_MONO_16:
 			if (2 * height * width <= buffer->priv->allocated_size) {
 				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned short *pixel = (unsigned short *)&buffer->priv->data [2*y * width + 2*x];
-
-						pixel_value = (256*x + 256*buffer->priv->frame_id + 256*y) % 65535;
-						pixel_value *= scale;
+					unsigned short *pixel = (unsigned short *) &buffer->priv->data [2 * y * width];
+					guint32 value;
 
-						*pixel = CLAMP (pixel_value, 0, 65535);
+					value = (256 * (buffer->priv->frame_id + y)) % 65535;
+					for (x = 0; x < width; x++) {
+						pixel_value = value * scale;
+						pixel[x] = CLAMP (pixel_value, 0, 65535);
+						value += 256;
+						if (value >= 65535)
+							value -= 65535;
 					}
 				}
                                 buffer->priv->received_size = 2 * height * width;
@@ -564,123 +579,42 @@ arv_fake_camera_diagonal_ramp (ArvBuffer *buffer, void *fill_pattern_data,
 			break;
 
 		case ARV_PIXEL_FORMAT_BAYER_BG_8:
-			if (height * width <= buffer->priv->allocated_size) {
-				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned int index;
-						unsigned char *pixel;
-
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
-						index = CLAMP (pixel_value, 0, 255);
-
-						// BG
-						// GR
-						pixel = &buffer->priv->data [y * width + x];
-						if (x & 1) {
-							if (y & 1)
-								*pixel = jet_colormap [index].b;
-							else
-								*pixel = jet_colormap [index].g;
-						} else {
-							if (y & 1)
-								*pixel = jet_colormap [index].g;
-							else
-								*pixel = jet_colormap [index].r;
-						}
-					}
-				}
-                                buffer->priv->received_size = height * width;
-			}
-			break;
-
 		case ARV_PIXEL_FORMAT_BAYER_GB_8:
+		case ARV_PIXEL_FORMAT_BAYER_GR_8:
+		case ARV_PIXEL_FORMAT_BAYER_RG_8:
 			if (height * width <= buffer->priv->allocated_size) {
-				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned int index;
-						unsigned char *pixel;
-
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
-						index = CLAMP (pixel_value, 0, 255);
-
-						// GB
-						// RG
-						pixel = &buffer->priv->data [y * width + x];
-						if (x & 1) {
-							if (y & 1)
-								*pixel = jet_colormap [index].g;
-							else
-								*pixel = jet_colormap [index].b;
-						} else {
-							if (y & 1)
-								*pixel = jet_colormap [index].r;
-							else
-								*pixel = jet_colormap [index].g;
-						}
-					}
+				/* Colormap component of the 2x2 bayer cell, indexed by (y & 1) * 2 + (x & 1),
+				 * 0 is red, 1 is green and 2 is blue. The per component lookup tables avoid
+				 * addressing the colormap entries as arrays. */
+				static const guint8 bg_cell[4] = {0, 1, 1, 2};
+				static const guint8 gb_cell[4] = {1, 2, 0, 1};
+				static const guint8 gr_cell[4] = {1, 0, 2, 1};
+				static const guint8 rg_cell[4] = {2, 1, 1, 0};
+				guint8 color_lut[3][ARV_FAKE_CAMERA_RAMP_PERIOD];
+				const guint8 *cell;
+
+				for (index = 0; index < ARV_FAKE_CAMERA_RAMP_PERIOD; index++) {
+					color_lut[0][index] = jet_colormap [lut[index]].r;
+					color_lut[1][index] = jet_colormap [lut[index]].g;
+					color_lut[2][index] = jet_colormap [lut[index]].b;
 				}
-                                buffer->priv->received_size = height * width;
-			}
-			break;
 
-		case ARV_PIXEL_FORMAT_BAYER_GR_8:
-			if (height * width <= buffer->priv->allocated_size) {
-				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned int index;
-						unsigned char *pixel;
-
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
-						index = CLAMP (pixel_value, 0, 255);
-
-						// GR
-						// BG
-						pixel = &buffer->priv->data [y * width + x];
-						if (x & 1) {
-							if (y & 1)
-								*pixel = jet_colormap [index].g;
-							else
-								*pixel = jet_colormap [index].r;
-						} else {
-							if (y & 1)
-								*pixel = jet_colormap [index].b;
-							else
-								*pixel = jet_colormap [index].g;
-						}
-					}
+				switch (pixel_format) {
+					case ARV_PIXEL_FORMAT_BAYER_BG_8: cell = bg_cell; break;
+					case ARV_PIXEL_FORMAT_BAYER_GB_8: cell = gb_cell; break;
+					case ARV_PIXEL_FORMAT_BAYER_GR_8: cell = gr_cell; break;
+					default: cell = rg_cell; break;
 				}
-                                buffer->priv->received_size = height * width;
-			}
-			break;
 
-		case ARV_PIXEL_FORMAT_BAYER_RG_8:
-			if (height * width <= buffer->priv->allocated_size) {
 				for (y = 0; y < height; y++) {
+					unsigned char *pixel = &buffer->priv->data [y * width];
+					const guint8 *line_cell = &cell[(y & 1) * 2];
+
+					index = (buffer->priv->frame_id + y) % ARV_FAKE_CAMERA_RAMP_PERIOD;
 					for (x = 0; x < width; x++) {
-						unsigned int index;
-						unsigned char *pixel;
-
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
-						index = CLAMP (pixel_value, 0, 255);
-
-						// RG
-						// GB
-						pixel = &buffer->priv->data [y * width + x];
-						if (x & 1) {
-							if (y & 1)
-								*pixel = jet_colormap [index].r;
-							else
-								*pixel = jet_colormap [index].g;
-						} else {
-							if (y & 1)
-								*pixel = jet_colormap [index].g;
-							else
-								*pixel = jet_colormap [index].b;
-						}
+						pixel[x] = color_lut[line_cell[x & 1]][index];
+						if (++index == ARV_FAKE_CAMERA_RAMP_PERIOD)
+							index = 0;
 					}
 				}
                                 buffer->priv->received_size = height * width;
@@ -690,18 +624,15 @@ arv_fake_camera_diagonal_ramp (ArvBuffer *buffer, void *fill_pattern_data,
 		case ARV_PIXEL_FORMAT_RGB_8_PACKED:
 			if (3 * height * width <= buffer->priv->allocated_size) {
 				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned char *pixel = &buffer->priv->data [3 * (y * width + x)];
-						unsigned int index;
+					unsigned char *pixel = &buffer->priv->data [3 * y * width];
 
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
-
-						index = CLAMP (pixel_value, 0, 255);
-
-						pixel[0] = jet_colormap [index].r;
-						pixel[1] = jet_colormap [index].g;
-						pixel[2] = jet_colormap [index].b;
+					index = (buffer->priv->frame_id + y) % ARV_FAKE_CAMERA_RAMP_PERIOD;
+					for (x = 0; x < width; x++) {
+						pixel[3 * x] = jet_colormap [lut[index]].r;
+						pixel[3 * x + 1] = jet_colormap [lut[index]].g;
+						pixel[3 * x + 2] = jet_colormap [lut[index]].b;
+						if (++index == ARV_FAKE_CAMERA_RAMP_PERIOD)
+							index = 0;
 					}
 				}
                                 buffer->priv->received_size = 3 * height * width;
@@ -751,17 +682,8 @@ arv_fake_camera_set_fill_pattern (ArvFakeCamera *camera,
 	g_mutex_unlock (&camera->priv->fill_pattern_mutex);
 }
 
-/**
- * arv_fake_camera_fill_buffer:
- * @camera: a #ArvFakeCamera
- * @buffer: the #ArvBuffer to fill
- * @packet_size: (out) (optional): the packet size
- *
- * Fill a buffer with data from the fake camera.
- */
-
-void
-arv_fake_camera_fill_buffer (ArvFakeCamera *camera, ArvBuffer *buffer, guint32 *packet_size)
+static void
+_fill_buffer (ArvFakeCamera *camera, ArvBuffer *buffer, guint32 *packet_size, gboolean fill_image)
 {
 	guint32 width;
 	guint32 height;
@@ -807,15 +729,17 @@ arv_fake_camera_fill_buffer (ArvFakeCamera *camera, ArvBuffer *buffer, guint32 *
         buffer->priv->parts[0].x_padding = 0;
         buffer->priv->parts[0].y_padding = 0;
 
-	g_mutex_lock (&camera->priv->fill_pattern_mutex);
+	if (fill_image) {
+		g_mutex_lock (&camera->priv->fill_pattern_mutex);
 
-	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_EXPOSURE_TIME_US, &exposure_time_us);
-	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_GAIN_RAW, &gain);
-	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_PIXEL_FORMAT, &pixel_format);
-	camera->priv->fill_pattern_callback (buffer, camera->priv->fill_pattern_data,
-					     exposure_time_us, gain, pixel_format);
+		arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_EXPOSURE_TIME_US, &exposure_time_us);
+		arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_GAIN_RAW, &gain);
+		arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_PIXEL_FORMAT, &pixel_format);
+		camera->priv->fill_pattern_callback (buffer, camera->priv->fill_pattern_data,
+						     exposure_time_us, gain, pixel_format);
 
-	g_mutex_unlock (&camera->priv->fill_pattern_mutex);
+		g_mutex_unlock (&camera->priv->fill_pattern_mutex);
+	}
 
         buffer->priv->parts[0].size = buffer->priv->received_size;
 
@@ -826,6 +750,40 @@ arv_fake_camera_fill_buffer (ArvFakeCamera *camera, ArvBuffer *buffer, guint32 *
 			ARV_GVBS_STREAM_CHANNEL_0_PACKET_SIZE_MASK;
 }
 
+/**
+ * arv_fake_camera_fill_buffer:
+ * @camera: a #ArvFakeCamera
+ * @buffer: the #ArvBuffer to fill
+ * @packet_size: (out) (optional): the packet size
+ *
+ * Fill a buffer with data from the fake camera.
+ */
+
+void
+arv_fake_camera_fill_buffer (ArvFakeCamera *camera, ArvBuffer *buffer, guint32 *packet_size)
+{
+	_fill_buffer (camera, buffer, packet_size, TRUE);
+}
+
+/**
+ * arv_fake_camera_fill_buffer_infos:
+ * @camera: a #ArvFakeCamera
+ * @buffer: the #ArvBuffer to update
+ * @packet_size: (out) (optional): the packet size
+ *
+ * Update the frame id, the timestamp and the image informations of a buffer previously filled by
+ * arv_fake_camera_fill_buffer(), without generating the image data again. This allows to reuse a set of
+ * pre-generated frames when the image content does not matter.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_fake_camera_fill_buffer_infos (ArvFakeCamera *camera, ArvBuffer *buffer, guint32 *packet_size)
+{
+	_fill_buffer (camera, buffer, packet_size, FALSE);
+}
+
 void
 arv_fake_camera_set_inet_address (ArvFakeCamera *camera, GInetAddress *address)
 {
@@ -886,6 +844,25 @@ arv_fake_camera_set_trigger_frequency (ArvFakeCamera *camera, double frequency)
 	camera->priv->trigger_frequency = frequency;
 }
 
+/**
+ * arv_fake_camera_set_frame_id:
+ * @camera: a #ArvFakeCamera
+ * @frame_id: a frame id
+ *
+ * Sets the id of the last generated frame. The next frame will use the following valid id. This is useful for
+ * testing the frame id counter wrap.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_fake_camera_set_frame_id (ArvFakeCamera *camera, guint16 frame_id)
+{
+	g_return_if_fail (ARV_IS_FAKE_CAMERA (camera));
+
+	camera->priv->frame_id = frame_id;
+}
+
 gboolean
 arv_fake_camera_check_and_acknowledge_software_trigger (ArvFakeCamera *camera)
 {
@@ -1083,6 +1060,8 @@ arv_fake_camera_new_full (const char *serial_number, const char *genicam_filenam
 	arv_fake_camera_write_register (fake_camera, ARV_GVBS_TIMESTAMP_TICK_FREQUENCY_HIGH_OFFSET, 0);
 	arv_fake_camera_write_register (fake_camera, ARV_GVBS_TIMESTAMP_TICK_FREQUENCY_LOW_OFFSET, 1000000000);
 	arv_fake_camera_write_register (fake_camera, ARV_GVBS_CONTROL_CHANNEL_PRIVILEGE_OFFSET, 0);
+	arv_fake_camera_write_register (fake_camera, ARV_GVBS_GVCP_CAPABILITY_OFFSET,
+					ARV_GVBS_GVCP_CAPABILITY_CONCATENATION);
 
 	arv_fake_camera_write_register (fake_camera, ARV_GVBS_STREAM_CHANNEL_0_PACKET_SIZE_OFFSET, 1400);
 
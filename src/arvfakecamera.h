@@ -106,6 +106,8 @@ ARV_API void			arv_fake_camera_wait_for_next_frame		(ArvFakeCamera *camera);
 ARV_API guint64			arv_fake_camera_get_sleep_time_for_next_frame	(ArvFakeCamera *camera, guint64 *next_timestamp_us);
 ARV_API void			arv_fake_camera_fill_buffer			(ArvFakeCamera *camera, ArvBuffer *buffer,
 										 guint32 *packet_size);
+ARV_API void			arv_fake_camera_fill_buffer_infos		(ArvFakeCamera *camera, ArvBuffer *buffer,
+										 guint32 *packet_size);
 
 ARV_API guint32 		arv_fake_camera_get_acquisition_status	(ArvFakeCamera *camera);
 ARV_API GSocketAddress *	arv_fake_camera_get_stream_address	(ArvFakeCamera *camera);
@@ -120,6 +122,7 @@ ARV_API void			arv_fake_camera_set_fill_pattern	(ArvFakeCamera *camera,
 									 void *fill_pattern_data,
                                                                          GDestroyNotify destroy);
 ARV_API void			arv_fake_camera_set_trigger_frequency	(ArvFakeCamera *camera, double frequency);
+ARV_API void			arv_fake_camera_set_frame_id		(ArvFakeCamera *camera, guint16 frame_id);
 ARV_API gboolean		arv_fake_camera_is_in_free_running_mode (ArvFakeCamera *camera);
 ARV_API gboolean		arv_fake_camera_is_in_software_trigger_mode (ArvFakeCamera *camera);
 ARV_API gboolean		arv_fake_camera_check_and_acknowledge_software_trigger (ArvFakeCamera *camera);
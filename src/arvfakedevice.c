@@ -43,6 +43,11 @@ typedef struct {
 	char *serial_number;
 	ArvFakeCamera *camera;
 	ArvGc *genicam;
+
+	guint n_memory_reads;
+	guint n_register_reads;
+	guint n_memory_writes;
+	guint n_register_writes;
 } ArvFakeDevicePrivate;
 
 struct _ArvFakeDevice {
@@ -87,6 +92,8 @@ arv_fake_device_read_memory (ArvDevice *device, guint64 address, guint32 size, v
 	ArvFakeDevicePrivate *priv = arv_fake_device_get_instance_private (ARV_FAKE_DEVICE (device));
         gboolean success;
 
+	g_atomic_int_inc (&priv->n_memory_reads);
+
 	success = arv_fake_camera_read_memory (priv->camera, address, size, buffer);
 
         arv_trace_device ("[FakeDevice::read_memory] address 0x%" G_GINT64_MODIFIER "x, size = %d", address, size);
@@ -104,6 +111,8 @@ arv_fake_device_write_memory (ArvDevice *device, guint64 address, guint32 size,
 	ArvFakeDevicePrivate *priv = arv_fake_device_get_instance_private (ARV_FAKE_DEVICE (device));
         gboolean success;
 
+	g_atomic_int_inc (&priv->n_memory_writes);
+
         arv_trace_device ("[FakeDevice::write_memory] address 0x%" G_GINT64_MODIFIER "x, size = %d", address, size);
 
 	success = arv_fake_camera_write_memory (priv->camera, address, size, buffer);
@@ -120,6 +129,8 @@ arv_fake_device_read_register (ArvDevice *device, guint64 address, guint32 *valu
 {
 	ArvFakeDevicePrivate *priv = arv_fake_device_get_instance_private (ARV_FAKE_DEVICE (device));
 
+	g_atomic_int_inc (&priv->n_register_reads);
+
 	return arv_fake_camera_read_register (priv->camera, address, value);
 }
 
@@ -128,6 +139,8 @@ arv_fake_device_write_register (ArvDevice *device, guint64 address, guint32 valu
 {
 	ArvFakeDevicePrivate *priv = arv_fake_device_get_instance_private (ARV_FAKE_DEVICE (device));
 
+	g_atomic_int_inc (&priv->n_register_writes);
+
 	return arv_fake_camera_write_register (priv->camera, address, value);
 }
 
@@ -150,6 +163,38 @@ arv_fake_device_get_fake_camera	(ArvFakeDevice *device)
 	return priv->camera;
 }
 
+/**
+ * arv_fake_device_get_access_statistics:
+ * @device: a fake device
+ * @n_memory_reads: (out) (optional): number of memory read accesses
+ * @n_register_reads: (out) (optional): number of register read accesses
+ * @n_memory_writes: (out) (optional): number of memory write accesses
+ * @n_register_writes: (out) (optional): number of register write accesses
+ *
+ * Retrieves the number of accesses to the fake camera since the device creation, which is useful for checking the
+ * number of commands a real device would have received.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_fake_device_get_access_statistics (ArvFakeDevice *device, guint64 *n_memory_reads, guint64 *n_register_reads,
+				       guint64 *n_memory_writes, guint64 *n_register_writes)
+{
+	ArvFakeDevicePrivate *priv = arv_fake_device_get_instance_private (ARV_FAKE_DEVICE (device));
+
+	g_return_if_fail (ARV_IS_FAKE_DEVICE (device));
+
+	if (n_memory_reads != NULL)
+		*n_memory_reads = g_atomic_int_get (&priv->n_memory_reads);
+	if (n_register_reads != NULL)
+		*n_register_reads = g_atomic_int_get (&priv->n_register_reads);
+	if (n_memory_writes != NULL)
+		*n_memory_writes = g_atomic_int_get (&priv->n_memory_writes);
+	if (n_register_writes != NULL)
+		*n_register_writes = g_atomic_int_get (&priv->n_register_writes);
+}
+
 /**
  * arv_fake_device_new:
  * @serial_number: fake device serial number
@@ -39,6 +39,9 @@ ARV_API G_DECLARE_FINAL_TYPE (ArvFakeDevice, arv_fake_device, ARV, FAKE_DEVICE,
 ARV_API ArvDevice *		arv_fake_device_new 			(const char *serial_number, GError **error);
 
 ARV_API ArvFakeCamera *		arv_fake_device_get_fake_camera		(ArvFakeDevice *device);
+ARV_API void			arv_fake_device_get_access_statistics	(ArvFakeDevice *device,
+									 guint64 *n_memory_reads, guint64 *n_register_reads,
+									 guint64 *n_memory_writes, guint64 *n_register_writes);
 
 G_END_DECLS
 
@@ -37,6 +37,12 @@ static char *arv_option_interface_name = NULL;
 static char *arv_option_serial_number = NULL;
 static char *arv_option_genicam_file = NULL;
 static double arv_option_gvsp_lost_ratio = 0.0;
+static int arv_option_gvsp_burst_length = 1;
+static double arv_option_gvsp_reorder_ratio = 0.0;
+static int arv_option_gvsp_reorder_distance = 4;
+static int arv_option_frame_history = 8;
+static int arv_option_random_seed = 0;
+static gboolean arv_option_high_rate = FALSE;
 static char *arv_option_debug_domains = NULL;
 
 static const GOptionEntry arv_option_entries[] =
@@ -49,6 +55,18 @@ static const GOptionEntry arv_option_entries[] =
 	        &arv_option_genicam_file, 	"XML Genicam file to use", "genicam_filename"},
 	{ "gvsp-lost-ratio",    'r', 0, G_OPTION_ARG_DOUBLE,
 	        &arv_option_gvsp_lost_ratio,	"GVSP lost packet ratio", "packet_per_thousand"},
+	{ "gvsp-burst-length",  'b', 0, G_OPTION_ARG_INT,
+	        &arv_option_gvsp_burst_length,	"GVSP packets lost per loss event", "n_packets"},
+	{ "gvsp-reorder-ratio", 'o', 0, G_OPTION_ARG_DOUBLE,
+	        &arv_option_gvsp_reorder_ratio,	"GVSP reordered packet ratio", "packet_per_thousand"},
+	{ "gvsp-reorder-distance", 0, 0, G_OPTION_ARG_INT,
+	        &arv_option_gvsp_reorder_distance, "GVSP reordered packet distance", "n_packets"},
+	{ "frame-history",      'f', 0, G_OPTION_ARG_INT,
+	        &arv_option_frame_history,	"Number of frames kept for packet resend", "n_frames"},
+	{ "seed",               0, 0, G_OPTION_ARG_INT,
+	        &arv_option_random_seed,	"Packet loss random seed (0: random)", "seed"},
+	{ "high-rate",          'H', 0, G_OPTION_ARG_NONE,
+	        &arv_option_high_rate,		"High rate stream mode, with frame rate report", NULL},
 	{
 		"debug", 			'd', 0, G_OPTION_ARG_STRING,
 		&arv_option_debug_domains, 	NULL,
@@ -67,7 +85,9 @@ description_content[] =
 "\n"
 "arv-fake-gv-camera-" ARAVIS_API_VERSION " -i eth0\n"
 "arv-fake-gv-camera-" ARAVIS_API_VERSION " -i 127.0.0.1\n"
-"arv-fake-gv-camera-" ARAVIS_API_VERSION " -s GV02 -d all\n";
+"arv-fake-gv-camera-" ARAVIS_API_VERSION " -s GV02 -d all\n"
+"arv-fake-gv-camera-" ARAVIS_API_VERSION " -i 127.0.0.1 -r 10 -b 4 -o 5 --seed 42\n"
+"arv-fake-gv-camera-" ARAVIS_API_VERSION " -i 127.0.0.1 -H\n";
 
 int
 main (int argc, char **argv)
@@ -100,13 +120,32 @@ main (int argc, char **argv)
 
 	gv_camera = arv_gv_fake_camera_new_full (arv_option_interface_name, arv_option_serial_number, arv_option_genicam_file);
 
-	g_object_set (gv_camera, "gvsp-lost-ratio", arv_option_gvsp_lost_ratio / 1000.0, NULL);
+	g_object_set (gv_camera,
+		      "gvsp-lost-ratio", arv_option_gvsp_lost_ratio / 1000.0,
+		      "gvsp-burst-length", MAX (arv_option_gvsp_burst_length, 1),
+		      "gvsp-reorder-ratio", arv_option_gvsp_reorder_ratio / 1000.0,
+		      "gvsp-reorder-distance", MAX (arv_option_gvsp_reorder_distance, 1),
+		      "frame-history", CLAMP (arv_option_frame_history, 1, 1024),
+		      "random-seed", (guint) arv_option_random_seed,
+		      "gvsp-high-rate", arv_option_high_rate,
+		      NULL);
 
 	signal (SIGINT, set_cancel);
 
 	if (arv_gv_fake_camera_is_running (gv_camera))
-		while (!cancel)
+		while (!cancel) {
 			g_usleep (1000000);
+
+			if (arv_option_high_rate) {
+				double frame_rate, packet_rate, data_rate;
+
+				arv_gv_fake_camera_get_stream_statistics (gv_camera, NULL, NULL,
+									  &frame_rate, &packet_rate, &data_rate);
+				if (frame_rate > 0.0)
+					printf ("%8.1f fps %10.0f packets/s %8.1f MB/s\n",
+						frame_rate, packet_rate, data_rate / 1e6);
+			}
+		}
 	else
 		printf ("Failed to start camera\n");
 
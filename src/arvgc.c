@@ -31,18 +31,20 @@
 
 #include <arvgcprivate.h>
 #include <arvgcnode.h>
-#include <arvgcpropertynode.h>
-#include <arvgcindexnode.h>
+#include <arvgcfeaturenodeprivate.h>
+#include <arvgcpropertynodeprivate.h>
+#include <arvgcindexnodeprivate.h>
 #include <arvgcvalueindexednode.h>
 #include <arvgcinvalidatornode.h>
 #include <arvgcregisterdescriptionnode.h>
 #include <arvgcgroupnode.h>
 #include <arvgccategory.h>
-#include <arvgcenumeration.h>
+#include <arvgcenumerationprivate.h>
 #include <arvgcenumentry.h>
 #include <arvgcintegernode.h>
 #include <arvgcfloatnode.h>
-#include <arvgcregisternode.h>
+#include <arvgcregisternodeprivate.h>
+#include <arvgcregister.h>
 #include <arvgcintregnode.h>
 #include <arvgcmaskedintregnode.h>
 #include <arvgcfloatregnode.h>
@@ -51,6 +53,7 @@
 #include <arvgcstructregnode.h>
 #include <arvgcstructentrynode.h>
 #include <arvgccommand.h>
+#include <arvgcselector.h>
 #include <arvgcinteger.h>
 #include <arvgcfloat.h>
 #include <arvgcboolean.h>
@@ -60,7 +63,14 @@
 #include <arvgcintconverternode.h>
 #include <arvgcport.h>
 #include <arvbuffer.h>
+#include <arvdevice.h>
+#include <arvgvdevice.h>
+#include <arvgvcpprivate.h>
+#if ARAVIS_HAS_USB
+#include <arvuvdeviceprivate.h>
+#endif
 #include <arvdebugprivate.h>
+#include <arvmiscprivate.h>
 #include <arvdomparser.h>
 #include <string.h>
 #include <stdarg.h>
@@ -76,6 +86,17 @@ typedef struct {
 	ArvAccessCheckPolicy access_check_policy;
 
         unsigned n_register_cache_errors;
+
+	guint link_generation;
+
+	guint dependency_link_generation;
+	guint value_cache_generation;
+	guint invalidation_serial;
+
+	GArray *staged_writes;
+	GArray *transaction_groups;
+	ArvGcFeatureNode *transaction_feature;
+	gboolean is_transaction_feature_open;
 } ArvGcPrivate;
 
 struct _ArvGc {
@@ -104,183 +125,147 @@ arv_gc_can_append_child (ArvDomNode *self, ArvDomNode *child)
 
 /* ArvDomDocument implementation */
 
+typedef ArvGcNode * (*ArvGcNodeNew) (void);
+
+typedef struct {
+	const char *tag_name;
+	ArvGcNodeNew node_new;
+} ArvGcElementType;
+
+/* A NULL constructor is used for the known elements which are ignored */
+
+static const ArvGcElementType arv_gc_element_types[] = {
+	{"Category", arv_gc_category_new},
+	{"Command", arv_gc_command_new},
+	{"Converter", arv_gc_converter_node_new},
+	{"IntConverter", arv_gc_int_converter_node_new},
+	{"Register", arv_gc_register_node_new},
+	{"IntReg", arv_gc_int_reg_node_new},
+	{"MaskedIntReg", arv_gc_masked_int_reg_node_new},
+	{"FloatReg", arv_gc_float_reg_node_new},
+	{"String", arv_gc_string_node_new},
+	{"StringReg", arv_gc_string_reg_node_new},
+	{"StructReg", arv_gc_struct_reg_node_new},
+	{"StructEntry", arv_gc_struct_entry_node_new},
+	{"Integer", arv_gc_integer_node_new},
+	{"Float", arv_gc_float_node_new},
+	{"Boolean", arv_gc_boolean_new},
+	{"Enumeration", arv_gc_enumeration_new},
+	{"EnumEntry", arv_gc_enum_entry_new},
+	{"SwissKnife", arv_gc_swiss_knife_node_new},
+	{"IntSwissKnife", arv_gc_int_swiss_knife_node_new},
+	{"Port", arv_gc_port_new},
+	{"pIndex", arv_gc_index_node_new},
+	{"RegisterDescription", arv_gc_register_description_node_new},
+	{"pFeature", arv_gc_property_node_new_p_feature},
+	{"Value", arv_gc_property_node_new_value},
+	{"pValue", arv_gc_property_node_new_p_value},
+	{"Address", arv_gc_property_node_new_address},
+	{"pAddress", arv_gc_property_node_new_p_address},
+	{"Description", arv_gc_property_node_new_description},
+	{"Visibility", arv_gc_property_node_new_visibility},
+	{"ToolTip", arv_gc_property_node_new_tooltip},
+	{"DisplayName", arv_gc_property_node_new_display_name},
+	{"Min", arv_gc_property_node_new_minimum},
+	{"pMin", arv_gc_property_node_new_p_minimum},
+	{"Max", arv_gc_property_node_new_maximum},
+	{"pMax", arv_gc_property_node_new_p_maximum},
+	{"Inc", arv_gc_property_node_new_increment},
+	{"pInc", arv_gc_property_node_new_p_increment},
+	{"IsLinear", arv_gc_property_node_new_is_linear},
+	{"Slope", arv_gc_property_node_new_slope},
+	{"Unit", arv_gc_property_node_new_unit},
+	{"Representation", arv_gc_property_node_new_representation},
+	{"DisplayNotation", arv_gc_property_node_new_display_notation},
+	{"DisplayPrecision", arv_gc_property_node_new_display_precision},
+	{"OnValue", arv_gc_property_node_new_on_value},
+	{"OffValue", arv_gc_property_node_new_off_value},
+	{"pIsImplemented", arv_gc_property_node_new_p_is_implemented},
+	{"pIsAvailable", arv_gc_property_node_new_p_is_available},
+	{"pIsLocked", arv_gc_property_node_new_p_is_locked},
+	{"pSelected", arv_gc_property_node_new_p_selected},
+	{"Length", arv_gc_property_node_new_length},
+	{"pLength", arv_gc_property_node_new_p_length},
+	{"pPort", arv_gc_property_node_new_p_port},
+	{"pVariable", arv_gc_property_node_new_p_variable},
+	{"ValueIndexed", arv_gc_value_indexed_node_new},
+	{"pValueIndexed", arv_gc_p_value_indexed_node_new},
+	{"ValueDefault", arv_gc_property_node_new_value_default},
+	{"pValueDefault", arv_gc_property_node_new_p_value_default},
+	{"Formula", arv_gc_property_node_new_formula},
+	{"FormulaTo", arv_gc_property_node_new_formula_to},
+	{"FormulaFrom", arv_gc_property_node_new_formula_from},
+	{"Expression", arv_gc_property_node_new_expression},
+	{"Constant", arv_gc_property_node_new_constant},
+	{"AccessMode", arv_gc_property_node_new_access_mode},
+	{"ImposedAccessMode", arv_gc_property_node_new_imposed_access_mode},
+	{"Cachable", arv_gc_property_node_new_cachable},
+	{"PollingTime", arv_gc_property_node_new_polling_time},
+	{"Endianess", arv_gc_property_node_new_endianness},
+	{"Sign", arv_gc_property_node_new_sign},
+	{"LSB", arv_gc_property_node_new_lsb},
+	{"MSB", arv_gc_property_node_new_msb},
+	{"Bit", arv_gc_property_node_new_bit},
+	{"pInvalidator", arv_gc_invalidator_node_new},
+	{"Streamable", arv_gc_property_node_new_streamable},
+	{"IsDeprecated", arv_gc_property_node_new_is_deprecated},
+	{"pAlias", arv_gc_property_node_new_p_alias},
+	{"pCastAlias", arv_gc_property_node_new_p_cast_alias},
+	{"CommandValue", arv_gc_property_node_new_command_value},
+	{"pCommandValue", arv_gc_property_node_new_p_command_value},
+	{"ChunkID", arv_gc_property_node_new_chunk_id},
+	{"EventID", arv_gc_property_node_new_event_id},
+	{"Group", arv_gc_group_node_new},
+	{"Extension", NULL},
+};
+
+static GHashTable *
+_get_element_types (void)
+{
+	static GHashTable *element_types = NULL;
+
+	/* Built once, the documents may be parsed concurrently */
+	if (g_once_init_enter (&element_types)) {
+		GHashTable *table;
+		unsigned int i;
+
+		table = g_hash_table_new (g_str_hash, g_str_equal);
+		for (i = 0; i < G_N_ELEMENTS (arv_gc_element_types); i++)
+			g_hash_table_insert (table, (char *) arv_gc_element_types[i].tag_name,
+					     (gpointer) &arv_gc_element_types[i]);
+
+		g_once_init_leave (&element_types, table);
+	}
+
+	return element_types;
+}
+
 static ArvDomElement *
 arv_gc_create_element (ArvDomDocument *document, const char *tag_name)
 {
-	ArvGcNode *node = NULL;
-
-	if (strcmp (tag_name, "Category") == 0)
-		node = arv_gc_category_new ();
-	else if (strcmp (tag_name, "Command") == 0)
-		node = arv_gc_command_new ();
-	else if (strcmp (tag_name, "Converter") == 0)
-		node = arv_gc_converter_node_new ();
-	else if (strcmp (tag_name, "IntConverter") == 0)
-		node = arv_gc_int_converter_node_new ();
-	else if (strcmp (tag_name, "Register") == 0)
-		node = arv_gc_register_node_new ();
-	else if (strcmp (tag_name, "IntReg") == 0)
-		node = arv_gc_int_reg_node_new ();
-	else if (strcmp (tag_name, "MaskedIntReg") == 0)
-		node = arv_gc_masked_int_reg_node_new ();
-	else if (strcmp (tag_name, "FloatReg") == 0)
-		node = arv_gc_float_reg_node_new ();
-	else if (strcmp (tag_name, "String") == 0)
-		node = arv_gc_string_node_new ();
-	else if (strcmp (tag_name, "StringReg") == 0)
-		node = arv_gc_string_reg_node_new ();
-	else if (strcmp (tag_name, "StructReg") == 0)
-		node = arv_gc_struct_reg_node_new ();
-	else if (strcmp (tag_name, "StructEntry") == 0)
-		node = arv_gc_struct_entry_node_new ();
-	else if (strcmp (tag_name, "Integer") == 0)
-		node = arv_gc_integer_node_new ();
-	else if (strcmp (tag_name, "Float") == 0)
-		node = arv_gc_float_node_new ();
-	else if (strcmp (tag_name, "Boolean") == 0)
-		node = arv_gc_boolean_new ();
-	else if (strcmp (tag_name, "Enumeration") == 0)
-		node = arv_gc_enumeration_new ();
-	else if (strcmp (tag_name, "EnumEntry") == 0)
-		node = arv_gc_enum_entry_new ();
-	else if (strcmp (tag_name, "SwissKnife") == 0)
-		node = arv_gc_swiss_knife_node_new ();
-	else if (strcmp (tag_name, "IntSwissKnife") == 0)
-		node = arv_gc_int_swiss_knife_node_new ();
-	else if (strcmp (tag_name, "Port") == 0)
-		node = arv_gc_port_new ();
-	else if (strcmp (tag_name, "pIndex") == 0)
-		node = arv_gc_index_node_new ();
-	else if (strcmp (tag_name, "RegisterDescription") == 0)
-		node = arv_gc_register_description_node_new ();
-	else if (strcmp (tag_name, "pFeature") == 0)
-		node = arv_gc_property_node_new_p_feature ();
-	else if (strcmp (tag_name, "Value") == 0)
-		node = arv_gc_property_node_new_value ();
-	else if (strcmp (tag_name, "pValue") == 0)
-		node = arv_gc_property_node_new_p_value ();
-	else if (strcmp (tag_name, "Address") == 0)
-		node = arv_gc_property_node_new_address ();
-	else if (strcmp (tag_name, "pAddress") == 0)
-		node = arv_gc_property_node_new_p_address ();
-	else if (strcmp (tag_name, "Description") == 0)
-		node = arv_gc_property_node_new_description ();
-	else if (strcmp (tag_name, "Visibility") == 0)
-		node = arv_gc_property_node_new_visibility ();
-	else if (strcmp (tag_name, "ToolTip") == 0)
-		node = arv_gc_property_node_new_tooltip ();
-	else if (strcmp (tag_name, "DisplayName") == 0)
-		node = arv_gc_property_node_new_display_name ();
-	else if (strcmp (tag_name, "Min") == 0)
-		node = arv_gc_property_node_new_minimum ();
-	else if (strcmp (tag_name, "pMin") == 0)
-		node = arv_gc_property_node_new_p_minimum ();
-	else if (strcmp (tag_name, "Max") == 0)
-		node = arv_gc_property_node_new_maximum ();
-	else if (strcmp (tag_name, "pMax") == 0)
-		node = arv_gc_property_node_new_p_maximum ();
-	else if (strcmp (tag_name, "Inc") == 0)
-		node = arv_gc_property_node_new_increment ();
-	else if (strcmp (tag_name, "pInc") == 0)
-		node = arv_gc_property_node_new_p_increment ();
-	else if (strcmp (tag_name, "IsLinear") == 0)
-		node = arv_gc_property_node_new_is_linear ();
-	else if (strcmp (tag_name, "Slope") == 0)
-		node = arv_gc_property_node_new_slope ();
-	else if (strcmp (tag_name, "Unit") == 0)
-		node = arv_gc_property_node_new_unit ();
-	else if (strcmp (tag_name, "Representation") == 0)
-		node = arv_gc_property_node_new_representation ();
-	else if (strcmp (tag_name, "DisplayNotation") == 0)
-		node = arv_gc_property_node_new_display_notation ();
-	else if (strcmp (tag_name, "DisplayPrecision") == 0)
-		node = arv_gc_property_node_new_display_precision ();
-	else if (strcmp (tag_name, "OnValue") == 0)
-		node = arv_gc_property_node_new_on_value ();
-	else if (strcmp (tag_name, "OffValue") == 0)
-		node = arv_gc_property_node_new_off_value ();
-	else if (strcmp (tag_name, "pIsImplemented") == 0)
-		node = arv_gc_property_node_new_p_is_implemented ();
-	else if (strcmp (tag_name, "pIsAvailable") == 0)
-		node = arv_gc_property_node_new_p_is_available ();
-	else if (strcmp (tag_name, "pIsLocked") == 0)
-		node = arv_gc_property_node_new_p_is_locked ();
-	else if (strcmp (tag_name, "pSelected") == 0)
-		node = arv_gc_property_node_new_p_selected ();
-	else if (strcmp (tag_name, "Length") == 0)
-		node = arv_gc_property_node_new_length ();
-	else if (strcmp (tag_name, "pLength") == 0)
-		node = arv_gc_property_node_new_p_length ();
-	else if (strcmp (tag_name, "pPort") == 0)
-		node = arv_gc_property_node_new_p_port ();
-	else if (strcmp (tag_name, "pVariable") == 0)
-		node = arv_gc_property_node_new_p_variable ();
-	else if (strcmp (tag_name, "ValueIndexed") == 0)
-		node = arv_gc_value_indexed_node_new ();
-	else if (strcmp (tag_name, "pValueIndexed") == 0)
-		node = arv_gc_p_value_indexed_node_new ();
-	else if (strcmp (tag_name, "ValueDefault") == 0)
-		node = arv_gc_property_node_new_value_default ();
-	else if (strcmp (tag_name, "pValueDefault") == 0)
-		node = arv_gc_property_node_new_p_value_default ();
-	else if (strcmp (tag_name, "Formula") == 0)
-		node = arv_gc_property_node_new_formula ();
-	else if (strcmp (tag_name, "FormulaTo") == 0)
-		node = arv_gc_property_node_new_formula_to ();
-	else if (strcmp (tag_name, "FormulaFrom") == 0)
-		node = arv_gc_property_node_new_formula_from ();
-	else if (strcmp (tag_name, "Expression") == 0)
-		node = arv_gc_property_node_new_expression ();
-	else if (strcmp (tag_name, "Constant") == 0)
-		node = arv_gc_property_node_new_constant ();
-
-	else if (strcmp (tag_name, "AccessMode") == 0)
-		node = arv_gc_property_node_new_access_mode ();
-	else if (strcmp (tag_name, "ImposedAccessMode") == 0)
-		node = arv_gc_property_node_new_imposed_access_mode ();
-	else if (strcmp (tag_name, "Cachable") == 0)
-		node = arv_gc_property_node_new_cachable ();
-	else if (strcmp (tag_name, "PollingTime") == 0)
-		node = arv_gc_property_node_new_polling_time ();
-	else if (strcmp (tag_name, "Endianess") == 0)
-		node = arv_gc_property_node_new_endianness ();
-	else if (strcmp (tag_name, "Sign") == 0)
-		node = arv_gc_property_node_new_sign ();
-	else if (strcmp (tag_name, "LSB") == 0)
-		node = arv_gc_property_node_new_lsb ();
-	else if (strcmp (tag_name, "MSB") == 0)
-		node = arv_gc_property_node_new_msb ();
-	else if (strcmp (tag_name, "Bit") == 0)
-		node = arv_gc_property_node_new_bit ();
-	else if (strcmp (tag_name, "pInvalidator") == 0)
-		node = arv_gc_invalidator_node_new ();
-	else if (strcmp (tag_name, "Streamable") == 0)
-		node = arv_gc_property_node_new_streamable ();
-	else if (strcmp (tag_name, "IsDeprecated") == 0)
-		node = arv_gc_property_node_new_is_deprecated ();
-	else if (strcmp (tag_name, "pAlias") == 0)
-		node = arv_gc_property_node_new_p_alias ();
-	else if (strcmp (tag_name, "pCastAlias") == 0)
-		node = arv_gc_property_node_new_p_cast_alias ();
-
-	else if (strcmp (tag_name, "CommandValue") == 0)
-		node = arv_gc_property_node_new_command_value ();
-	else if (strcmp (tag_name, "pCommandValue") == 0)
-		node = arv_gc_property_node_new_p_command_value ();
-
-	else if (strcmp (tag_name, "ChunkID") == 0)
-		node = arv_gc_property_node_new_chunk_id ();
-	else if (strcmp (tag_name, "EventID") == 0)
-		node = arv_gc_property_node_new_event_id ();
-
-	else if (strcmp (tag_name, "Group") == 0)
-		node = arv_gc_group_node_new ();
-	else if (strcmp (tag_name, "Extension") == 0)
-		node = NULL;
-	else
+	const ArvGcElementType *element_type;
+
+	element_type = g_hash_table_lookup (_get_element_types (), tag_name);
+	if (element_type == NULL) {
 		arv_info_dom ("[Genicam::create_element] Unknown tag (%s)", tag_name);
+		return NULL;
+	}
+
+	if (element_type->node_new == NULL)
+		return NULL;
+
+	return ARV_DOM_ELEMENT (element_type->node_new ());
+}
 
-	return ARV_DOM_ELEMENT (node);
+/* The text content of the property nodes is stored inline, without ArvDomText children. The other nodes of a Genicam
+ * document don't accept text children, their text content is only made of the whitespaces between their child
+ * elements, which are dropped without creating temporary text nodes. */
+
+static void
+arv_gc_append_text (ArvDomDocument *document, ArvDomNode *parent, const char *data, gsize length)
+{
+	if (ARV_IS_GC_PROPERTY_NODE (parent))
+		arv_gc_property_node_append_inline_data (ARV_GC_PROPERTY_NODE (parent), data, length);
 }
 
 /* ArvGc implementation */
@@ -336,7 +321,9 @@ arv_gc_register_feature_node (ArvGc *genicam, ArvGcFeatureNode *node)
 
 	g_object_ref (node);
 
-	g_hash_table_remove (genicam->priv->nodes, (char *) name);
+	/* Replacing a node invalidates the node pointers cached by the property nodes */
+	if (g_hash_table_remove (genicam->priv->nodes, (char *) name))
+		genicam->priv->link_generation++;
 	g_hash_table_insert (genicam->priv->nodes, (char *) name, node);
 
 	arv_debug_genicam ("[Gc::register_feature_node] Register node '%s' [%s]", name,
@@ -366,11 +353,940 @@ arv_gc_set_default_node_data (ArvGc *genicam, const char *node_name, ...)
 	va_end (args);
 }
 
+static void
+_collect_registers (ArvGcNode *node, GHashTable *visited, GPtrArray *registers)
+{
+	ArvDomNode *child;
+
+	if (node == NULL || g_hash_table_contains (visited, node))
+		return;
+
+	g_hash_table_add (visited, node);
+
+	if (ARV_IS_GC_REGISTER_NODE (node))
+		g_ptr_array_add (registers, node);
+
+	for (child = arv_dom_node_get_first_child (ARV_DOM_NODE (node));
+	     child != NULL;
+	     child = arv_dom_node_get_next_sibling (child)) {
+		if (ARV_IS_GC_PROPERTY_NODE (child)) {
+			/* Invalidators and selected features are not read along with the feature */
+			if (ARV_IS_GC_INVALIDATOR_NODE (child) ||
+			    arv_gc_property_node_get_node_type (ARV_GC_PROPERTY_NODE (child)) ==
+			    ARV_GC_PROPERTY_NODE_TYPE_P_SELECTED)
+				continue;
+
+			_collect_registers (arv_gc_property_node_get_linked_node (ARV_GC_PROPERTY_NODE (child)),
+					    visited, registers);
+		} else if (ARV_IS_GC_NODE (child))
+			_collect_registers (ARV_GC_NODE (child), visited, registers);
+	}
+}
+
+/* Returns the device port registers read along with the given feature */
+
+GPtrArray *
+arv_gc_dup_feature_registers (ArvGc *genicam, const char *feature)
+{
+	GHashTable *visited;
+	GPtrArray *nodes;
+	GPtrArray *registers;
+	guint i;
+
+	g_return_val_if_fail (ARV_IS_GC (genicam), NULL);
+	g_return_val_if_fail (feature != NULL, NULL);
+
+	visited = g_hash_table_new (g_direct_hash, g_direct_equal);
+	nodes = g_ptr_array_new ();
+	registers = g_ptr_array_new_with_free_func (g_object_unref);
+
+	_collect_registers (arv_gc_get_node (genicam, feature), visited, nodes);
+
+	for (i = 0; i < nodes->len; i++)
+		if (arv_gc_register_node_is_device_register (g_ptr_array_index (nodes, i)))
+			g_ptr_array_add (registers, g_object_ref (g_ptr_array_index (nodes, i)));
+
+	g_ptr_array_unref (nodes);
+	g_hash_table_unref (visited);
+
+	return registers;
+}
+
+/* Returns the device port registers with a PollingTime property */
+
+GPtrArray *
+arv_gc_dup_polled_registers (ArvGc *genicam)
+{
+	GHashTableIter iter;
+	GPtrArray *registers;
+	gpointer node;
+
+	g_return_val_if_fail (ARV_IS_GC (genicam), NULL);
+
+	registers = g_ptr_array_new_with_free_func (g_object_unref);
+
+	g_hash_table_iter_init (&iter, genicam->priv->nodes);
+	while (g_hash_table_iter_next (&iter, NULL, &node))
+		if (ARV_IS_GC_REGISTER_NODE (node) &&
+		    arv_gc_register_node_get_polling_time (node) > 0 &&
+		    arv_gc_register_node_is_device_register (node))
+			g_ptr_array_add (registers, g_object_ref (node));
+
+	return registers;
+}
+
+/* Register block prefetch
+ *
+ * The address ranges of the registers to prefetch are sorted, and merged into blocks when they are adjacent or
+ * overlapping, up to the maximum size of a single memory read command. Unused addresses are never read, as some
+ * devices refuse the reads of unmapped addresses, or have side effects on read. */
+
+#define ARV_GC_PREFETCH_BLOCK_SIZE_DEFAULT	1024
+
+typedef struct {
+	ArvGcRegisterNode *node;
+	guint64 address;
+	guint64 length;
+} ArvGcPrefetchRange;
+
+static gint
+_compare_prefetch_range (gconstpointer a, gconstpointer b)
+{
+	const ArvGcPrefetchRange *range_a = a;
+	const ArvGcPrefetchRange *range_b = b;
+
+	if (range_a->address < range_b->address)
+		return -1;
+	if (range_a->address > range_b->address)
+		return 1;
+	return 0;
+}
+
+static guint64
+_get_prefetch_block_size_max (ArvDevice *device)
+{
+	if (ARV_IS_GV_DEVICE (device))
+		return ARV_GVCP_DATA_SIZE_MAX;
+#if ARAVIS_HAS_USB
+	if (ARV_IS_UV_DEVICE (device))
+		return arv_uv_device_get_memory_data_size_max (ARV_UV_DEVICE (device));
+#endif
+
+	return ARV_GC_PREFETCH_BLOCK_SIZE_DEFAULT;
+}
+
+static gboolean
+_prefetch_blocks (ArvDevice *device, const ArvGcPrefetchRange *ranges, guint n_ranges,
+		  guint64 block_size_max, guint *n_reads, GError **error)
+{
+	gboolean success = TRUE;
+	guint8 *buffer = NULL;
+	guint first, last;
+	guint i;
+
+	for (first = 0; first < n_ranges; first = last) {
+		guint64 block_address = ranges[first].address;
+		guint64 block_end = ranges[first].address + ranges[first].length;
+		GError *local_error = NULL;
+
+		for (last = first + 1; last < n_ranges; last++) {
+			guint64 end = MAX (block_end, ranges[last].address + ranges[last].length);
+
+			if (ranges[last].address > block_end ||
+			    end - block_address > block_size_max)
+				break;
+
+			block_end = end;
+		}
+
+		buffer = g_realloc (buffer, block_end - block_address);
+
+		(*n_reads)++;
+
+		if (arv_device_read_memory (device, block_address, block_end - block_address, buffer, &local_error)) {
+			for (i = first; i < last; i++)
+				arv_gc_register_node_set_prefetched_data (ranges[i].node, ranges[i].address,
+									  buffer + (ranges[i].address - block_address),
+									  ranges[i].length);
+		} else {
+			if (success)
+				g_propagate_error (error, local_error);
+			else
+				g_clear_error (&local_error);
+			success = FALSE;
+		}
+	}
+
+	g_free (buffer);
+
+	return success;
+}
+
+/**
+ * arv_gc_prefetch_features:
+ * @genicam: a #ArvGc object
+ * @features: (array zero-terminated=1): a %NULL terminated list of feature names
+ * @error: a #GError placeholder
+ *
+ * Reads the registers the given features depend on, and stores their values in the register caches, such that the
+ * subsequent reads of these features do not require a command per register. The registers at adjacent addresses
+ * are read together, using a single memory read command per block. Prefetching a category prefetches all its
+ * features, for example "Root" for the whole feature tree. Prefetch is only done for the cachable registers of the
+ * device, and when the register cache policy is set to %ARV_REGISTER_CACHE_POLICY_ENABLE. Unknown features are
+ * ignored.
+ *
+ * Returns: %TRUE on success. On failure, the registers that could not be read are left out of the cache.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_gc_prefetch_features (ArvGc *genicam, const char **features, GError **error)
+{
+	GHashTable *visited;
+	GPtrArray *nodes;
+	GArray *ranges;
+	GArray *addresses;
+	GPtrArray *registers;
+	guint32 *values;
+	gboolean success = TRUE;
+	guint n_reads = 0;
+	guint i;
+
+	g_return_val_if_fail (ARV_IS_GC (genicam), FALSE);
+	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
+
+	if (features == NULL ||
+	    !ARV_IS_DEVICE (genicam->priv->device) ||
+	    genicam->priv->cache_policy != ARV_REGISTER_CACHE_POLICY_ENABLE)
+		return TRUE;
+
+	visited = g_hash_table_new (g_direct_hash, g_direct_equal);
+	nodes = g_ptr_array_new ();
+	ranges = g_array_new (FALSE, FALSE, sizeof (ArvGcPrefetchRange));
+	addresses = g_array_new (FALSE, FALSE, sizeof (guint64));
+	registers = g_ptr_array_new ();
+
+	for (i = 0; features[i] != NULL; i++)
+		_collect_registers (arv_gc_get_node (genicam, features[i]), visited, nodes);
+
+	for (i = 0; i < nodes->len; i++) {
+		ArvGcPrefetchRange range;
+		gboolean register_access;
+
+		range.node = g_ptr_array_index (nodes, i);
+		if (!arv_gc_register_node_get_prefetch_range (range.node, &range.address, &range.length,
+							      &register_access))
+			continue;
+
+		if (register_access) {
+			g_array_append_val (addresses, range.address);
+			g_ptr_array_add (registers, range.node);
+		} else
+			g_array_append_val (ranges, range);
+	}
+
+	if (ranges->len > 0) {
+		g_array_sort (ranges, _compare_prefetch_range);
+
+		success = _prefetch_blocks (genicam->priv->device, (ArvGcPrefetchRange *) ranges->data, ranges->len,
+					    _get_prefetch_block_size_max (genicam->priv->device),
+					    &n_reads, error);
+	}
+
+	if (registers->len > 0) {
+		GError *local_error = NULL;
+
+		values = g_new0 (guint32, registers->len);
+
+		n_reads++;
+
+		if (arv_device_read_registers (genicam->priv->device, (const guint64 *) addresses->data,
+					       values, registers->len, &local_error)) {
+			for (i = 0; i < registers->len; i++) {
+				guint32 be_value = GUINT32_TO_BE (values[i]);
+
+				arv_gc_register_node_set_prefetched_data (g_ptr_array_index (registers, i),
+									  g_array_index (addresses, guint64, i),
+									  &be_value, sizeof (be_value));
+			}
+		} else {
+			if (success)
+				g_propagate_error (error, local_error);
+			else
+				g_clear_error (&local_error);
+			success = FALSE;
+		}
+
+		g_free (values);
+	}
+
+	arv_info_genicam ("[Gc::prefetch_features] Prefetch %u register(s) using %u read(s)",
+			  ranges->len + registers->len, n_reads);
+
+	g_ptr_array_unref (registers);
+	g_array_unref (addresses);
+	g_array_unref (ranges);
+	g_ptr_array_unref (nodes);
+	g_hash_table_unref (visited);
+
+	return success;
+}
+
+/* Feature transactions
+ *
+ * While a transaction is open, the writes to the device port are staged instead of being sent, and the reads of the
+ * device port see the staged data, such that the range, access and availability checks of the subsequent feature
+ * assignments are done against the state the device will have after the commit.
+ *
+ * The staged writes are grouped by feature assignment. At commit, a group is scheduled after an earlier one if it reads
+ * or writes a register written by the earlier group, if it writes a register read by the earlier group, or if one of
+ * them is a selector of the other. Commands and the writes outside of a feature assignment are barriers. The groups of
+ * a same level are independent, their contiguous writes are merged into single memory write commands, and their
+ * register writes are sent as one batch. */
+
+typedef struct {
+	guint64 address;
+	guint64 length;
+	guint8 *data;
+	gboolean register_access;
+	guint group;
+} ArvGcStagedWrite;
+
+typedef struct {
+	ArvGcFeatureNode *feature;	/* NULL for the writes outside of a feature assignment */
+	gboolean is_barrier;
+	GArray *read_ranges;		/* ArvGcPrefetchRange */
+	guint first_write;
+	guint n_writes;
+	guint level;
+} ArvGcTransactionGroup;
+
+static void
+_clear_staged_write (gpointer data)
+{
+	ArvGcStagedWrite *write = data;
+
+	g_clear_pointer (&write->data, g_free);
+}
+
+static void
+_clear_transaction_group (gpointer data)
+{
+	ArvGcTransactionGroup *group = data;
+
+	g_clear_pointer (&group->read_ranges, g_array_unref);
+}
+
+/**
+ * arv_gc_begin_transaction:
+ * @genicam: a #ArvGc object
+ * @error: a #GError placeholder
+ *
+ * Starts a feature transaction. Until the call to [method@Aravis.Gc.commit_transaction] or
+ * [method@Aravis.Gc.abort_transaction], the register writes to the device are deferred. The feature reads return the
+ * values set during the transaction.
+ *
+ * Returns: %TRUE on success, %FALSE if a transaction is already open or if there is no device.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_gc_begin_transaction (ArvGc *genicam, GError **error)
+{
+	g_return_val_if_fail (ARV_IS_GC (genicam), FALSE);
+	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
+
+	if (!ARV_IS_DEVICE (genicam->priv->device)) {
+		g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_NO_DEVICE_SET, "No device set");
+		return FALSE;
+	}
+
+	if (genicam->priv->staged_writes != NULL) {
+		g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_TRANSACTION, "Transaction already open");
+		return FALSE;
+	}
+
+	genicam->priv->staged_writes = g_array_new (FALSE, FALSE, sizeof (ArvGcStagedWrite));
+	g_array_set_clear_func (genicam->priv->staged_writes, _clear_staged_write);
+	genicam->priv->transaction_groups = g_array_new (FALSE, FALSE, sizeof (ArvGcTransactionGroup));
+	g_array_set_clear_func (genicam->priv->transaction_groups, _clear_transaction_group);
+	genicam->priv->transaction_feature = NULL;
+	genicam->priv->is_transaction_feature_open = FALSE;
+
+	arv_debug_genicam ("[Gc::begin_transaction]");
+
+	return TRUE;
+}
+
+/* Starts a new write group for the assignment of @feature, or closes the current one if @feature is NULL. The writes
+ * done by the nodes the feature depends on are part of its group. */
+
+void
+arv_gc_set_transaction_feature (ArvGc *genicam, ArvGcFeatureNode *feature)
+{
+	g_return_if_fail (ARV_IS_GC (genicam));
+
+	if (genicam->priv->staged_writes == NULL)
+		return;
+
+	genicam->priv->transaction_feature = feature;
+	genicam->priv->is_transaction_feature_open = FALSE;
+}
+
+gboolean
+arv_gc_is_in_transaction (ArvGc *genicam)
+{
+	g_return_val_if_fail (ARV_IS_GC (genicam), FALSE);
+
+	return genicam->priv->staged_writes != NULL;
+}
+
+/* Stages a device port write. @data is in the device memory layout, even for the writes done using the register write
+ * command. Returns %FALSE if there is no open transaction, in which case the write must be sent to the device. */
+
+gboolean
+arv_gc_stage_write (ArvGc *genicam, guint64 address, const void *data, guint64 length, gboolean register_access)
+{
+	ArvGcPrivate *priv;
+	ArvGcStagedWrite write;
+	ArvGcTransactionGroup *group = NULL;
+
+	g_return_val_if_fail (ARV_IS_GC (genicam), FALSE);
+
+	priv = genicam->priv;
+
+	if (priv->staged_writes == NULL)
+		return FALSE;
+
+	g_return_val_if_fail (data != NULL, FALSE);
+
+	if (priv->transaction_groups->len > 0)
+		group = &g_array_index (priv->transaction_groups, ArvGcTransactionGroup,
+					priv->transaction_groups->len - 1);
+
+	/* Consecutive writes outside of a feature assignment share the same group */
+	if (priv->is_transaction_feature_open ||
+	    (priv->transaction_feature == NULL && group != NULL && group->feature == NULL &&
+	     group->first_write + group->n_writes == priv->staged_writes->len)) {
+		group->n_writes++;
+	} else {
+		ArvGcTransactionGroup new_group = {0};
+
+		new_group.feature = priv->transaction_feature;
+		new_group.first_write = priv->staged_writes->len;
+		new_group.n_writes = 1;
+		g_array_append_val (priv->transaction_groups, new_group);
+
+		priv->is_transaction_feature_open = priv->transaction_feature != NULL;
+	}
+
+	write.address = address;
+	write.length = length;
+	write.data = arv_memdup (data, length);
+	write.register_access = register_access;
+	write.group = priv->transaction_groups->len - 1;
+	g_array_append_val (priv->staged_writes, write);
+
+	arv_debug_genicam ("[Gc::stage_write] 0x%08" G_GINT64_MODIFIER "x, %" G_GUINT64_FORMAT " byte(s) (%s)",
+			   address, length,
+			   priv->transaction_feature != NULL ?
+			   arv_gc_feature_node_get_name (priv->transaction_feature) : "register");
+
+	return TRUE;
+}
+
+/* Copies the staged data overlapping the given range into @buffer. If @is_complete_only is %TRUE, nothing is copied
+ * unless the staged data covers the whole range, and %TRUE is returned if it does. */
+
+gboolean
+arv_gc_read_staged_data (ArvGc *genicam, guint64 address, void *buffer, guint64 length, gboolean is_complete_only)
+{
+	GArray *staged_writes;
+	guint8 *is_covered = NULL;
+	guint64 n_covered = 0;
+	guint i;
+
+	g_return_val_if_fail (ARV_IS_GC (genicam), FALSE);
+
+	staged_writes = genicam->priv->staged_writes;
+	if (staged_writes == NULL || staged_writes->len == 0 || length == 0)
+		return FALSE;
+
+	if (is_complete_only) {
+		is_covered = g_malloc0 (length);
+
+		for (i = 0; i < staged_writes->len; i++) {
+			ArvGcStagedWrite *write = &g_array_index (staged_writes, ArvGcStagedWrite, i);
+			guint64 start = MAX (write->address, address);
+			guint64 end = MIN (write->address + write->length, address + length);
+			guint64 j;
+
+			for (j = start; j < end; j++)
+				if (!is_covered[j - address]) {
+					is_covered[j - address] = TRUE;
+					n_covered++;
+				}
+		}
+
+		g_free (is_covered);
+
+		if (n_covered < length)
+			return FALSE;
+	}
+
+	/* In staging order, the last write wins */
+	for (i = 0; i < staged_writes->len; i++) {
+		ArvGcStagedWrite *write = &g_array_index (staged_writes, ArvGcStagedWrite, i);
+		guint64 start = MAX (write->address, address);
+		guint64 end = MIN (write->address + write->length, address + length);
+
+		if (start < end)
+			memcpy ((guint8 *) buffer + (start - address), write->data + (start - write->address),
+				end - start);
+	}
+
+	return is_complete_only;
+}
+
+static void
+_end_transaction (ArvGc *genicam, gboolean discard_caches)
+{
+	ArvGcPrivate *priv = genicam->priv;
+
+	if (discard_caches && priv->staged_writes->len > 0) {
+		GHashTableIter iter;
+		gpointer node;
+
+		/* The register caches hold the staged data */
+		g_hash_table_iter_init (&iter, priv->nodes);
+		while (g_hash_table_iter_next (&iter, NULL, &node)) {
+			GError *local_error = NULL;
+			guint64 address, length;
+			guint i;
+
+			if (!ARV_IS_GC_REGISTER_NODE (node))
+				continue;
+
+			address = arv_gc_register_get_address (ARV_GC_REGISTER (node), &local_error);
+			if (local_error == NULL)
+				length = arv_gc_register_get_length (ARV_GC_REGISTER (node), &local_error);
+
+			if (local_error != NULL) {
+				g_clear_error (&local_error);
+				arv_gc_register_node_discard_cache (node);
+				continue;
+			}
+
+			for (i = 0; i < priv->staged_writes->len; i++) {
+				ArvGcStagedWrite *write = &g_array_index (priv->staged_writes, ArvGcStagedWrite, i);
+
+				if (write->address < address + length && address < write->address + write->length) {
+					arv_gc_register_node_discard_cache (node);
+					break;
+				}
+			}
+		}
+
+		priv->value_cache_generation++;
+	}
+
+	g_clear_pointer (&priv->staged_writes, g_array_unref);
+	g_clear_pointer (&priv->transaction_groups, g_array_unref);
+	priv->transaction_feature = NULL;
+	priv->is_transaction_feature_open = FALSE;
+}
+
+/**
+ * arv_gc_abort_transaction:
+ * @genicam: a #ArvGc object
+ *
+ * Discards the writes staged since [method@Aravis.Gc.begin_transaction]. The device is left untouched.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_gc_abort_transaction (ArvGc *genicam)
+{
+	g_return_if_fail (ARV_IS_GC (genicam));
+
+	if (genicam->priv->staged_writes == NULL)
+		return;
+
+	arv_debug_genicam ("[Gc::abort_transaction] Discard %u write(s)", genicam->priv->staged_writes->len);
+
+	_end_transaction (genicam, TRUE);
+}
+
+static gboolean
+_ranges_overlap (const ArvGcPrefetchRange *ranges, guint n_ranges, guint64 address, guint64 length)
+{
+	guint i;
+
+	for (i = 0; i < n_ranges; i++)
+		if (ranges[i].address < address + length && address < ranges[i].address + ranges[i].length)
+			return TRUE;
+
+	return FALSE;
+}
+
+static gboolean
+_group_writes_overlap (GArray *staged_writes, const ArvGcTransactionGroup *group,
+		       const ArvGcPrefetchRange *ranges, guint n_ranges)
+{
+	guint i;
+
+	for (i = group->first_write; i < group->first_write + group->n_writes; i++) {
+		ArvGcStagedWrite *write = &g_array_index (staged_writes, ArvGcStagedWrite, i);
+
+		if (_ranges_overlap (ranges, n_ranges, write->address, write->length))
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
+static gboolean
+_is_selecting (ArvGcFeatureNode *selector, ArvGcFeatureNode *feature)
+{
+	if (!ARV_IS_GC_SELECTOR (selector) || !arv_gc_selector_is_selector (ARV_GC_SELECTOR (selector)))
+		return FALSE;
+
+	return g_slist_find ((GSList *) arv_gc_selector_get_selected_features (ARV_GC_SELECTOR (selector)),
+			     feature) != NULL;
+}
+
+static GArray *
+_dup_group_ranges (GArray *staged_writes, const ArvGcTransactionGroup *group)
+{
+	GArray *ranges = g_array_new (FALSE, FALSE, sizeof (ArvGcPrefetchRange));
+	guint i;
+
+	if (group->read_ranges != NULL)
+		g_array_append_vals (ranges, group->read_ranges->data, group->read_ranges->len);
+
+	for (i = group->first_write; i < group->first_write + group->n_writes; i++) {
+		ArvGcStagedWrite *write = &g_array_index (staged_writes, ArvGcStagedWrite, i);
+		ArvGcPrefetchRange range = {NULL, write->address, write->length};
+
+		g_array_append_val (ranges, range);
+	}
+
+	return ranges;
+}
+
+/* Computes the registers the feature validation depends on, and the dependency level of each write group */
+
+static guint
+_schedule_transaction (ArvGc *genicam)
+{
+	ArvGcPrivate *priv = genicam->priv;
+	GArray *groups = priv->transaction_groups;
+	guint n_levels = 0;
+	guint i, j;
+
+	for (i = 0; i < groups->len; i++) {
+		ArvGcTransactionGroup *group = &g_array_index (groups, ArvGcTransactionGroup, i);
+		GHashTable *visited;
+		GPtrArray *nodes;
+		guint k;
+
+		if (group->feature == NULL || ARV_IS_GC_COMMAND (group->feature)) {
+			group->is_barrier = TRUE;
+			continue;
+		}
+
+		visited = g_hash_table_new (g_direct_hash, g_direct_equal);
+		nodes = g_ptr_array_new ();
+		group->read_ranges = g_array_new (FALSE, FALSE, sizeof (ArvGcPrefetchRange));
+
+		_collect_registers (ARV_GC_NODE (group->feature), visited, nodes);
+
+		for (k = 0; k < nodes->len && !group->is_barrier; k++) {
+			ArvGcRegisterNode *node = g_ptr_array_index (nodes, k);
+			ArvGcPrefetchRange range;
+			GError *local_error = NULL;
+
+			if (!arv_gc_register_node_is_device_register (node))
+				continue;
+
+			range.node = node;
+			range.address = arv_gc_register_get_address (ARV_GC_REGISTER (node), &local_error);
+			if (local_error == NULL)
+				range.length = arv_gc_register_get_length (ARV_GC_REGISTER (node), &local_error);
+
+			/* Unknown dependencies, keep the assignment order */
+			if (local_error != NULL) {
+				g_clear_error (&local_error);
+				group->is_barrier = TRUE;
+			} else
+				g_array_append_val (group->read_ranges, range);
+		}
+
+		g_ptr_array_unref (nodes);
+		g_hash_table_unref (visited);
+	}
+
+	for (j = 0; j < groups->len; j++) {
+		ArvGcTransactionGroup *group = &g_array_index (groups, ArvGcTransactionGroup, j);
+		GArray *ranges = _dup_group_ranges (priv->staged_writes, group);
+
+		group->level = 0;
+
+		for (i = 0; i < j; i++) {
+			ArvGcTransactionGroup *previous = &g_array_index (groups, ArvGcTransactionGroup, i);
+
+			if (previous->level + 1 <= group->level)
+				continue;
+
+			if (group->is_barrier || previous->is_barrier ||
+			    _group_writes_overlap (priv->staged_writes, previous,
+						   (ArvGcPrefetchRange *) ranges->data, ranges->len) ||
+			    (previous->read_ranges != NULL &&
+			     _group_writes_overlap (priv->staged_writes, group,
+						    (ArvGcPrefetchRange *) previous->read_ranges->data,
+						    previous->read_ranges->len)) ||
+			    _is_selecting (previous->feature, group->feature) ||
+			    _is_selecting (group->feature, previous->feature))
+				group->level = previous->level + 1;
+		}
+
+		n_levels = MAX (n_levels, group->level + 1);
+
+		g_array_unref (ranges);
+	}
+
+	return n_levels;
+}
+
+static gboolean
+_is_register_write (const ArvGcStagedWrite *write)
+{
+	return write->register_access && write->length == sizeof (guint32);
+}
+
+static gint
+_compare_staged_write (gconstpointer a, gconstpointer b)
+{
+	const ArvGcStagedWrite *write_a = *((const ArvGcStagedWrite **) a);
+	const ArvGcStagedWrite *write_b = *((const ArvGcStagedWrite **) b);
+
+	if (write_a->address < write_b->address)
+		return -1;
+	if (write_a->address > write_b->address)
+		return 1;
+	return 0;
+}
+
+/* Sends the writes of one dependency level */
+
+static gboolean
+_commit_level (ArvGc *genicam, guint level, guint64 block_size_max, guint *n_commands, GError **error)
+{
+	ArvGcPrivate *priv = genicam->priv;
+	GPtrArray *writes;
+	GArray *addresses;
+	GArray *values;
+	guint8 *buffer = NULL;
+	gboolean success = TRUE;
+	guint first, last;
+	guint i;
+
+	writes = g_ptr_array_new ();
+	addresses = g_array_new (FALSE, FALSE, sizeof (guint64));
+	values = g_array_new (FALSE, FALSE, sizeof (guint32));
+
+	for (i = 0; i < priv->staged_writes->len; i++) {
+		ArvGcStagedWrite *write = &g_array_index (priv->staged_writes, ArvGcStagedWrite, i);
+
+		if (g_array_index (priv->transaction_groups, ArvGcTransactionGroup, write->group).level != level)
+			continue;
+
+		if (_is_register_write (write)) {
+			guint32 value;
+
+			memcpy (&value, write->data, sizeof (value));
+			value = GUINT32_FROM_BE (value);
+			g_array_append_val (addresses, write->address);
+			g_array_append_val (values, value);
+		} else
+			g_ptr_array_add (writes, write);
+	}
+
+	/* Stable sort, the writes to a same address stay in staging order */
+	g_ptr_array_sort (writes, _compare_staged_write);
+
+	for (first = 0; first < writes->len && success; first = last) {
+		ArvGcStagedWrite *write = g_ptr_array_index (writes, first);
+		guint64 block_address = write->address;
+		guint64 block_end = write->address + write->length;
+
+		for (last = first + 1; last < writes->len; last++) {
+			ArvGcStagedWrite *next = g_ptr_array_index (writes, last);
+			guint64 end = MAX (block_end, next->address + next->length);
+
+			/* Only contiguous data, the content of the gaps is unknown */
+			if (next->address > block_end || end - block_address > block_size_max)
+				break;
+
+			block_end = end;
+		}
+
+		buffer = g_realloc (buffer, block_end - block_address);
+
+		/* Overlapping writes of a same level are applied in staging order. A write straddling the limit
+		 * between two blocks is clipped, in order to not be overwritten by the data of the next block. */
+		for (i = 0; i < priv->staged_writes->len; i++) {
+			ArvGcStagedWrite *staged = &g_array_index (priv->staged_writes, ArvGcStagedWrite, i);
+			guint64 start, end;
+
+			if (_is_register_write (staged) ||
+			    g_array_index (priv->transaction_groups, ArvGcTransactionGroup, staged->group).level != level)
+				continue;
+
+			start = MAX (staged->address, block_address);
+			end = MIN (staged->address + staged->length, block_end);
+			if (start < end)
+				memcpy (buffer + (start - block_address),
+					staged->data + (start - staged->address), end - start);
+		}
+
+		(*n_commands)++;
+
+		success = arv_device_write_memory (priv->device, block_address, block_end - block_address, buffer, error);
+	}
+
+	if (success && addresses->len > 0) {
+		(*n_commands)++;
+
+		success = arv_device_write_registers (priv->device, (guint64 *) addresses->data,
+						      (guint32 *) values->data, addresses->len, error);
+	}
+
+	g_free (buffer);
+	g_array_unref (values);
+	g_array_unref (addresses);
+	g_ptr_array_unref (writes);
+
+	return success;
+}
+
+static void
+_append_group_names (GString *string, GArray *groups, guint min_level, guint max_level)
+{
+	gboolean is_empty = TRUE;
+	guint i;
+
+	for (i = 0; i < groups->len; i++) {
+		ArvGcTransactionGroup *group = &g_array_index (groups, ArvGcTransactionGroup, i);
+
+		if (group->level < min_level || group->level > max_level)
+			continue;
+
+		g_string_append_printf (string, "%s%s", is_empty ? "" : " ",
+					group->feature != NULL ? arv_gc_feature_node_get_name (group->feature) :
+					"<register>");
+		is_empty = FALSE;
+	}
+
+	if (is_empty)
+		g_string_append (string, "none");
+}
+
+/**
+ * arv_gc_commit_transaction:
+ * @genicam: a #ArvGc object
+ * @error: a #GError placeholder
+ *
+ * Sends the writes staged since [method@Aravis.Gc.begin_transaction] to the device, and closes the transaction. The
+ * writes are ordered by dependency, and the independent ones are sent together, using a memory write command for each
+ * set of contiguous registers, and a single batch for the registers needing a register write command.
+ *
+ * On failure, the message of @error lists the features which were applied, the ones which may have been partially
+ * applied, and the ones which were not applied, which allows the caller to restore a known device state. The register
+ * caches of all the staged registers are discarded.
+ *
+ * Returns: %TRUE on success.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_gc_commit_transaction (ArvGc *genicam, GError **error)
+{
+	ArvGcPrivate *priv;
+	GError *local_error = NULL;
+	guint64 block_size_max;
+	guint n_commands = 0;
+	guint n_levels;
+	guint level;
+
+	g_return_val_if_fail (ARV_IS_GC (genicam), FALSE);
+	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
+
+	priv = genicam->priv;
+
+	if (priv->staged_writes == NULL) {
+		g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_TRANSACTION, "No open transaction");
+		return FALSE;
+	}
+
+	n_levels = _schedule_transaction (genicam);
+	block_size_max = _get_prefetch_block_size_max (priv->device);
+
+	for (level = 0; level < n_levels; level++) {
+		if (!_commit_level (genicam, level, block_size_max, &n_commands, &local_error))
+			break;
+	}
+
+	if (level < n_levels) {
+		GString *report = g_string_new (NULL);
+
+		if (local_error == NULL)
+			local_error = g_error_new (ARV_GC_ERROR, ARV_GC_ERROR_TRANSACTION, "Write error");
+
+		g_string_append_printf (report, "%s (applied: ", local_error->message);
+		if (level > 0)
+			_append_group_names (report, priv->transaction_groups, 0, level - 1);
+		else
+			g_string_append (report, "none");
+		g_string_append (report, ", partially applied: ");
+		_append_group_names (report, priv->transaction_groups, level, level);
+		g_string_append (report, ", not applied: ");
+		_append_group_names (report, priv->transaction_groups, level + 1, G_MAXUINT);
+		g_string_append (report, ")");
+
+		arv_warning_genicam ("[Gc::commit_transaction] %s", report->str);
+
+		g_set_error_literal (error, local_error->domain, local_error->code, report->str);
+
+		g_string_free (report, TRUE);
+		g_clear_error (&local_error);
+
+		_end_transaction (genicam, TRUE);
+
+		return FALSE;
+	}
+
+	arv_info_genicam ("[Gc::commit_transaction] %u write(s) in %u group(s), %u level(s), %u command(s)",
+			  priv->staged_writes->len, priv->transaction_groups->len, n_levels, n_commands);
+
+	_end_transaction (genicam, FALSE);
+
+	return TRUE;
+}
+
 void
 arv_gc_set_register_cache_policy (ArvGc *genicam, ArvRegisterCachePolicy policy)
 {
 	g_return_if_fail (ARV_IS_GC (genicam));
 
+	/* The node values cached under the previous policy can't be trusted anymore */
+	if (policy != genicam->priv->cache_policy)
+		genicam->priv->value_cache_generation++;
+
 	genicam->priv->cache_policy = policy;
 }
 
@@ -463,6 +1379,202 @@ arv_gc_register_cache_error_add (ArvGc *genicam, guint64 n_errors)
         return genicam->priv->n_register_cache_errors;
 }
 
+guint
+arv_gc_get_link_generation (ArvGc *genicam)
+{
+	g_return_val_if_fail (ARV_IS_GC (genicam), 0);
+
+	return genicam->priv->link_generation;
+}
+
+/*
+ * arv_gc_get_value_cache_generation:
+ * @genicam: a #ArvGc object
+ *
+ * Returns: the current generation of the node value caches, or 0 if the value caches must not be used, either because
+ * the register cache is not enabled, or because the node dependency graph is outdated.
+ */
+
+guint
+arv_gc_get_value_cache_generation (ArvGc *genicam)
+{
+	g_return_val_if_fail (ARV_IS_GC (genicam), 0);
+
+	if (genicam->priv->cache_policy != ARV_REGISTER_CACHE_POLICY_ENABLE ||
+	    genicam->priv->dependency_link_generation != genicam->priv->link_generation)
+		return 0;
+
+	return genicam->priv->value_cache_generation;
+}
+
+guint
+arv_gc_new_invalidation_serial (ArvGc *genicam)
+{
+	g_return_val_if_fail (ARV_IS_GC (genicam), 0);
+
+	genicam->priv->invalidation_serial++;
+	if (genicam->priv->invalidation_serial == 0)
+		genicam->priv->invalidation_serial++;
+
+	return genicam->priv->invalidation_serial;
+}
+
+static void
+_link_node (ArvGc *genicam, ArvDomNode *node)
+{
+	ArvDomNode *iter;
+
+	if (ARV_IS_GC_PROPERTY_NODE (node)) {
+		arv_gc_property_node_link (ARV_GC_PROPERTY_NODE (node), genicam);
+		return;
+	}
+
+	for (iter = arv_dom_node_get_first_child (node); iter != NULL; iter = arv_dom_node_get_next_sibling (iter))
+		_link_node (genicam, iter);
+}
+
+/*
+ * arv_gc_link:
+ * @genicam: a #ArvGc object
+ *
+ * Resolves the node references of all the property nodes of the document, and parses their constant values, in
+ * order to avoid node table lookups and string conversions during the feature accesses.
+ */
+
+/* Only the properties which contribute to the node value are dependencies. The port is not, as any register write
+ * increments its change count. */
+
+static gboolean
+_is_value_dependency (ArvGcPropertyNodeType type)
+{
+	switch (type) {
+		case ARV_GC_PROPERTY_NODE_TYPE_P_VALUE:
+		case ARV_GC_PROPERTY_NODE_TYPE_P_ADDRESS:
+		case ARV_GC_PROPERTY_NODE_TYPE_P_INDEX:
+		case ARV_GC_PROPERTY_NODE_TYPE_P_LENGTH:
+		case ARV_GC_PROPERTY_NODE_TYPE_P_VARIABLE:
+		case ARV_GC_PROPERTY_NODE_TYPE_P_INVALIDATOR:
+		case ARV_GC_PROPERTY_NODE_TYPE_P_VALUE_INDEXED:
+		case ARV_GC_PROPERTY_NODE_TYPE_P_VALUE_DEFAULT:
+			return TRUE;
+		default:
+			return FALSE;
+	}
+}
+
+static gboolean
+_is_value_cachable (ArvGcFeatureNode *node)
+{
+	if (ARV_IS_GC_REGISTER_NODE (node))
+		return arv_gc_register_node_is_value_cachable (ARV_GC_REGISTER_NODE (node));
+
+	return (ARV_IS_GC_SWISS_KNIFE (node) ||
+		ARV_IS_GC_CONVERTER (node) ||
+		ARV_IS_GC_INTEGER_NODE (node) ||
+		ARV_IS_GC_FLOAT_NODE (node) ||
+		ARV_IS_GC_ENUMERATION (node) ||
+		ARV_IS_GC_ENUM_ENTRY (node) ||
+		ARV_IS_GC_BOOLEAN (node) ||
+		ARV_IS_GC_STRING_NODE (node));
+}
+
+static void
+_link_dependencies (ArvGc *genicam, ArvDomNode *node)
+{
+	ArvDomNode *iter;
+
+	for (iter = arv_dom_node_get_first_child (node); iter != NULL; iter = arv_dom_node_get_next_sibling (iter)) {
+		ArvGcNode *input = NULL;
+
+		if (ARV_IS_GC_FEATURE_NODE (node)) {
+			if (ARV_IS_GC_PROPERTY_NODE (iter) &&
+			    _is_value_dependency (arv_gc_property_node_get_node_type (ARV_GC_PROPERTY_NODE (iter)))) {
+				input = arv_gc_property_node_get_linked_node (ARV_GC_PROPERTY_NODE (iter));
+
+				if (ARV_IS_GC_INDEX_NODE (iter)) {
+					ArvGcNode *offset = arv_gc_index_node_get_offset_node (ARV_GC_INDEX_NODE (iter));
+
+					if (ARV_IS_GC_FEATURE_NODE (offset))
+						arv_gc_feature_node_add_dependent (ARV_GC_FEATURE_NODE (offset),
+										   ARV_GC_FEATURE_NODE (node), genicam);
+				}
+			} else if (ARV_IS_GC_FEATURE_NODE (iter) && _is_value_cachable (ARV_GC_FEATURE_NODE (node)))
+				/* Anonymous nodes, like the SwissKnife computing a register address */
+				input = ARV_GC_NODE (iter);
+		}
+
+		if (ARV_IS_GC_FEATURE_NODE (input))
+			arv_gc_feature_node_add_dependent (ARV_GC_FEATURE_NODE (input), ARV_GC_FEATURE_NODE (node),
+							   genicam);
+
+		if (!ARV_IS_GC_PROPERTY_NODE (iter))
+			_link_dependencies (genicam, iter);
+	}
+}
+
+static void
+_link_value_caches (ArvGc *genicam, ArvDomNode *node)
+{
+	ArvDomNode *iter;
+
+	if (ARV_IS_GC_FEATURE_NODE (node))
+		arv_gc_feature_node_set_value_cachable (ARV_GC_FEATURE_NODE (node), genicam, TRUE);
+
+	for (iter = arv_dom_node_get_first_child (node); iter != NULL; iter = arv_dom_node_get_next_sibling (iter))
+		if (!ARV_IS_GC_PROPERTY_NODE (iter))
+			_link_value_caches (genicam, iter);
+}
+
+static void
+_unlink_value_caches (ArvGc *genicam, ArvDomNode *node)
+{
+	ArvDomNode *iter;
+
+	/* Disabling the value cache of a node also disables it for all its dependents */
+	if (ARV_IS_GC_FEATURE_NODE (node) && !_is_value_cachable (ARV_GC_FEATURE_NODE (node)))
+		arv_gc_feature_node_set_value_cachable (ARV_GC_FEATURE_NODE (node), genicam, FALSE);
+
+	for (iter = arv_dom_node_get_first_child (node); iter != NULL; iter = arv_dom_node_get_next_sibling (iter))
+		if (!ARV_IS_GC_PROPERTY_NODE (iter))
+			_unlink_value_caches (genicam, iter);
+}
+
+static void
+_link_enumerations (ArvGc *genicam, ArvDomNode *node)
+{
+	ArvDomNode *iter;
+
+	if (ARV_IS_GC_ENUMERATION (node)) {
+		arv_gc_enumeration_link (ARV_GC_ENUMERATION (node));
+		return;
+	}
+
+	for (iter = arv_dom_node_get_first_child (node); iter != NULL; iter = arv_dom_node_get_next_sibling (iter))
+		if (!ARV_IS_GC_PROPERTY_NODE (iter))
+			_link_enumerations (genicam, iter);
+}
+
+static void
+arv_gc_link (ArvGc *genicam)
+{
+	gint64 start_time = g_get_monotonic_time ();
+
+	_link_node (genicam, ARV_DOM_NODE (genicam));
+
+	/* Dependency graph, used for the propagation of the value changes to the computed nodes, which can then cache
+	 * their value as long as none of their inputs bypasses the register cache. */
+	_link_dependencies (genicam, ARV_DOM_NODE (genicam));
+	_link_value_caches (genicam, ARV_DOM_NODE (genicam));
+	_unlink_value_caches (genicam, ARV_DOM_NODE (genicam));
+	genicam->priv->dependency_link_generation = genicam->priv->link_generation;
+
+	/* Entry lookup tables, built once the availability inputs know whether their value can be cached */
+	_link_enumerations (genicam, ARV_DOM_NODE (genicam));
+
+	arv_debug_genicam ("[Gc::link] Link phase done in %" G_GINT64_FORMAT " us",
+			   g_get_monotonic_time () - start_time);
+}
+
 ArvGc *
 arv_gc_new (ArvDevice *device, const void *xml, size_t size)
 {
@@ -479,6 +1591,8 @@ arv_gc_new (ArvDevice *device, const void *xml, size_t size)
 	genicam = ARV_GC (document);
 	genicam->priv->device = device;
 
+	arv_gc_link (genicam);
+
 	return genicam;
 }
 
@@ -491,6 +1605,10 @@ arv_gc_init (ArvGc *genicam)
 
 	genicam->priv->nodes = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, g_object_unref);
 	genicam->priv->cache_policy = ARV_REGISTER_CACHE_POLICY_DISABLE;
+	genicam->priv->link_generation = 1;
+	genicam->priv->dependency_link_generation = 0;
+	genicam->priv->value_cache_generation = 1;
+	genicam->priv->invalidation_serial = 0;
 }
 
 static void
@@ -501,6 +1619,9 @@ arv_gc_finalize (GObject *object)
 	if (genicam->priv->buffer != NULL)
 		g_object_weak_unref (G_OBJECT (genicam->priv->buffer), _weak_notify_cb, genicam);
 
+	g_clear_pointer (&genicam->priv->staged_writes, g_array_unref);
+	g_clear_pointer (&genicam->priv->transaction_groups, g_array_unref);
+
 	g_hash_table_unref (genicam->priv->nodes);
 
 	G_OBJECT_CLASS (arv_gc_parent_class)->finalize (object);
@@ -516,4 +1637,5 @@ arv_gc_class_init (ArvGcClass *node_class)
 	object_class->finalize = arv_gc_finalize;
 	d_node_class->can_append_child = arv_gc_can_append_child;
 	d_document_class->create_element = arv_gc_create_element;
+	d_document_class->append_text = arv_gc_append_text;
 }
@@ -52,7 +52,8 @@ typedef enum {
 	ARV_GC_ERROR_SET_FROM_STRING_UNDEFINED,
 	ARV_GC_ERROR_GET_AS_STRING_UNDEFINED,
 	ARV_GC_ERROR_INVALID_BIT_RANGE,
-        ARV_GC_ERROR_INVALID_SYNTAX
+        ARV_GC_ERROR_INVALID_SYNTAX,
+	ARV_GC_ERROR_TRANSACTION
 } ArvGcError;
 
 /**
@@ -118,6 +119,11 @@ ARV_API ArvAccessCheckPolicy            arv_gc_get_access_check_policy
 ARV_API void				arv_gc_set_default_node_data		(ArvGc *genicam, const char *node_name, ...)
                                                                                 G_GNUC_NULL_TERMINATED;
 ARV_API ArvGcNode *			arv_gc_get_node				(ArvGc *genicam, const char *name);
+ARV_API gboolean			arv_gc_prefetch_features		(ArvGc *genicam, const char **features,
+										 GError **error);
+ARV_API gboolean			arv_gc_begin_transaction		(ArvGc *genicam, GError **error);
+ARV_API gboolean			arv_gc_commit_transaction		(ArvGc *genicam, GError **error);
+ARV_API void				arv_gc_abort_transaction		(ArvGc *genicam);
 ARV_API ArvDevice *			arv_gc_get_device			(ArvGc *genicam);
 ARV_API void				arv_gc_set_buffer			(ArvGc *genicam, ArvBuffer *buffer);
 ARV_API ArvBuffer *			arv_gc_get_buffer			(ArvGc *genicam);
@@ -27,7 +27,7 @@
 
 #include <arvgcfeaturenodeprivate.h>
 #include <arvgcconverterprivate.h>
-#include <arvevaluator.h>
+#include <arvevaluatorprivate.h>
 #include <arvgcinteger.h>
 #include <arvgcfloat.h>
 #include <arvgcdefaultsprivate.h>
@@ -52,6 +52,14 @@ typedef struct {
 
 	ArvEvaluator *formula_to;
 	ArvEvaluator *formula_from;
+	gboolean is_formula_to_set;
+	gboolean is_formula_from_set;
+
+	/* Evaluator slots of the variables */
+	guint *formula_to_variable_slots;
+	guint *formula_from_variable_slots;
+	guint from_slot;
+	guint to_slot;
 } ArvGcConverterPrivate;
 
 G_DEFINE_ABSTRACT_TYPE_WITH_CODE (ArvGcConverter, arv_gc_converter, ARV_TYPE_GC_FEATURE_NODE,
@@ -70,21 +78,31 @@ arv_gc_converter_post_new_child (ArvDomNode *self, ArvDomNode *child)
 		switch (arv_gc_property_node_get_node_type (property_node)) {
 			case ARV_GC_PROPERTY_NODE_TYPE_P_VARIABLE:
 				priv->variables = g_slist_prepend (priv->variables, property_node);
+				priv->is_formula_to_set = FALSE;
+				priv->is_formula_from_set = FALSE;
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_P_VALUE:
 				priv->value = property_node;
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_FORMULA_TO:
 				priv->formula_to_node = property_node;
+				priv->is_formula_to_set = FALSE;
+				priv->is_formula_from_set = FALSE;
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_FORMULA_FROM:
 				priv->formula_from_node = property_node;
+				priv->is_formula_to_set = FALSE;
+				priv->is_formula_from_set = FALSE;
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_EXPRESSION:
 				priv->expressions = g_slist_prepend (priv->expressions, property_node);
+				priv->is_formula_to_set = FALSE;
+				priv->is_formula_from_set = FALSE;
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_CONSTANT:
 				priv->constants = g_slist_prepend (priv->constants, property_node);
+				priv->is_formula_to_set = FALSE;
+				priv->is_formula_from_set = FALSE;
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_UNIT:
 				priv->unit = property_node;
@@ -127,6 +145,9 @@ arv_gc_converter_init (ArvGcConverter *self)
 	priv->formula_to = arv_evaluator_new (NULL);
 	priv->formula_from = arv_evaluator_new (NULL);
 	priv->value = NULL;
+
+	priv->from_slot = arv_evaluator_get_variable_slot (priv->formula_to, "FROM");
+	priv->to_slot = arv_evaluator_get_variable_slot (priv->formula_from, "TO");
 }
 
 static ArvGcFeatureNode *
@@ -153,6 +174,8 @@ arv_gc_converter_finalize (GObject *object)
 	g_slist_free (priv->variables);
 	g_slist_free (priv->expressions);
 	g_slist_free (priv->constants);
+	g_free (priv->formula_to_variable_slots);
+	g_free (priv->formula_from_variable_slots);
 
 	g_object_unref (priv->formula_to);
 	g_object_unref (priv->formula_from);
@@ -207,50 +230,65 @@ arv_gc_converter_update_from_variables (ArvGcConverter *gc_converter, ArvGcConve
 	GError *local_error = NULL;
 	GSList *iter;
 	const char *expression;
+	guint i;
 
-	if (priv->formula_from_node != NULL)
-		expression = arv_gc_property_node_get_string (priv->formula_from_node, &local_error);
-	else
-		expression = "";
-
-	if (local_error != NULL) {
-                g_propagate_error (error, local_error);
-		return FALSE;
-	}
-
-	arv_evaluator_set_expression (priv->formula_from, expression);
+	/* The formula, the sub-expressions and the constants are literal values, they are set only once in the
+	 * evaluator. */
 
-	for (iter = priv->expressions; iter != NULL; iter = iter->next) {
-		const char *expression;
-		const char *name;
+	if (!priv->is_formula_from_set) {
+		if (priv->formula_from_node != NULL)
+			expression = arv_gc_property_node_get_string (priv->formula_from_node, &local_error);
+		else
+			expression = "";
 
-		expression = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
 		if (local_error != NULL) {
                         g_propagate_error (error, local_error);
-                        return FALSE;
-                }
+			return FALSE;
+		}
 
-		name = arv_gc_property_node_get_name (iter->data);
+		arv_evaluator_set_expression (priv->formula_from, expression);
 
-		arv_evaluator_set_sub_expression (priv->formula_from, name, expression);
-	}
+		for (iter = priv->expressions; iter != NULL; iter = iter->next) {
+			const char *expression;
+			const char *name;
+
+			expression = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
+			if (local_error != NULL) {
+                                g_propagate_error (error, local_error);
+                                return FALSE;
+                        }
 
-	for (iter = priv->constants; iter != NULL; iter = iter->next) {
-		const char *constant;
-		const char *name;
+			name = arv_gc_property_node_get_name (iter->data);
 
-		constant = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
-		if (local_error != NULL) {
-                        g_propagate_error (error, local_error);
-			return FALSE;
+			arv_evaluator_set_sub_expression (priv->formula_from, name, expression);
 		}
 
-		name = arv_gc_property_node_get_name (iter->data);
+		for (iter = priv->constants; iter != NULL; iter = iter->next) {
+			const char *constant;
+			const char *name;
+
+			constant = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
+			if (local_error != NULL) {
+                                g_propagate_error (error, local_error);
+				return FALSE;
+			}
+
+			name = arv_gc_property_node_get_name (iter->data);
+
+			arv_evaluator_set_constant (priv->formula_from, name, constant);
+		}
 
-		arv_evaluator_set_constant (priv->formula_from, name, constant);
+		g_free (priv->formula_from_variable_slots);
+		priv->formula_from_variable_slots = g_new (guint, g_slist_length (priv->variables));
+		for (iter = priv->variables, i = 0; iter != NULL; iter = iter->next, i++)
+			priv->formula_from_variable_slots[i] =
+				arv_evaluator_get_variable_slot (priv->formula_from,
+								 arv_gc_property_node_get_name (iter->data));
+
+		priv->is_formula_from_set = TRUE;
 	}
 
-	for (iter = priv->variables; iter != NULL; iter = iter->next) {
+	for (iter = priv->variables, i = 0; iter != NULL; iter = iter->next, i++) {
 		ArvGcPropertyNode *variable_node = iter->data;
 
 		node = arv_gc_property_node_get_linked_node (ARV_GC_PROPERTY_NODE (variable_node));
@@ -264,9 +302,8 @@ arv_gc_converter_update_from_variables (ArvGcConverter *gc_converter, ArvGcConve
                                 return FALSE;
                         }
 
-			arv_evaluator_set_int64_variable (priv->formula_from,
-							  arv_gc_property_node_get_name (variable_node),
-							  value);
+			arv_evaluator_set_int64_variable_by_slot (priv->formula_from,
+								  priv->formula_from_variable_slots[i], value);
 		} else if (ARV_IS_GC_FLOAT (node)) {
 			double value;
 
@@ -277,9 +314,8 @@ arv_gc_converter_update_from_variables (ArvGcConverter *gc_converter, ArvGcConve
 				return FALSE;
 			}
 
-			arv_evaluator_set_double_variable (priv->formula_from,
-							  arv_gc_property_node_get_name (variable_node),
-							  value);
+			arv_evaluator_set_double_variable_by_slot (priv->formula_from,
+								   priv->formula_from_variable_slots[i], value);
 		}
 	}
 
@@ -315,7 +351,7 @@ arv_gc_converter_update_from_variables (ArvGcConverter *gc_converter, ArvGcConve
 				return FALSE;
 			}
 
-			arv_evaluator_set_int64_variable (priv->formula_from, "TO", value);
+			arv_evaluator_set_int64_variable_by_slot (priv->formula_from, priv->to_slot, value);
 		} else if (ARV_IS_GC_FLOAT (node)) {
 			double value;
 
@@ -348,7 +384,7 @@ arv_gc_converter_update_from_variables (ArvGcConverter *gc_converter, ArvGcConve
                                 return FALSE;
                         }
 
-			arv_evaluator_set_double_variable (priv->formula_from, "TO", value);
+			arv_evaluator_set_double_variable_by_slot (priv->formula_from, priv->to_slot, value);
 		} else {
 			arv_warning_genicam ("[GcConverter::set_value] Invalid pValue node '%s'",
 					     arv_gc_property_node_get_string (priv->value, NULL));
@@ -375,6 +411,10 @@ arv_gc_converter_convert_to_double (ArvGcConverter *gc_converter, ArvGcConverter
 
 	g_return_val_if_fail (ARV_IS_GC_CONVERTER (gc_converter), 0.0);
 
+	if (node_type == ARV_GC_CONVERTER_NODE_TYPE_VALUE &&
+	    arv_gc_feature_node_get_cached_double (ARV_GC_FEATURE_NODE (gc_converter), &value))
+		return value;
+
 	if (!arv_gc_converter_update_from_variables (gc_converter, node_type, &local_error)) {
 		if (local_error != NULL)
                         g_propagate_prefixed_error (error, local_error, "[%s] ",
@@ -395,6 +435,8 @@ arv_gc_converter_convert_to_double (ArvGcConverter *gc_converter, ArvGcConverter
         if (local_error != NULL)
                 g_propagate_prefixed_error (error, local_error, "[%s] ",
                                             arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (gc_converter)));
+	else if (node_type == ARV_GC_CONVERTER_NODE_TYPE_VALUE)
+		arv_gc_feature_node_set_cached_double (ARV_GC_FEATURE_NODE (gc_converter), value);
 
         return value;
 }
@@ -408,6 +450,10 @@ arv_gc_converter_convert_to_int64 (ArvGcConverter *gc_converter, ArvGcConverterN
 
 	g_return_val_if_fail (ARV_IS_GC_CONVERTER (gc_converter), 0);
 
+	if (node_type == ARV_GC_CONVERTER_NODE_TYPE_VALUE &&
+	    arv_gc_feature_node_get_cached_int64 (ARV_GC_FEATURE_NODE (gc_converter), &value))
+		return value;
+
 	if (!arv_gc_converter_update_from_variables (gc_converter, node_type, &local_error)) {
 		if (local_error != NULL)
                         g_propagate_prefixed_error (error, local_error, "[%s] ",
@@ -428,6 +474,8 @@ arv_gc_converter_convert_to_int64 (ArvGcConverter *gc_converter, ArvGcConverterN
         if (local_error != NULL)
                 g_propagate_prefixed_error (error, local_error, "[%s] ",
                                             arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (gc_converter)));
+	else if (node_type == ARV_GC_CONVERTER_NODE_TYPE_VALUE)
+		arv_gc_feature_node_set_cached_int64 (ARV_GC_FEATURE_NODE (gc_converter), value);
 
         return value;
 }
@@ -440,50 +488,62 @@ arv_gc_converter_update_to_variables (ArvGcConverter *gc_converter, GError **err
 	GError *local_error = NULL;
 	GSList *iter;
 	const char *expression;
+	guint i;
 
-	if (priv->formula_to_node != NULL)
-		expression = arv_gc_property_node_get_string (priv->formula_to_node, &local_error);
-	else
-		expression = "";
+	if (!priv->is_formula_to_set) {
+		if (priv->formula_to_node != NULL)
+			expression = arv_gc_property_node_get_string (priv->formula_to_node, &local_error);
+		else
+			expression = "";
 
-	if (local_error != NULL) {
-                g_propagate_error (error, local_error);
-		return;
-	}
+		if (local_error != NULL) {
+                        g_propagate_error (error, local_error);
+			return;
+		}
 
-	arv_evaluator_set_expression (priv->formula_to, expression);
+		arv_evaluator_set_expression (priv->formula_to, expression);
 
-	for (iter = priv->expressions; iter != NULL; iter = iter->next) {
-		const char *expression;
-		const char *name;
+		for (iter = priv->expressions; iter != NULL; iter = iter->next) {
+			const char *expression;
+			const char *name;
 
-		expression = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
-		if (local_error != NULL) {
-			g_propagate_error (error, local_error);
-			return;
+			expression = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
+			if (local_error != NULL) {
+				g_propagate_error (error, local_error);
+				return;
+			}
+
+			name = arv_gc_property_node_get_name (iter->data);
+
+			arv_evaluator_set_sub_expression (priv->formula_to, name, expression);
 		}
 
-		name = arv_gc_property_node_get_name (iter->data);
+		for (iter = priv->constants; iter != NULL; iter = iter->next) {
+			const char *constant;
+			const char *name;
 
-		arv_evaluator_set_sub_expression (priv->formula_to, name, expression);
-	}
+			constant = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
+			if (local_error != NULL) {
+				g_propagate_error (error, local_error);
+				return;
+			}
 
-	for (iter = priv->constants; iter != NULL; iter = iter->next) {
-		const char *constant;
-		const char *name;
+			name = arv_gc_property_node_get_name (iter->data);
 
-		constant = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
-		if (local_error != NULL) {
-			g_propagate_error (error, local_error);
-			return;
+			arv_evaluator_set_constant (priv->formula_to, name, constant);
 		}
 
-		name = arv_gc_property_node_get_name (iter->data);
+		g_free (priv->formula_to_variable_slots);
+		priv->formula_to_variable_slots = g_new (guint, g_slist_length (priv->variables));
+		for (iter = priv->variables, i = 0; iter != NULL; iter = iter->next, i++)
+			priv->formula_to_variable_slots[i] =
+				arv_evaluator_get_variable_slot (priv->formula_to,
+								 arv_gc_property_node_get_name (iter->data));
 
-		arv_evaluator_set_constant (priv->formula_to, name, constant);
+		priv->is_formula_to_set = TRUE;
 	}
 
-	for (iter = priv->variables; iter != NULL; iter = iter->next) {
+	for (iter = priv->variables, i = 0; iter != NULL; iter = iter->next, i++) {
 		ArvGcPropertyNode *variable_node = iter->data;
 
 		node = arv_gc_property_node_get_linked_node (ARV_GC_PROPERTY_NODE (variable_node));
@@ -497,9 +557,8 @@ arv_gc_converter_update_to_variables (ArvGcConverter *gc_converter, GError **err
 				return;
 			}
 
-			arv_evaluator_set_int64_variable (priv->formula_to,
-							  arv_gc_property_node_get_name (variable_node),
-							  value);
+			arv_evaluator_set_int64_variable_by_slot (priv->formula_to,
+								  priv->formula_to_variable_slots[i], value);
 		} else if (ARV_IS_GC_FLOAT (node)) {
 			double value;
 
@@ -510,9 +569,8 @@ arv_gc_converter_update_to_variables (ArvGcConverter *gc_converter, GError **err
 				return;
 			}
 
-			arv_evaluator_set_double_variable (priv->formula_to,
-							   arv_gc_property_node_get_name (variable_node),
-							   value);
+			arv_evaluator_set_double_variable_by_slot (priv->formula_to,
+								   priv->formula_to_variable_slots[i], value);
 		}
 	}
 
@@ -552,7 +610,7 @@ arv_gc_converter_convert_from_double (ArvGcConverter *gc_converter, double value
 	g_return_if_fail (ARV_IS_GC_CONVERTER (gc_converter));
 
 	arv_gc_feature_node_increment_change_count (ARV_GC_FEATURE_NODE (gc_converter));
-	arv_evaluator_set_double_variable (priv->formula_to, "FROM", value);
+	arv_evaluator_set_double_variable_by_slot (priv->formula_to, priv->from_slot, value);
 	arv_gc_converter_update_to_variables (gc_converter, &local_error);
 
         if (local_error != NULL)
@@ -569,7 +627,7 @@ arv_gc_converter_convert_from_int64 (ArvGcConverter *gc_converter, gint64 value,
 	g_return_if_fail (ARV_IS_GC_CONVERTER (gc_converter));
 
 	arv_gc_feature_node_increment_change_count (ARV_GC_FEATURE_NODE (gc_converter));
-	arv_evaluator_set_int64_variable (priv->formula_to, "FROM", value);
+	arv_evaluator_set_int64_variable_by_slot (priv->formula_to, priv->from_slot, value);
 	arv_gc_converter_update_to_variables (gc_converter, &local_error);
 
         if (local_error != NULL)
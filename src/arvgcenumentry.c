@@ -25,7 +25,7 @@
  * @short_description: Class for EnumEntry nodes
  */
 
-#include <arvgcenumentry.h>
+#include <arvgcenumentryprivate.h>
 #include <arvgc.h>
 #include <string.h>
 
@@ -102,6 +102,23 @@ arv_gc_enum_entry_get_value (ArvGcEnumEntry *entry, GError **error)
 	return value;
 }
 
+/*
+ * arv_gc_enum_entry_is_value_constant:
+ * @entry: a #ArvGcEnumEntry
+ *
+ * Returns: %TRUE if the entry value is given by a <Value> element, and can not change during the document
+ * lifetime.
+ */
+
+gboolean
+arv_gc_enum_entry_is_value_constant (ArvGcEnumEntry *entry)
+{
+	g_return_val_if_fail (ARV_IS_GC_ENUM_ENTRY (entry), FALSE);
+
+	return entry->value == NULL ||
+		arv_gc_property_node_get_node_type (entry->value) == ARV_GC_PROPERTY_NODE_TYPE_VALUE;
+}
+
 ArvGcNode *
 arv_gc_enum_entry_new (void)
 {
@@ -25,13 +25,13 @@
  * @short_description: Class for Enumeration nodes
  */
 
-#include <arvgcenumeration.h>
-#include <arvgcenumentry.h>
+#include <arvgcenumerationprivate.h>
+#include <arvgcenumentryprivate.h>
 #include <arvgcinteger.h>
 #include <arvgcselector.h>
 #include <arvgcstring.h>
 #include <arvgcfeaturenodeprivate.h>
-#include <arvgc.h>
+#include <arvgcprivate.h>
 #include <arvmisc.h>
 #include <arvdebugprivate.h>
 #include <string.h>
@@ -44,6 +44,20 @@ struct _ArvGcEnumeration {
 
 	GSList *selecteds;		/* #ArvGcPropertyNode */
 	GSList *selected_features;	/* #ArvGcFeatureNode */
+
+	/* Lookup tables, see arv_gc_enumeration_link() */
+	guint link_generation;
+	GPtrArray *entry_array;		/* #ArvGcEnumEntry, in document order */
+	gint64 *entry_values;
+	GHashTable *entries_by_name;	/* entry name -> index + 1 */
+	GHashTable *entries_by_value;	/* entry value -> index + 1, NULL if an entry value is not constant */
+
+	/* Entry availability bitmap, memoized until one of the pIsAvailable or pIsImplemented inputs changes */
+	GPtrArray *availability_inputs;	/* #ArvGcFeatureNode, NULL if the availability can't be cached */
+	guint32 *available_entries;
+	guint n_available_entries;
+	guint64 availability_change_count;
+	guint availability_generation;
 };
 
 struct _ArvGcEnumerationClass {
@@ -59,6 +73,8 @@ G_DEFINE_TYPE_WITH_CODE (ArvGcEnumeration, arv_gc_enumeration, ARV_TYPE_GC_FEATU
 			 G_IMPLEMENT_INTERFACE (ARV_TYPE_GC_STRING, arv_gc_enumeration_string_interface_init)
 			 G_IMPLEMENT_INTERFACE (ARV_TYPE_GC_SELECTOR, arv_gc_enumeration_selector_interface_init))
 
+static void _reset_lookup_tables (ArvGcEnumeration *enumeration);
+
 /* ArvGcDomNode implementation */
 
 static const char *
@@ -88,13 +104,16 @@ arv_gc_enumeration_post_new_child (ArvDomNode *self, ArvDomNode *child)
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_P_SELECTED:
 				node->selecteds = g_slist_prepend (node->selecteds, property_node);
+				_reset_lookup_tables (node);
 				break;
 			default:
 				ARV_DOM_NODE_CLASS (arv_gc_enumeration_parent_class)->post_new_child (self, child);
 				break;
 		}
-	} else if (ARV_IS_GC_ENUM_ENTRY (child))
+	} else if (ARV_IS_GC_ENUM_ENTRY (child)) {
 		node->entries = g_slist_prepend (node->entries, child);
+		_reset_lookup_tables (node);
+	}
 }
 
 static void
@@ -105,6 +124,259 @@ arv_gc_enumeration_pre_remove_child (ArvDomNode *self, ArvDomNode *child)
 
 /* ArvGcEnumeration implementation */
 
+static void
+_reset_lookup_tables (ArvGcEnumeration *enumeration)
+{
+	enumeration->link_generation = 0;
+	enumeration->availability_generation = 0;
+	enumeration->n_available_entries = 0;
+
+	g_clear_pointer (&enumeration->entry_array, g_ptr_array_unref);
+	g_clear_pointer (&enumeration->entry_values, g_free);
+	g_clear_pointer (&enumeration->entries_by_name, g_hash_table_unref);
+	g_clear_pointer (&enumeration->entries_by_value, g_hash_table_unref);
+	g_clear_pointer (&enumeration->availability_inputs, g_ptr_array_unref);
+	g_clear_pointer (&enumeration->available_entries, g_free);
+	g_clear_pointer (&enumeration->selected_features, g_slist_free);
+}
+
+static guint
+_get_link_generation (ArvGcEnumeration *enumeration)
+{
+	ArvGc *genicam = arv_gc_node_get_genicam (ARV_GC_NODE (enumeration));
+
+	return ARV_IS_GC (genicam) ? arv_gc_get_link_generation (genicam) : 0;
+}
+
+/*
+ * arv_gc_enumeration_link:
+ * @enumeration: a #ArvGcEnumeration
+ *
+ * Builds the entry lookup tables by name and by value, the list of the selected features, and the list of the nodes
+ * the entry availability depends on. This is done during the link phase of #ArvGc, and again on the next access if
+ * the document node references have changed since.
+ */
+
+void
+arv_gc_enumeration_link (ArvGcEnumeration *enumeration)
+{
+	GHashTable *inputs;
+	GPtrArray *entry_inputs;
+	GSList *iter;
+	gboolean is_value_constant = TRUE;
+	gboolean is_availability_cachable = TRUE;
+	guint n_entries;
+	guint i;
+
+	g_return_if_fail (ARV_IS_GC_ENUMERATION (enumeration));
+
+	_reset_lookup_tables (enumeration);
+
+	n_entries = g_slist_length (enumeration->entries);
+
+	enumeration->entry_array = g_ptr_array_sized_new (n_entries);
+	g_ptr_array_set_size (enumeration->entry_array, n_entries);
+	enumeration->entry_values = g_new0 (gint64, n_entries);
+	enumeration->entries_by_name = g_hash_table_new (g_str_hash, g_str_equal);
+
+	/* The entry list is in reverse document order */
+	for (iter = enumeration->entries, i = n_entries; iter != NULL; iter = iter->next)
+		g_ptr_array_index (enumeration->entry_array, --i) = iter->data;
+
+	inputs = g_hash_table_new (g_direct_hash, g_direct_equal);
+	entry_inputs = g_ptr_array_new ();
+
+	/* When several entries share the same name or value, the last one in document order wins, as it was the first
+	 * one found by the former list lookups */
+	for (i = 0; i < n_entries; i++) {
+		ArvGcEnumEntry *entry = g_ptr_array_index (enumeration->entry_array, i);
+		const char *name = arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (entry));
+		guint j;
+
+		if (name != NULL)
+			g_hash_table_insert (enumeration->entries_by_name, (char *) name, GUINT_TO_POINTER (i + 1));
+
+		if (is_value_constant && arv_gc_enum_entry_is_value_constant (entry)) {
+			GError *error = NULL;
+
+			enumeration->entry_values[i] = arv_gc_enum_entry_get_value (entry, &error);
+			if (error != NULL) {
+				is_value_constant = FALSE;
+				g_clear_error (&error);
+			}
+		} else
+			is_value_constant = FALSE;
+
+		g_ptr_array_set_size (entry_inputs, 0);
+		if (is_availability_cachable &&
+		    arv_gc_feature_node_get_availability_inputs (ARV_GC_FEATURE_NODE (entry), entry_inputs)) {
+			for (j = 0; j < entry_inputs->len; j++)
+				g_hash_table_add (inputs, g_ptr_array_index (entry_inputs, j));
+		} else
+			is_availability_cachable = FALSE;
+	}
+
+	if (is_value_constant) {
+		enumeration->entries_by_value = g_hash_table_new (g_int64_hash, g_int64_equal);
+		for (i = 0; i < n_entries; i++)
+			g_hash_table_insert (enumeration->entries_by_value, &enumeration->entry_values[i],
+					     GUINT_TO_POINTER (i + 1));
+	}
+
+	if (is_availability_cachable) {
+		GHashTableIter hash_iter;
+		gpointer input;
+
+		enumeration->availability_inputs = g_ptr_array_sized_new (g_hash_table_size (inputs));
+		g_hash_table_iter_init (&hash_iter, inputs);
+		while (g_hash_table_iter_next (&hash_iter, &input, NULL))
+			g_ptr_array_add (enumeration->availability_inputs, input);
+	}
+
+	g_ptr_array_unref (entry_inputs);
+	g_hash_table_unref (inputs);
+
+	for (iter = enumeration->selecteds; iter != NULL; iter = iter->next) {
+		ArvGcNode *feature_node = arv_gc_property_node_get_linked_node (iter->data);
+		if (ARV_IS_GC_FEATURE_NODE (feature_node))
+		    enumeration->selected_features = g_slist_prepend (enumeration->selected_features, feature_node);
+	}
+
+	enumeration->link_generation = _get_link_generation (enumeration);
+
+	arv_debug_genicam ("[GcEnumeration::link] %s: %u entries, %s values, %s availability",
+			   arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)), n_entries,
+			   is_value_constant ? "constant" : "computed",
+			   is_availability_cachable ? "cachable" : "uncachable");
+}
+
+static void
+_ensure_lookup_tables (ArvGcEnumeration *enumeration)
+{
+	if (enumeration->entry_array == NULL || enumeration->link_generation != _get_link_generation (enumeration))
+		arv_gc_enumeration_link (enumeration);
+}
+
+static inline gboolean
+_is_entry_available (const guint32 *available_entries, guint index)
+{
+	return (available_entries[index / 32] & (1U << (index % 32))) != 0;
+}
+
+static gint64
+_get_entry_value (ArvGcEnumeration *enumeration, guint index, GError **error)
+{
+	if (enumeration->entries_by_value != NULL)
+		return enumeration->entry_values[index];
+
+	return arv_gc_enum_entry_get_value (g_ptr_array_index (enumeration->entry_array, index), error);
+}
+
+/* Returns the availability bitmap of the entries, indexed like entry_array. Evaluating the pIsAvailable and
+ * pIsImplemented properties of hundreds of entries is costly, so the result is reused as long as the value cache is
+ * enabled and the change counts of the availability inputs are unchanged. */
+
+static const guint32 *
+_get_available_entries (ArvGcEnumeration *enumeration, GError **error)
+{
+	ArvGc *genicam;
+	GError *local_error = NULL;
+	guint64 change_count = 0;
+	guint generation = 0;
+	guint i;
+
+	_ensure_lookup_tables (enumeration);
+
+	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (enumeration));
+
+	if (enumeration->availability_inputs != NULL && ARV_IS_GC (genicam)) {
+		generation = arv_gc_get_value_cache_generation (genicam);
+		if (generation != 0) {
+			/* Change counts only grow, their sum changes if any of them does */
+			for (i = 0; i < enumeration->availability_inputs->len; i++)
+				change_count += arv_gc_feature_node_get_change_count
+					(g_ptr_array_index (enumeration->availability_inputs, i));
+
+			if (enumeration->available_entries != NULL &&
+			    enumeration->availability_generation == generation &&
+			    enumeration->availability_change_count == change_count)
+				return enumeration->available_entries;
+		}
+	}
+
+	enumeration->availability_generation = 0;
+	enumeration->n_available_entries = 0;
+	g_free (enumeration->available_entries);
+	enumeration->available_entries = g_new0 (guint32, enumeration->entry_array->len / 32 + 1);
+
+	for (i = 0; i < enumeration->entry_array->len; i++) {
+		ArvGcFeatureNode *entry = g_ptr_array_index (enumeration->entry_array, i);
+		gboolean is_available;
+
+		is_available = arv_gc_feature_node_is_available (entry, &local_error);
+
+		if (local_error == NULL && is_available)
+			is_available = arv_gc_feature_node_is_implemented (entry, &local_error);
+
+		if (local_error != NULL) {
+			g_propagate_error (error, local_error);
+			g_clear_pointer (&enumeration->available_entries, g_free);
+			enumeration->n_available_entries = 0;
+			return NULL;
+		}
+
+		if (is_available) {
+			enumeration->available_entries[i / 32] |= 1U << (i % 32);
+			enumeration->n_available_entries++;
+		}
+	}
+
+	enumeration->availability_generation = generation;
+	enumeration->availability_change_count = change_count;
+
+	return enumeration->available_entries;
+}
+
+/* Returns the index of the entry matching @value, restricted to the available ones if @available_entries is not NULL,
+ * or -1 */
+
+static int
+_find_entry_by_value (ArvGcEnumeration *enumeration, const guint32 *available_entries, gint64 value, GError **error)
+{
+	GError *local_error = NULL;
+	guint i;
+
+	if (enumeration->entries_by_value != NULL) {
+		guint index = GPOINTER_TO_UINT (g_hash_table_lookup (enumeration->entries_by_value, &value));
+
+		if (index == 0)
+			return -1;
+
+		if (available_entries == NULL || _is_entry_available (available_entries, index - 1))
+			return index - 1;
+	}
+
+	/* Computed entry values, or an unavailable entry sharing its value with another one */
+	for (i = enumeration->entry_array->len; i-- > 0; ) {
+		gint64 entry_value;
+
+		if (available_entries != NULL && !_is_entry_available (available_entries, i))
+			continue;
+
+		entry_value = _get_entry_value (enumeration, i, &local_error);
+
+		if (local_error != NULL) {
+			g_propagate_error (error, local_error);
+			return -1;
+		}
+
+		if (entry_value == value)
+			return i;
+	}
+
+	return -1;
+}
+
 /**
  * arv_gc_enumeration_dup_available_int_values:
  * @enumeration: a #ArvGcEnumeration
@@ -121,9 +393,8 @@ gint64 *
 arv_gc_enumeration_dup_available_int_values (ArvGcEnumeration *enumeration, guint *n_values, GError **error)
 {
 	gint64 *values;
-	const GSList *entries, *iter;
-	GSList *available_entries = NULL;
-	unsigned int i;
+	const guint32 *available_entries;
+	unsigned int i, j;
 	GError *local_error = NULL;
 
 	g_return_val_if_fail (n_values != NULL, NULL);
@@ -133,67 +404,35 @@ arv_gc_enumeration_dup_available_int_values (ArvGcEnumeration *enumeration, guin
 	g_return_val_if_fail (ARV_IS_GC_ENUMERATION (enumeration), NULL);
 	g_return_val_if_fail (error == NULL || *error == NULL, NULL);
 
-	entries = arv_gc_enumeration_get_entries (enumeration);
-
-	*n_values = 0;
-	for (iter = entries; iter != NULL; iter = iter->next) {
-		gboolean is_available;
-
-		is_available = arv_gc_feature_node_is_available (iter->data, &local_error);
-
-		if (local_error != NULL) {
-			g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-			*n_values = 0;
-			g_slist_free (available_entries);
-
-			return NULL;
-		}
-
-		if (is_available) {
-			gboolean is_implemented;
-
-			is_implemented = arv_gc_feature_node_is_implemented (iter->data, &local_error);
-
-			if (local_error != NULL) {
-                                g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-                                *n_values = 0;
-                                g_slist_free (available_entries);
-
-				return NULL;
-			}
+	available_entries = _get_available_entries (enumeration, &local_error);
 
-			if (is_implemented) {
-				(*n_values)++;
-				available_entries = g_slist_prepend (available_entries, iter->data);
-			}
-		}
+	if (local_error != NULL) {
+		g_propagate_prefixed_error (error, local_error, "[%s] ",
+					    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+		return NULL;
 	}
 
-	if (*n_values == 0) {
-		g_slist_free (available_entries);
+	if (enumeration->n_available_entries == 0)
 		return NULL;
-	}
 
-	values = g_new (gint64, *n_values);
-	for (iter = available_entries, i = 0; iter != NULL; iter = iter->next) {
+	values = g_new (gint64, enumeration->n_available_entries);
+	for (i = 0, j = 0; i < enumeration->entry_array->len; i++) {
+		if (!_is_entry_available (available_entries, i))
+			continue;
 
-		values[i] = arv_gc_enum_entry_get_value (iter->data, &local_error);
+		values[j] = _get_entry_value (enumeration, i, &local_error);
 
 		if (local_error != NULL) {
                         g_propagate_prefixed_error (error, local_error, "[%s] ",
                                                     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-                        *n_values = 0;
-                        g_slist_free (available_entries);
                         g_free (values);
 
 			return NULL;
 		}
-		i++;
+		j++;
 	}
 
-	g_slist_free (available_entries);
+	*n_values = j;
 
 	return values;
 }
@@ -202,9 +441,8 @@ static const char **
 _dup_available_string_values (ArvGcEnumeration *enumeration, gboolean display_name ,guint *n_values, GError **error)
 {
 	const char ** strings;
-	const GSList *entries, *iter;
-	GSList *available_entries = NULL;
-	unsigned int i;
+	const guint32 *available_entries;
+	unsigned int i, j;
 	GError *local_error = NULL;
 
 	g_return_val_if_fail (n_values != NULL, NULL);
@@ -214,60 +452,33 @@ _dup_available_string_values (ArvGcEnumeration *enumeration, gboolean display_na
 	g_return_val_if_fail (ARV_IS_GC_ENUMERATION (enumeration), NULL);
 	g_return_val_if_fail (error == NULL || *error == NULL, NULL);
 
-	entries = arv_gc_enumeration_get_entries (enumeration);
-
-	*n_values = 0;
-	for (iter = entries; iter != NULL; iter = iter->next) {
-		gboolean is_available;
-
-		is_available = arv_gc_feature_node_is_available (iter->data, &local_error);
-
-		if (local_error != NULL) {
-                        g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-			*n_values = 0;
-			g_slist_free (available_entries);
-
-			return NULL;
-		}
-
-		if (is_available) {
-			gboolean is_implemented;
-
-			is_implemented = arv_gc_feature_node_is_implemented (iter->data, &local_error);
-
-			if (local_error != NULL) {
-                                g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-                                *n_values = 0;
-                                g_slist_free (available_entries);
-
-				return NULL;
-			}
+	available_entries = _get_available_entries (enumeration, &local_error);
 
-			if (is_implemented) {
-				(*n_values)++;
-				available_entries = g_slist_prepend (available_entries, iter->data);
-			}
-		}
+	if (local_error != NULL) {
+		g_propagate_prefixed_error (error, local_error, "[%s] ",
+					    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+		return NULL;
 	}
 
-	if (*n_values == 0) {
-		g_slist_free (available_entries);
+	if (enumeration->n_available_entries == 0)
 		return NULL;
-	}
 
-	strings = g_new (const char*, *n_values);
-	for (iter = available_entries, i = 0; iter != NULL; iter = iter->next, i++) {
+	strings = g_new (const char*, enumeration->n_available_entries);
+	for (i = 0, j = 0; i < enumeration->entry_array->len; i++) {
+		ArvGcFeatureNode *entry = g_ptr_array_index (enumeration->entry_array, i);
 		const char *string = NULL;
+
+		if (!_is_entry_available (available_entries, i))
+			continue;
+
 		if (display_name)
-			string = arv_gc_feature_node_get_display_name (iter->data);
+			string = arv_gc_feature_node_get_display_name (entry);
 		if (string == NULL)
-			string = arv_gc_feature_node_get_name (iter->data);
-		strings[i] = string;
+			string = arv_gc_feature_node_get_name (entry);
+		strings[j++] = string;
 	}
 
-	g_slist_free (available_entries);
+	*n_values = j;
 
 	return strings;
 }
@@ -324,6 +535,9 @@ _get_int_value (ArvGcEnumeration *enumeration, GError **error)
 	if (enumeration->value == NULL)
 		return 0;
 
+	if (arv_gc_feature_node_get_cached_int64 (ARV_GC_FEATURE_NODE (enumeration), &value))
+		return value;
+
 	value = arv_gc_property_node_get_int64 (enumeration->value, &local_error);
 
 	if (local_error != NULL) {
@@ -332,6 +546,8 @@ _get_int_value (ArvGcEnumeration *enumeration, GError **error)
 		return 0;
 	}
 
+	arv_gc_feature_node_set_cached_int64 (ARV_GC_FEATURE_NODE (enumeration), value);
+
 	return value;
 }
 
@@ -353,40 +569,33 @@ _set_int_value (ArvGcEnumeration *enumeration, gint64 value, GError **error)
 
 	if (enumeration->value) {
 		GError *local_error = NULL;
+		const guint32 *available_entries;
 
-		{
-			gint64 *available_values;
-			unsigned n_values;
-			unsigned i;
-			gboolean found = FALSE;
-
-			available_values = arv_gc_enumeration_dup_available_int_values (enumeration, &n_values, &local_error);
-			if (local_error != NULL) {
-                                g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-				return FALSE;
-			}
-
-			if (available_values == NULL) {
-				g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_EMPTY_ENUMERATION,
-					     "[%s] No available entry found",
-					     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-				return FALSE;
-			}
+		available_entries = _get_available_entries (enumeration, &local_error);
 
-			for (i = 0; i < n_values; i++)
-				if (available_values[i] == value)
-					found = TRUE;
+		if (local_error != NULL) {
+			g_propagate_prefixed_error (error, local_error, "[%s] ",
+						    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+			return FALSE;
+		}
 
-			g_free (available_values);
+		if (enumeration->n_available_entries == 0) {
+			g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_EMPTY_ENUMERATION,
+				     "[%s] No available entry found",
+				     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+			return FALSE;
+		}
 
-			if (!found) {
+		if (_find_entry_by_value (enumeration, available_entries, value, &local_error) < 0) {
+			if (local_error != NULL)
+				g_propagate_prefixed_error (error, local_error, "[%s] ",
+							    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+			else
 				g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_OUT_OF_RANGE,
 					     "[%s] Value %" G_GINT64_FORMAT " not found",
 					     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)),
-                                             value);
-				return FALSE;
-			}
+					     value);
+			return FALSE;
 		}
 
 		arv_gc_feature_node_increment_change_count (ARV_GC_FEATURE_NODE (enumeration));
@@ -419,9 +628,9 @@ arv_gc_enumeration_set_int_value (ArvGcEnumeration *enumeration, gint64 value, G
 static const char *
 _get_string_value (ArvGcEnumeration *enumeration, GError **error)
 {
-	const GSList *iter;
 	GError *local_error = NULL;
 	gint64 value;
+	int index;
 
 	g_return_val_if_fail (ARV_IS_GC_ENUMERATION (enumeration), NULL);
 	g_return_val_if_fail (error == NULL || *error == NULL, NULL);
@@ -434,25 +643,23 @@ _get_string_value (ArvGcEnumeration *enumeration, GError **error)
 		return NULL;
 	}
 
-	for (iter = enumeration->entries; iter != NULL; iter = iter->next) {
-		gint64 enum_value;
+	_ensure_lookup_tables (enumeration);
 
-		enum_value = arv_gc_enum_entry_get_value (iter->data, &local_error);
+	index = _find_entry_by_value (enumeration, NULL, value, &local_error);
 
-		if (local_error != NULL) {
-                        g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-                        return NULL;
-                }
+	if (local_error != NULL) {
+		g_propagate_prefixed_error (error, local_error, "[%s] ",
+					    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+		return NULL;
+	}
 
-		if (enum_value == value) {
-			const char *string;
+	if (index >= 0) {
+		const char *string;
 
-			string = arv_gc_feature_node_get_name (iter->data);
-			arv_debug_genicam ("[GcEnumeration::get_string_value] value = %" G_GINT64_FORMAT " - string = %s",
-					 value, string);
-			return string;
-		}
+		string = arv_gc_feature_node_get_name (g_ptr_array_index (enumeration->entry_array, index));
+		arv_debug_genicam ("[GcEnumeration::get_string_value] value = %" G_GINT64_FORMAT " - string = %s",
+				   value, string);
+		return string;
 	}
 
 	arv_warning_genicam ("[GcEnumeration::get_string_value] value = %" G_GINT64_FORMAT " not found for node %s",
@@ -473,38 +680,40 @@ arv_gc_enumeration_get_string_value (ArvGcEnumeration *enumeration, GError **err
 static gboolean
 _set_string_value (ArvGcEnumeration *enumeration, const char *value, GError **error)
 {
-	const GSList *iter;
+	guint index;
 
 	g_return_val_if_fail (ARV_IS_GC_ENUMERATION (enumeration), FALSE);
 	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
 
-	for (iter = enumeration->entries; iter != NULL; iter = iter->next)
-		if (g_strcmp0 (arv_gc_feature_node_get_name (iter->data), value) == 0) {
-			GError *local_error = NULL;
-			gint64 enum_value;
+	_ensure_lookup_tables (enumeration);
 
-			enum_value = arv_gc_enum_entry_get_value (iter->data, &local_error);
+	index = value != NULL ? GPOINTER_TO_UINT (g_hash_table_lookup (enumeration->entries_by_name, value)) : 0;
+	if (index > 0) {
+		GError *local_error = NULL;
+		gint64 enum_value;
 
-			arv_debug_genicam ("[GcEnumeration::set_string_value] value = %" G_GINT64_FORMAT " - string = %s",
-					 enum_value, value);
+		enum_value = _get_entry_value (enumeration, index - 1, &local_error);
 
-			if (local_error != NULL) {
-                                g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-                                return FALSE;
-                        }
+		arv_debug_genicam ("[GcEnumeration::set_string_value] value = %" G_GINT64_FORMAT " - string = %s",
+				   enum_value, value);
 
-			_set_int_value (enumeration, enum_value, &local_error);
+		if (local_error != NULL) {
+			g_propagate_prefixed_error (error, local_error, "[%s] ",
+						    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+			return FALSE;
+		}
 
-			if (local_error != NULL) {
-                                g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-				return FALSE;
-			}
+		_set_int_value (enumeration, enum_value, &local_error);
 
-			return TRUE;
+		if (local_error != NULL) {
+			g_propagate_prefixed_error (error, local_error, "[%s] ",
+						    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+			return FALSE;
 		}
 
+		return TRUE;
+	}
+
 	arv_warning_genicam ("[GcEnumeration::set_string_value] entry %s not found", value);
 
 	g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_ENUM_ENTRY_NOT_FOUND, "[%s] '%s' not an entry",
@@ -573,9 +782,10 @@ arv_gc_enumeration_finalize (GObject *object)
 {
 	ArvGcEnumeration *enumeration = ARV_GC_ENUMERATION (object);
 
+	_reset_lookup_tables (enumeration);
+
 	g_clear_pointer (&enumeration->entries, g_slist_free);
 	g_clear_pointer (&enumeration->selecteds, g_slist_free);
-	g_clear_pointer (&enumeration->selected_features, g_slist_free);
 
 	G_OBJECT_CLASS (arv_gc_enumeration_parent_class)->finalize (object);
 }
@@ -669,14 +879,8 @@ static const GSList *
 arv_gc_enumeration_get_selected_features (ArvGcSelector *selector)
 {
 	ArvGcEnumeration *enumeration = ARV_GC_ENUMERATION (selector);
-	GSList *iter;
 
-	g_clear_pointer (&enumeration->selected_features, g_slist_free);
-	for (iter = enumeration->selecteds; iter != NULL; iter = iter->next) {
-		ArvGcFeatureNode *feature_node = ARV_GC_FEATURE_NODE (arv_gc_property_node_get_linked_node (iter->data));
-		if (ARV_IS_GC_FEATURE_NODE (feature_node))
-		    enumeration->selected_features = g_slist_prepend (enumeration->selected_features, feature_node);
-	}
+	_ensure_lookup_tables (enumeration);
 
 	return enumeration->selected_features;
 }
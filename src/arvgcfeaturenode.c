@@ -30,7 +30,7 @@
 
 #include <arvgcfeaturenodeprivate.h>
 #include <arvgcpropertynode.h>
-#include <arvgc.h>
+#include <arvgcprivate.h>
 #include <arvgcboolean.h>
 #include <arvgcinteger.h>
 #include <arvgcfloat.h>
@@ -62,6 +62,18 @@ typedef struct {
 
 	guint64 change_count;
 
+	/* Value cache of computed nodes, see arv_gc_feature_node_get_cached_int64() */
+	ArvGc *genicam;
+	GSList *dependents;		/* #ArvGcFeatureNode */
+	guint invalidation_serial;
+	gboolean is_value_cachable;
+	guint int64_cache_generation;
+	guint double_cache_generation;
+	gint64 cached_int64;
+	double cached_double;
+	guint64 n_value_cache_hits;
+	guint64 n_value_cache_misses;
+
 	char *string_buffer;
 } ArvGcFeatureNodePrivate;
 
@@ -564,6 +576,35 @@ arv_gc_feature_node_get_value_as_string (ArvGcFeatureNode *self, GError **error)
 	return value;
 }
 
+static void
+_invalidate_dependents (ArvGcFeatureNodePrivate *priv, guint serial)
+{
+	GSList *iter;
+
+	for (iter = priv->dependents; iter != NULL; iter = iter->next) {
+		ArvGcFeatureNodePrivate *dependent_priv = arv_gc_feature_node_get_instance_private (iter->data);
+
+		/* Already visited during this propagation, which also guards against dependency loops */
+		if (dependent_priv->invalidation_serial == serial)
+			continue;
+
+		dependent_priv->invalidation_serial = serial;
+		dependent_priv->change_count++;
+		dependent_priv->int64_cache_generation = 0;
+		dependent_priv->double_cache_generation = 0;
+
+		_invalidate_dependents (dependent_priv, serial);
+	}
+}
+
+/*
+ * arv_gc_feature_node_increment_change_count:
+ * @gc_feature_node: a #ArvGcFeatureNode
+ *
+ * Signals a change of the node value. The change count of all the nodes depending on this node, as listed by the
+ * dependency graph built during the link phase of #ArvGc, is also incremented, and their cached values are discarded.
+ */
+
 void
 arv_gc_feature_node_increment_change_count (ArvGcFeatureNode *self)
 {
@@ -572,6 +613,13 @@ arv_gc_feature_node_increment_change_count (ArvGcFeatureNode *self)
 	g_return_if_fail (ARV_IS_GC_FEATURE_NODE (self));
 
 	priv->change_count++;
+	priv->int64_cache_generation = 0;
+	priv->double_cache_generation = 0;
+
+	if (priv->dependents != NULL && priv->genicam != NULL) {
+		priv->invalidation_serial = arv_gc_new_invalidation_serial (priv->genicam);
+		_invalidate_dependents (priv, priv->invalidation_serial);
+	}
 }
 
 guint64
@@ -584,6 +632,216 @@ arv_gc_feature_node_get_change_count (ArvGcFeatureNode *self)
 	return priv->change_count;
 }
 
+/*
+ * arv_gc_feature_node_add_dependent:
+ * @gc_feature_node: a #ArvGcFeatureNode
+ * @dependent: a node which value depends on @gc_feature_node
+ * @genicam: the #ArvGc document owning the nodes
+ *
+ * Adds an edge to the dependency graph used for the propagation of the value changes.
+ */
+
+void
+arv_gc_feature_node_add_dependent (ArvGcFeatureNode *self, ArvGcFeatureNode *dependent, ArvGc *genicam)
+{
+	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (self);
+
+	g_return_if_fail (ARV_IS_GC_FEATURE_NODE (self));
+	g_return_if_fail (ARV_IS_GC_FEATURE_NODE (dependent));
+
+	priv->genicam = genicam;
+
+	if (dependent != self && g_slist_find (priv->dependents, dependent) == NULL)
+		priv->dependents = g_slist_prepend (priv->dependents, dependent);
+}
+
+/*
+ * arv_gc_feature_node_set_value_cachable:
+ * @gc_feature_node: a #ArvGcFeatureNode
+ * @genicam: the #ArvGc document owning the node
+ * @is_value_cachable: whether the node value can be cached
+ *
+ * Marks a node as being able to cache its value. If @is_value_cachable is %FALSE, the value cache is also disabled for
+ * all the nodes depending on @gc_feature_node.
+ */
+
+void
+arv_gc_feature_node_set_value_cachable (ArvGcFeatureNode *self, ArvGc *genicam, gboolean is_value_cachable)
+{
+	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (self);
+	GSList *iter;
+
+	g_return_if_fail (ARV_IS_GC_FEATURE_NODE (self));
+
+	priv->genicam = genicam;
+	priv->is_value_cachable = is_value_cachable;
+
+	if (is_value_cachable)
+		return;
+
+	for (iter = priv->dependents; iter != NULL; iter = iter->next) {
+		ArvGcFeatureNodePrivate *dependent_priv = arv_gc_feature_node_get_instance_private (iter->data);
+
+		if (dependent_priv->is_value_cachable)
+			arv_gc_feature_node_set_value_cachable (iter->data, genicam, FALSE);
+	}
+}
+
+/*
+ * arv_gc_feature_node_get_availability_inputs:
+ * @gc_feature_node: a #ArvGcFeatureNode
+ * @inputs: (element-type ArvGcFeatureNode): an array the inputs are appended to
+ *
+ * Appends to @inputs the nodes pointed by the pIsAvailable and pIsImplemented properties of @gc_feature_node, which
+ * allows the callers to memoize the availability status of a node, using the change counts of its inputs.
+ *
+ * Returns: %FALSE if one of the inputs is not a feature node, or bypasses the value cache.
+ */
+
+gboolean
+arv_gc_feature_node_get_availability_inputs (ArvGcFeatureNode *self, GPtrArray *inputs)
+{
+	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (self);
+	ArvGcPropertyNode *properties[2];
+	unsigned int i;
+
+	g_return_val_if_fail (ARV_IS_GC_FEATURE_NODE (self), FALSE);
+	g_return_val_if_fail (inputs != NULL, FALSE);
+
+	properties[0] = priv->is_available;
+	properties[1] = priv->is_implemented;
+
+	for (i = 0; i < G_N_ELEMENTS (properties); i++) {
+		ArvGcNode *input;
+		ArvGcFeatureNodePrivate *input_priv;
+
+		if (properties[i] == NULL)
+			continue;
+
+		input = arv_gc_property_node_get_linked_node (properties[i]);
+		if (!ARV_IS_GC_FEATURE_NODE (input))
+			return FALSE;
+
+		input_priv = arv_gc_feature_node_get_instance_private (ARV_GC_FEATURE_NODE (input));
+		if (!input_priv->is_value_cachable)
+			return FALSE;
+
+		g_ptr_array_add (inputs, input);
+	}
+
+	return TRUE;
+}
+
+/*
+ * arv_gc_feature_node_get_cached_int64:
+ * @gc_feature_node: a #ArvGcFeatureNode
+ * @value: (out): the cached value
+ *
+ * Computed nodes (SwissKnife, Converter, Integer, Float or Enumeration) memoize their value until one of their inputs
+ * changes. The value cache is only used if the register cache is enabled, and if none of the node inputs bypasses the
+ * register cache (registers declared as not cachable, or registers of chunk and event ports).
+ *
+ * Returns: %TRUE if @value was set from the cache.
+ */
+
+gboolean
+arv_gc_feature_node_get_cached_int64 (ArvGcFeatureNode *self, gint64 *value)
+{
+	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (self);
+	guint generation;
+
+	if (!priv->is_value_cachable)
+		return FALSE;
+
+	generation = arv_gc_get_value_cache_generation (priv->genicam);
+	if (generation == 0)
+		return FALSE;
+
+	if (priv->int64_cache_generation == generation) {
+		*value = priv->cached_int64;
+		priv->n_value_cache_hits++;
+		return TRUE;
+	}
+
+	priv->n_value_cache_misses++;
+
+	return FALSE;
+}
+
+void
+arv_gc_feature_node_set_cached_int64 (ArvGcFeatureNode *self, gint64 value)
+{
+	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (self);
+
+	if (!priv->is_value_cachable)
+		return;
+
+	priv->cached_int64 = value;
+	priv->int64_cache_generation = arv_gc_get_value_cache_generation (priv->genicam);
+}
+
+gboolean
+arv_gc_feature_node_get_cached_double (ArvGcFeatureNode *self, double *value)
+{
+	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (self);
+	guint generation;
+
+	if (!priv->is_value_cachable)
+		return FALSE;
+
+	generation = arv_gc_get_value_cache_generation (priv->genicam);
+	if (generation == 0)
+		return FALSE;
+
+	if (priv->double_cache_generation == generation) {
+		*value = priv->cached_double;
+		priv->n_value_cache_hits++;
+		return TRUE;
+	}
+
+	priv->n_value_cache_misses++;
+
+	return FALSE;
+}
+
+void
+arv_gc_feature_node_set_cached_double (ArvGcFeatureNode *self, double value)
+{
+	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (self);
+
+	if (!priv->is_value_cachable)
+		return;
+
+	priv->cached_double = value;
+	priv->double_cache_generation = arv_gc_get_value_cache_generation (priv->genicam);
+}
+
+/**
+ * arv_gc_feature_node_get_value_cache_statistics:
+ * @gc_feature_node: a #ArvGcFeatureNode
+ * @n_hits: (out) (optional): number of value reads served from the cache
+ * @n_misses: (out) (optional): number of value reads which needed a computation
+ *
+ * Retrieves the value cache counters of a computed node (SwissKnife, Converter, Integer, Float or Enumeration). The
+ * counters are only incremented when the register cache policy is %ARV_REGISTER_CACHE_POLICY_ENABLE and the node value
+ * is cachable.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_gc_feature_node_get_value_cache_statistics (ArvGcFeatureNode *self, guint64 *n_hits, guint64 *n_misses)
+{
+	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (self);
+
+	g_return_if_fail (ARV_IS_GC_FEATURE_NODE (self));
+
+	if (n_hits != NULL)
+		*n_hits = priv->n_value_cache_hits;
+	if (n_misses != NULL)
+		*n_misses = priv->n_value_cache_misses;
+}
+
 static void
 arv_gc_feature_node_init (ArvGcFeatureNode *self)
 {
@@ -597,6 +855,13 @@ arv_gc_feature_node_finalize (GObject *object)
 {
 	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (ARV_GC_FEATURE_NODE(object));
 
+	if (priv->n_value_cache_hits > 0 || priv->n_value_cache_misses > 0)
+		arv_debug_policies ("%-15s: value cache hit(s) = %3" G_GUINT64_FORMAT " / %-3" G_GUINT64_FORMAT,
+				    priv->name != NULL ? priv->name : arv_dom_node_get_node_name (ARV_DOM_NODE (object)),
+				    priv->n_value_cache_hits,
+				    priv->n_value_cache_hits + priv->n_value_cache_misses);
+
+	g_slist_free (priv->dependents);
 	g_clear_pointer (&priv->name, g_free);
         g_clear_pointer (&priv->comment, g_free);
 	g_clear_pointer (&priv->string_buffer, g_free);
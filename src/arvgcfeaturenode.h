@@ -68,6 +68,9 @@ ARV_API void			arv_gc_feature_node_set_value_from_string	(ArvGcFeatureNode *gc_f
 										 GError **error);
 ARV_API const char *		arv_gc_feature_node_get_value_as_string		(ArvGcFeatureNode *gc_feature_node, GError **error);
 
+ARV_API void			arv_gc_feature_node_get_value_cache_statistics	(ArvGcFeatureNode *gc_feature_node,
+										 guint64 *n_hits, guint64 *n_misses);
+
 G_END_DECLS
 
 #endif
@@ -33,6 +33,17 @@ G_BEGIN_DECLS
 void			arv_gc_feature_node_increment_change_count	(ArvGcFeatureNode *gc_feature_node);
 guint64 		arv_gc_feature_node_get_change_count 		(ArvGcFeatureNode *gc_feature_node);
 
+void			arv_gc_feature_node_add_dependent		(ArvGcFeatureNode *gc_feature_node,
+									 ArvGcFeatureNode *dependent, ArvGc *genicam);
+void			arv_gc_feature_node_set_value_cachable		(ArvGcFeatureNode *gc_feature_node, ArvGc *genicam,
+									 gboolean is_value_cachable);
+gboolean		arv_gc_feature_node_get_availability_inputs	(ArvGcFeatureNode *gc_feature_node, GPtrArray *inputs);
+
+gboolean		arv_gc_feature_node_get_cached_int64		(ArvGcFeatureNode *gc_feature_node, gint64 *value);
+void			arv_gc_feature_node_set_cached_int64		(ArvGcFeatureNode *gc_feature_node, gint64 value);
+gboolean		arv_gc_feature_node_get_cached_double		(ArvGcFeatureNode *gc_feature_node, double *value);
+void			arv_gc_feature_node_set_cached_double		(ArvGcFeatureNode *gc_feature_node, double value);
+
 static inline gboolean
 arv_gc_feature_node_check_write_access (ArvGcFeatureNode *gc_feature_node, GError **error)
 {
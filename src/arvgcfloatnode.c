@@ -230,6 +230,9 @@ arv_gc_float_node_get_float_value (ArvGcFloat *gc_float, GError **error)
 	GError *local_error = NULL;
 	double value;
 
+	if (arv_gc_feature_node_get_cached_double (ARV_GC_FEATURE_NODE (gc_float), &value))
+		return value;
+
 	value_node = _get_value_node (gc_float_node, &local_error);
 	if (value_node == NULL) {
                 if (local_error != NULL)
@@ -245,6 +248,8 @@ arv_gc_float_node_get_float_value (ArvGcFloat *gc_float, GError **error)
                 return 0.0;
         }
 
+	arv_gc_feature_node_set_cached_double (ARV_GC_FEATURE_NODE (gc_float), value);
+
 	return value;
 }
 
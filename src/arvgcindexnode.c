@@ -25,7 +25,7 @@
  * @short_description: Class for Index nodes
  */
 
-#include <arvgcindexnode.h>
+#include <arvgcindexnodeprivate.h>
 #include <arvgcpropertynode.h>
 #include <arvgcinteger.h>
 #include <arvgc.h>
@@ -128,6 +128,19 @@ arv_gc_index_node_get_index (ArvGcIndexNode *index_node, gint64 default_offset,
 	return offset * node_value;
 }
 
+/* Node pointed to by the pOffset attribute, NULL for a literal offset */
+
+ArvGcNode *
+arv_gc_index_node_get_offset_node (ArvGcIndexNode *index_node)
+{
+	g_return_val_if_fail (ARV_IS_GC_INDEX_NODE (index_node), NULL);
+
+	if (index_node->offset == NULL || !index_node->is_p_offset)
+		return NULL;
+
+	return arv_gc_get_node (arv_gc_node_get_genicam (ARV_GC_NODE (index_node)), index_node->offset);
+}
+
 ArvGcNode *
 arv_gc_index_node_new (void)
 {
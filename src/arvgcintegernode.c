@@ -233,6 +233,9 @@ arv_gc_integer_node_get_integer_value (ArvGcInteger *gc_integer, GError **error)
 	GError *local_error = NULL;
 	gint64 value;
 
+	if (arv_gc_feature_node_get_cached_int64 (ARV_GC_FEATURE_NODE (gc_integer_node), &value))
+		return value;
+
 	value_node = _get_value_node (gc_integer_node, &local_error);
 	if (value_node == NULL) {
                 if (local_error != NULL)
@@ -248,6 +251,8 @@ arv_gc_integer_node_get_integer_value (ArvGcInteger *gc_integer, GError **error)
                 return 0;
         }
 
+	arv_gc_feature_node_set_cached_int64 (ARV_GC_FEATURE_NODE (gc_integer_node), value);
+
 	return value;
 }
 
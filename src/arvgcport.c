@@ -25,7 +25,7 @@
  * @short_description: Class for Port nodes
  */
 
-#include <arvgcport.h>
+#include <arvgcportprivate.h>
 #include <arvgcregisterdescriptionnode.h>
 #include <arvgcfeaturenodeprivate.h>
 #include <arvdevice.h>
@@ -34,7 +34,7 @@
 #include <arvchunkparserprivate.h>
 #include <arvbuffer.h>
 #include <arvgcpropertynode.h>
-#include <arvgc.h>
+#include <arvgcprivate.h>
 #include <memory.h>
 
 typedef struct {
@@ -172,6 +172,34 @@ _use_legacy_endianness_mechanism (ArvGcPort *port, guint64 length)
 	return length == 4 && port->priv->has_legacy_infos;
 }
 
+/* TRUE if the port gives access to the device registers, instead of chunk or event data */
+
+gboolean
+arv_gc_port_is_device_port (ArvGcPort *port)
+{
+	g_return_val_if_fail (ARV_IS_GC_PORT (port), FALSE);
+
+	return port->priv->chunk_id == NULL && port->priv->event_id == NULL;
+}
+
+/* TRUE if the device register accesses of the given length use the register read and write commands, instead of the
+ * memory ones */
+
+gboolean
+arv_gc_port_uses_register_access (ArvGcPort *port, guint64 length)
+{
+	ArvDevice *device;
+
+	g_return_val_if_fail (ARV_IS_GC_PORT (port), FALSE);
+
+	if (!arv_gc_port_is_device_port (port))
+		return FALSE;
+
+	device = arv_gc_get_device (arv_gc_node_get_genicam (ARV_GC_NODE (port)));
+
+	return ARV_IS_GV_DEVICE (device) && _use_legacy_endianness_mechanism (port, length);
+}
+
 void
 arv_gc_port_read (ArvGcPort *port, void *buffer, guint64 address, guint64 length, GError **error)
 {
@@ -232,6 +260,10 @@ arv_gc_port_read (ArvGcPort *port, void *buffer, guint64 address, guint64 length
 
 		device = arv_gc_get_device (genicam);
 		if (ARV_IS_DEVICE (device)) {
+			/* Registers fully written during the current transaction */
+			if (arv_gc_read_staged_data (genicam, address, buffer, length, TRUE))
+				return;
+
 			/* For schema < 1.1.0 and length == 4, register read must be used instead of memory read.
 			 * Only applies to GigE Vision devices. See Appendix 3 of Genicam 2.0 specification. */
 			if (ARV_IS_GV_DEVICE (device) && _use_legacy_endianness_mechanism (port, length)) {
@@ -243,6 +275,9 @@ arv_gc_port_read (ArvGcPort *port, void *buffer, guint64 address, guint64 length
 				*((guint32 *) buffer) = GUINT32_TO_BE (value);
 			} else
 				arv_device_read_memory (device, address, length, buffer, error);
+
+			if (error == NULL || *error == NULL)
+				arv_gc_read_staged_data (genicam, address, buffer, length, FALSE);
 		} else {
 			g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_NO_DEVICE_SET,
 				     "[%s] No device set",
@@ -298,9 +333,16 @@ arv_gc_port_write (ArvGcPort *port, void *buffer, guint64 address, guint64 lengt
 		device = arv_gc_get_device (genicam);
 
 		if (ARV_IS_DEVICE (device)) {
+			gboolean register_access = ARV_IS_GV_DEVICE (device) &&
+				_use_legacy_endianness_mechanism (port, length);
+
+			/* Deferred until the end of the current transaction */
+			if (arv_gc_stage_write (genicam, address, buffer, length, register_access))
+				return;
+
 			/* For schema < 1.1.0 and length == 4, register write must be used instead of memory write.
 			 * Only applies to GigE Vision devices. See Appendix 3 of Genicam 2.0 specification. */
-			if (ARV_IS_GV_DEVICE (device) && _use_legacy_endianness_mechanism (port, length)) {
+			if (register_access) {
 				guint32 value;
 
 				/* For schema < 1.1.0, all registers are big endian. */
@@ -26,5 +26,18 @@
 #include <arvgc.h>
 
 ARV_API guint64            arv_gc_register_cache_error_add         (ArvGc *genicam, guint64 n_errors);
+guint			   arv_gc_get_link_generation		   (ArvGc *genicam);
+guint			   arv_gc_get_value_cache_generation	   (ArvGc *genicam);
+guint			   arv_gc_new_invalidation_serial	   (ArvGc *genicam);
+
+GPtrArray *		   arv_gc_dup_feature_registers		   (ArvGc *genicam, const char *feature);
+GPtrArray *		   arv_gc_dup_polled_registers		   (ArvGc *genicam);
+
+gboolean		   arv_gc_is_in_transaction		   (ArvGc *genicam);
+void			   arv_gc_set_transaction_feature	   (ArvGc *genicam, ArvGcFeatureNode *feature);
+gboolean		   arv_gc_stage_write			   (ArvGc *genicam, guint64 address, const void *data,
+								    guint64 length, gboolean register_access);
+gboolean		   arv_gc_read_staged_data		   (ArvGc *genicam, guint64 address, void *buffer,
+								    guint64 length, gboolean is_complete_only);
 
 #endif
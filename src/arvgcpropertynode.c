@@ -28,13 +28,13 @@
  * types of Genicam property nodes (Value, pValue, Endianness...).
  */
 
-#include <arvgcpropertynode.h>
+#include <arvgcpropertynodeprivate.h>
 #include <arvgcfeaturenode.h>
 #include <arvgcinteger.h>
 #include <arvgcfloat.h>
 #include <arvgcboolean.h>
 #include <arvgcstring.h>
-#include <arvgc.h>
+#include <arvgcprivate.h>
 #include <arvdomtext.h>
 #include <arvmiscprivate.h>
 #include <arvdebugprivate.h>
@@ -47,16 +47,35 @@ enum {
 } ArvGcPropertyNodeProperties;
 
 typedef struct {
-	ArvGcNode base;
-
 	ArvGcPropertyNodeType	type;
 
 	char *name;
 
-	gboolean value_data_up_to_date;
+	/* Text content, stored inline by the parser instead of as ArvDomText children. If text children are added
+	 * using the DOM API, their concatenation with the inline data is cached in value_data. */
+
+	char *inline_data;
 	char *value_data;
+
+	/* Link cache, see arv_gc_property_node_link() */
+
+	ArvGc *genicam;
+	ArvGcNode *linked_node;
+	guint link_generation;
+
+	guint value_data_up_to_date : 1;
+	guint int64_up_to_date : 1;
+	guint double_up_to_date : 1;
+	guint typed_value_up_to_date : 1;
+
+	gint64 int64_value;
+	double double_value;
+	gint64 typed_value;
 } ArvGcPropertyNodePrivate;
 
+/* Value of the typed value cache for unknown keywords, the getters return their default value in this case */
+#define ARV_GC_PROPERTY_NODE_TYPED_VALUE_UNKNOWN	G_MININT64
+
 G_DEFINE_TYPE_WITH_CODE (ArvGcPropertyNode, arv_gc_property_node, ARV_TYPE_GC_NODE, G_ADD_PRIVATE (ArvGcPropertyNode))
 
 /* ArvDomNode implementation */
@@ -174,6 +193,16 @@ arv_gc_property_node_get_node_name (ArvDomNode *node)
 	}
 }
 
+static void
+_invalidate_value_caches (ArvGcPropertyNodePrivate *priv)
+{
+	priv->value_data_up_to_date = FALSE;
+	priv->int64_up_to_date = FALSE;
+	priv->double_up_to_date = FALSE;
+	priv->typed_value_up_to_date = FALSE;
+	priv->linked_node = NULL;
+}
+
 /* ArvDomElement implementation */
 
 static gboolean
@@ -187,7 +216,7 @@ _post_new_child (ArvDomNode *parent, ArvDomNode *child)
 {
 	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (ARV_GC_PROPERTY_NODE (parent));
 
-	priv->value_data_up_to_date = FALSE;
+	_invalidate_value_caches (priv);
 }
 
 static void
@@ -195,7 +224,7 @@ _pre_remove_child (ArvDomNode *parent, ArvDomNode *child)
 {
 	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (ARV_GC_PROPERTY_NODE (parent));
 
-	priv->value_data_up_to_date = FALSE;
+	_invalidate_value_caches (priv);
 }
 
 /* ArvDomElement implementation */
@@ -233,9 +262,12 @@ _get_value_data (ArvGcPropertyNode *property_node)
 	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (property_node);
 	ArvDomNode *dom_node = ARV_DOM_NODE (property_node);
 
+	if (arv_dom_node_get_first_child (dom_node) == NULL)
+		return priv->inline_data != NULL ? priv->inline_data : "";
+
 	if (!priv->value_data_up_to_date) {
 		ArvDomNode *iter;
-		GString *string = g_string_new (NULL);
+		GString *string = g_string_new (priv->inline_data);
 
 		for (iter = arv_dom_node_get_first_child (dom_node);
 		     iter != NULL;
@@ -253,38 +285,196 @@ static void
 _set_value_data (ArvGcPropertyNode *property_node, const char *data)
 {
 	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (property_node);
-	ArvDomNode *dom_node = ARV_DOM_NODE (property_node);
+	ArvDomNode *iter;
 
-	if (arv_dom_node_get_first_child (dom_node) != NULL) {
-		ArvDomNode *iter;
+	for (iter = arv_dom_node_get_first_child (ARV_DOM_NODE (property_node));
+	     iter != NULL;
+	     iter = arv_dom_node_get_next_sibling (iter))
+		arv_dom_character_data_set_data (ARV_DOM_CHARACTER_DATA (iter), "");
 
-		arv_dom_character_data_set_data (ARV_DOM_CHARACTER_DATA (arv_dom_node_get_first_child (dom_node)), data);
-		for (iter = arv_dom_node_get_next_sibling (arv_dom_node_get_first_child (dom_node));
-		     iter != NULL;
-		     iter = arv_dom_node_get_next_sibling (iter))
-			arv_dom_character_data_set_data (ARV_DOM_CHARACTER_DATA (iter), "");
+	_invalidate_value_caches (priv);
+
+	g_free (priv->inline_data);
+	priv->inline_data = g_strdup (data);
+}
+
+/*
+ * arv_gc_property_node_append_inline_data:
+ * @node: a #ArvGcPropertyNode
+ * @data: text data
+ * @length: size of @data
+ *
+ * Appends a chunk of text to the node content, without creating a #ArvDomText child.
+ */
+
+void
+arv_gc_property_node_append_inline_data (ArvGcPropertyNode *node, const char *data, gsize length)
+{
+	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (node);
+	gsize inline_length;
+
+	g_return_if_fail (ARV_IS_GC_PROPERTY_NODE (node));
+
+	inline_length = priv->inline_data != NULL ? strlen (priv->inline_data) : 0;
+
+	priv->inline_data = g_realloc (priv->inline_data, inline_length + length + 1);
+	memcpy (priv->inline_data + inline_length, data, length);
+	priv->inline_data[inline_length + length] = '\0';
+
+	_invalidate_value_caches (priv);
+}
+
+static ArvGcNode *
+_resolve_linked_node (ArvGcPropertyNode *property_node)
+{
+	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (property_node);
+	guint link_generation;
+
+	if (priv->genicam == NULL) {
+		priv->genicam = arv_gc_node_get_genicam (ARV_GC_NODE (property_node));
+		if (priv->genicam == NULL)
+			return NULL;
 	}
 
-	g_free (priv->value_data);
-	priv->value_data = g_strdup (data);
-	priv->value_data_up_to_date = TRUE;
+	/* The cached pointer is only valid as long as no node was replaced in the genicam node table. A missing node is
+	 * not cached, as it may be added later by arv_gc_set_default_node_data(). */
+
+	link_generation = arv_gc_get_link_generation (priv->genicam);
+	if (priv->linked_node != NULL && priv->link_generation == link_generation)
+		return priv->linked_node;
+
+	priv->linked_node = arv_gc_get_node (priv->genicam, _get_value_data (property_node));
+	priv->link_generation = link_generation;
+
+	return priv->linked_node;
 }
 
 static ArvDomNode *
 _get_pvalue_node (ArvGcPropertyNode *property_node)
 {
-	ArvDomNode *pvalue_node;
-	const char *node_name;
-	ArvGc *genicam;
+	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (property_node);
 
-	if (arv_gc_property_node_get_node_type (property_node) < ARV_GC_PROPERTY_NODE_TYPE_P_UNKNONW)
+	if (priv->type < ARV_GC_PROPERTY_NODE_TYPE_P_UNKNONW)
 		return NULL;
 
-	node_name = _get_value_data (property_node);
-	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (property_node));
-	pvalue_node = ARV_DOM_NODE (arv_gc_get_node (genicam, node_name));
+	return ARV_DOM_NODE (_resolve_linked_node (property_node));
+}
+
+static gint64
+_parse_typed_value (ArvGcPropertyNodeType type, const char *value)
+{
+	switch (type) {
+		case ARV_GC_PROPERTY_NODE_TYPE_VISIBILITY:
+			if (g_strcmp0 (value, "Invisible") == 0)
+				return ARV_GC_VISIBILITY_INVISIBLE;
+			else if (g_strcmp0 (value, "Guru") == 0)
+				return ARV_GC_VISIBILITY_GURU;
+			else if (g_strcmp0 (value, "Expert") == 0)
+				return ARV_GC_VISIBILITY_EXPERT;
+			else if (g_strcmp0 (value, "Beginner") == 0)
+				return ARV_GC_VISIBILITY_BEGINNER;
+			return ARV_GC_VISIBILITY_UNDEFINED;
+		case ARV_GC_PROPERTY_NODE_TYPE_REPRESENTATION:
+			if (g_strcmp0 (value, "Linear") == 0)
+				return ARV_GC_REPRESENTATION_LINEAR;
+			else if (g_strcmp0 (value, "Logarithmic") == 0)
+				return ARV_GC_REPRESENTATION_LOGARITHMIC;
+			else if (g_strcmp0 (value, "Boolean") == 0)
+				return ARV_GC_REPRESENTATION_BOOLEAN;
+			else if (g_strcmp0 (value, "PureNumber") == 0)
+				return ARV_GC_REPRESENTATION_PURE_NUMBER;
+			else if (g_strcmp0 (value, "HexNumber") == 0)
+				return ARV_GC_REPRESENTATION_HEX_NUMBER;
+			else if (g_strcmp0 (value, "IPV4Address") == 0)
+				return ARV_GC_REPRESENTATION_IPV4_ADDRESS;
+			else if (g_strcmp0 (value, "MACAddress") == 0)
+				return ARV_GC_REPRESENTATION_MAC_ADDRESS;
+			return ARV_GC_PROPERTY_NODE_TYPED_VALUE_UNKNOWN;
+		case ARV_GC_PROPERTY_NODE_TYPE_DISPLAY_NOTATION:
+			if (g_strcmp0 (value, "Automatic") == 0)
+				return ARV_GC_DISPLAY_NOTATION_AUTOMATIC;
+			else if (g_strcmp0 (value, "Fixed") == 0)
+				return ARV_GC_DISPLAY_NOTATION_FIXED;
+			else if (g_strcmp0 (value, "Scientific") == 0)
+				return ARV_GC_DISPLAY_NOTATION_SCIENTIFIC;
+			return ARV_GC_PROPERTY_NODE_TYPED_VALUE_UNKNOWN;
+		case ARV_GC_PROPERTY_NODE_TYPE_DISPLAY_PRECISION:
+			return g_ascii_strtoll (value, NULL, 0);
+		case ARV_GC_PROPERTY_NODE_TYPE_ACCESS_MODE:
+		case ARV_GC_PROPERTY_NODE_TYPE_IMPOSED_ACCESS_MODE:
+			if (g_strcmp0 (value, "RO") == 0)
+				return ARV_GC_ACCESS_MODE_RO;
+			else if (g_strcmp0 (value, "WO") == 0)
+				return ARV_GC_ACCESS_MODE_WO;
+			else if (g_strcmp0 (value, "RW") == 0)
+				return ARV_GC_ACCESS_MODE_RW;
+			return ARV_GC_PROPERTY_NODE_TYPED_VALUE_UNKNOWN;
+		case ARV_GC_PROPERTY_NODE_TYPE_CACHABLE:
+			if (g_strcmp0 (value, "WriteAround") == 0)
+				return ARV_GC_CACHABLE_WRITE_AROUND;
+			else if (g_strcmp0 (value, "WriteThrough") == 0)
+				return ARV_GC_CACHABLE_WRITE_THROUGH;
+			return ARV_GC_CACHABLE_NO_CACHE;
+		case ARV_GC_PROPERTY_NODE_TYPE_ENDIANNESS:
+			if (g_strcmp0 (value, "BigEndian") == 0)
+				return G_BIG_ENDIAN;
+			return G_LITTLE_ENDIAN;
+		case ARV_GC_PROPERTY_NODE_TYPE_SIGN:
+			if (g_strcmp0 (value, "Unsigned") == 0)
+				return ARV_GC_SIGNEDNESS_UNSIGNED;
+			return ARV_GC_SIGNEDNESS_SIGNED;
+		case ARV_GC_PROPERTY_NODE_TYPE_LSB:
+		case ARV_GC_PROPERTY_NODE_TYPE_MSB:
+		case ARV_GC_PROPERTY_NODE_TYPE_BIT:
+			return g_ascii_strtoll (value, NULL, 10);
+		case ARV_GC_PROPERTY_NODE_TYPE_STREAMABLE:
+			if (g_strcmp0 (value, "Yes") == 0)
+				return ARV_GC_STREAMABLE_YES;
+			return ARV_GC_STREAMABLE_NO;
+		default:
+			return ARV_GC_PROPERTY_NODE_TYPED_VALUE_UNKNOWN;
+	}
+}
+
+/* Returns the value of a keyword or numeric property, parsed once */
 
-	return pvalue_node;
+static gint64
+_get_typed_value (ArvGcPropertyNode *property_node)
+{
+	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (property_node);
+
+	if (!priv->typed_value_up_to_date) {
+		priv->typed_value = _parse_typed_value (priv->type, _get_value_data (property_node));
+		priv->typed_value_up_to_date = TRUE;
+	}
+
+	return priv->typed_value;
+}
+
+static gint64
+_get_literal_int64 (ArvGcPropertyNode *property_node)
+{
+	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (property_node);
+
+	if (!priv->int64_up_to_date) {
+		priv->int64_value = g_ascii_strtoll (_get_value_data (property_node), NULL, 0);
+		priv->int64_up_to_date = TRUE;
+	}
+
+	return priv->int64_value;
+}
+
+static double
+_get_literal_double (ArvGcPropertyNode *property_node)
+{
+	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (property_node);
+
+	if (!priv->double_up_to_date) {
+		priv->double_value = g_ascii_strtod (_get_value_data (property_node), NULL);
+		priv->double_up_to_date = TRUE;
+	}
+
+	return priv->double_value;
 }
 
 /**
@@ -375,7 +565,7 @@ arv_gc_property_node_get_int64 (ArvGcPropertyNode *node, GError **error)
 
 	pvalue_node = _get_pvalue_node (node);
 	if (pvalue_node == NULL)
-		return g_ascii_strtoll (_get_value_data (node), NULL, 0);
+		return _get_literal_int64 (node);
 
 	if (ARV_IS_GC_INTEGER (pvalue_node)) {
 		return arv_gc_integer_get_value (ARV_GC_INTEGER (pvalue_node), error);
@@ -431,7 +621,7 @@ arv_gc_property_node_get_double (ArvGcPropertyNode *node, GError **error)
 
 	pvalue_node = _get_pvalue_node (node);
 	if (pvalue_node == NULL)
-		return g_ascii_strtod (_get_value_data (node), NULL);
+		return _get_literal_double (node);
 
 
 	if (ARV_IS_GC_FLOAT (pvalue_node)) {
@@ -495,15 +685,58 @@ arv_gc_property_node_get_node_type (ArvGcPropertyNode *node)
 ArvGcNode *
 arv_gc_property_node_get_linked_node (ArvGcPropertyNode *node)
 {
-	ArvGc *genicam;
-
 	g_return_val_if_fail (ARV_IS_GC_PROPERTY_NODE (node), NULL);
 
 	if (arv_gc_property_node_get_node_type (node) <= ARV_GC_PROPERTY_NODE_TYPE_P_UNKNONW)
 		return NULL;
 
-	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (node));
-	return arv_gc_get_node (genicam, _get_value_data (node));
+	return _resolve_linked_node (node);
+}
+
+/*
+ * arv_gc_property_node_link:
+ * @node: a #ArvGcPropertyNode
+ * @genicam: the #ArvGc document owning @node
+ *
+ * Resolves the node pointed to by a pointer property, and parses the value of a literal property, such that
+ * the subsequent accesses do not need a node table lookup or a string conversion. Properties that are not linked
+ * are resolved on their first access.
+ */
+
+void
+arv_gc_property_node_link (ArvGcPropertyNode *node, ArvGc *genicam)
+{
+	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (node);
+
+	g_return_if_fail (ARV_IS_GC_PROPERTY_NODE (node));
+	g_return_if_fail (ARV_IS_GC (genicam));
+
+	priv->genicam = genicam;
+
+	if (priv->type > ARV_GC_PROPERTY_NODE_TYPE_P_UNKNONW) {
+		if (_resolve_linked_node (node) == NULL)
+			arv_debug_genicam ("[GcPropertyNode::link] Node '%s' not found", _get_value_data (node));
+		return;
+	}
+
+	switch (priv->type) {
+		case ARV_GC_PROPERTY_NODE_TYPE_VALUE:
+		case ARV_GC_PROPERTY_NODE_TYPE_ADDRESS:
+		case ARV_GC_PROPERTY_NODE_TYPE_MINIMUM:
+		case ARV_GC_PROPERTY_NODE_TYPE_MAXIMUM:
+		case ARV_GC_PROPERTY_NODE_TYPE_INCREMENT:
+		case ARV_GC_PROPERTY_NODE_TYPE_LENGTH:
+		case ARV_GC_PROPERTY_NODE_TYPE_ON_VALUE:
+		case ARV_GC_PROPERTY_NODE_TYPE_OFF_VALUE:
+		case ARV_GC_PROPERTY_NODE_TYPE_COMMAND_VALUE:
+		case ARV_GC_PROPERTY_NODE_TYPE_VALUE_DEFAULT:
+			_get_literal_int64 (node);
+			_get_literal_double (node);
+			break;
+		default:
+			_get_typed_value (node);
+			break;
+	}
 }
 
 static ArvGcNode *
@@ -558,7 +791,6 @@ ArvGcVisibility
 arv_gc_property_node_get_visibility (ArvGcPropertyNode *self, ArvGcVisibility default_value)
 {
 	ArvGcPropertyNodePrivate *priv;
-	const char *value;
 
 	if (self == NULL)
 		return default_value;
@@ -568,18 +800,7 @@ arv_gc_property_node_get_visibility (ArvGcPropertyNode *self, ArvGcVisibility de
 	g_return_val_if_fail (ARV_IS_GC_PROPERTY_NODE (self), default_value);
 	g_return_val_if_fail (priv->type == ARV_GC_PROPERTY_NODE_TYPE_VISIBILITY, ARV_GC_VISIBILITY_UNDEFINED);
 
-	value = _get_value_data (self);
-
-	if (g_strcmp0 (value, "Invisible") == 0)
-		return ARV_GC_VISIBILITY_INVISIBLE;
-	else if (g_strcmp0 (value, "Guru") == 0)
-		return ARV_GC_VISIBILITY_GURU;
-	else if (g_strcmp0 (value, "Expert") == 0)
-		return ARV_GC_VISIBILITY_EXPERT;
-	else if (g_strcmp0 (value, "Beginner") == 0)
-		return ARV_GC_VISIBILITY_BEGINNER;
-
-	return ARV_GC_VISIBILITY_UNDEFINED;
+	return _get_typed_value (self);
 }
 
 ArvGcNode *
@@ -652,7 +873,7 @@ ArvGcRepresentation
 arv_gc_property_node_get_representation (ArvGcPropertyNode *self, ArvGcRepresentation default_value)
 {
 	ArvGcPropertyNodePrivate *priv;
-	const char *value;
+	gint64 value;
 
 	if (self == NULL)
 		return default_value;
@@ -662,24 +883,11 @@ arv_gc_property_node_get_representation (ArvGcPropertyNode *self, ArvGcRepresent
 	g_return_val_if_fail (ARV_IS_GC_PROPERTY_NODE (self), default_value);
 	g_return_val_if_fail (priv->type == ARV_GC_PROPERTY_NODE_TYPE_REPRESENTATION, default_value);
 
-	value = _get_value_data (self);
-
-	if (g_strcmp0 (value, "Linear") == 0)
-		return ARV_GC_REPRESENTATION_LINEAR;
-	else if (g_strcmp0 (value, "Logarithmic") == 0)
-		return ARV_GC_REPRESENTATION_LOGARITHMIC;
-	else if (g_strcmp0 (value, "Boolean") == 0)
-		return ARV_GC_REPRESENTATION_BOOLEAN;
-	else if (g_strcmp0 (value, "PureNumber") == 0)
-		return ARV_GC_REPRESENTATION_PURE_NUMBER;
-	else if (g_strcmp0 (value, "HexNumber") == 0)
-		return ARV_GC_REPRESENTATION_HEX_NUMBER;
-	else if (g_strcmp0 (value, "IPV4Address") == 0)
-		return ARV_GC_REPRESENTATION_IPV4_ADDRESS;
-	else if (g_strcmp0 (value, "MACAddress") == 0)
-		return ARV_GC_REPRESENTATION_MAC_ADDRESS;
+	value = _get_typed_value (self);
+	if (value == ARV_GC_PROPERTY_NODE_TYPED_VALUE_UNKNOWN)
+		return default_value;
 
-	return default_value;
+	return value;
 }
 
 ArvGcNode *
@@ -692,7 +900,7 @@ ArvGcDisplayNotation
 arv_gc_property_node_get_display_notation (ArvGcPropertyNode *self, ArvGcDisplayNotation default_value)
 {
 	ArvGcPropertyNodePrivate *priv;
-	const char *value;
+	gint64 value;
 
 	if (self == NULL)
 		return default_value;
@@ -702,16 +910,11 @@ arv_gc_property_node_get_display_notation (ArvGcPropertyNode *self, ArvGcDisplay
 	g_return_val_if_fail (ARV_IS_GC_PROPERTY_NODE (self), default_value);
 	g_return_val_if_fail (priv->type == ARV_GC_PROPERTY_NODE_TYPE_DISPLAY_NOTATION, default_value);
 
-	value = _get_value_data (self);
-
-	if (g_strcmp0 (value, "Automatic") == 0)
-		return ARV_GC_DISPLAY_NOTATION_AUTOMATIC;
-	else if (g_strcmp0 (value, "Fixed") == 0)
-		return ARV_GC_DISPLAY_NOTATION_FIXED;
-	else if (g_strcmp0 (value, "Scientific") == 0)
-		return ARV_GC_DISPLAY_NOTATION_SCIENTIFIC;
+	value = _get_typed_value (self);
+	if (value == ARV_GC_PROPERTY_NODE_TYPED_VALUE_UNKNOWN)
+		return default_value;
 
-	return default_value;
+	return value;
 }
 
 ArvGcNode *
@@ -733,7 +936,7 @@ arv_gc_property_node_get_display_precision (ArvGcPropertyNode *self, gint64 defa
 	g_return_val_if_fail (ARV_IS_GC_PROPERTY_NODE (self), default_value);
 	g_return_val_if_fail (priv->type == ARV_GC_PROPERTY_NODE_TYPE_DISPLAY_PRECISION, default_value);
 
-	return g_ascii_strtoll (_get_value_data (self), NULL, 0);
+	return _get_typed_value (self);
 }
 
 ArvGcNode *
@@ -848,7 +1051,7 @@ ArvGcAccessMode
 arv_gc_property_node_get_access_mode (ArvGcPropertyNode *self, ArvGcAccessMode default_value)
 {
 	ArvGcPropertyNodePrivate *priv;
-	const char *value;
+	gint64 value;
 
 	if (self == NULL)
 		return default_value;
@@ -859,16 +1062,11 @@ arv_gc_property_node_get_access_mode (ArvGcPropertyNode *self, ArvGcAccessMode d
 	g_return_val_if_fail (priv->type == ARV_GC_PROPERTY_NODE_TYPE_ACCESS_MODE ||
 			      priv->type == ARV_GC_PROPERTY_NODE_TYPE_IMPOSED_ACCESS_MODE, default_value);
 
-	value = _get_value_data (self);
-
-	if (g_strcmp0 (value, "RO") == 0)
-		return ARV_GC_ACCESS_MODE_RO;
-	else if (g_strcmp0 (value, "WO") == 0)
-		return ARV_GC_ACCESS_MODE_WO;
-	else if (g_strcmp0 (value, "RW") == 0)
-		return ARV_GC_ACCESS_MODE_RW;
+	value = _get_typed_value (self);
+	if (value == ARV_GC_PROPERTY_NODE_TYPED_VALUE_UNKNOWN)
+		return default_value;
 
-	return default_value;
+	return value;
 }
 
 ArvGcNode *
@@ -881,7 +1079,6 @@ ArvGcCachable
 arv_gc_property_node_get_cachable (ArvGcPropertyNode *self, ArvGcCachable default_value)
 {
 	ArvGcPropertyNodePrivate *priv;
-	const char *value;
 
 	if (self == NULL)
 		return default_value;
@@ -891,14 +1088,7 @@ arv_gc_property_node_get_cachable (ArvGcPropertyNode *self, ArvGcCachable defaul
 	g_return_val_if_fail (ARV_IS_GC_PROPERTY_NODE (self), default_value);
 	g_return_val_if_fail (priv->type == ARV_GC_PROPERTY_NODE_TYPE_CACHABLE, default_value);
 
-	value = _get_value_data (self);
-
-	if (g_strcmp0 (value, "WriteAround") == 0)
-		return ARV_GC_CACHABLE_WRITE_AROUND;
-	else if (g_strcmp0 (value, "WriteThrough") == 0)
-		return ARV_GC_CACHABLE_WRITE_THROUGH;
-
-	return ARV_GC_CACHABLE_NO_CACHE;
+	return _get_typed_value (self);
 }
 
 ArvGcNode *
@@ -926,10 +1116,7 @@ arv_gc_property_node_get_endianness (ArvGcPropertyNode *self, guint default_valu
 	g_return_val_if_fail (ARV_IS_GC_PROPERTY_NODE (self), default_value);
 	g_return_val_if_fail (priv->type == ARV_GC_PROPERTY_NODE_TYPE_ENDIANNESS, default_value);
 
-	if (g_strcmp0 (_get_value_data (self), "BigEndian") == 0)
-		return G_BIG_ENDIAN;
-
-	return G_LITTLE_ENDIAN;
+	return _get_typed_value (self);
 }
 
 ArvGcNode *
@@ -951,10 +1138,7 @@ arv_gc_property_node_get_sign (ArvGcPropertyNode *self, ArvGcSignedness default_
 	g_return_val_if_fail (ARV_IS_GC_PROPERTY_NODE (self), default_value);
 	g_return_val_if_fail (priv->type == ARV_GC_PROPERTY_NODE_TYPE_SIGN, default_value);
 
-	if (g_strcmp0 (_get_value_data (self), "Unsigned") == 0)
-		return ARV_GC_SIGNEDNESS_UNSIGNED;
-
-	return ARV_GC_SIGNEDNESS_SIGNED;
+	return _get_typed_value (self);
 }
 
 ArvGcNode *
@@ -977,7 +1161,7 @@ arv_gc_property_node_get_lsb (ArvGcPropertyNode *self, guint default_value)
 	g_return_val_if_fail (priv->type == ARV_GC_PROPERTY_NODE_TYPE_LSB ||
 			      priv->type == ARV_GC_PROPERTY_NODE_TYPE_BIT, default_value);
 
-	return g_ascii_strtoll (_get_value_data (self), NULL, 10);
+	return _get_typed_value (self);
 }
 
 ArvGcNode *
@@ -1000,7 +1184,7 @@ arv_gc_property_node_get_msb (ArvGcPropertyNode *self, guint default_value)
 	g_return_val_if_fail (priv->type == ARV_GC_PROPERTY_NODE_TYPE_MSB ||
 			      priv->type == ARV_GC_PROPERTY_NODE_TYPE_BIT, default_value);
 
-	return g_ascii_strtoll (_get_value_data (self), NULL, 10);
+	return _get_typed_value (self);
 }
 
 ArvGcNode *
@@ -1049,7 +1233,6 @@ ArvGcStreamable
 arv_gc_property_node_get_streamable (ArvGcPropertyNode *self, ArvGcStreamable default_value)
 {
 	ArvGcPropertyNodePrivate *priv;
-	const char *value;
 
 	if (self == NULL)
 		return default_value;
@@ -1059,14 +1242,7 @@ arv_gc_property_node_get_streamable (ArvGcPropertyNode *self, ArvGcStreamable de
 	g_return_val_if_fail (ARV_IS_GC_PROPERTY_NODE (self), default_value);
 	g_return_val_if_fail (priv->type == ARV_GC_PROPERTY_NODE_TYPE_STREAMABLE, default_value);
 
-	value = _get_value_data (self);
-
-	if (g_strcmp0 (value, "Yes") == 0)
-		return ARV_GC_STREAMABLE_YES;
-	else if (g_strcmp0 (value, "No") == 0)
-		return ARV_GC_STREAMABLE_NO;
-
-	return ARV_GC_STREAMABLE_NO;
+	return _get_typed_value (self);
 }
 
 ArvGcNode *
@@ -1129,6 +1305,7 @@ arv_gc_property_node_init (ArvGcPropertyNode *self)
 	ArvGcPropertyNodePrivate *priv = arv_gc_property_node_get_instance_private (self);
 
 	priv->type = ARV_GC_PROPERTY_NODE_TYPE_UNKNOWN;
+	priv->inline_data = NULL;
 	priv->value_data = NULL;
 	priv->value_data_up_to_date = FALSE;
 }
@@ -1140,6 +1317,7 @@ arv_gc_property_node_finalize (GObject *object)
 
 	G_OBJECT_CLASS (arv_gc_property_node_parent_class)->finalize (object);
 
+	g_free (priv->inline_data);
 	g_free (priv->value_data);
 	g_free (priv->name);
 }
@@ -35,7 +35,7 @@
 #include <arvgcselector.h>
 #include <arvgcfloat.h>
 #include <arvgcstring.h>
-#include <arvgcport.h>
+#include <arvgcportprivate.h>
 #include <arvgcprivate.h>
 #include <arvmiscprivate.h>
 #include <arvdebugprivate.h>
@@ -135,7 +135,6 @@ arv_gc_register_node_post_new_child (ArvDomNode *self, ArvDomNode *child)
 				priv->cachable = property_node;
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_POLLING_TIME:
-				/* TODO */
 				priv->polling_time = property_node;
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_ENDIANNESS:
@@ -416,6 +415,183 @@ _write_to_port (ArvGcRegisterNode *self, gint64 address, gint64 length, void *bu
 		priv->cached = FALSE;
 }
 
+/* Register prefetch
+ *
+ * Only the cachable, readable and not yet cached registers of the device port are prefetched. Their cache content is
+ * the raw data of a memory read, or the big endian value of a register read for the ports using register accesses. */
+
+gboolean
+arv_gc_register_node_get_prefetch_range (ArvGcRegisterNode *self, guint64 *address, guint64 *length,
+					 gboolean *register_access)
+{
+	ArvGcRegisterNodePrivate *priv = arv_gc_register_node_get_instance_private (ARV_GC_REGISTER_NODE (self));
+	GError *local_error = NULL;
+	ArvGcNode *port;
+	ArvGc *genicam;
+	GSList *iter;
+	gint64 register_address;
+	gint64 register_length;
+
+	g_return_val_if_fail (ARV_IS_GC_REGISTER_NODE (self), FALSE);
+	g_return_val_if_fail (address != NULL, FALSE);
+	g_return_val_if_fail (length != NULL, FALSE);
+	g_return_val_if_fail (register_access != NULL, FALSE);
+
+	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (self));
+	g_return_val_if_fail (ARV_IS_GC (genicam), FALSE);
+
+	if (arv_gc_get_register_cache_policy (genicam) != ARV_REGISTER_CACHE_POLICY_ENABLE ||
+	    !arv_gc_register_node_is_value_cachable (self) ||
+	    arv_gc_feature_node_get_actual_access_mode (ARV_GC_FEATURE_NODE (self)) == ARV_GC_ACCESS_MODE_WO)
+		return FALSE;
+
+	/* The invalidator changes are consumed here, the cached flag must reflect them */
+	for (iter = priv->invalidators; iter != NULL; iter = iter->next) {
+		if (arv_gc_invalidator_has_changed (iter->data))
+			priv->cached = FALSE;
+	}
+
+	if (priv->cached)
+		return FALSE;
+
+	register_length = _get_length (self, &local_error);
+	if (local_error == NULL)
+		register_address = _get_address (self, &local_error);
+
+	if (local_error != NULL) {
+		g_clear_error (&local_error);
+		return FALSE;
+	}
+
+	if (register_length <= 0 || register_address < 0)
+		return FALSE;
+
+	port = arv_gc_property_node_get_linked_node (priv->port);
+
+	*address = register_address;
+	*length = register_length;
+	*register_access = arv_gc_port_uses_register_access (ARV_GC_PORT (port), register_length);
+
+	return TRUE;
+}
+
+static gboolean
+_store_data (ArvGcRegisterNode *self, guint64 address, const void *data, guint64 length)
+{
+	ArvGcRegisterNodePrivate *priv = arv_gc_register_node_get_instance_private (ARV_GC_REGISTER_NODE (self));
+	GError *local_error = NULL;
+	gint64 cache_address;
+	gint64 cache_length;
+	void *cache;
+
+	cache = _get_cache (self, &cache_address, &cache_length, &local_error);
+	if (local_error != NULL) {
+		g_clear_error (&local_error);
+		return FALSE;
+	}
+
+	if ((guint64) cache_address != address || (guint64) cache_length != length)
+		return FALSE;
+
+	memcpy (cache, data, length);
+	if (_get_cachable (self) != ARV_GC_CACHABLE_NO_CACHE)
+		priv->cached = TRUE;
+
+	return TRUE;
+}
+
+void
+arv_gc_register_node_set_prefetched_data (ArvGcRegisterNode *self, guint64 address, const void *data, guint64 length)
+{
+	g_return_if_fail (ARV_IS_GC_REGISTER_NODE (self));
+	g_return_if_fail (data != NULL);
+
+	_store_data (self, address, data, length);
+}
+
+/* TRUE if the register is accessed through the device port, instead of the chunk or event data ports */
+
+gboolean
+arv_gc_register_node_is_device_register (ArvGcRegisterNode *self)
+{
+	ArvGcRegisterNodePrivate *priv = arv_gc_register_node_get_instance_private (ARV_GC_REGISTER_NODE (self));
+	ArvGcNode *port;
+
+	g_return_val_if_fail (ARV_IS_GC_REGISTER_NODE (self), FALSE);
+
+	if (priv->port == NULL)
+		return FALSE;
+
+	port = arv_gc_property_node_get_linked_node (priv->port);
+
+	return ARV_IS_GC_PORT (port) && arv_gc_port_is_device_port (ARV_GC_PORT (port));
+}
+
+/* The value of the nodes depending on this register can be cached only if the register content is cached too, which
+ * excludes the not cachable registers and the ones of the chunk and event data ports. */
+
+gboolean
+arv_gc_register_node_is_value_cachable (ArvGcRegisterNode *self)
+{
+	g_return_val_if_fail (ARV_IS_GC_REGISTER_NODE (self), FALSE);
+
+	return _get_cachable (self) != ARV_GC_CACHABLE_NO_CACHE &&
+		arv_gc_register_node_is_device_register (self);
+}
+
+/* Recommended polling period, in milliseconds, or 0 if the register has no PollingTime property */
+
+guint64
+arv_gc_register_node_get_polling_time (ArvGcRegisterNode *self)
+{
+	ArvGcRegisterNodePrivate *priv = arv_gc_register_node_get_instance_private (ARV_GC_REGISTER_NODE (self));
+	GError *local_error = NULL;
+	gint64 polling_time;
+
+	g_return_val_if_fail (ARV_IS_GC_REGISTER_NODE (self), 0);
+
+	if (priv->polling_time == NULL)
+		return 0;
+
+	polling_time = arv_gc_property_node_get_int64 (priv->polling_time, &local_error);
+	if (local_error != NULL) {
+		arv_warning_genicam ("[GcRegisterNode::get_polling_time] Invalid polling time for '%s' (%s)",
+				     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (self)),
+				     local_error->message);
+		g_clear_error (&local_error);
+		return 0;
+	}
+
+	return polling_time > 0 ? polling_time : 0;
+}
+
+/* Stores a register content read by the device poller, and invalidates the values depending on it. The content is
+ * dropped if the register address or length changed since the read, for example after a selector change. */
+
+void
+arv_gc_register_node_set_polled_data (ArvGcRegisterNode *self, guint64 address, const void *data, guint64 length)
+{
+	g_return_if_fail (ARV_IS_GC_REGISTER_NODE (self));
+	g_return_if_fail (data != NULL);
+
+	if (_store_data (self, address, data, length))
+		arv_gc_feature_node_increment_change_count (ARV_GC_FEATURE_NODE (self));
+}
+
+/* Forgets the cached register content, which may not match the device one anymore */
+
+void
+arv_gc_register_node_discard_cache (ArvGcRegisterNode *self)
+{
+	ArvGcRegisterNodePrivate *priv = arv_gc_register_node_get_instance_private (ARV_GC_REGISTER_NODE (self));
+
+	g_return_if_fail (ARV_IS_GC_REGISTER_NODE (self));
+
+	priv->cached = FALSE;
+
+	arv_gc_feature_node_increment_change_count (ARV_GC_FEATURE_NODE (self));
+}
+
 ArvGcNode *
 arv_gc_register_node_new (void)
 {
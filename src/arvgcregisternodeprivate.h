@@ -38,5 +38,20 @@ void 		arv_gc_register_node_set_masked_integer_value 	(ArvGcRegisterNode *gc_reg
 								 gint64 value, GError **error);
 guint 		arv_gc_register_node_get_endianness 		(ArvGcRegisterNode *register_node);
 
+gboolean	arv_gc_register_node_get_prefetch_range		(ArvGcRegisterNode *register_node,
+								 guint64 *address, guint64 *length,
+								 gboolean *register_access);
+void		arv_gc_register_node_set_prefetched_data	(ArvGcRegisterNode *register_node, guint64 address,
+								 const void *data, guint64 length);
+
+gboolean	arv_gc_register_node_is_device_register		(ArvGcRegisterNode *register_node);
+gboolean	arv_gc_register_node_is_value_cachable		(ArvGcRegisterNode *register_node);
+
+guint64		arv_gc_register_node_get_polling_time		(ArvGcRegisterNode *register_node);
+void		arv_gc_register_node_set_polled_data		(ArvGcRegisterNode *register_node, guint64 address,
+								 const void *data, guint64 length);
+
+void		arv_gc_register_node_discard_cache		(ArvGcRegisterNode *register_node);
+
 
 #endif
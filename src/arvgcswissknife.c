@@ -26,7 +26,8 @@
  */
 
 #include <arvgcswissknifeprivate.h>
-#include <arvevaluator.h>
+#include <arvgcfeaturenodeprivate.h>
+#include <arvevaluatorprivate.h>
 #include <arvgcinteger.h>
 #include <arvgcfloat.h>
 #include <arvgcport.h>
@@ -45,6 +46,8 @@ typedef struct {
 	ArvGcPropertyNode *representation;
 
 	ArvEvaluator *formula;
+	gboolean is_formula_set;
+	guint *variable_slots;	/* Evaluator slots of the variables */
 } ArvGcSwissKnifePrivate;
 
 G_DEFINE_ABSTRACT_TYPE_WITH_CODE (ArvGcSwissKnife, arv_gc_swiss_knife, ARV_TYPE_GC_FEATURE_NODE, G_ADD_PRIVATE (ArvGcSwissKnife))
@@ -62,9 +65,11 @@ arv_gc_swiss_knife_post_new_child (ArvDomNode *self, ArvDomNode *child)
 		switch (arv_gc_property_node_get_node_type (property_node)) {
 			case ARV_GC_PROPERTY_NODE_TYPE_P_VARIABLE:
 				priv->variables = g_slist_prepend (priv->variables, property_node);
+				priv->is_formula_set = FALSE;
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_FORMULA:
 				priv->formula_node = property_node;
+				priv->is_formula_set = FALSE;
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_UNIT:
 				priv->unit = property_node;
@@ -74,9 +79,11 @@ arv_gc_swiss_knife_post_new_child (ArvDomNode *self, ArvDomNode *child)
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_EXPRESSION:
 				priv->expressions = g_slist_prepend (priv->expressions, property_node);
+				priv->is_formula_set = FALSE;
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_CONSTANT:
 				priv->constants = g_slist_prepend (priv->constants, property_node);
+				priv->is_formula_set = FALSE;
 				break;
 			default:
 				ARV_DOM_NODE_CLASS (arv_gc_swiss_knife_parent_class)->post_new_child (self, child);
@@ -115,6 +122,7 @@ arv_gc_swiss_knife_finalize (GObject *object)
 	g_slist_free (priv->variables);
 	g_slist_free (priv->expressions);
 	g_slist_free (priv->constants);
+	g_free (priv->variable_slots);
 
 	g_clear_object (&priv->formula);
 
@@ -144,53 +152,67 @@ _update_variables (ArvGcSwissKnife *self, GError **error)
 	GError *local_error = NULL;
 	GSList *iter;
 	const char *expression;
+	guint i;
 
-	if (priv->formula_node != NULL)
-		expression = arv_gc_property_node_get_string (priv->formula_node, &local_error);
-	else
-		expression = "";
-
-	if (local_error != NULL) {
-		g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (self)));
-		return;
-	}
+	/* The formula, the sub-expressions and the constants are literal values, they are set only once in the
+	 * evaluator. */
 
-	arv_evaluator_set_expression (priv->formula, expression);
+	if (!priv->is_formula_set) {
+		if (priv->formula_node != NULL)
+			expression = arv_gc_property_node_get_string (priv->formula_node, &local_error);
+		else
+			expression = "";
 
-	for (iter = priv->expressions; iter != NULL; iter = iter->next) {
-		const char *expression;
-		const char *name;
-
-		expression = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
 		if (local_error != NULL) {
-                        g_propagate_prefixed_error (error, local_error, "[%s] ",
+			g_propagate_prefixed_error (error, local_error, "[%s] ",
                                                     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (self)));
-                        return;
-                }
+			return;
+		}
 
-		name = arv_gc_property_node_get_name (iter->data);
+		arv_evaluator_set_expression (priv->formula, expression);
 
-		arv_evaluator_set_sub_expression (priv->formula, name, expression);
-	}
+		for (iter = priv->expressions; iter != NULL; iter = iter->next) {
+			const char *expression;
+			const char *name;
 
-	for (iter = priv->constants; iter != NULL; iter = iter->next) {
-		const char *constant;
-		const char *name;
+			expression = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
+			if (local_error != NULL) {
+                                g_propagate_prefixed_error (error, local_error, "[%s] ",
+                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (self)));
+                                return;
+                        }
 
-		constant = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
-		if (local_error != NULL) {
-                        g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (self)));
-			return;
+			name = arv_gc_property_node_get_name (iter->data);
+
+			arv_evaluator_set_sub_expression (priv->formula, name, expression);
 		}
 
-		name = arv_gc_property_node_get_name (iter->data);
+		for (iter = priv->constants; iter != NULL; iter = iter->next) {
+			const char *constant;
+			const char *name;
 
-		arv_evaluator_set_constant (priv->formula, name, constant);
+			constant = arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (iter->data), &local_error);
+			if (local_error != NULL) {
+                                g_propagate_prefixed_error (error, local_error, "[%s] ",
+                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (self)));
+				return;
+			}
+
+			name = arv_gc_property_node_get_name (iter->data);
+
+			arv_evaluator_set_constant (priv->formula, name, constant);
+		}
+
+		g_free (priv->variable_slots);
+		priv->variable_slots = g_new (guint, g_slist_length (priv->variables));
+		for (iter = priv->variables, i = 0; iter != NULL; iter = iter->next, i++)
+			priv->variable_slots[i] = arv_evaluator_get_variable_slot (priv->formula,
+										   arv_gc_property_node_get_name (iter->data));
+
+		priv->is_formula_set = TRUE;
 	}
 
-	for (iter = priv->variables; iter != NULL; iter = iter->next) {
+	for (iter = priv->variables, i = 0; iter != NULL; iter = iter->next, i++) {
 		ArvGcPropertyNode *variable_node = iter->data;
 
 		node = arv_gc_property_node_get_linked_node (ARV_GC_PROPERTY_NODE (variable_node));
@@ -205,9 +227,7 @@ _update_variables (ArvGcSwissKnife *self, GError **error)
                                 return;
                         }
 
-			arv_evaluator_set_int64_variable (priv->formula,
-							  arv_gc_property_node_get_name (variable_node),
-							  value);
+			arv_evaluator_set_int64_variable_by_slot (priv->formula, priv->variable_slots[i], value);
 		} else if (ARV_IS_GC_FLOAT (node)) {
 			double value;
 
@@ -219,9 +239,7 @@ _update_variables (ArvGcSwissKnife *self, GError **error)
 				return;
 			}
 
-			arv_evaluator_set_double_variable (priv->formula,
-							  arv_gc_property_node_get_name (variable_node),
-							  value);
+			arv_evaluator_set_double_variable_by_slot (priv->formula, priv->variable_slots[i], value);
 		}
 	}
 }
@@ -231,9 +249,13 @@ arv_gc_swiss_knife_get_integer_value (ArvGcSwissKnife *self, GError **error)
 {
 	ArvGcSwissKnifePrivate *priv = arv_gc_swiss_knife_get_instance_private (self);
 	GError *local_error = NULL;
+	gint64 value;
 
 	g_return_val_if_fail (ARV_IS_GC_SWISS_KNIFE (self), 0);
 
+	if (arv_gc_feature_node_get_cached_int64 (ARV_GC_FEATURE_NODE (self), &value))
+		return value;
+
 	_update_variables (self, &local_error);
 
 	if (local_error != NULL) {
@@ -242,7 +264,15 @@ arv_gc_swiss_knife_get_integer_value (ArvGcSwissKnife *self, GError **error)
                 return 0;
         }
 
-	return arv_evaluator_evaluate_as_int64 (priv->formula, NULL);
+	value = arv_evaluator_evaluate_as_int64 (priv->formula, &local_error);
+
+	/* Evaluation errors are not reported, but their result is not cached */
+	if (local_error == NULL)
+		arv_gc_feature_node_set_cached_int64 (ARV_GC_FEATURE_NODE (self), value);
+	else
+		g_clear_error (&local_error);
+
+	return value;
 }
 
 double
@@ -250,9 +280,13 @@ arv_gc_swiss_knife_get_float_value (ArvGcSwissKnife *self, GError **error)
 {
 	ArvGcSwissKnifePrivate *priv = arv_gc_swiss_knife_get_instance_private (self);
 	GError *local_error = NULL;
+	double value;
 
 	g_return_val_if_fail (ARV_IS_GC_SWISS_KNIFE (self), 0.0);
 
+	if (arv_gc_feature_node_get_cached_double (ARV_GC_FEATURE_NODE (self), &value))
+		return value;
+
 	_update_variables (self, &local_error);
 
 	if (local_error != NULL) {
@@ -261,7 +295,14 @@ arv_gc_swiss_knife_get_float_value (ArvGcSwissKnife *self, GError **error)
 		return 0.0;
 	}
 
-	return arv_evaluator_evaluate_as_double (priv->formula, NULL);
+	value = arv_evaluator_evaluate_as_double (priv->formula, &local_error);
+
+	if (local_error == NULL)
+		arv_gc_feature_node_set_cached_double (ARV_GC_FEATURE_NODE (self), value);
+	else
+		g_clear_error (&local_error);
+
+	return value;
 }
 
 ArvGcRepresentation
@@ -0,0 +1,89 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+#ifndef ARV_GENDC_PRIVATE_H
+#define ARV_GENDC_PRIVATE_H
+
+#include <arvtypes.h>
+
+G_BEGIN_DECLS
+
+/* GenDC container layout, shared by the USB3Vision and GigE Vision streams. All the fields are little endian. */
+
+#define ARV_GENDC_SIGNATURE			0x43444E47	/* "GNDC" */
+#define ARV_GENDC_COMPONENT_TYPE_INTENSITY	0x0000000000000001	/* GDC_INTENSITY from SFNC */
+
+#pragma pack(push,1)
+
+typedef struct {
+	guint32 signature;
+	guint32 version_with_0;
+	guint16 header_type;
+	guint16 flags;
+	guint32 header_size;
+	guint64 id;
+	guint64 variable_field_with_0;
+	guint64 datasize;
+	guint64 dataoffset;
+	guint32 descriptorsize;
+	guint32 component_count;
+} ArvGenDCContainerHeader;	/* Followed by the 64 bit component offsets */
+
+typedef struct {
+	guint16 header_type;
+	guint16 flags;
+	guint32 header_size;
+	guint16 reserved;
+	guint16 groupid;
+	guint16 sourceid;
+	guint16 regionid;
+	guint32 region_offset_x;
+	guint32 region_offset_y;
+	guint64 timestamp;
+	guint64 type_id;
+	guint32 format;
+	guint16 reserved2;
+	guint16 part_count;
+} ArvGenDCComponentHeader;	/* Followed by the 64 bit part offsets */
+
+typedef struct {
+	guint16 header_type;
+	guint16 flags;
+	guint32 header_size;
+	guint32 format;
+	guint16 reserved;
+	guint16 flow_id;
+	guint64 flowoffset;
+	guint64 datasize;
+	guint64 dataoffset;
+	guint32 dimension_x;
+	guint32 dimension_y;
+	guint16 padding_x;
+	guint16 padding_y;
+	guint32 info_reserved;
+} ArvGenDCPartHeader;
+
+#pragma pack(pop)
+
+G_END_DECLS
+
+#endif
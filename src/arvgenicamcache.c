@@ -0,0 +1,233 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ */
+
+/* On disk cache of the Genicam data downloaded from the devices.
+ *
+ * The uncompressed Genicam data are stored in $XDG_CACHE_HOME/aravis, under a name derived from a hash of the device
+ * identity and of the Genicam file location, such that a firmware upgrade changing the file location, size or
+ * checksum doesn't use a stale description. The cache can be disabled by setting the ARV_GENICAM_CACHE environment
+ * variable to "disable". Setting it to "enable" also caches the data of the devices which don't provide a checksum of
+ * their Genicam file, for which a stale description can not be detected. */
+
+#include <arvgenicamcacheprivate.h>
+#include <arvdebugprivate.h>
+#include <glib/gstdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+/* Increment when the content of the cache files changes */
+#define ARV_GENICAM_CACHE_FORMAT_VERSION	"1"
+
+static GMutex arv_genicam_cache_mutex;
+static char *arv_genicam_cache_directory = NULL;
+
+static char *
+_get_cache_directory (void)
+{
+	const char *setting;
+	char *directory;
+
+	setting = g_getenv ("ARV_GENICAM_CACHE");
+	if (g_strcmp0 (setting, "disable") == 0 || g_strcmp0 (setting, "0") == 0)
+		return NULL;
+
+	g_mutex_lock (&arv_genicam_cache_mutex);
+	if (arv_genicam_cache_directory != NULL)
+		directory = g_strdup (arv_genicam_cache_directory);
+	else
+		directory = g_build_filename (g_get_user_cache_dir (), "aravis", NULL);
+	g_mutex_unlock (&arv_genicam_cache_mutex);
+
+	return directory;
+}
+
+/*
+ * arv_genicam_cache_set_directory:
+ * @directory: (nullable): cache directory, %NULL for the default location
+ *
+ * Overrides the cache location, mainly for testing purpose.
+ */
+
+void
+arv_genicam_cache_set_directory (const char *directory)
+{
+	g_mutex_lock (&arv_genicam_cache_mutex);
+	g_free (arv_genicam_cache_directory);
+	arv_genicam_cache_directory = g_strdup (directory);
+	g_mutex_unlock (&arv_genicam_cache_mutex);
+}
+
+/*
+ * arv_genicam_cache_is_forced:
+ *
+ * Returns: %TRUE if the ARV_GENICAM_CACHE environment variable is set to "enable", in which case the Genicam data
+ * without checksum are also cached.
+ */
+
+gboolean
+arv_genicam_cache_is_forced (void)
+{
+	const char *setting;
+
+	setting = g_getenv ("ARV_GENICAM_CACHE");
+
+	return g_strcmp0 (setting, "enable") == 0 || g_strcmp0 (setting, "1") == 0;
+}
+
+static char *
+_get_cache_filename (const char *key)
+{
+	char *directory;
+	char *basename;
+	char *filename;
+
+	directory = _get_cache_directory ();
+	if (directory == NULL)
+		return NULL;
+
+	basename = g_strdup_printf ("genicam-%s.xml", key);
+	filename = g_build_filename (directory, basename, NULL);
+
+	g_free (basename);
+	g_free (directory);
+
+	return filename;
+}
+
+/*
+ * arv_genicam_cache_compute_key:
+ * @component: first component of the key
+ * @...: %NULL terminated list of additional components
+ *
+ * Returns: a newly allocated key, built from a hash of all the components. %NULL components are considered as empty
+ * strings.
+ */
+
+char *
+arv_genicam_cache_compute_key (const char *component, ...)
+{
+	GChecksum *checksum;
+	va_list args;
+	char *key;
+
+	checksum = g_checksum_new (G_CHECKSUM_SHA256);
+
+	g_checksum_update (checksum, (const guchar *) ARV_GENICAM_CACHE_FORMAT_VERSION,
+			   sizeof (ARV_GENICAM_CACHE_FORMAT_VERSION));
+
+	va_start (args, component);
+	for (; component != NULL; component = va_arg (args, const char *))
+		/* The terminating null character separates the components */
+		g_checksum_update (checksum, (const guchar *) component, strlen (component) + 1);
+	va_end (args);
+
+	key = g_strdup (g_checksum_get_string (checksum));
+
+	g_checksum_free (checksum);
+
+	return key;
+}
+
+/*
+ * arv_genicam_cache_load:
+ * @key: (nullable): a key returned by arv_genicam_cache_compute_key()
+ * @size: (out): size of the returned data
+ *
+ * Returns: a newly allocated copy of the cached Genicam data, or %NULL if not found.
+ */
+
+char *
+arv_genicam_cache_load (const char *key, size_t *size)
+{
+	char *filename;
+	char *xml = NULL;
+	gsize length = 0;
+
+	g_return_val_if_fail (size != NULL, NULL);
+
+	*size = 0;
+
+	if (key == NULL)
+		return NULL;
+
+	filename = _get_cache_filename (key);
+	if (filename == NULL)
+		return NULL;
+
+	if (g_file_get_contents (filename, &xml, &length, NULL) && length > 0) {
+		arv_info_device ("[GenicamCache::load] Genicam data loaded from %s", filename);
+		*size = length;
+	} else
+		g_clear_pointer (&xml, g_free);
+
+	g_free (filename);
+
+	return xml;
+}
+
+/*
+ * arv_genicam_cache_save:
+ * @key: (nullable): a key returned by arv_genicam_cache_compute_key()
+ * @xml: Genicam data
+ * @size: size of @xml
+ *
+ * Stores the Genicam data in the cache. The file is replaced atomically, such that concurrent loads never see a
+ * partial content.
+ *
+ * Returns: %TRUE on success.
+ */
+
+gboolean
+arv_genicam_cache_save (const char *key, const char *xml, size_t size)
+{
+	GError *error = NULL;
+	char *directory;
+	char *filename;
+	gboolean success = FALSE;
+
+	g_return_val_if_fail (xml != NULL || size == 0, FALSE);
+
+	if (key == NULL || size == 0)
+		return FALSE;
+
+	directory = _get_cache_directory ();
+	if (directory == NULL)
+		return FALSE;
+
+	filename = _get_cache_filename (key);
+
+	if (g_mkdir_with_parents (directory, 0700) != 0)
+		arv_warning_device ("[GenicamCache::save] Failed to create %s", directory);
+	else if (!g_file_set_contents (filename, xml, size, &error)) {
+		arv_warning_device ("[GenicamCache::save] Failed to write %s (%s)", filename, error->message);
+		g_clear_error (&error);
+	} else {
+		arv_info_device ("[GenicamCache::save] Genicam data stored in %s", filename);
+		success = TRUE;
+	}
+
+	g_free (filename);
+	g_free (directory);
+
+	return success;
+}
@@ -0,0 +1,40 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ */
+
+#ifndef ARV_GENICAM_CACHE_PRIVATE_H
+#define ARV_GENICAM_CACHE_PRIVATE_H
+
+#include <arvapi.h>
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+ARV_API char *		arv_genicam_cache_compute_key	(const char *component, ...) G_GNUC_NULL_TERMINATED;
+ARV_API char *		arv_genicam_cache_load		(const char *key, size_t *size);
+ARV_API gboolean	arv_genicam_cache_save		(const char *key, const char *xml, size_t size);
+ARV_API void		arv_genicam_cache_set_directory	(const char *directory);
+ARV_API gboolean	arv_genicam_cache_is_forced	(void);
+
+G_END_DECLS
+
+#endif
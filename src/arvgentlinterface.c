@@ -321,6 +321,8 @@ arv_gentl_interface_update_device_list (ArvInterface *interface, GArray *device_
 	_discover(gentl_interface, device_ids);
 }
 
+static GMutex arv_gentl_interface_open_mutex;
+
 static ArvDevice *
 arv_gentl_interface_open_device (ArvInterface *interface, const char *key, GError **error)
 {
@@ -328,6 +330,9 @@ arv_gentl_interface_open_device (ArvInterface *interface, const char *key, GErro
 	ArvDevice *device = NULL;
 	ArvGenTLInterfaceDeviceInfos *device_infos = NULL;
 
+	/* The device list may be refreshed here, serialize concurrent openings */
+	g_mutex_lock (&arv_gentl_interface_open_mutex);
+
         if (key == NULL) {
 		GList *device_list;
 
@@ -354,6 +359,8 @@ arv_gentl_interface_open_device (ArvInterface *interface, const char *key, GErro
 	if (device_infos)
 		device = arv_gentl_device_new (device_infos->system, device_infos->interface, device_infos->guid, error);
 
+	g_mutex_unlock (&arv_gentl_interface_open_mutex);
+
 	return device;
 }
 
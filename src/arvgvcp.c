@@ -186,114 +186,191 @@ arv_gvcp_packet_new_write_memory_ack (guint32 address,
 }
 
 /**
- * arv_gvcp_packet_new_read_register_cmd: (skip)
- * @address: write address
+ * arv_gvcp_packet_new_read_registers_cmd: (skip)
+ * @addresses: (array length=n_addresses): register addresses
+ * @n_addresses: number of addresses, at most %ARV_GVCP_N_READ_REGISTERS_MAX
  * @packet_id: packet id
  * @packet_size: (out): packet size, in bytes
  * Return value: (transfer full): a new #ArvGvcpPacket
  *
- * Create a gvcp packet for a register read command.
+ * Create a gvcp packet for a multiple register read command.
  */
 
 ArvGvcpPacket *
-arv_gvcp_packet_new_read_register_cmd (guint32 address,
-				       guint16 packet_id,
-				       size_t *packet_size)
+arv_gvcp_packet_new_read_registers_cmd (const guint32 *addresses, guint n_addresses,
+					guint16 packet_id,
+					size_t *packet_size)
 {
 	ArvGvcpPacket *packet;
-	guint32 n_address = g_htonl (address);
+	guint i;
 
+	g_return_val_if_fail (addresses != NULL, NULL);
+	g_return_val_if_fail (n_addresses > 0 && n_addresses <= ARV_GVCP_N_READ_REGISTERS_MAX, NULL);
 	g_return_val_if_fail (packet_size != NULL, NULL);
 
-	*packet_size = sizeof (ArvGvcpHeader) + sizeof (guint32);
+	*packet_size = sizeof (ArvGvcpHeader) + n_addresses * sizeof (guint32);
 
 	packet = g_malloc (*packet_size);
 
 	packet->header.packet_type = ARV_GVCP_PACKET_TYPE_CMD;
 	packet->header.packet_flags = ARV_GVCP_CMD_PACKET_FLAGS_ACK_REQUIRED;
 	packet->header.command = g_htons (ARV_GVCP_COMMAND_READ_REGISTER_CMD);
-	packet->header.size = g_htons (sizeof (guint32));
+	packet->header.size = g_htons (n_addresses * sizeof (guint32));
 	packet->header.id = g_htons (packet_id);
 
-	memcpy (&packet->data, &n_address, sizeof (guint32));
+	for (i = 0; i < n_addresses; i++) {
+		guint32 n_address = g_htonl (addresses[i]);
+
+		memcpy (&packet->data[i * sizeof (guint32)], &n_address, sizeof (guint32));
+	}
 
 	return packet;
 }
 
 /**
- * arv_gvcp_packet_new_read_register_ack: (skip)
- * @value: read value
+ * arv_gvcp_packet_new_read_register_cmd: (skip)
+ * @address: write address
  * @packet_id: packet id
  * @packet_size: (out): packet size, in bytes
  * Return value: (transfer full): a new #ArvGvcpPacket
  *
- * Create a gvcp packet for a register read acknowledge.
+ * Create a gvcp packet for a register read command.
  */
 
 ArvGvcpPacket *
-arv_gvcp_packet_new_read_register_ack (guint32 value,
+arv_gvcp_packet_new_read_register_cmd (guint32 address,
 				       guint16 packet_id,
 				       size_t *packet_size)
+{
+	return arv_gvcp_packet_new_read_registers_cmd (&address, 1, packet_id, packet_size);
+}
+
+/**
+ * arv_gvcp_packet_new_read_registers_ack: (skip)
+ * @values: (array length=n_values): read values
+ * @n_values: number of values, at most %ARV_GVCP_N_READ_REGISTERS_MAX
+ * @packet_id: packet id
+ * @packet_size: (out): packet size, in bytes
+ * Return value: (transfer full): a new #ArvGvcpPacket
+ *
+ * Create a gvcp packet for a multiple register read acknowledge.
+ */
+
+ArvGvcpPacket *
+arv_gvcp_packet_new_read_registers_ack (const guint32 *values, guint n_values,
+					guint16 packet_id,
+					size_t *packet_size)
 {
 	ArvGvcpPacket *packet;
-	guint32 n_value = g_htonl (value);
+	guint i;
 
+	g_return_val_if_fail (values != NULL, NULL);
+	g_return_val_if_fail (n_values > 0 && n_values <= ARV_GVCP_N_READ_REGISTERS_MAX, NULL);
 	g_return_val_if_fail (packet_size != NULL, NULL);
 
-	*packet_size = arv_gvcp_packet_get_read_register_ack_size ();
+	*packet_size = arv_gvcp_packet_get_read_registers_ack_size (n_values);
 
 	packet = g_malloc (*packet_size);
 
 	packet->header.packet_type = ARV_GVCP_PACKET_TYPE_ACK;
 	packet->header.packet_flags = 0;
 	packet->header.command = g_htons (ARV_GVCP_COMMAND_READ_REGISTER_ACK);
-	packet->header.size = g_htons (sizeof (guint32));
+	packet->header.size = g_htons (n_values * sizeof (guint32));
 	packet->header.id = g_htons (packet_id);
 
-	memcpy (&packet->data, &n_value, sizeof (guint32));
+	for (i = 0; i < n_values; i++) {
+		guint32 n_value = g_htonl (values[i]);
+
+		memcpy (&packet->data[i * sizeof (guint32)], &n_value, sizeof (guint32));
+	}
 
 	return packet;
 }
 
 /**
- * arv_gvcp_packet_new_write_register_cmd: (skip)
- * @address: write address
- * @value: value to write
+ * arv_gvcp_packet_new_read_register_ack: (skip)
+ * @value: read value
  * @packet_id: packet id
  * @packet_size: (out): packet size, in bytes
  * Return value: (transfer full): a new #ArvGvcpPacket
  *
- * Create a gvcp packet for a register write command.
+ * Create a gvcp packet for a register read acknowledge.
  */
 
 ArvGvcpPacket *
-arv_gvcp_packet_new_write_register_cmd (guint32 address,
-					guint32 value,
-					guint16 packet_id,
-					size_t *packet_size)
+arv_gvcp_packet_new_read_register_ack (guint32 value,
+				       guint16 packet_id,
+				       size_t *packet_size)
+{
+	return arv_gvcp_packet_new_read_registers_ack (&value, 1, packet_id, packet_size);
+}
+
+/**
+ * arv_gvcp_packet_new_write_registers_cmd: (skip)
+ * @addresses: (array length=n_registers): register addresses
+ * @values: (array length=n_registers): values to write
+ * @n_registers: number of registers, at most %ARV_GVCP_N_WRITE_REGISTERS_MAX
+ * @packet_id: packet id
+ * @packet_size: (out): packet size, in bytes
+ * Return value: (transfer full): a new #ArvGvcpPacket
+ *
+ * Create a gvcp packet for a multiple register write command. The registers are written in order by the device.
+ */
+
+ArvGvcpPacket *
+arv_gvcp_packet_new_write_registers_cmd (const guint32 *addresses, const guint32 *values, guint n_registers,
+					 guint16 packet_id,
+					 size_t *packet_size)
 {
 	ArvGvcpPacket *packet;
-	guint32 n_address = g_htonl (address);
-	guint32 n_value = g_htonl (value);
+	guint i;
 
+	g_return_val_if_fail (addresses != NULL, NULL);
+	g_return_val_if_fail (values != NULL, NULL);
+	g_return_val_if_fail (n_registers > 0 && n_registers <= ARV_GVCP_N_WRITE_REGISTERS_MAX, NULL);
 	g_return_val_if_fail (packet_size != NULL, NULL);
 
-	*packet_size = sizeof (ArvGvcpHeader) + 2 * sizeof (guint32);
+	*packet_size = sizeof (ArvGvcpHeader) + 2 * n_registers * sizeof (guint32);
 
 	packet = g_malloc (*packet_size);
 
 	packet->header.packet_type = ARV_GVCP_PACKET_TYPE_CMD;
 	packet->header.packet_flags = ARV_GVCP_CMD_PACKET_FLAGS_ACK_REQUIRED;
 	packet->header.command = g_htons (ARV_GVCP_COMMAND_WRITE_REGISTER_CMD);
-	packet->header.size = g_htons (2 * sizeof (guint32));
+	packet->header.size = g_htons (2 * n_registers * sizeof (guint32));
 	packet->header.id = g_htons (packet_id);
 
-	memcpy (&packet->data, &n_address, sizeof (guint32));
-	memcpy (&packet->data[sizeof (guint32)], &n_value, sizeof (guint32));
+	for (i = 0; i < n_registers; i++) {
+		guint32 n_address = g_htonl (addresses[i]);
+		guint32 n_value = g_htonl (values[i]);
+
+		memcpy (&packet->data[2 * i * sizeof (guint32)], &n_address, sizeof (guint32));
+		memcpy (&packet->data[(2 * i + 1) * sizeof (guint32)], &n_value, sizeof (guint32));
+	}
 
 	return packet;
 }
 
+/**
+ * arv_gvcp_packet_new_write_register_cmd: (skip)
+ * @address: write address
+ * @value: value to write
+ * @packet_id: packet id
+ * @packet_size: (out): packet size, in bytes
+ * Return value: (transfer full): a new #ArvGvcpPacket
+ *
+ * Create a gvcp packet for a register write command.
+ */
+
+ArvGvcpPacket *
+arv_gvcp_packet_new_write_register_cmd (guint32 address,
+					guint32 value,
+					guint16 packet_id,
+					size_t *packet_size)
+{
+	return arv_gvcp_packet_new_write_registers_cmd (&address, &value, 1, packet_id, packet_size);
+}
+
 /**
  * arv_gvcp_packet_new_write_register_ack: (skip)
  * @data_index: data index
@@ -571,6 +648,7 @@ arv_gvcp_packet_to_string (const ArvGvcpPacket *packet)
 	char *data;
 	int packet_size;
 	guint32 value;
+	int i;
 
 	g_return_val_if_fail (packet != NULL, NULL);
 
@@ -617,12 +695,14 @@ arv_gvcp_packet_to_string (const ArvGvcpPacket *packet)
 						data[ARV_GVBS_CURRENT_IP_ADDRESS_OFFSET + 3] & 0xff);
 			break;
 		case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
-			value = g_ntohl (*((guint32 *) &data[0]));
-			g_string_append_printf (string, "address      = %10u (0x%08x)\n",
-						value, value);
-			value = g_ntohl (*((guint32 *) &data[4]));
-			g_string_append_printf (string, "value        = %10u (0x%08x)\n",
-						value, value);
+			for (i = 0; i + 8 <= g_ntohs (packet->header.size); i += 8) {
+				value = g_ntohl (*((guint32 *) &data[i]));
+				g_string_append_printf (string, "address      = %10u (0x%08x)\n",
+							value, value);
+				value = g_ntohl (*((guint32 *) &data[i + 4]));
+				g_string_append_printf (string, "value        = %10u (0x%08x)\n",
+							value, value);
+			}
 			break;
 		case ARV_GVCP_COMMAND_WRITE_REGISTER_ACK:
 			value = g_ntohl (*((guint32 *) &data[0]));
@@ -630,14 +710,18 @@ arv_gvcp_packet_to_string (const ArvGvcpPacket *packet)
 						value, value);
 			break;
 		case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
-			value = g_ntohl (*((guint32 *) &data[0]));
-			g_string_append_printf (string, "address      = %10u (0x%08x)\n",
-						value, value);
+			for (i = 0; i + 4 <= g_ntohs (packet->header.size); i += 4) {
+				value = g_ntohl (*((guint32 *) &data[i]));
+				g_string_append_printf (string, "address      = %10u (0x%08x)\n",
+							value, value);
+			}
 			break;
 		case ARV_GVCP_COMMAND_READ_REGISTER_ACK:
-			value = g_ntohl (*((guint32 *) &data[0]));
-			g_string_append_printf (string, "value        = %10u (0x%08x)\n",
-						value, value);
+			for (i = 0; i + 4 <= g_ntohs (packet->header.size); i += 4) {
+				value = g_ntohl (*((guint32 *) &data[i]));
+				g_string_append_printf (string, "value        = %10u (0x%08x)\n",
+							value, value);
+			}
 			break;
 		case ARV_GVCP_COMMAND_READ_MEMORY_CMD:
 			value = g_ntohl (*((guint32 *) &data[0]));
@@ -138,6 +138,9 @@ G_BEGIN_DECLS
 
 #define ARV_GVCP_DATA_SIZE_MAX				512
 
+#define ARV_GVCP_N_READ_REGISTERS_MAX			(ARV_GVCP_DATA_SIZE_MAX / sizeof (guint32))
+#define ARV_GVCP_N_WRITE_REGISTERS_MAX			(ARV_GVCP_DATA_SIZE_MAX / (2 * sizeof (guint32)))
+
 /**
  * ArvGvcpPacketType:
  * @ARV_GVCP_PACKET_TYPE_ACK: acknowledge packet
@@ -334,6 +337,13 @@ ArvGvcpPacket * 	arv_gvcp_packet_new_write_register_cmd 	(guint32 address, guint
 								 guint16 packet_id, size_t *packet_size);
 ArvGvcpPacket * 	arv_gvcp_packet_new_write_register_ack 	(guint32 data_index,
 								 guint16 packet_id, size_t *packet_size);
+ArvGvcpPacket * 	arv_gvcp_packet_new_read_registers_cmd 	(const guint32 *addresses, guint n_addresses,
+								 guint16 packet_id, size_t *packet_size);
+ArvGvcpPacket * 	arv_gvcp_packet_new_read_registers_ack 	(const guint32 *values, guint n_values,
+								 guint16 packet_id, size_t *packet_size);
+ArvGvcpPacket * 	arv_gvcp_packet_new_write_registers_cmd	(const guint32 *addresses, const guint32 *values,
+								 guint n_registers,
+								 guint16 packet_id, size_t *packet_size);
 ArvGvcpPacket * 	arv_gvcp_packet_new_discovery_cmd 	(gboolean allow_broadcast_discovery_ack, size_t *packet_size);
 ArvGvcpPacket * 	arv_gvcp_packet_new_discovery_ack 	(guint16 packet_id, size_t *packet_size);
 ArvGvcpPacket * 	arv_gvcp_packet_new_packet_resend_cmd 	(guint64 frame_id,
@@ -488,10 +498,43 @@ arv_gvcp_packet_get_read_register_cmd_infos (const ArvGvcpPacket *packet, size_t
 		*address = g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket))));
 }
 
+static inline guint
+arv_gvcp_packet_get_read_registers_cmd_n_addresses (const ArvGvcpPacket *packet, size_t packet_size)
+{
+	if G_UNLIKELY(packet == NULL || packet_size < sizeof (ArvGvcpPacket))
+		return 0;
+
+	return MIN (g_ntohs (packet->header.size), packet_size - sizeof (ArvGvcpPacket)) / sizeof (guint32);
+}
+
+static inline guint32
+arv_gvcp_packet_get_read_registers_cmd_address (const ArvGvcpPacket *packet, size_t packet_size, guint index)
+{
+	if G_UNLIKELY(index >= arv_gvcp_packet_get_read_registers_cmd_n_addresses (packet, packet_size))
+		return 0;
+
+	return g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket) + index * sizeof (guint32))));
+}
+
+static inline size_t
+arv_gvcp_packet_get_read_registers_ack_size (guint n_values)
+{
+	return sizeof (ArvGvcpHeader) + n_values * sizeof (guint32);
+}
+
+static inline guint32
+arv_gvcp_packet_get_read_registers_ack_value (const ArvGvcpPacket *packet, size_t packet_size, guint index)
+{
+	if G_UNLIKELY(packet == NULL || packet_size < arv_gvcp_packet_get_read_registers_ack_size (index + 1))
+		return 0;
+
+	return g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket) + index * sizeof (guint32))));
+}
+
 static inline size_t
 arv_gvcp_packet_get_read_register_ack_size (void)
 {
-	return sizeof (ArvGvcpHeader) + sizeof (guint32);
+	return arv_gvcp_packet_get_read_registers_ack_size (1);
 }
 
 static inline guint32
@@ -521,12 +564,52 @@ arv_gvcp_packet_get_write_register_cmd_infos (const ArvGvcpPacket *packet, size_
 		*value = g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket) + sizeof (guint32))));
 }
 
+static inline guint
+arv_gvcp_packet_get_write_registers_cmd_n_registers (const ArvGvcpPacket *packet, size_t packet_size)
+{
+	if G_UNLIKELY(packet == NULL || packet_size < sizeof (ArvGvcpPacket))
+		return 0;
+
+	return MIN (g_ntohs (packet->header.size), packet_size - sizeof (ArvGvcpPacket)) / (2 * sizeof (guint32));
+}
+
+static inline void
+arv_gvcp_packet_get_write_registers_cmd_infos (const ArvGvcpPacket *packet, size_t packet_size, guint index,
+					       guint32 *address, guint32 *value)
+{
+	const char *data = (const char *) packet + sizeof (ArvGvcpPacket) + 2 * index * sizeof (guint32);
+
+	if G_UNLIKELY(index >= arv_gvcp_packet_get_write_registers_cmd_n_registers (packet, packet_size)) {
+		if (address != NULL)
+			*address = 0;
+		if (value != NULL)
+			*value = 0;
+		return;
+	}
+
+	if (address != NULL)
+		*address = g_ntohl (*((guint32 *) data));
+	if (value != NULL)
+		*value = g_ntohl (*((guint32 *) (data + sizeof (guint32))));
+}
+
 static inline size_t
 arv_gvcp_packet_get_write_register_ack_size (void)
 {
 	return sizeof (ArvGvcpHeader) + sizeof (guint32);
 }
 
+/* Index of the last successful write, for multiple register writes */
+
+static inline guint16
+arv_gvcp_packet_get_write_register_ack_index (const ArvGvcpPacket *packet, size_t packet_size)
+{
+	if G_UNLIKELY(packet == NULL || packet_size < arv_gvcp_packet_get_write_register_ack_size ())
+		return 0;
+
+	return g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket)))) & 0xffff;
+}
+
 static inline guint16
 arv_gvcp_next_packet_id (guint16 packet_id)
 {
@@ -536,6 +619,42 @@ arv_gvcp_next_packet_id (guint16 packet_id)
 	return packet_id + 1;
 }
 
+static inline gboolean
+arv_gvcp_packet_get_packet_resend_cmd_infos (const ArvGvcpPacket *packet, size_t packet_size,
+					     guint64 *frame_id, guint32 *first_block, guint32 *last_block)
+{
+	const guint32 *data;
+	gboolean extended_ids;
+
+	if G_UNLIKELY(packet == NULL || packet_size < sizeof (ArvGvcpPacket) + 3 * sizeof (guint32))
+		return FALSE;
+
+	extended_ids = (packet->header.packet_flags & ARV_GVCP_CMD_PACKET_FLAGS_EXTENDED_IDS) != 0;
+	if G_UNLIKELY(extended_ids && packet_size < sizeof (ArvGvcpPacket) + 5 * sizeof (guint32))
+		return FALSE;
+
+	data = (const guint32 *) ((const char *) packet + sizeof (ArvGvcpPacket));
+
+	if (extended_ids) {
+		if (frame_id != NULL)
+			*frame_id = ((guint64) g_ntohl (data[3]) << 32) | g_ntohl (data[4]);
+		if (first_block != NULL)
+			*first_block = g_ntohl (data[1]);
+		if (last_block != NULL)
+			*last_block = g_ntohl (data[2]);
+	} else {
+		/* With regular ids, the frame id is 16 bits and the block ids 24 bits wide */
+		if (frame_id != NULL)
+			*frame_id = g_ntohl (data[0]) & 0xffff;
+		if (first_block != NULL)
+			*first_block = g_ntohl (data[1]) & 0x00ffffff;
+		if (last_block != NULL)
+			*last_block = g_ntohl (data[2]) & 0x00ffffff;
+	}
+
+	return TRUE;
+}
+
 static inline size_t
 arv_gvcp_packet_get_pending_ack_size (void)
 {
@@ -37,8 +37,10 @@
 #include <arvgvspprivate.h>
 #include <arvnetworkprivate.h>
 #include <arvzip.h>
+#include <arvgenicamcacheprivate.h>
 #include <arvstr.h>
 #include <arvmiscprivate.h>
+#include <arvwakeupprivate.h>
 #include <arvenumtypes.h>
 #include <string.h>
 #include <stdlib.h>
@@ -50,11 +52,13 @@ enum
 	PROP_0,
 	PROP_GV_DEVICE_INTERFACE_ADDRESS,
 	PROP_GV_DEVICE_DEVICE_ADDRESS,
-	PROP_GV_DEVICE_PACKET_SIZE_ADJUSTEMENT
+	PROP_GV_DEVICE_PACKET_SIZE_ADJUSTEMENT,
+	PROP_GV_DEVICE_GVCP_WINDOW
 };
 
 typedef struct {
 	GMutex mutex;
+	GCond cond;
 
 	guint16 packet_id;
 
@@ -68,6 +72,15 @@ typedef struct {
 
 	unsigned int gvcp_n_retries;
 	unsigned int gvcp_timeout_ms;
+	unsigned int gvcp_window;
+
+	GQueue queued_requests;
+	GPtrArray *pending_requests;
+
+	ArvWakeup *wakeup;
+	GThread *control_thread;
+	gint64 control_deadline_ms;
+	gboolean cancel;
 
 	gboolean is_controller;
 } ArvGvDeviceIOData;
@@ -90,9 +103,11 @@ typedef struct {
 
 	gboolean is_packet_resend_supported;
 	gboolean is_write_memory_supported;
+	gboolean is_concatenation_supported;
 
 	ArvGvStreamOption stream_options;
 	ArvGvPacketSizeAdjustment packet_size_adjustment;
+	guint gvcp_window;
 
 	gboolean first_stream_created;
 
@@ -134,238 +149,543 @@ arv_gvcp_error_to_device_error (ArvGvcpError code)
         return ARV_DEVICE_ERROR_PROTOCOL_ERROR;
 }
 
-static gboolean
-_send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
-			   guint64 address, size_t size, void *buffer, GError **error)
-{
+/* GVCP control channel
+ *
+ * The GVCP commands are sent and acknowledged by a control thread, which keeps up to gvcp_window commands in flight,
+ * and matches the acknowledges with the pending commands using their packet id. The commands are grouped in
+ * transactions, which are completed when all their commands are acknowledged or timed out. The synchronous API waits
+ * for the transaction completion, while the asynchronous one returns a GTask. */
+
+typedef struct {
+	GTask *task;
+	gboolean is_read_register;
+
+	guint n_pending_requests;
+	gboolean is_completed;
+
+	guint32 value;
+	GError *error;
+} ArvGvDeviceTransaction;
+
+typedef struct {
+	ArvGvDeviceTransaction *transaction;
+
+	ArvGvcpCommand command;
 	ArvGvcpCommand expected_ack_command;
-	ArvGvcpPacket *ack_packet = io_data->buffer;
-	ArvGvcpPacket *packet;
 	const char *operation;
-	size_t packet_size;
 	size_t ack_size;
-	unsigned int n_retries = 0;
-	gboolean success = FALSE;
-	ArvGvcpError command_error = ARV_GVCP_ERROR_NONE;
-	int count;
+
+	guint32 size;
+	void *buffer;
+
+	ArvGvcpPacket *packet;
+	size_t packet_size;
+	guint16 packet_id;
+
+	unsigned int n_sends;
+	gint64 deadline_ms;
+} ArvGvDeviceRequest;
+
+static void
+_release_transaction_locked (ArvGvDeviceIOData *io_data, ArvGvDeviceTransaction *transaction, GSList **completed)
+{
+	g_return_if_fail (transaction->n_pending_requests > 0);
+
+	transaction->n_pending_requests--;
+	if (transaction->n_pending_requests > 0)
+		return;
+
+	transaction->is_completed = TRUE;
+
+	if (transaction->task != NULL)
+		*completed = g_slist_prepend (*completed, transaction);
+	else
+		g_cond_broadcast (&io_data->cond);
+}
+
+/* Must be called without holding the io_data mutex, as the task callbacks may be invoked synchronously */
+
+static void
+_return_transactions (GSList *completed)
+{
+	GSList *iter;
+
+	for (iter = completed; iter != NULL; iter = iter->next) {
+		ArvGvDeviceTransaction *transaction = iter->data;
+
+		if (transaction->error != NULL)
+			g_task_return_error (transaction->task, transaction->error);
+		else if (transaction->is_read_register)
+			g_task_return_int (transaction->task, transaction->value);
+		else
+			g_task_return_boolean (transaction->task, TRUE);
+
+		g_object_unref (transaction->task);
+		g_free (transaction);
+	}
+
+	g_slist_free (completed);
+}
+
+static void
+_complete_request_locked (ArvGvDeviceIOData *io_data, ArvGvDeviceRequest *request,
+			  gboolean success, ArvGvcpError command_error,
+			  ArvGvcpPacket *ack_packet, size_t count,
+			  GSList **completed)
+{
+	ArvGvDeviceTransaction *transaction = request->transaction;
+
+	success = success && command_error == ARV_GVCP_ERROR_NONE;
+
+	switch (request->command) {
+		case ARV_GVCP_COMMAND_READ_MEMORY_CMD:
+			if (success)
+				memcpy (request->buffer, arv_gvcp_packet_get_read_memory_ack_data (ack_packet),
+					request->size);
+			else
+				memset (request->buffer, 0, request->size);
+			break;
+		case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
+			if (success) {
+				guint i;
+
+				for (i = 0; i < request->size / sizeof (guint32); i++)
+					((guint32 *) request->buffer)[i] =
+						arv_gvcp_packet_get_read_registers_ack_value (ack_packet, count, i);
+			} else
+				memset (request->buffer, 0, request->size);
+			break;
+		case ARV_GVCP_COMMAND_WRITE_MEMORY_CMD:
+		case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
+			break;
+		default:
+			g_assert_not_reached ();
+	}
+
+	if (!success && transaction->error == NULL) {
+		if (command_error != ARV_GVCP_ERROR_NONE)
+			transaction->error = g_error_new (ARV_DEVICE_ERROR,
+							  arv_gvcp_error_to_device_error (command_error),
+							  "GigEVision %s error (%s)", request->operation,
+							  arv_gvcp_error_to_string (command_error));
+		else
+			transaction->error = g_error_new (ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_TIMEOUT,
+							  "GigEVision %s timeout", request->operation);
+	}
+
+	arv_gvcp_packet_free (request->packet);
+	g_free (request);
+
+	_release_transaction_locked (io_data, transaction, completed);
+}
+
+static void
+_send_request_locked (ArvGvDeviceIOData *io_data, ArvGvDeviceRequest *request, gint64 now_ms)
+{
+	GError *local_error = NULL;
+
+	arv_gvcp_packet_debug (request->packet, ARV_DEBUG_LEVEL_TRACE);
+
+	if (g_socket_send_to (io_data->socket, io_data->device_address,
+			      (const char *) request->packet, request->packet_size,
+			      NULL, &local_error) < 0) {
+		arv_warning_device ("[GvDevice::%s] Command sending error: %s", request->operation,
+				    local_error != NULL ? local_error->message : "Unknown error");
+		g_clear_error (&local_error);
+	}
+
+	request->n_sends++;
+	request->deadline_ms = now_ms + io_data->gvcp_timeout_ms;
+}
+
+static void
+_send_queued_requests_locked (ArvGvDeviceIOData *io_data, gint64 now_ms)
+{
+	while (io_data->pending_requests->len < io_data->gvcp_window &&
+	       !g_queue_is_empty (&io_data->queued_requests)) {
+		ArvGvDeviceRequest *request = g_queue_pop_head (&io_data->queued_requests);
+
+		g_ptr_array_add (io_data->pending_requests, request);
+		_send_request_locked (io_data, request, now_ms);
+	}
+}
+
+/* For the register commands, @addresses contains size / 4 register addresses, which are read or written in a single
+ * command, and @buffer the corresponding values. For the memory commands, only the first address is used. */
+
+static void
+_submit_request (ArvGvDeviceIOData *io_data, ArvGvDeviceTransaction *transaction, ArvGvcpCommand command,
+		 const guint64 *addresses, guint32 size, void *buffer)
+{
+	ArvGvDeviceRequest *request;
+	GSList *completed = NULL;
+	guint32 register_addresses[ARV_GVCP_N_READ_REGISTERS_MAX];
+	guint n_registers = 0;
+	gint64 now_ms;
+	guint i;
+
+	request = g_new0 (ArvGvDeviceRequest, 1);
+	request->transaction = transaction;
+	request->command = command;
+	request->size = size;
+	request->buffer = buffer;
 
 	switch (command) {
 		case ARV_GVCP_COMMAND_READ_MEMORY_CMD:
-			operation = "read_memory";
-			expected_ack_command = ARV_GVCP_COMMAND_READ_MEMORY_ACK;
-			ack_size = arv_gvcp_packet_get_read_memory_ack_size (size);
+			request->operation = "read_memory";
+			request->expected_ack_command = ARV_GVCP_COMMAND_READ_MEMORY_ACK;
+			request->ack_size = arv_gvcp_packet_get_read_memory_ack_size (size);
 			break;
 		case ARV_GVCP_COMMAND_WRITE_MEMORY_CMD:
-			operation = "write_memory";
-			expected_ack_command = ARV_GVCP_COMMAND_WRITE_MEMORY_ACK;
-			ack_size = arv_gvcp_packet_get_write_memory_ack_size ();
+			request->operation = "write_memory";
+			request->expected_ack_command = ARV_GVCP_COMMAND_WRITE_MEMORY_ACK;
+			request->ack_size = arv_gvcp_packet_get_write_memory_ack_size ();
 			break;
 		case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
-			operation = "read_register";
-			expected_ack_command = ARV_GVCP_COMMAND_READ_REGISTER_ACK;
-			ack_size = arv_gvcp_packet_get_read_register_ack_size ();
+			request->operation = "read_register";
+			request->expected_ack_command = ARV_GVCP_COMMAND_READ_REGISTER_ACK;
+			request->ack_size = arv_gvcp_packet_get_read_registers_ack_size (size / sizeof (guint32));
 			break;
 		case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
-			operation = "write_register";
-			expected_ack_command = ARV_GVCP_COMMAND_WRITE_REGISTER_ACK;
-			ack_size = arv_gvcp_packet_get_write_register_ack_size ();
+			request->operation = "write_register";
+			request->expected_ack_command = ARV_GVCP_COMMAND_WRITE_REGISTER_ACK;
+			request->ack_size = arv_gvcp_packet_get_write_register_ack_size ();
 			break;
 		default:
 			g_assert_not_reached ();
 	}
 
-	g_return_val_if_fail (ack_size <= ARV_GV_DEVICE_BUFFER_SIZE, FALSE);
+	g_assert (request->ack_size <= ARV_GV_DEVICE_BUFFER_SIZE);
+
+	if (command == ARV_GVCP_COMMAND_READ_REGISTER_CMD ||
+	    command == ARV_GVCP_COMMAND_WRITE_REGISTER_CMD) {
+		n_registers = size / sizeof (guint32);
+
+		g_assert (n_registers > 0);
+		g_assert (n_registers <= (command == ARV_GVCP_COMMAND_READ_REGISTER_CMD ?
+					  ARV_GVCP_N_READ_REGISTERS_MAX : ARV_GVCP_N_WRITE_REGISTERS_MAX));
+
+		for (i = 0; i < n_registers; i++)
+			register_addresses[i] = addresses[i];
+	}
 
 	g_mutex_lock (&io_data->mutex);
 
+	transaction->n_pending_requests++;
+
 	io_data->packet_id = arv_gvcp_next_packet_id (io_data->packet_id);
+	request->packet_id = io_data->packet_id;
 
 	switch (command) {
 		case ARV_GVCP_COMMAND_READ_MEMORY_CMD:
-			packet = arv_gvcp_packet_new_read_memory_cmd (address, size,
-								      io_data->packet_id, &packet_size);
+			request->packet = arv_gvcp_packet_new_read_memory_cmd (addresses[0], size, request->packet_id,
+									       &request->packet_size);
 			break;
 		case ARV_GVCP_COMMAND_WRITE_MEMORY_CMD:
-			packet = arv_gvcp_packet_new_write_memory_cmd (address, size, buffer,
-								       io_data->packet_id, &packet_size);
+			request->packet = arv_gvcp_packet_new_write_memory_cmd (addresses[0], size, buffer,
+										request->packet_id,
+										&request->packet_size);
 			break;
 		case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
-			packet = arv_gvcp_packet_new_read_register_cmd (address,
-									io_data->packet_id, &packet_size);
+			request->packet = arv_gvcp_packet_new_read_registers_cmd (register_addresses, n_registers,
+										  request->packet_id,
+										  &request->packet_size);
 			break;
 		case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
-			packet = arv_gvcp_packet_new_write_register_cmd (address, *((guint32 *) buffer),
-									 io_data->packet_id, &packet_size);
+			request->packet = arv_gvcp_packet_new_write_registers_cmd (register_addresses, buffer,
+										   n_registers, request->packet_id,
+										   &request->packet_size);
 			break;
 		default:
 			g_assert_not_reached ();
 	}
 
-	do {
-		GError *local_error = NULL;
+	if (io_data->cancel) {
+		_complete_request_locked (io_data, request, FALSE, ARV_GVCP_ERROR_NONE, NULL, 0, &completed);
+	} else {
+		now_ms = g_get_monotonic_time () / 1000;
 
-		arv_gvcp_packet_debug (packet, ARV_DEBUG_LEVEL_TRACE);
-
-		success = g_socket_send_to (io_data->socket, io_data->device_address,
-					    (const char *) packet, packet_size,
-					    NULL, &local_error) >= 0;
-
-		if (success) {
-			gint timeout_ms;
-			gint64 timeout_stop_ms;
-			gboolean pending_ack;
-			gboolean expected_answer;
-
-			timeout_stop_ms = g_get_monotonic_time () / 1000 + io_data->gvcp_timeout_ms;
-
-			do {
-				pending_ack = FALSE;
-
-				timeout_ms = timeout_stop_ms - g_get_monotonic_time () / 1000;
-				if (timeout_ms < 0)
-					timeout_ms = 0;
-
-				success = TRUE;
-				success = success && g_poll (&io_data->poll_in_event, 1, timeout_ms) > 0;
-
-				if (success) {
-					arv_gpollfd_clear_one (&io_data->poll_in_event, io_data->socket);
-					count = g_socket_receive (io_data->socket, io_data->buffer,
-								  ARV_GV_DEVICE_BUFFER_SIZE, NULL, &local_error);
-				} else
-					count = 0;
-				success = success && (count >= sizeof (ArvGvcpHeader));
-
-				if (success) {
-					ArvGvcpPacketType packet_type;
-					ArvGvcpCommand ack_command;
-					guint16 packet_id;
-
-					arv_gvcp_packet_debug (ack_packet, ARV_DEBUG_LEVEL_TRACE);
-
-					packet_type = arv_gvcp_packet_get_packet_type (ack_packet, count);
-					ack_command = arv_gvcp_packet_get_command (ack_packet, count);
-					packet_id = arv_gvcp_packet_get_packet_id (ack_packet, count);
-
-					if (ack_command == ARV_GVCP_COMMAND_PENDING_ACK &&
-					    count >= arv_gvcp_packet_get_pending_ack_size ()) {
-						gint64 pending_ack_timeout_ms =
-                                                        arv_gvcp_packet_get_pending_ack_timeout (ack_packet, count);
-						pending_ack = TRUE;
-						expected_answer = FALSE;
-
-						timeout_stop_ms = g_get_monotonic_time () / 1000 + pending_ack_timeout_ms;
-
-						arv_debug_device ("[GvDevice::%s] Pending ack timeout = %"
-                                                                  G_GINT64_FORMAT,
-                                                                  operation, pending_ack_timeout_ms);
-                                        } else if (packet_type == ARV_GVCP_PACKET_TYPE_ERROR ||
-                                                   packet_type == ARV_GVCP_PACKET_TYPE_UNKNOWN_ERROR) {
-                                                expected_answer = ack_command == expected_ack_command &&
-                                                        packet_id == io_data->packet_id;
-                                                if (!expected_answer) {
-                                                        arv_info_device ("[GvDevice::%s] Unexpected answer (0x%02x)",
-                                                                         operation, packet_type);
-                                                } else
-                                                        command_error = arv_gvcp_packet_get_packet_flags (ack_packet,
-                                                                                                          count);
-                                        } else  {
-                                                expected_answer = packet_type == ARV_GVCP_PACKET_TYPE_ACK &&
-                                                        ack_command == expected_ack_command &&
-                                                        packet_id == io_data->packet_id &&
-                                                        count >= ack_size;
-                                                if (!expected_answer) {
-                                                        arv_info_device ("[GvDevice::%s] Unexpected answer (0x%02x)",
-                                                                         operation, packet_type);
-                                                }
-                                        }
-                                } else {
-                                        expected_answer = FALSE;
-                                        if (local_error != NULL)
-                                                arv_warning_device ("[GvDevice::%s] Ack reception error: %s", operation,
-                                                                    local_error->message);
-                                        else
-                                                arv_warning_device ("[GvDevice::%s] Ack reception timeout", operation);
-                                        g_clear_error (&local_error);
-                                }
-                        } while (pending_ack || (!expected_answer && timeout_ms > 0));
-
-			success = success && expected_answer;
-
-			if (success && command_error == ARV_GVCP_ERROR_NONE) {
-				switch (command) {
-					case ARV_GVCP_COMMAND_READ_MEMORY_CMD:
-						memcpy (buffer,
-                                                        arv_gvcp_packet_get_read_memory_ack_data (ack_packet),
-                                                        size);
-						break;
-					case ARV_GVCP_COMMAND_WRITE_MEMORY_CMD:
-						break;
-					case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
-						*((gint32 *) buffer) =
-                                                        arv_gvcp_packet_get_read_register_ack_value (ack_packet, count);
-						break;
-					case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
-						break;
-					default:
-						g_assert_not_reached ();
-				}
+		/* The command is sent from the calling thread if the window is not full, and the control thread is only
+		 * woken up if its current poll timeout is later than the command deadline. */
+		g_queue_push_tail (&io_data->queued_requests, request);
+		_send_queued_requests_locked (io_data, now_ms);
+
+		if (g_queue_is_empty (&io_data->queued_requests) &&
+		    io_data->control_deadline_ms > now_ms + io_data->gvcp_timeout_ms)
+			arv_wakeup_signal (io_data->wakeup);
+	}
+
+	g_mutex_unlock (&io_data->mutex);
+
+	_return_transactions (completed);
+}
+
+static void
+_process_ack_locked (ArvGvDeviceIOData *io_data, ArvGvcpPacket *ack_packet, size_t count, gint64 now_ms,
+		     GSList **completed)
+{
+	ArvGvDeviceRequest *request = NULL;
+	ArvGvcpPacketType packet_type;
+	ArvGvcpCommand ack_command;
+	guint16 packet_id;
+	guint i;
+
+	arv_gvcp_packet_debug (ack_packet, ARV_DEBUG_LEVEL_TRACE);
+
+	packet_type = arv_gvcp_packet_get_packet_type (ack_packet, count);
+	ack_command = arv_gvcp_packet_get_command (ack_packet, count);
+	packet_id = arv_gvcp_packet_get_packet_id (ack_packet, count);
+
+	for (i = 0; i < io_data->pending_requests->len; i++) {
+		ArvGvDeviceRequest *pending_request = g_ptr_array_index (io_data->pending_requests, i);
+
+		if (pending_request->packet_id == packet_id) {
+			request = pending_request;
+			break;
+		}
+	}
+
+	if (request == NULL) {
+		arv_info_device ("[GvDevice::control] Unexpected answer (0x%02x, packet id %u)",
+				 packet_type, packet_id);
+		return;
+	}
+
+	if (ack_command == ARV_GVCP_COMMAND_PENDING_ACK &&
+	    count >= arv_gvcp_packet_get_pending_ack_size ()) {
+		gint64 pending_ack_timeout_ms = arv_gvcp_packet_get_pending_ack_timeout (ack_packet, count);
+
+		request->deadline_ms = now_ms + pending_ack_timeout_ms;
+
+		arv_debug_device ("[GvDevice::%s] Pending ack timeout = %" G_GINT64_FORMAT,
+				  request->operation, pending_ack_timeout_ms);
+		return;
+	}
+
+	if (packet_type == ARV_GVCP_PACKET_TYPE_ERROR ||
+	    packet_type == ARV_GVCP_PACKET_TYPE_UNKNOWN_ERROR) {
+		if (ack_command != request->expected_ack_command) {
+			arv_info_device ("[GvDevice::%s] Unexpected answer (0x%02x)", request->operation, packet_type);
+			return;
+		}
+
+		g_ptr_array_remove_index_fast (io_data->pending_requests, i);
+
+		/* A device may refuse a command received while it is processing the previous ones. Pipelining is
+		 * disabled, and the command is sent again once the commands still in flight are acknowledged. */
+		if (arv_gvcp_packet_get_packet_flags (ack_packet, count) == ARV_GVCP_ERROR_BUSY &&
+		    io_data->gvcp_window > 1 &&
+		    request->n_sends < io_data->gvcp_n_retries) {
+			arv_info_device ("[GvDevice::control] Busy device with %u commands in flight, "
+					 "disable command pipelining", io_data->pending_requests->len + 1);
+			io_data->gvcp_window = 1;
+			g_queue_push_head (&io_data->queued_requests, request);
+			return;
+		}
+
+		_complete_request_locked (io_data, request, TRUE,
+					  arv_gvcp_packet_get_packet_flags (ack_packet, count),
+					  ack_packet, count, completed);
+		return;
+	}
+
+	if (packet_type != ARV_GVCP_PACKET_TYPE_ACK ||
+	    ack_command != request->expected_ack_command ||
+	    count < request->ack_size) {
+		arv_info_device ("[GvDevice::%s] Unexpected answer (0x%02x)", request->operation, packet_type);
+		return;
+	}
+
+	g_ptr_array_remove_index_fast (io_data->pending_requests, i);
+	_complete_request_locked (io_data, request, TRUE, ARV_GVCP_ERROR_NONE, ack_packet, count, completed);
+}
+
+static gint64
+_process_timeouts_locked (ArvGvDeviceIOData *io_data, gint64 now_ms, GSList **completed)
+{
+	gint64 next_deadline_ms = G_MAXINT64;
+	guint i = 0;
+
+	while (i < io_data->pending_requests->len) {
+		ArvGvDeviceRequest *request = g_ptr_array_index (io_data->pending_requests, i);
+
+		if (request->deadline_ms <= now_ms) {
+			arv_warning_device ("[GvDevice::%s] Ack reception timeout", request->operation);
+
+			/* Some devices silently drop the commands received while they are busy */
+			if (io_data->pending_requests->len > 1 && io_data->gvcp_window > 1) {
+				arv_info_device ("[GvDevice::control] Timeout with %u commands in flight, "
+						 "disable command pipelining", io_data->pending_requests->len);
+				io_data->gvcp_window = 1;
+			}
+
+			if (request->n_sends < io_data->gvcp_n_retries) {
+				_send_request_locked (io_data, request, now_ms);
+			} else {
+				g_ptr_array_remove_index_fast (io_data->pending_requests, i);
+				_complete_request_locked (io_data, request, FALSE, ARV_GVCP_ERROR_NONE,
+							  NULL, 0, completed);
+				continue;
 			}
-		} else {
-			if (local_error != NULL)
-				arv_warning_device ("[GvDevice::%s] Command sending error: %s", operation, local_error->message);
-			g_clear_error (&local_error);
 		}
 
-		n_retries++;
-	} while (!success && n_retries < io_data->gvcp_n_retries);
+		next_deadline_ms = MIN (next_deadline_ms, request->deadline_ms);
+		i++;
+	}
 
-	arv_gvcp_packet_free (packet);
+	return next_deadline_ms;
+}
 
-	g_mutex_unlock (&io_data->mutex);
+static gpointer
+arv_gv_device_control_thread (gpointer data)
+{
+	ArvGvDeviceIOData *io_data = data;
+	GPollFD poll_fds[2];
+	GSList *completed = NULL;
 
-	success = success && command_error == ARV_GVCP_ERROR_NONE;
+	poll_fds[0] = io_data->poll_in_event;
+	arv_wakeup_get_pollfd (io_data->wakeup, &poll_fds[1]);
 
-	if (!success) {
-		switch (command) {
-			case ARV_GVCP_COMMAND_READ_MEMORY_CMD:
-				memset (buffer, 0, size);
-				break;
-			case ARV_GVCP_COMMAND_WRITE_MEMORY_CMD:
-				break;
-			case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
-				*((guint32 *) buffer) = 0;
-				break;
-			case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
-				break;
-			default:
-				g_assert_not_reached ();
+	g_mutex_lock (&io_data->mutex);
+
+	while (!io_data->cancel) {
+		gint64 now_ms;
+		gint timeout_ms;
+
+		now_ms = g_get_monotonic_time () / 1000;
+
+		io_data->control_deadline_ms = _process_timeouts_locked (io_data, now_ms, &completed);
+		_send_queued_requests_locked (io_data, now_ms);
+		if (io_data->pending_requests->len > 0)
+			io_data->control_deadline_ms = MIN (io_data->control_deadline_ms,
+							    now_ms + io_data->gvcp_timeout_ms);
+
+		timeout_ms = io_data->control_deadline_ms == G_MAXINT64 ? -1 :
+			CLAMP (io_data->control_deadline_ms - now_ms, 0, G_MAXINT);
+
+		g_mutex_unlock (&io_data->mutex);
+
+		_return_transactions (completed);
+		completed = NULL;
+
+		poll_fds[0].revents = 0;
+		poll_fds[1].revents = 0;
+		g_poll (poll_fds, 2, timeout_ms);
+
+		if (poll_fds[1].revents != 0)
+			arv_wakeup_acknowledge (io_data->wakeup);
+
+		if (poll_fds[0].revents != 0) {
+			arv_gpollfd_clear_one (&poll_fds[0], io_data->socket);
+
+			for (;;) {
+				GError *local_error = NULL;
+				gssize count;
+
+				count = g_socket_receive (io_data->socket, io_data->buffer, ARV_GV_DEVICE_BUFFER_SIZE,
+							  NULL, &local_error);
+				if (count < 0) {
+					if (!g_error_matches (local_error, G_IO_ERROR, G_IO_ERROR_WOULD_BLOCK))
+						arv_warning_device ("[GvDevice::control] Ack reception error: %s",
+								    local_error != NULL ? local_error->message :
+								    "Unknown error");
+					g_clear_error (&local_error);
+					break;
+				}
+
+				if (count < sizeof (ArvGvcpHeader))
+					continue;
+
+				g_mutex_lock (&io_data->mutex);
+				_process_ack_locked (io_data, io_data->buffer, count, g_get_monotonic_time () / 1000,
+						     &completed);
+				g_mutex_unlock (&io_data->mutex);
+			}
 		}
 
-                if (command_error != ARV_GVCP_ERROR_NONE)
-                        g_set_error (error, ARV_DEVICE_ERROR, arv_gvcp_error_to_device_error (command_error),
-                                     "GigEVision %s error (%s)", operation,
-                                     arv_gvcp_error_to_string (command_error));
-                else
-                        g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_TIMEOUT,
-                                     "GigEVision %s timeout", operation);
-        }
+		g_mutex_lock (&io_data->mutex);
+	}
 
-	return success;
+	/* Fail the remaining commands */
+	while (io_data->pending_requests->len > 0) {
+		ArvGvDeviceRequest *request = g_ptr_array_index (io_data->pending_requests, 0);
+
+		g_ptr_array_remove_index_fast (io_data->pending_requests, 0);
+		_complete_request_locked (io_data, request, FALSE, ARV_GVCP_ERROR_NONE, NULL, 0, &completed);
+	}
+	while (!g_queue_is_empty (&io_data->queued_requests))
+		_complete_request_locked (io_data, g_queue_pop_head (&io_data->queued_requests),
+					  FALSE, ARV_GVCP_ERROR_NONE, NULL, 0, &completed);
+
+	g_mutex_unlock (&io_data->mutex);
+
+	_return_transactions (completed);
+
+	return NULL;
 }
 
 static gboolean
-_read_memory (ArvGvDeviceIOData *io_data, guint64 address, guint32 size, void *buffer, GError **error)
+_wait_transaction (ArvGvDeviceIOData *io_data, ArvGvDeviceTransaction *transaction, GError **error)
+{
+	GSList *completed = NULL;
+
+	g_mutex_lock (&io_data->mutex);
+
+	/* Release the submission reference */
+	_release_transaction_locked (io_data, transaction, &completed);
+
+	while (!transaction->is_completed)
+		g_cond_wait (&io_data->cond, &io_data->mutex);
+
+	g_mutex_unlock (&io_data->mutex);
+
+	if (transaction->error != NULL) {
+		g_propagate_error (error, transaction->error);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+static ArvGvDeviceTransaction *
+_new_async_transaction (ArvDevice *device, gpointer source_tag,
+			GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data)
+{
+	ArvGvDeviceTransaction *transaction;
+
+	transaction = g_new0 (ArvGvDeviceTransaction, 1);
+	transaction->task = g_task_new (device, cancellable, callback, user_data);
+	g_task_set_source_tag (transaction->task, source_tag);
+
+	/* Submission reference, released by _commit_async_transaction */
+	transaction->n_pending_requests = 1;
+
+	return transaction;
+}
+
+static void
+_commit_async_transaction (ArvGvDeviceIOData *io_data, ArvGvDeviceTransaction *transaction)
 {
-	return _send_cmd_and_receive_ack (io_data, ARV_GVCP_COMMAND_READ_MEMORY_CMD,
-					  address, size, buffer, error);
+	GSList *completed = NULL;
+
+	g_mutex_lock (&io_data->mutex);
+	_release_transaction_locked (io_data, transaction, &completed);
+	g_mutex_unlock (&io_data->mutex);
+
+	_return_transactions (completed);
 }
 
 static gboolean
-_write_memory (ArvGvDeviceIOData *io_data, guint64 address, guint32 size, void *buffer, GError **error)
+_send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
+			   guint64 address, size_t size, void *buffer, GError **error)
 {
-	return  _send_cmd_and_receive_ack (io_data, ARV_GVCP_COMMAND_WRITE_MEMORY_CMD,
-					   address, size, buffer, error);
+	ArvGvDeviceTransaction transaction = {0};
+
+	transaction.n_pending_requests = 1;
+
+	_submit_request (io_data, &transaction, command, &address, size, buffer);
+
+	return _wait_transaction (io_data, &transaction, error);
 }
 
 static gboolean
@@ -382,22 +702,34 @@ _write_register (ArvGvDeviceIOData *io_data, guint32 address, guint32 value, GEr
 					  address, sizeof (guint32), &value, error);
 }
 
-static gboolean
-arv_gv_device_read_memory (ArvDevice *device, guint64 address, guint32 size, void *buffer, GError **error)
+static void
+_submit_memory_requests (ArvGvDeviceIOData *io_data, ArvGvDeviceTransaction *transaction, ArvGvcpCommand command,
+			 guint64 address, guint32 size, void *buffer)
 {
-	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (ARV_GV_DEVICE (device));
 	int i;
 	gint32 block_size;
 
 	for (i = 0; i < (size + ARV_GVCP_DATA_SIZE_MAX - 1) / ARV_GVCP_DATA_SIZE_MAX; i++) {
+		guint64 block_address = address + i * ARV_GVCP_DATA_SIZE_MAX;
+
 		block_size = MIN (ARV_GVCP_DATA_SIZE_MAX, size - i * ARV_GVCP_DATA_SIZE_MAX);
-		if (!_read_memory (priv->io_data,
-				   address + i * ARV_GVCP_DATA_SIZE_MAX,
-				   block_size, ((char *) buffer) + i * ARV_GVCP_DATA_SIZE_MAX, error))
-			return FALSE;
+		_submit_request (io_data, transaction, command, &block_address,
+				 block_size, ((char *) buffer) + i * ARV_GVCP_DATA_SIZE_MAX);
 	}
+}
 
-	return TRUE;
+static gboolean
+arv_gv_device_read_memory (ArvDevice *device, guint64 address, guint32 size, void *buffer, GError **error)
+{
+	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (ARV_GV_DEVICE (device));
+	ArvGvDeviceTransaction transaction = {0};
+
+	/* All the blocks are requested at once, and kept in flight by the control thread */
+	transaction.n_pending_requests = 1;
+	_submit_memory_requests (priv->io_data, &transaction, ARV_GVCP_COMMAND_READ_MEMORY_CMD,
+				 address, size, buffer);
+
+	return _wait_transaction (priv->io_data, &transaction, error);
 }
 
 static gboolean
@@ -407,11 +739,12 @@ arv_gv_device_write_memory (ArvDevice *device, guint64 address, guint32 size, co
 	int i;
 	gint32 block_size;
 
+	/* The blocks are written in order, stopping at the first error */
 	for (i = 0; i < (size + ARV_GVCP_DATA_SIZE_MAX - 1) / ARV_GVCP_DATA_SIZE_MAX; i++) {
 		block_size = MIN (ARV_GVCP_DATA_SIZE_MAX, size - i * ARV_GVCP_DATA_SIZE_MAX);
-		if (!_write_memory (priv->io_data,
-				    address + i * ARV_GVCP_DATA_SIZE_MAX,
-				    block_size, ((char *) buffer) + i * ARV_GVCP_DATA_SIZE_MAX, error))
+		if (!_send_cmd_and_receive_ack (priv->io_data, ARV_GVCP_COMMAND_WRITE_MEMORY_CMD,
+						address + i * ARV_GVCP_DATA_SIZE_MAX,
+						block_size, ((char *) buffer) + i * ARV_GVCP_DATA_SIZE_MAX, error))
 			return FALSE;
 	}
 
@@ -434,6 +767,157 @@ arv_gv_device_write_register (ArvDevice *device, guint64 address, guint32 value,
 	return _write_register (priv->io_data, address, value, error);
 }
 
+static gboolean
+arv_gv_device_read_registers (ArvDevice *device, const guint64 *addresses, guint32 *values, guint n_registers,
+			      GError **error)
+{
+	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (ARV_GV_DEVICE (device));
+	ArvGvDeviceTransaction transaction = {0};
+	guint n_registers_max;
+	guint i;
+
+	n_registers_max = priv->is_concatenation_supported ? ARV_GVCP_N_READ_REGISTERS_MAX : 1;
+
+	/* Reads have no side effects, all the commands are kept in flight by the control thread */
+	transaction.n_pending_requests = 1;
+	for (i = 0; i < n_registers; i += n_registers_max) {
+		guint n = MIN (n_registers_max, n_registers - i);
+
+		_submit_request (priv->io_data, &transaction, ARV_GVCP_COMMAND_READ_REGISTER_CMD,
+				 &addresses[i], n * sizeof (guint32), &values[i]);
+	}
+
+	return _wait_transaction (priv->io_data, &transaction, error);
+}
+
+static gboolean
+arv_gv_device_write_registers (ArvDevice *device, const guint64 *addresses, const guint32 *values, guint n_registers,
+			       GError **error)
+{
+	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (ARV_GV_DEVICE (device));
+	guint n_registers_max;
+	guint i;
+
+	n_registers_max = priv->is_concatenation_supported ? ARV_GVCP_N_WRITE_REGISTERS_MAX : 1;
+
+	/* The commands are sent in order, stopping at the first error */
+	for (i = 0; i < n_registers; i += n_registers_max) {
+		ArvGvDeviceTransaction transaction = {0};
+		guint n = MIN (n_registers_max, n_registers - i);
+
+		transaction.n_pending_requests = 1;
+		_submit_request (priv->io_data, &transaction, ARV_GVCP_COMMAND_WRITE_REGISTER_CMD,
+				 &addresses[i], n * sizeof (guint32), (void *) &values[i]);
+		if (!_wait_transaction (priv->io_data, &transaction, error))
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
+static void
+arv_gv_device_read_memory_async (ArvDevice *device, guint64 address, guint32 size, void *buffer,
+				 GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data)
+{
+	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (ARV_GV_DEVICE (device));
+	ArvGvDeviceTransaction *transaction;
+
+	transaction = _new_async_transaction (device, arv_device_read_memory_async, cancellable, callback, user_data);
+	_submit_memory_requests (priv->io_data, transaction, ARV_GVCP_COMMAND_READ_MEMORY_CMD, address, size, buffer);
+	_commit_async_transaction (priv->io_data, transaction);
+}
+
+/* As in the synchronous write, the blocks of an asynchronous memory write are written in order, stopping at the first
+ * error. Each block is submitted on the acknowledge of the previous one. */
+
+typedef struct {
+	GTask *task;
+	guint64 address;
+	guint32 size;
+	guint32 offset;
+	const char *buffer;
+} ArvGvDeviceWriteMemoryData;
+
+static void _write_memory_next_block (ArvGvDevice *gv_device, ArvGvDeviceWriteMemoryData *data);
+
+static void
+_write_memory_block_cb (GObject *source_object, GAsyncResult *result, gpointer user_data)
+{
+	ArvGvDeviceWriteMemoryData *data = user_data;
+	GError *error = NULL;
+
+	if (!g_task_propagate_boolean (G_TASK (result), &error)) {
+		g_task_return_error (data->task, error);
+	} else if (data->offset < data->size) {
+		_write_memory_next_block (ARV_GV_DEVICE (source_object), data);
+		return;
+	} else {
+		g_task_return_boolean (data->task, TRUE);
+	}
+
+	g_object_unref (data->task);
+	g_free (data);
+}
+
+static void
+_write_memory_next_block (ArvGvDevice *gv_device, ArvGvDeviceWriteMemoryData *data)
+{
+	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (gv_device);
+	ArvGvDeviceTransaction *transaction;
+	guint64 block_address = data->address + data->offset;
+	guint32 block_size = MIN (ARV_GVCP_DATA_SIZE_MAX, data->size - data->offset);
+
+	transaction = _new_async_transaction (ARV_DEVICE (gv_device), _write_memory_next_block,
+					      g_task_get_cancellable (data->task), _write_memory_block_cb, data);
+	_submit_request (priv->io_data, transaction, ARV_GVCP_COMMAND_WRITE_MEMORY_CMD,
+			 &block_address, block_size, (void *) (data->buffer + data->offset));
+	data->offset += block_size;
+	_commit_async_transaction (priv->io_data, transaction);
+}
+
+static void
+arv_gv_device_write_memory_async (ArvDevice *device, guint64 address, guint32 size, const void *buffer,
+				  GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data)
+{
+	ArvGvDeviceWriteMemoryData *data;
+
+	data = g_new0 (ArvGvDeviceWriteMemoryData, 1);
+	data->task = g_task_new (device, cancellable, callback, user_data);
+	g_task_set_source_tag (data->task, arv_device_write_memory_async);
+	data->address = address;
+	data->size = size;
+	data->buffer = buffer;
+
+	_write_memory_next_block (ARV_GV_DEVICE (device), data);
+}
+
+static void
+arv_gv_device_read_register_async (ArvDevice *device, guint64 address,
+				   GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data)
+{
+	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (ARV_GV_DEVICE (device));
+	ArvGvDeviceTransaction *transaction;
+
+	transaction = _new_async_transaction (device, arv_device_read_register_async, cancellable, callback, user_data);
+	transaction->is_read_register = TRUE;
+	_submit_request (priv->io_data, transaction, ARV_GVCP_COMMAND_READ_REGISTER_CMD,
+			 &address, sizeof (guint32), &transaction->value);
+	_commit_async_transaction (priv->io_data, transaction);
+}
+
+static void
+arv_gv_device_write_register_async (ArvDevice *device, guint64 address, guint32 value,
+				    GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data)
+{
+	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (ARV_GV_DEVICE (device));
+	ArvGvDeviceTransaction *transaction;
+
+	transaction = _new_async_transaction (device, arv_device_write_register_async, cancellable, callback, user_data);
+	_submit_request (priv->io_data, transaction, ARV_GVCP_COMMAND_WRITE_REGISTER_CMD,
+			 &address, sizeof (guint32), &value);
+	_commit_async_transaction (priv->io_data, transaction);
+}
+
 /* Heartbeat thread */
 
 typedef struct {
@@ -1262,6 +1746,56 @@ arv_gv_device_is_controller (ArvGvDevice *gv_device)
 	return priv->io_data->is_controller;
 }
 
+/* The Genicam data stored on the device are identified by the device identity and the url, which includes the file
+ * address and size, and the file checksum for the devices providing it. Without checksum, a firmware upgrade keeping
+ * the same file location and size would not be detected, and the data are only cached if explicitly enabled. */
+
+static gboolean
+_genicam_url_has_checksum (const char *query)
+{
+	GStrv parameters;
+	gboolean has_checksum = FALSE;
+	guint i;
+
+	if (query == NULL)
+		return FALSE;
+
+	parameters = g_strsplit (query, "&", -1);
+	for (i = 0; parameters[i] != NULL && !has_checksum; i++)
+		has_checksum = g_ascii_strncasecmp (parameters[i], "SHA1=", 5) == 0 && parameters[i][5] != '\0';
+	g_strfreev (parameters);
+
+	return has_checksum;
+}
+
+static char *
+_compute_genicam_cache_key (ArvGvDevice *gv_device, const char *url)
+{
+	char identity[ARV_GVBS_MANUFACTURER_NAME_SIZE + ARV_GVBS_MODEL_NAME_SIZE + ARV_GVBS_DEVICE_VERSION_SIZE];
+	char *manufacturer;
+	char *model;
+	char *version;
+	char *key;
+
+	/* Manufacturer name, model name and device version are contiguous in the bootstrap registers */
+	if (!arv_gv_device_read_memory (ARV_DEVICE (gv_device), ARV_GVBS_MANUFACTURER_NAME_OFFSET,
+					sizeof (identity), identity, NULL))
+		return NULL;
+
+	manufacturer = g_strndup (identity, ARV_GVBS_MANUFACTURER_NAME_SIZE);
+	model = g_strndup (identity + ARV_GVBS_MANUFACTURER_NAME_SIZE, ARV_GVBS_MODEL_NAME_SIZE);
+	version = g_strndup (identity + ARV_GVBS_MANUFACTURER_NAME_SIZE + ARV_GVBS_MODEL_NAME_SIZE,
+			     ARV_GVBS_DEVICE_VERSION_SIZE);
+
+	key = arv_genicam_cache_compute_key ("GigEVision", manufacturer, model, version, url, NULL);
+
+	g_free (manufacturer);
+	g_free (model);
+	g_free (version);
+
+	return key;
+}
+
 static char *
 _load_genicam (ArvGvDevice *gv_device, guint32 address, size_t  *size, char **url, GError **error)
 {
@@ -1270,6 +1804,8 @@ _load_genicam (ArvGvDevice *gv_device, guint32 address, size_t  *size, char **ur
 	char *genicam = NULL;
 	char *scheme = NULL;
 	char *path = NULL;
+	char *query = NULL;
+	char *cache_key = NULL;
 	guint64 file_address;
 	guint64 file_size;
 
@@ -1286,7 +1822,7 @@ _load_genicam (ArvGvDevice *gv_device, guint32 address, size_t  *size, char **ur
 
 	arv_info_device ("[GvDevice::load_genicam] xml url = '%s' at 0x%x", filename, address);
 
-	arv_parse_genicam_url (filename, -1, &scheme, NULL, &path, NULL, NULL,
+	arv_parse_genicam_url (filename, -1, &scheme, NULL, &path, &query, NULL,
 			       &file_address, &file_size);
 
         if (scheme != NULL) {
@@ -1302,7 +1838,16 @@ _load_genicam (ArvGvDevice *gv_device, guint32 address, size_t  *size, char **ur
                         arv_info_device ("[GvDevice::load_genicam] Xml address = 0x%" G_GINT64_MODIFIER "x - "
                                          "size = 0x%" G_GINT64_MODIFIER "x - %s", file_address, file_size, path);
 
-                        if (file_size > 0) {
+                        if (file_size > 0 &&
+                            (_genicam_url_has_checksum (query) || arv_genicam_cache_is_forced ()))
+                                cache_key = _compute_genicam_cache_key (gv_device, filename);
+
+                        genicam = arv_genicam_cache_load (cache_key, size);
+                        if (genicam != NULL) {
+                                *url = g_strdup_printf ("%s:///%s;%" G_GINT64_MODIFIER "x;%"
+                                                        G_GINT64_MODIFIER "x", scheme, path,
+                                                        file_address, file_size);
+                        } else if (file_size > 0) {
                                 genicam = g_malloc (file_size);
                                 if (arv_gv_device_read_memory (ARV_DEVICE (gv_device), file_address, file_size,
                                                                genicam, &local_error)) {
@@ -1350,10 +1895,12 @@ _load_genicam (ArvGvDevice *gv_device, guint32 address, size_t  *size, char **ur
                                                 *size = file_size;
                                         }
 
-                                        if (genicam != NULL)
+                                        if (genicam != NULL) {
                                                 *url = g_strdup_printf ("%s:///%s;%" G_GINT64_MODIFIER "x;%"
                                                                         G_GINT64_MODIFIER "x", scheme, path,
                                                                         file_address, file_size);
+                                                arv_genicam_cache_save (cache_key, genicam, *size);
+                                        }
                                 } else {
                                         g_clear_pointer (&genicam, g_free);
                                 }
@@ -1390,8 +1937,10 @@ _load_genicam (ArvGvDevice *gv_device, guint32 address, size_t  *size, char **ur
                 g_propagate_error (error, local_error);
         }
 
+	g_free (cache_key);
 	g_free (scheme);
 	g_free (path);
+	g_free (query);
 
 	return genicam;
 }
@@ -2009,6 +2558,7 @@ arv_gv_device_constructed (GObject *object)
 	io_data = g_new0 (ArvGvDeviceIOData, 1);
 
 	g_mutex_init (&io_data->mutex);
+	g_cond_init (&io_data->cond);
 
 	io_data->packet_id = 65300; /* Start near the end of the circular counter */
 
@@ -2031,14 +2581,23 @@ arv_gv_device_constructed (GObject *object)
 	io_data->buffer = g_malloc (ARV_GV_DEVICE_BUFFER_SIZE);
 	io_data->gvcp_n_retries = ARV_GV_DEVICE_GVCP_N_RETRIES_DEFAULT;
 	io_data->gvcp_timeout_ms = ARV_GV_DEVICE_GVCP_TIMEOUT_MS_DEFAULT;
+	io_data->gvcp_window = priv->gvcp_window;
+	g_queue_init (&io_data->queued_requests);
+	io_data->pending_requests = g_ptr_array_new ();
+	io_data->wakeup = arv_wakeup_new ();
+	io_data->control_deadline_ms = G_MAXINT64;
 	io_data->poll_in_event.fd = g_socket_get_fd (io_data->socket);
 	io_data->poll_in_event.events =  G_IO_IN;
 	io_data->poll_in_event.revents = 0;
 
 	arv_gpollfd_prepare_all (&io_data->poll_in_event, 1);
 
+	g_socket_set_blocking (io_data->socket, FALSE);
+
 	priv->io_data = io_data;
 
+	io_data->control_thread = g_thread_new ("arv_gv_control", arv_gv_device_control_thread, io_data);
+
 	arv_gv_device_load_genicam (gv_device, &local_error);
 	if (local_error != NULL) {
 		arv_device_take_init_error (ARV_DEVICE (gv_device), local_error);
@@ -2071,10 +2630,12 @@ arv_gv_device_constructed (GObject *object)
 	arv_gv_device_read_register (ARV_DEVICE (gv_device), ARV_GVBS_GVCP_CAPABILITY_OFFSET, &capabilities, NULL);
 	priv->is_packet_resend_supported = (capabilities & ARV_GVBS_GVCP_CAPABILITY_PACKET_RESEND) != 0;
 	priv->is_write_memory_supported = (capabilities & ARV_GVBS_GVCP_CAPABILITY_WRITE_MEMORY) != 0;
+	priv->is_concatenation_supported = (capabilities & ARV_GVBS_GVCP_CAPABILITY_CONCATENATION) != 0;
 
 	arv_info_device ("[GvDevice::new] Device endianness = %s", priv->is_big_endian_device ? "big" : "little");
 	arv_info_device ("[GvDevice::new] Packet resend     = %s", priv->is_packet_resend_supported ? "yes" : "no");
 	arv_info_device ("[GvDevice::new] Write memory      = %s", priv->is_write_memory_supported ? "yes" : "no");
+	arv_info_device ("[GvDevice::new] Concatenation     = %s", priv->is_concatenation_supported ? "yes" : "no");
 
 	document = ARV_DOM_DOCUMENT (priv->genicam);
 	register_description = ARV_GC_REGISTER_DESCRIPTION_NODE (arv_dom_document_get_document_element (document));
@@ -2123,11 +2684,24 @@ arv_gv_device_finalize (GObject *object)
 
 	io_data = priv->io_data;
 	if (io_data != NULL) {
+		if (io_data->control_thread != NULL) {
+			g_mutex_lock (&io_data->mutex);
+			io_data->cancel = TRUE;
+			arv_wakeup_signal (io_data->wakeup);
+			g_mutex_unlock (&io_data->mutex);
+
+			g_thread_join (io_data->control_thread);
+			io_data->control_thread = NULL;
+		}
+
+		g_clear_pointer (&io_data->wakeup, arv_wakeup_free);
+		g_clear_pointer (&io_data->pending_requests, g_ptr_array_unref);
 		g_clear_object (&io_data->device_address);
 		g_clear_object (&io_data->interface_address);
 		g_clear_object (&io_data->socket);
 		g_clear_pointer (&io_data->buffer, g_free);
 		g_mutex_clear (&io_data->mutex);
+		g_cond_clear (&io_data->cond);
 
 		arv_gpollfd_finish_all (&io_data->poll_in_event, 1);
 
@@ -2193,6 +2767,14 @@ arv_gv_device_set_property (GObject *self, guint prop_id, const GValue *value, G
 		case PROP_GV_DEVICE_PACKET_SIZE_ADJUSTEMENT:
 			priv->packet_size_adjustment = g_value_get_enum (value);
 			break;
+		case PROP_GV_DEVICE_GVCP_WINDOW:
+			priv->gvcp_window = g_value_get_uint (value);
+			if (priv->io_data != NULL) {
+				g_mutex_lock (&priv->io_data->mutex);
+				priv->io_data->gvcp_window = priv->gvcp_window;
+				g_mutex_unlock (&priv->io_data->mutex);
+			}
+			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (self, prop_id, pspec);
 			break;
@@ -2208,6 +2790,14 @@ arv_gv_device_get_property (GObject *object, guint prop_id, GValue *value, GPara
 		case PROP_GV_DEVICE_PACKET_SIZE_ADJUSTEMENT:
 			g_value_set_enum (value, priv->packet_size_adjustment);
 			break;
+		case PROP_GV_DEVICE_GVCP_WINDOW:
+			if (priv->io_data != NULL) {
+				g_mutex_lock (&priv->io_data->mutex);
+				g_value_set_uint (value, priv->io_data->gvcp_window);
+				g_mutex_unlock (&priv->io_data->mutex);
+			} else
+				g_value_set_uint (value, priv->gvcp_window);
+			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
 			break;
@@ -2232,6 +2822,12 @@ arv_gv_device_class_init (ArvGvDeviceClass *gv_device_class)
 	device_class->write_memory = arv_gv_device_write_memory;
 	device_class->read_register = arv_gv_device_read_register;
 	device_class->write_register = arv_gv_device_write_register;
+	device_class->read_registers = arv_gv_device_read_registers;
+	device_class->write_registers = arv_gv_device_write_registers;
+	device_class->read_memory_async = arv_gv_device_read_memory_async;
+	device_class->write_memory_async = arv_gv_device_write_memory_async;
+	device_class->read_register_async = arv_gv_device_read_register_async;
+	device_class->write_register_async = arv_gv_device_write_register_async;
 
 	g_object_class_install_property
 		(object_class,
@@ -2256,4 +2852,20 @@ arv_gv_device_class_init (ArvGvDeviceClass *gv_device_class)
 							    ARV_GV_PACKET_SIZE_ADJUSTMENT_DEFAULT,
 							    G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
 								G_PARAM_CONSTRUCT));
+	/**
+	 * ArvGvDevice:gvcp-window:
+	 *
+	 * Maximum number of GVCP commands in flight. The default value of 1 disables the command pipelining, which
+	 * is also automatically disabled if a command times out or is refused as busy while other commands are in
+	 * flight.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class, PROP_GV_DEVICE_GVCP_WINDOW,
+					 g_param_spec_uint ("gvcp-window", "GVCP window",
+							    "Maximum number of GVCP commands in flight",
+							    1, ARV_GV_DEVICE_GVCP_WINDOW_MAX,
+							    ARV_GV_DEVICE_GVCP_WINDOW_DEFAULT,
+							    G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+								G_PARAM_CONSTRUCT));
 }
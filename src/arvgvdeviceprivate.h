@@ -49,6 +49,9 @@ G_BEGIN_DECLS
 
 #define ARV_GV_DEVICE_BUFFER_SIZE	1024
 
+#define ARV_GV_DEVICE_GVCP_WINDOW_DEFAULT	1
+#define ARV_GV_DEVICE_GVCP_WINDOW_MAX		32
+
 GRegex * 		arv_gv_device_get_url_regex 			(void);
 void                    arv_gc_set_default_gv_features                  (ArvGc *genicam);
 
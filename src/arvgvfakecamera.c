@@ -20,14 +20,35 @@
  * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
  */
 
+#ifdef HAVE_SENDMMSG
+#define _GNU_SOURCE
+#endif
+
 #include <arvgvfakecamera.h>
 #include <arvfakecamera.h>
 #include <arvbufferprivate.h>
 #include <arvgvcpprivate.h>
 #include <arvgvspprivate.h>
+#include <arvgendcprivate.h>
+#include <arvenumtypes.h>
 #include <arvmisc.h>
 #include <arvmiscprivate.h>
 #include <arvnetworkprivate.h>
+#include <string.h>
+
+#ifdef HAVE_SENDMMSG
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <errno.h>
+
+#ifndef SOL_UDP
+#define SOL_UDP		17
+#endif
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT	103
+#endif
+#endif
 
 /**
  * SECTION: arvgvfakecamera
@@ -38,6 +59,22 @@
 
 #define ARV_GV_FAKE_CAMERA_BUFFER_SIZE	65536
 
+#define ARV_GV_FAKE_CAMERA_FRAME_HISTORY_DEFAULT	8
+#define ARV_GV_FAKE_CAMERA_FRAME_HISTORY_MAX		1024
+#define ARV_GV_FAKE_CAMERA_N_HELD_PACKETS_MAX		64
+
+/* High rate sender: number of packets sent by a single sendmmsg call, size of the buffer used for the packet
+ * headers, and limits of the UDP segmentation offload messages */
+#define ARV_GV_FAKE_CAMERA_BATCH_SIZE			256
+#define ARV_GV_FAKE_CAMERA_HEADER_SIZE			64
+#define ARV_GV_FAKE_CAMERA_GSO_SEGMENTS_MAX		64
+#define ARV_GV_FAKE_CAMERA_GSO_SIZE_MAX			65000
+
+/* GenDC descriptor of a single intensity component, made of a single part */
+#define ARV_GV_FAKE_CAMERA_GENDC_DESCRIPTOR_SIZE	(sizeof (ArvGenDCContainerHeader) + sizeof (guint64) + \
+							 sizeof (ArvGenDCComponentHeader) + sizeof (guint64) + \
+							 sizeof (ArvGenDCPartHeader))
+
 enum {
 	ARV_GV_FAKE_CAMERA_INPUT_SOCKET_GVCP = 0,
 	ARV_GV_FAKE_CAMERA_INPUT_SOCKET_GLOBAL_DISCOVERY,
@@ -52,9 +89,68 @@ enum
   PROP_SERIAL_NUMBER,
   PROP_GENICAM_FILENAME,
   PROP_GVSP_LOST_PACKET_RATIO,
+  PROP_GVSP_BURST_LENGTH,
+  PROP_GVSP_REORDER_RATIO,
+  PROP_GVSP_REORDER_DISTANCE,
+  PROP_FRAME_HISTORY,
+  PROP_RANDOM_SEED,
+  PROP_GVSP_HIGH_RATE,
+  PROP_GVSP_PAYLOAD_TYPE,
+  PROP_GVSP_ALL_IN,
   PROP_CM_DOMAIN
 };
 
+/* A frame of the history, kept for the packet resend requests */
+
+typedef struct {
+	ArvBuffer *buffer;
+	size_t payload;
+	size_t packet_data_size;
+	guint32 n_packets;
+	gboolean is_template;
+	gboolean is_all_in;
+	guint8 gendc_descriptor[ARV_GV_FAKE_CAMERA_GENDC_DESCRIPTOR_SIZE];
+} ArvGvFakeCameraFrame;
+
+/* A packet held back by the reordering injection, sent after countdown other packets */
+
+typedef struct {
+	ArvGvFakeCameraFrame *frame;
+	guint32 packet_id;
+	guint countdown;
+} ArvGvFakeCameraHeldPacket;
+
+#ifdef HAVE_SENDMMSG
+
+/* Packets waiting for the next sendmmsg call. The payload data is not copied, the packets are described by a
+ * header and a pointer to the frame data. When UDP segmentation offload is available, consecutive payload
+ * packets of the same size are grouped in a single message, which is split by the kernel. */
+
+typedef struct {
+	guint8 headers[ARV_GV_FAKE_CAMERA_BATCH_SIZE][ARV_GV_FAKE_CAMERA_HEADER_SIZE];
+	struct iovec iovecs[2 * ARV_GV_FAKE_CAMERA_BATCH_SIZE];
+	struct mmsghdr messages[ARV_GV_FAKE_CAMERA_BATCH_SIZE];
+	union {
+		char buffer[CMSG_SPACE (sizeof (guint16))];
+		struct cmsghdr align;
+	} controls[ARV_GV_FAKE_CAMERA_BATCH_SIZE];
+
+	struct sockaddr_storage address;
+	socklen_t address_length;
+
+	guint n_packets;
+	guint n_iovecs;
+	guint n_messages;
+
+	/* Last message segmentation state, segment_size is 0 for a non segmented message */
+	size_t segment_size;
+	size_t message_size;
+	guint n_segments;
+	gboolean is_message_closed;
+} ArvGvFakeCameraBatch;
+
+#endif
+
 typedef struct {
 	char *interface_name;
 	char *serial_number;
@@ -78,6 +174,60 @@ typedef struct {
 	gboolean cancel;
 
 	double gvsp_lost_packet_ratio;
+	guint gvsp_burst_length;
+	double gvsp_reorder_ratio;
+	guint gvsp_reorder_distance;
+	guint frame_history_size;
+	guint32 random_seed;
+	gboolean gvsp_high_rate;
+	ArvBufferPayloadType gvsp_payload_type;
+	gboolean gvsp_all_in;
+
+	/* Stream state, only used by the camera thread */
+	ArvBufferPayloadType payload_type;
+	gboolean all_in;
+	GSocketAddress *stream_address;
+	void *packet_buffer;
+	GRand *rand;
+	ArvGvFakeCameraFrame *frames;
+	guint n_frames;
+	guint frame_index;
+	guint n_burst_packets;
+	ArvGvFakeCameraHeldPacket held_packets[ARV_GV_FAKE_CAMERA_N_HELD_PACKETS_MAX];
+	guint n_held_packets;
+#ifdef HAVE_SENDMMSG
+	ArvGvFakeCameraBatch *batch;
+	gboolean is_gso_enabled;
+#endif
+	gboolean use_templates;
+
+	guint64 n_sent_frames;
+	guint64 n_sent_packets;
+	guint64 n_sent_bytes;
+	gint64 statistics_time_us;
+	guint64 statistics_n_frames;
+	guint64 statistics_n_packets;
+	guint64 statistics_n_bytes;
+
+	/* Published stream statistics, protected by statistics_mutex */
+	GMutex statistics_mutex;
+	guint64 published_n_frames;
+	guint64 published_n_packets;
+	double frame_rate;
+	double packet_rate;
+	double data_rate;
+
+	/* Control statistics, protected by statistics_mutex */
+	guint64 n_read_register_commands;
+	guint64 n_read_registers;
+	guint64 n_write_register_commands;
+	guint64 n_written_registers;
+
+	guint64 n_dropped_packets;
+	guint64 n_reordered_packets;
+	guint64 n_resend_requests;
+	guint64 n_resent_packets;
+	guint64 n_resend_misses;
 } ArvGvFakeCameraPrivate;
 
 struct _ArvGvFakeCamera {
@@ -106,6 +256,695 @@ _g_inet_socket_address_is_equal (GInetSocketAddress *a, GInetSocketAddress *b)
 				     g_inet_socket_address_get_address (b));
 }
 
+#ifdef HAVE_SENDMMSG
+
+static void
+_flush_batch (ArvGvFakeCamera *gv_fake_camera)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	ArvGvFakeCameraBatch *batch = priv->batch;
+	int fd;
+	guint n_sent = 0;
+
+	if (batch == NULL || batch->n_messages == 0)
+		return;
+
+	fd = g_socket_get_fd (priv->gvsp_socket);
+
+	while (n_sent < batch->n_messages) {
+		int result;
+
+		result = sendmmsg (fd, &batch->messages[n_sent], batch->n_messages - n_sent, 0);
+		if (result > 0) {
+			n_sent += result;
+			continue;
+		}
+
+		if (result < 0 && errno == EINTR)
+			continue;
+
+		if (result < 0 && (errno == EIO || errno == EINVAL) && priv->is_gso_enabled) {
+			/* The output device may not support the segmentation offload */
+			arv_warning_stream_thread ("[GvFakeCamera::flush_batch] UDP segmentation offload failed (%s),"
+						   " disable it", g_strerror (errno));
+			priv->is_gso_enabled = FALSE;
+		} else
+			arv_info_stream_thread ("[GvFakeCamera::flush_batch] Failed to send packets: %s",
+						result < 0 ? g_strerror (errno) : "no message sent");
+
+		/* Skip the failing message, the receiver will ask for the missing packets */
+		n_sent++;
+	}
+
+	batch->n_packets = 0;
+	batch->n_iovecs = 0;
+	batch->n_messages = 0;
+	batch->segment_size = 0;
+}
+
+static void
+_batch_packet (ArvGvFakeCamera *gv_fake_camera, ArvGvFakeCameraFrame *frame, guint32 packet_id)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	ArvGvFakeCameraBatch *batch = priv->batch;
+	ArvBuffer *buffer = frame->buffer;
+	struct iovec *iovecs;
+	size_t header_size;
+	size_t packet_size;
+	guint n_iovecs = 1;
+	gboolean is_payload = FALSE;
+	void *header;
+
+	if (batch->n_packets >= ARV_GV_FAKE_CAMERA_BATCH_SIZE)
+		_flush_batch (gv_fake_camera);
+
+	header = batch->headers[batch->n_packets];
+	iovecs = &batch->iovecs[batch->n_iovecs];
+
+	if (packet_id == 0) {
+		arv_gvsp_packet_new_image_leader (buffer->priv->frame_id, packet_id,
+						  arv_buffer_get_timestamp (buffer),
+						  arv_buffer_get_image_pixel_format (buffer),
+						  arv_buffer_get_image_width (buffer),
+						  arv_buffer_get_image_height (buffer),
+						  arv_buffer_get_image_x (buffer),
+						  arv_buffer_get_image_y (buffer),
+						  0, 0,
+						  header, ARV_GV_FAKE_CAMERA_HEADER_SIZE, &header_size);
+	} else if (packet_id == frame->n_packets - 1) {
+		arv_gvsp_packet_new_data_trailer (buffer->priv->frame_id, packet_id,
+						  arv_buffer_get_image_height (buffer),
+						  header, ARV_GV_FAKE_CAMERA_HEADER_SIZE, &header_size);
+	} else {
+		size_t offset = (packet_id - 1) * frame->packet_data_size;
+
+		arv_gvsp_packet_new_payload_header (buffer->priv->frame_id, packet_id,
+						    header, ARV_GV_FAKE_CAMERA_HEADER_SIZE, &header_size);
+
+		iovecs[1].iov_base = ((char *) buffer->priv->data) + offset;
+		iovecs[1].iov_len = MIN (frame->packet_data_size, frame->payload - offset);
+		n_iovecs = 2;
+		is_payload = TRUE;
+	}
+
+	iovecs[0].iov_base = header;
+	iovecs[0].iov_len = header_size;
+
+	packet_size = header_size + (n_iovecs > 1 ? iovecs[1].iov_len : 0);
+
+	if (priv->is_gso_enabled && is_payload &&
+	    batch->n_messages > 0 &&
+	    batch->segment_size > 0 &&
+	    !batch->is_message_closed &&
+	    packet_size <= batch->segment_size &&
+	    batch->n_segments < ARV_GV_FAKE_CAMERA_GSO_SEGMENTS_MAX &&
+	    batch->message_size + packet_size <= ARV_GV_FAKE_CAMERA_GSO_SIZE_MAX) {
+		guint message_index = batch->n_messages - 1;
+		struct msghdr *message = &batch->messages[message_index].msg_hdr;
+
+		if (batch->n_segments == 1) {
+			struct cmsghdr *control;
+
+			message->msg_control = batch->controls[message_index].buffer;
+			message->msg_controllen = sizeof (batch->controls[message_index].buffer);
+			control = CMSG_FIRSTHDR (message);
+			control->cmsg_level = SOL_UDP;
+			control->cmsg_type = UDP_SEGMENT;
+			control->cmsg_len = CMSG_LEN (sizeof (guint16));
+			*((guint16 *) CMSG_DATA (control)) = batch->segment_size;
+		}
+
+		message->msg_iovlen += n_iovecs;
+		batch->n_segments++;
+		batch->message_size += packet_size;
+
+		/* Only the last segment can be shorter */
+		if (packet_size < batch->segment_size)
+			batch->is_message_closed = TRUE;
+	} else {
+		struct msghdr *message = &batch->messages[batch->n_messages].msg_hdr;
+
+		message->msg_name = &batch->address;
+		message->msg_namelen = batch->address_length;
+		message->msg_iov = iovecs;
+		message->msg_iovlen = n_iovecs;
+		message->msg_control = NULL;
+		message->msg_controllen = 0;
+		message->msg_flags = 0;
+
+		batch->n_messages++;
+		batch->segment_size = is_payload ? packet_size : 0;
+		batch->message_size = packet_size;
+		batch->n_segments = 1;
+		batch->is_message_closed = FALSE;
+	}
+
+	batch->n_iovecs += n_iovecs;
+	batch->n_packets++;
+
+	priv->n_sent_packets++;
+	priv->n_sent_bytes += packet_size;
+}
+
+#endif
+
+static void
+_send_packet (ArvGvFakeCamera *gv_fake_camera, ArvGvFakeCameraFrame *frame, guint32 packet_id)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	ArvBuffer *buffer = frame->buffer;
+	GError *error = NULL;
+	size_t packet_size;
+
+#ifdef HAVE_SENDMMSG
+	if (priv->batch != NULL) {
+		if (priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_IMAGE && !frame->is_all_in) {
+			_batch_packet (gv_fake_camera, frame, packet_id);
+			return;
+		}
+
+		/* Only the image payload packets are batched, keep the packet order */
+		_flush_batch (gv_fake_camera);
+	}
+#endif
+
+	if (frame->is_all_in) {
+		arv_gvsp_packet_new_image_all_in (buffer->priv->frame_id, packet_id,
+						  arv_buffer_get_timestamp (buffer),
+						  arv_buffer_get_image_pixel_format (buffer),
+						  arv_buffer_get_image_width (buffer),
+						  arv_buffer_get_image_height (buffer),
+						  arv_buffer_get_image_x (buffer),
+						  arv_buffer_get_image_y (buffer),
+						  0, 0,
+						  frame->payload, buffer->priv->data,
+						  priv->packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
+						  &packet_size);
+		/* A multipart all-in packet is not supported by the receivers, only the payload type is changed */
+		if (priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_MULTIPART) {
+			ArvGvspLeader *leader;
+
+			leader = arv_gvsp_packet_get_data ((ArvGvspPacket *) priv->packet_buffer, packet_size);
+			leader->payload_type = g_htons (ARV_BUFFER_PAYLOAD_TYPE_MULTIPART);
+		}
+	} else if (packet_id == 0) {
+		if (priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_IMAGE)
+			arv_gvsp_packet_new_image_leader (buffer->priv->frame_id, packet_id,
+							  arv_buffer_get_timestamp (buffer),
+							  arv_buffer_get_image_pixel_format (buffer),
+							  arv_buffer_get_image_width (buffer),
+							  arv_buffer_get_image_height (buffer),
+							  arv_buffer_get_image_x (buffer),
+							  arv_buffer_get_image_y (buffer),
+							  0, 0,
+							  priv->packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
+							  &packet_size);
+		else
+			arv_gvsp_packet_new_generic_leader (buffer->priv->frame_id, packet_id,
+							    priv->payload_type, arv_buffer_get_timestamp (buffer),
+							    priv->packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
+							    &packet_size);
+	} else if (packet_id == frame->n_packets - 1) {
+		arv_gvsp_packet_new_data_trailer (buffer->priv->frame_id, packet_id,
+						  arv_buffer_get_image_height (buffer),
+						  priv->packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
+						  &packet_size);
+	} else if (priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER) {
+		/* The first data packet transports the descriptor, followed in the container by the image data */
+		if (packet_id == 1) {
+			arv_gvsp_packet_new_gendc (buffer->priv->frame_id, packet_id,
+						   0, sizeof (frame->gendc_descriptor), frame->gendc_descriptor,
+						   priv->packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
+						   &packet_size);
+		} else {
+			size_t offset = (packet_id - 2) * frame->packet_data_size;
+
+			arv_gvsp_packet_new_gendc (buffer->priv->frame_id, packet_id,
+						   sizeof (frame->gendc_descriptor) + offset,
+						   MIN (frame->packet_data_size, frame->payload - offset),
+						   ((char *) buffer->priv->data) + offset,
+						   priv->packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
+						   &packet_size);
+		}
+	} else if (priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_H264) {
+		size_t offset = (packet_id - 1) * frame->packet_data_size;
+
+		arv_gvsp_packet_new_h264_payload (buffer->priv->frame_id, packet_id,
+						  MIN (frame->packet_data_size, frame->payload - offset),
+						  ((char *) buffer->priv->data) + offset,
+						  priv->packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
+						  &packet_size);
+	} else {
+		size_t offset = (packet_id - 1) * frame->packet_data_size;
+
+		arv_gvsp_packet_new_payload (buffer->priv->frame_id, packet_id,
+					     MIN (frame->packet_data_size, frame->payload - offset),
+					     ((char *) buffer->priv->data) + offset,
+					     priv->packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
+					     &packet_size);
+	}
+
+	g_socket_send_to (priv->gvsp_socket, priv->stream_address, priv->packet_buffer, packet_size, NULL, &error);
+
+	priv->n_sent_packets++;
+	priv->n_sent_bytes += packet_size;
+
+	if (error != NULL) {
+		arv_info_stream_thread ("[GvFakeCamera::send_packet] Failed to send packet %u for frame %"
+					G_GUINT64_FORMAT ": %s", packet_id, buffer->priv->frame_id, error->message);
+		g_clear_error (&error);
+	}
+}
+
+/* GenDC container descriptor of the frame image, which follows it in the container */
+
+static void
+_fill_gendc_descriptor (ArvGvFakeCameraFrame *frame)
+{
+	ArvBuffer *buffer = frame->buffer;
+	ArvGenDCContainerHeader *container;
+	ArvGenDCComponentHeader *component;
+	ArvGenDCPartHeader *part;
+	guint8 *data = frame->gendc_descriptor;
+	guint64 component_offset;
+	guint64 part_offset;
+
+	memset (data, 0, sizeof (frame->gendc_descriptor));
+
+	component_offset = sizeof (ArvGenDCContainerHeader) + sizeof (guint64);
+	part_offset = component_offset + sizeof (ArvGenDCComponentHeader) + sizeof (guint64);
+
+	container = (ArvGenDCContainerHeader *) data;
+	container->signature = GUINT32_TO_LE (ARV_GENDC_SIGNATURE);
+	container->header_size = GUINT32_TO_LE (sizeof (ArvGenDCContainerHeader) + sizeof (guint64));
+	container->id = GUINT64_TO_LE (buffer->priv->frame_id);
+	container->datasize = GUINT64_TO_LE (frame->payload);
+	container->dataoffset = GUINT64_TO_LE (sizeof (frame->gendc_descriptor));
+	container->descriptorsize = GUINT32_TO_LE (sizeof (frame->gendc_descriptor));
+	container->component_count = GUINT32_TO_LE (1);
+	component_offset = GUINT64_TO_LE (component_offset);
+	memcpy (data + sizeof (ArvGenDCContainerHeader), &component_offset, sizeof (guint64));
+
+	component = (ArvGenDCComponentHeader *) (data + GUINT64_FROM_LE (component_offset));
+	component->header_size = GUINT32_TO_LE (sizeof (ArvGenDCComponentHeader) + sizeof (guint64));
+	component->timestamp = GUINT64_TO_LE (buffer->priv->timestamp_ns);
+	component->type_id = GUINT64_TO_LE (ARV_GENDC_COMPONENT_TYPE_INTENSITY);
+	component->format = GUINT32_TO_LE (arv_buffer_get_image_pixel_format (buffer));
+	component->part_count = GUINT16_TO_LE (1);
+	part_offset = GUINT64_TO_LE (part_offset);
+	memcpy ((guint8 *) component + sizeof (ArvGenDCComponentHeader), &part_offset, sizeof (guint64));
+
+	part = (ArvGenDCPartHeader *) (data + GUINT64_FROM_LE (part_offset));
+	part->header_size = GUINT32_TO_LE (sizeof (ArvGenDCPartHeader));
+	part->format = GUINT32_TO_LE (arv_buffer_get_image_pixel_format (buffer));
+	part->datasize = GUINT64_TO_LE (frame->payload);
+	part->dataoffset = GUINT64_TO_LE (sizeof (frame->gendc_descriptor));
+	part->dimension_x = GUINT32_TO_LE (arv_buffer_get_image_width (buffer));
+	part->dimension_y = GUINT32_TO_LE (arv_buffer_get_image_height (buffer));
+}
+
+/* Packet layout of a frame, depending on the payload type of the stream. An image small enough is sent in a single
+ * all-in packet, if enabled. */
+
+static void
+_prepare_frame_packets (ArvGvFakeCameraPrivate *priv, ArvGvFakeCameraFrame *frame, guint32 gv_packet_size)
+{
+	frame->is_all_in = priv->all_in &&
+		(priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_IMAGE ||
+		 priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_MULTIPART) &&
+		sizeof (ArvGvspImageLeader) + frame->payload <=
+		gv_packet_size - ARV_GVSP_PACKET_PROTOCOL_OVERHEAD (FALSE);
+
+	if (frame->is_all_in) {
+		frame->packet_data_size = frame->payload;
+		frame->n_packets = 1;
+	} else if (priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER) {
+		_fill_gendc_descriptor (frame);
+		frame->packet_data_size = gv_packet_size - ARV_GVSP_GENDC_PACKET_PROTOCOL_OVERHEAD (FALSE);
+		frame->n_packets = 3 + (frame->payload + frame->packet_data_size - 1) / frame->packet_data_size;
+	} else {
+		frame->packet_data_size = gv_packet_size - ARV_GVSP_PACKET_PROTOCOL_OVERHEAD (FALSE);
+		frame->n_packets = 2 + (frame->payload + frame->packet_data_size - 1) / frame->packet_data_size;
+	}
+}
+
+static void
+_flush_packets (ArvGvFakeCamera *gv_fake_camera)
+{
+#ifdef HAVE_SENDMMSG
+	_flush_batch (gv_fake_camera);
+#endif
+}
+
+/* Inter packet delay, from the GevSCPD register, in ns */
+
+static guint64
+_get_packet_delay_ns (ArvGvFakeCameraPrivate *priv)
+{
+	guint32 delay = 0;
+	guint32 frequency_high = 0;
+	guint32 frequency_low = 0;
+	guint64 frequency;
+
+	arv_fake_camera_read_register (priv->camera, ARV_GVBS_STREAM_CHANNEL_0_PACKET_DELAY_OFFSET, &delay);
+	if (delay == 0)
+		return 0;
+
+	arv_fake_camera_read_register (priv->camera, ARV_GVBS_TIMESTAMP_TICK_FREQUENCY_HIGH_OFFSET, &frequency_high);
+	arv_fake_camera_read_register (priv->camera, ARV_GVBS_TIMESTAMP_TICK_FREQUENCY_LOW_OFFSET, &frequency_low);
+	frequency = ((guint64) frequency_high << 32) | frequency_low;
+	if (frequency == 0)
+		return 0;
+
+	return (guint64) delay * 1000000000LL / frequency;
+}
+
+/* Wait for the time of the next packet. The pending packets are sent first, then the thread sleeps if the
+ * deadline is far enough, and spins for the remaining time. */
+
+static void
+_wait_for_packet_time (ArvGvFakeCamera *gv_fake_camera, gint64 deadline_ns)
+{
+	gint64 time_ns;
+
+	time_ns = g_get_monotonic_time () * 1000;
+	if (time_ns >= deadline_ns)
+		return;
+
+	_flush_packets (gv_fake_camera);
+
+	time_ns = g_get_monotonic_time () * 1000;
+	if (deadline_ns - time_ns > 200000)
+		g_usleep ((deadline_ns - time_ns - 100000) / 1000);
+
+	while (g_get_monotonic_time () * 1000 < deadline_ns)
+		;
+}
+
+/* Random loss, followed by gvsp_burst_length - 1 consecutive losses */
+
+static gboolean
+_drop_packet (ArvGvFakeCameraPrivate *priv)
+{
+	if (priv->n_burst_packets > 0) {
+		priv->n_burst_packets--;
+		return TRUE;
+	}
+
+	if (priv->gvsp_lost_packet_ratio > 0.0 &&
+	    g_rand_double (priv->rand) < priv->gvsp_lost_packet_ratio) {
+		priv->n_burst_packets = MAX (priv->gvsp_burst_length, 1) - 1;
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+static void
+_send_held_packets (ArvGvFakeCamera *gv_fake_camera, gboolean flush)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	guint i = 0;
+
+	while (i < priv->n_held_packets) {
+		ArvGvFakeCameraHeldPacket *held_packet = &priv->held_packets[i];
+
+		if (flush || --held_packet->countdown == 0) {
+			_send_packet (gv_fake_camera, held_packet->frame, held_packet->packet_id);
+			memmove (held_packet, held_packet + 1,
+				 (priv->n_held_packets - i - 1) * sizeof (ArvGvFakeCameraHeldPacket));
+			priv->n_held_packets--;
+		} else
+			i++;
+	}
+}
+
+static void
+_send_frame (ArvGvFakeCamera *gv_fake_camera, ArvGvFakeCameraFrame *frame)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	guint32 packet_id;
+	guint64 packet_delay_ns;
+	gint64 start_time_ns;
+	guint64 n_packets = 0;
+
+	packet_delay_ns = _get_packet_delay_ns (priv);
+	start_time_ns = g_get_monotonic_time () * 1000;
+
+	for (packet_id = 0; packet_id < frame->n_packets; packet_id++) {
+		if (_drop_packet (priv)) {
+			arv_debug_stream_thread ("[GvFakeCamera::send_frame] Drop packet %u of frame %" G_GUINT64_FORMAT,
+						 packet_id, frame->buffer->priv->frame_id);
+			priv->n_dropped_packets++;
+			continue;
+		}
+
+		if (priv->gvsp_reorder_ratio > 0.0 &&
+		    priv->n_held_packets < ARV_GV_FAKE_CAMERA_N_HELD_PACKETS_MAX &&
+		    g_rand_double (priv->rand) < priv->gvsp_reorder_ratio) {
+			ArvGvFakeCameraHeldPacket *held_packet = &priv->held_packets[priv->n_held_packets++];
+
+			held_packet->frame = frame;
+			held_packet->packet_id = packet_id;
+			held_packet->countdown = MAX (priv->gvsp_reorder_distance, 1);
+			priv->n_reordered_packets++;
+			continue;
+		}
+
+		if (packet_delay_ns > 0)
+			_wait_for_packet_time (gv_fake_camera,
+					       start_time_ns + (gint64) (n_packets * packet_delay_ns));
+
+		_send_packet (gv_fake_camera, frame, packet_id);
+		_send_held_packets (gv_fake_camera, FALSE);
+		n_packets++;
+	}
+
+	/* The held packets never outlive their frame */
+	_send_held_packets (gv_fake_camera, TRUE);
+	_flush_packets (gv_fake_camera);
+
+	priv->n_sent_frames++;
+}
+
+static void
+_update_statistics (ArvGvFakeCamera *gv_fake_camera, gboolean reset)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	gint64 time_us;
+	double elapsed;
+
+	time_us = g_get_monotonic_time ();
+
+	if (reset) {
+		priv->n_sent_frames = 0;
+		priv->n_sent_packets = 0;
+		priv->n_sent_bytes = 0;
+		priv->statistics_time_us = time_us;
+		priv->statistics_n_frames = 0;
+		priv->statistics_n_packets = 0;
+		priv->statistics_n_bytes = 0;
+
+		g_mutex_lock (&priv->statistics_mutex);
+		priv->published_n_frames = 0;
+		priv->published_n_packets = 0;
+		priv->frame_rate = 0.0;
+		priv->packet_rate = 0.0;
+		priv->data_rate = 0.0;
+		g_mutex_unlock (&priv->statistics_mutex);
+		return;
+	}
+
+	if (time_us - priv->statistics_time_us < G_USEC_PER_SEC)
+		return;
+
+	elapsed = (double) (time_us - priv->statistics_time_us) / (double) G_USEC_PER_SEC;
+
+	g_mutex_lock (&priv->statistics_mutex);
+	priv->published_n_frames = priv->n_sent_frames;
+	priv->published_n_packets = priv->n_sent_packets;
+	priv->frame_rate = (double) (priv->n_sent_frames - priv->statistics_n_frames) / elapsed;
+	priv->packet_rate = (double) (priv->n_sent_packets - priv->statistics_n_packets) / elapsed;
+	priv->data_rate = (double) (priv->n_sent_bytes - priv->statistics_n_bytes) / elapsed;
+	g_mutex_unlock (&priv->statistics_mutex);
+
+	arv_info_stream_thread ("[GvFakeCamera::thread] %.1f fps, %.0f packets/s, %.1f MB/s",
+				priv->frame_rate, priv->packet_rate, priv->data_rate / 1e6);
+
+	priv->statistics_time_us = time_us;
+	priv->statistics_n_frames = priv->n_sent_frames;
+	priv->statistics_n_packets = priv->n_sent_packets;
+	priv->statistics_n_bytes = priv->n_sent_bytes;
+}
+
+static void
+_resend_packets (ArvGvFakeCamera *gv_fake_camera, guint64 frame_id, guint32 first_packet, guint32 last_packet)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	ArvGvFakeCameraFrame *frame = NULL;
+	guint32 packet_id;
+	guint i;
+
+	priv->n_resend_requests++;
+
+	/* Only 16 bit frame ids are sent */
+	for (i = 0; i < priv->n_frames && priv->stream_address != NULL; i++) {
+		if (priv->frames[i].n_packets > 0 &&
+		    (guint16) priv->frames[i].buffer->priv->frame_id == (guint16) frame_id) {
+			frame = &priv->frames[i];
+			break;
+		}
+	}
+
+	if (frame == NULL) {
+		arv_info_stream_thread ("[GvFakeCamera::resend_packets] Frame %" G_GUINT64_FORMAT
+					" not found in history", frame_id);
+		priv->n_resend_misses++;
+		return;
+	}
+
+	arv_debug_stream_thread ("[GvFakeCamera::resend_packets] Resend packets %u to %u of frame %" G_GUINT64_FORMAT,
+				 first_packet, last_packet, frame_id);
+
+	/* Resent packets are subject to the random loss, but not to the bursts and the reordering */
+	for (packet_id = first_packet; packet_id <= MIN (last_packet, frame->n_packets - 1); packet_id++) {
+		if (priv->gvsp_lost_packet_ratio > 0.0 &&
+		    g_rand_double (priv->rand) < priv->gvsp_lost_packet_ratio) {
+			priv->n_dropped_packets++;
+			continue;
+		}
+
+		_send_packet (gv_fake_camera, frame, packet_id);
+		priv->n_resent_packets++;
+	}
+
+	_flush_packets (gv_fake_camera);
+}
+
+static void
+_start_stream (ArvGvFakeCamera *gv_fake_camera)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	GInetAddress *inet_address;
+	char *inet_address_string;
+	size_t payload;
+	guint i;
+
+	priv->stream_address = arv_fake_camera_get_stream_address (priv->camera);
+	inet_address = g_inet_socket_address_get_address (G_INET_SOCKET_ADDRESS (priv->stream_address));
+	inet_address_string = g_inet_address_to_string (inet_address);
+	arv_info_stream_thread ("[GvFakeCamera::thread] Start stream to %s (%d)",
+				inet_address_string,
+				g_inet_socket_address_get_port (G_INET_SOCKET_ADDRESS (priv->stream_address)));
+	g_free (inet_address_string);
+
+	payload = arv_fake_camera_get_payload (priv->camera);
+
+	priv->n_frames = CLAMP (priv->frame_history_size, 1, ARV_GV_FAKE_CAMERA_FRAME_HISTORY_MAX);
+	priv->frames = g_new0 (ArvGvFakeCameraFrame, priv->n_frames);
+	for (i = 0; i < priv->n_frames; i++) {
+		priv->frames[i].buffer = arv_buffer_new (payload, NULL);
+		priv->frames[i].payload = payload;
+	}
+	priv->frame_index = 0;
+
+	priv->n_burst_packets = 0;
+	priv->n_held_packets = 0;
+
+	priv->n_dropped_packets = 0;
+	priv->n_reordered_packets = 0;
+	priv->n_resend_requests = 0;
+	priv->n_resent_packets = 0;
+	priv->n_resend_misses = 0;
+
+	priv->payload_type = priv->gvsp_payload_type;
+	priv->all_in = priv->gvsp_all_in;
+
+	/* A non zero seed makes the loss and reordering patterns reproducible */
+	if (priv->random_seed != 0)
+		g_rand_set_seed (priv->rand, priv->random_seed);
+
+	/* In high rate mode, the image data of the history frames is generated once, and only the frame
+	 * informations are updated afterward */
+	priv->use_templates = priv->gvsp_high_rate;
+
+#ifdef HAVE_SENDMMSG
+	if (priv->gvsp_high_rate) {
+		GError *error = NULL;
+		int value = 0;
+
+		priv->batch = g_new0 (ArvGvFakeCameraBatch, 1);
+		if (g_socket_address_to_native (priv->stream_address, &priv->batch->address,
+						sizeof (priv->batch->address), &error)) {
+			priv->batch->address_length = g_socket_address_get_native_size (priv->stream_address);
+
+			/* A zero segment size is accepted if the kernel supports the UDP segmentation offload */
+			priv->is_gso_enabled = setsockopt (g_socket_get_fd (priv->gvsp_socket),
+							   SOL_UDP, UDP_SEGMENT, &value, sizeof (value)) == 0;
+
+			arv_info_stream_thread ("[GvFakeCamera::thread] High rate mode, UDP segmentation offload %s",
+						priv->is_gso_enabled ? "enabled" : "disabled");
+		} else {
+			arv_warning_stream_thread ("[GvFakeCamera::thread] Invalid stream address: %s",
+						   error->message);
+			g_clear_error (&error);
+			g_clear_pointer (&priv->batch, g_free);
+		}
+	}
+#else
+	if (priv->gvsp_high_rate)
+		arv_info_stream_thread ("[GvFakeCamera::thread] Batched packet sending not available");
+#endif
+
+	_update_statistics (gv_fake_camera, TRUE);
+}
+
+static void
+_stop_stream (ArvGvFakeCamera *gv_fake_camera)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	guint i;
+
+	if (priv->stream_address == NULL)
+		return;
+
+#ifdef HAVE_SENDMMSG
+	_flush_batch (gv_fake_camera);
+	g_clear_pointer (&priv->batch, g_free);
+#endif
+
+	for (i = 0; i < priv->n_frames; i++)
+		g_clear_object (&priv->frames[i].buffer);
+	g_clear_pointer (&priv->frames, g_free);
+	priv->n_frames = 0;
+
+	g_clear_object (&priv->stream_address);
+
+	g_mutex_lock (&priv->statistics_mutex);
+	priv->published_n_frames = priv->n_sent_frames;
+	priv->published_n_packets = priv->n_sent_packets;
+	priv->frame_rate = 0.0;
+	priv->packet_rate = 0.0;
+	priv->data_rate = 0.0;
+	g_mutex_unlock (&priv->statistics_mutex);
+
+	arv_info_stream_thread ("[GvFakeCamera::thread] Stop stream");
+	arv_info_stream_thread ("[GvFakeCamera::thread] n_sent_frames       = %" G_GUINT64_FORMAT,
+				priv->n_sent_frames);
+	arv_info_stream_thread ("[GvFakeCamera::thread] n_sent_packets      = %" G_GUINT64_FORMAT,
+				priv->n_sent_packets);
+	arv_info_stream_thread ("[GvFakeCamera::thread] n_dropped_packets   = %" G_GUINT64_FORMAT,
+				priv->n_dropped_packets);
+	arv_info_stream_thread ("[GvFakeCamera::thread] n_reordered_packets = %" G_GUINT64_FORMAT,
+				priv->n_reordered_packets);
+	arv_info_stream_thread ("[GvFakeCamera::thread] n_resend_requests   = %" G_GUINT64_FORMAT,
+				priv->n_resend_requests);
+	arv_info_stream_thread ("[GvFakeCamera::thread] n_resent_packets    = %" G_GUINT64_FORMAT,
+				priv->n_resent_packets);
+	arv_info_stream_thread ("[GvFakeCamera::thread] n_resend_misses     = %" G_GUINT64_FORMAT,
+				priv->n_resend_misses);
+}
+
 static gboolean
 _handle_control_packet (ArvGvFakeCamera *gv_fake_camera, GSocket *socket,
 			GSocketAddress *remote_address,
@@ -119,6 +958,9 @@ _handle_control_packet (ArvGvFakeCamera *gv_fake_camera, GSocket *socket,
 	guint16 packet_type;
 	guint32 register_address;
 	guint32 register_value;
+	guint32 register_values[ARV_GVCP_N_READ_REGISTERS_MAX];
+	guint n_registers;
+	guint i;
 	gboolean write_access;
 	gboolean success = FALSE;
 
@@ -187,31 +1029,76 @@ _handle_control_packet (ArvGvFakeCamera *gv_fake_camera, GSocket *socket,
 									   &ack_packet_size);
 			break;
 		case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
-			arv_gvcp_packet_get_read_register_cmd_infos (packet, size, &register_address);
-			arv_fake_camera_read_register (gv_fake_camera->priv->camera, register_address, &register_value);
-			arv_info_device ("[GvFakeCamera::handle_control_packet] Read register command %d -> %d",
-					  register_address, register_value);
-			ack_packet = arv_gvcp_packet_new_read_register_ack (register_value, packet_id,
-									    &ack_packet_size);
+			n_registers = MIN (arv_gvcp_packet_get_read_registers_cmd_n_addresses (packet, size),
+					   ARV_GVCP_N_READ_REGISTERS_MAX);
+			if (n_registers == 0) {
+				arv_warning_device ("[GvFakeCamera::handle_control_packet] Empty read register command");
+				break;
+			}
+
+			for (i = 0; i < n_registers; i++) {
+				register_address = arv_gvcp_packet_get_read_registers_cmd_address (packet, size, i);
+				arv_fake_camera_read_register (gv_fake_camera->priv->camera, register_address,
+							       &register_values[i]);
+				arv_info_device ("[GvFakeCamera::handle_control_packet] Read register command %d -> %d",
+						  register_address, register_values[i]);
 
-			if (register_address == ARV_GVBS_CONTROL_CHANNEL_PRIVILEGE_OFFSET)
-				gv_fake_camera->priv->controller_time = g_get_real_time ();
+				if (register_address == ARV_GVBS_CONTROL_CHANNEL_PRIVILEGE_OFFSET)
+					gv_fake_camera->priv->controller_time = g_get_real_time ();
+			}
+
+			ack_packet = arv_gvcp_packet_new_read_registers_ack (register_values, n_registers, packet_id,
+									     &ack_packet_size);
 
+			g_mutex_lock (&gv_fake_camera->priv->statistics_mutex);
+			gv_fake_camera->priv->n_read_register_commands++;
+			gv_fake_camera->priv->n_read_registers += n_registers;
+			g_mutex_unlock (&gv_fake_camera->priv->statistics_mutex);
 			break;
 		case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
-			arv_gvcp_packet_get_write_register_cmd_infos (packet, size, &register_address, &register_value);
+			n_registers = arv_gvcp_packet_get_write_registers_cmd_n_registers (packet, size);
 			if (!write_access) {
+				arv_gvcp_packet_get_write_registers_cmd_infos (packet, size, 0,
+									       &register_address, &register_value);
 				arv_warning_device("[GvFakeCamera::handle_control_packet]"
                                                    " Ignore Write register command %d (%d) not controller",
 					register_address, register_value);
 				break;
 			}
 
-			arv_fake_camera_write_register (gv_fake_camera->priv->camera, register_address, register_value);
-			arv_info_device ("[GvFakeCamera::handle_control_packet] Write register command %d -> %d",
-					  register_address, register_value);
-			ack_packet = arv_gvcp_packet_new_write_register_ack (1, packet_id,
+			/* The registers are written in order, the ack index is the number of completed writes */
+			for (i = 0; i < n_registers; i++) {
+				arv_gvcp_packet_get_write_registers_cmd_infos (packet, size, i,
+									       &register_address, &register_value);
+				arv_fake_camera_write_register (gv_fake_camera->priv->camera, register_address,
+								register_value);
+				arv_info_device ("[GvFakeCamera::handle_control_packet] Write register command %d -> %d",
+						  register_address, register_value);
+			}
+
+			ack_packet = arv_gvcp_packet_new_write_register_ack (n_registers, packet_id,
 									     &ack_packet_size);
+
+			g_mutex_lock (&gv_fake_camera->priv->statistics_mutex);
+			gv_fake_camera->priv->n_write_register_commands++;
+			gv_fake_camera->priv->n_written_registers += n_registers;
+			g_mutex_unlock (&gv_fake_camera->priv->statistics_mutex);
+			break;
+		case ARV_GVCP_COMMAND_PACKET_RESEND_CMD:
+			{
+				guint64 frame_id;
+				guint32 first_packet;
+				guint32 last_packet;
+
+				/* No acknowledge is sent for resend requests */
+				if (arv_gvcp_packet_get_packet_resend_cmd_infos (packet, size, &frame_id,
+										 &first_packet, &last_packet))
+					_resend_packets (gv_fake_camera, frame_id, first_packet, last_packet);
+				else
+					arv_warning_device ("[GvFakeCamera::handle_control_packet] "
+							    "Invalid packet resend command");
+				success = TRUE;
+			}
 			break;
 		default:
 			arv_warning_device ("[GvFakeCamera::handle_control_packet] Unknown command");
@@ -247,14 +1134,7 @@ static void *
 _thread (void *user_data)
 {
 	ArvGvFakeCamera *gv_fake_camera = user_data;
-	ArvBuffer *image_buffer = NULL;
-	GError *error = NULL;
-	GSocketAddress *stream_address = NULL;
-	void *packet_buffer;
-	size_t packet_size;
-	size_t payload = 0;
-	guint16 block_id;
-	ptrdiff_t offset;
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
 	guint32 gv_packet_size;
 	GInputVector input_vector;
 	int n_events;
@@ -263,13 +1143,13 @@ _thread (void *user_data)
 	input_vector.buffer = g_malloc0 (ARV_GV_FAKE_CAMERA_BUFFER_SIZE);
 	input_vector.size = ARV_GV_FAKE_CAMERA_BUFFER_SIZE;
 
-	packet_buffer = g_malloc (ARV_GV_FAKE_CAMERA_BUFFER_SIZE);
+	priv->packet_buffer = g_malloc (ARV_GV_FAKE_CAMERA_BUFFER_SIZE);
 
 	do {
 		guint64 next_timestamp_us;
 
 		if (is_streaming) {
-			arv_fake_camera_get_sleep_time_for_next_frame (gv_fake_camera->priv->camera, &next_timestamp_us);
+			arv_fake_camera_get_sleep_time_for_next_frame (priv->camera, &next_timestamp_us);
 		} else {
 			next_timestamp_us = g_get_real_time () + 100000;
 		}
@@ -283,18 +1163,18 @@ _thread (void *user_data)
 			else if (timeout_ms > 100)
 				timeout_ms = 100;
 
-			n_events = g_poll (gv_fake_camera->priv->socket_fds, gv_fake_camera->priv->n_socket_fds, timeout_ms);
+			n_events = g_poll (priv->socket_fds, priv->n_socket_fds, timeout_ms);
 			if (n_events > 0) {
 				unsigned int i;
 
 				for (i = 0; i < ARV_GV_FAKE_CAMERA_N_INPUT_SOCKETS; i++) {
-					GSocket *socket = gv_fake_camera->priv->input_sockets[i];
+					GSocket *socket = priv->input_sockets[i];
 					int count;
 
 					if (G_IS_SOCKET (socket)) {
 						GSocketAddress *remote_address = NULL;
 
-						arv_gpollfd_clear_one (&gv_fake_camera->priv->socket_fds[i], socket);
+						arv_gpollfd_clear_one (&priv->socket_fds[i], socket);
 
 						count = g_socket_receive_message (socket, &remote_address,
                                                                                   &input_vector, 1, NULL, NULL,
@@ -310,143 +1190,52 @@ _thread (void *user_data)
 					}
 				}
 
-				if (arv_fake_camera_get_control_channel_privilege (gv_fake_camera->priv->camera) == 0 ||
-				    arv_fake_camera_get_acquisition_status (gv_fake_camera->priv->camera) == 0) {
-					if (stream_address != NULL) {
-						g_object_unref (stream_address);
-						stream_address = NULL;
-						g_object_unref (image_buffer);
-						image_buffer = NULL;
-						arv_info_stream_thread ("[GvFakeCamera::thread] Stop stream");
-					}
+				if (arv_fake_camera_get_control_channel_privilege (priv->camera) == 0 ||
+				    arv_fake_camera_get_acquisition_status (priv->camera) == 0) {
+					_stop_stream (gv_fake_camera);
 					is_streaming = FALSE;
 				}
 			}
-		} while (!g_atomic_int_get (&gv_fake_camera->priv->cancel) && g_get_real_time () < next_timestamp_us);
-
-		if (arv_fake_camera_get_control_channel_privilege (gv_fake_camera->priv->camera) != 0 &&
-		    arv_fake_camera_get_acquisition_status (gv_fake_camera->priv->camera) != 0) {
-			if (stream_address == NULL) {
-				GInetAddress *inet_address;
-				char *inet_address_string;
-
-				stream_address = arv_fake_camera_get_stream_address (gv_fake_camera->priv->camera);
-				inet_address = g_inet_socket_address_get_address
-					(G_INET_SOCKET_ADDRESS (stream_address));
-				inet_address_string = g_inet_address_to_string (inet_address);
-				arv_info_stream_thread ("[GvFakeCamera::thread] Start stream to %s (%d)",
-							 inet_address_string,
-							 g_inet_socket_address_get_port
-							 (G_INET_SOCKET_ADDRESS (stream_address)));
-				g_free (inet_address_string);
-
-				payload = arv_fake_camera_get_payload (gv_fake_camera->priv->camera);
-				image_buffer = arv_buffer_new (payload, NULL);
-			}
-
-			if (arv_fake_camera_is_in_free_running_mode (gv_fake_camera->priv->camera) ||
-			    (arv_fake_camera_is_in_software_trigger_mode (gv_fake_camera->priv->camera) &&
-			     arv_fake_camera_check_and_acknowledge_software_trigger (gv_fake_camera->priv->camera))) {
-				arv_fake_camera_fill_buffer (gv_fake_camera->priv->camera, image_buffer,
-                                                             &gv_packet_size);
-
-				arv_info_stream_thread ("[GvFakeCamera::thread] Send frame %" G_GUINT64_FORMAT,
-                                                        image_buffer->priv->frame_id);
-
-				block_id = 0;
-
-                                arv_gvsp_packet_new_image_leader (image_buffer->priv->frame_id,
-                                                                  block_id,
-                                                                  arv_buffer_get_timestamp(image_buffer),
-                                                                  arv_buffer_get_image_pixel_format(image_buffer),
-                                                                  arv_buffer_get_image_width(image_buffer),
-                                                                  arv_buffer_get_image_height(image_buffer),
-                                                                  arv_buffer_get_image_x(image_buffer),
-                                                                  arv_buffer_get_image_y(image_buffer),
-                                                                  0, 0,
-                                                                  packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
-                                                                  &packet_size);
-
-				if (g_random_double () >= gv_fake_camera->priv->gvsp_lost_packet_ratio)
-					g_socket_send_to (gv_fake_camera->priv->gvsp_socket, stream_address,
-							packet_buffer, packet_size, NULL, &error);
-				else
-					arv_info_stream_thread
-                                                ("Drop GVSP leader packet frame: %" G_GUINT64_FORMAT,
-                                                 image_buffer->priv->frame_id);
-
-				if (error != NULL) {
-					arv_warning_stream_thread
-                                                ("[GvFakeCamera::thread] Failed to send leader for frame %"
-                                                 G_GUINT64_FORMAT ": %s", image_buffer->priv->frame_id, error->message);
-                                        g_clear_error (&error);
-                                }
-
-				block_id++;
-
-				offset = 0;
-				while (offset < payload) {
-					size_t data_size;
-
-					data_size = MIN (gv_packet_size - ARV_GVSP_PACKET_PROTOCOL_OVERHEAD (FALSE),
-							payload - offset);
-
-                                        arv_gvsp_packet_new_payload (image_buffer->priv->frame_id, block_id,
-                                                                     data_size,
-                                                                     ((char *) image_buffer->priv->data) + offset,
-                                                                     packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
-                                                                     &packet_size);
-
-					if (g_random_double () >= gv_fake_camera->priv->gvsp_lost_packet_ratio)
-						g_socket_send_to (gv_fake_camera->priv->gvsp_socket, stream_address,
-								packet_buffer, packet_size, NULL, &error);
-					else
-						arv_info_stream_thread
-                                                        ("Drop GVSP data packet frame:%" G_GUINT64_FORMAT
-                                                         ", block:%u", image_buffer->priv->frame_id, block_id);
-
-					if (error != NULL) {
-						arv_info_stream_thread
-                                                        ("[GvFakeCamera::thread] Failed to send frame block %d for frame"
-                                                         " %" G_GUINT64_FORMAT ": %s",
-                                                         block_id, image_buffer->priv->frame_id, error->message);
-                                                g_clear_error (&error);
-                                        }
-
-					offset += data_size;
-					block_id++;
+		} while (!g_atomic_int_get (&priv->cancel) && g_get_real_time () < next_timestamp_us);
+
+		if (arv_fake_camera_get_control_channel_privilege (priv->camera) != 0 &&
+		    arv_fake_camera_get_acquisition_status (priv->camera) != 0) {
+			if (priv->stream_address == NULL)
+				_start_stream (gv_fake_camera);
+
+			if (arv_fake_camera_is_in_free_running_mode (priv->camera) ||
+			    (arv_fake_camera_is_in_software_trigger_mode (priv->camera) &&
+			     arv_fake_camera_check_and_acknowledge_software_trigger (priv->camera))) {
+				ArvGvFakeCameraFrame *frame;
+
+				/* Oldest frame of the history */
+				frame = &priv->frames[priv->frame_index];
+				priv->frame_index = (priv->frame_index + 1) % priv->n_frames;
+
+				if (priv->use_templates && frame->is_template) {
+					arv_fake_camera_fill_buffer_infos (priv->camera, frame->buffer, &gv_packet_size);
+				} else {
+					arv_fake_camera_fill_buffer (priv->camera, frame->buffer, &gv_packet_size);
+					frame->is_template = priv->use_templates;
 				}
 
-                                arv_gvsp_packet_new_data_trailer (image_buffer->priv->frame_id, block_id, arv_buffer_get_image_height(image_buffer) ,
-                                                                  packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
-                                                                  &packet_size);
+				_prepare_frame_packets (priv, frame, gv_packet_size);
 
-				if (g_random_double () >= gv_fake_camera->priv->gvsp_lost_packet_ratio)
-					g_socket_send_to (gv_fake_camera->priv->gvsp_socket, stream_address,
-							packet_buffer, packet_size, NULL, &error);
-				else
-					arv_info_stream_thread ("Drop GVSP trailer packet frame: %" G_GUINT64_FORMAT,
-								image_buffer->priv->frame_id);
+				arv_info_stream_thread ("[GvFakeCamera::thread] Send frame %" G_GUINT64_FORMAT,
+                                                        frame->buffer->priv->frame_id);
 
-				if (error != NULL) {
-					arv_info_stream_thread
-                                                ("[GvFakeCamera::thread] Failed to send trailer for frame %"
-                                                 G_GUINT64_FORMAT ": %s", image_buffer->priv->frame_id, error->message);
-                                        g_clear_error (&error);
-                                }
+				_send_frame (gv_fake_camera, frame);
+				_update_statistics (gv_fake_camera, FALSE);
 
 				is_streaming = TRUE;
 			}
 		}
 
-	} while (!g_atomic_int_get (&gv_fake_camera->priv->cancel));
+	} while (!g_atomic_int_get (&priv->cancel));
 
-	if (stream_address != NULL)
-		g_object_unref (stream_address);
-	if (image_buffer != NULL)
-		g_object_unref (image_buffer);
+	_stop_stream (gv_fake_camera);
 
-	g_free (packet_buffer);
+	g_clear_pointer (&priv->packet_buffer, g_free);
 	g_free (input_vector.buffer);
 
 	return NULL;
@@ -664,6 +1453,42 @@ _set_property (GObject *object, guint prop_id, const GValue *value, GParamSpec *
 		case PROP_GVSP_LOST_PACKET_RATIO:
 			gv_fake_camera->priv->gvsp_lost_packet_ratio = g_value_get_double (value);
 			break;
+		case PROP_GVSP_BURST_LENGTH:
+			gv_fake_camera->priv->gvsp_burst_length = g_value_get_uint (value);
+			break;
+		case PROP_GVSP_REORDER_RATIO:
+			gv_fake_camera->priv->gvsp_reorder_ratio = g_value_get_double (value);
+			break;
+		case PROP_GVSP_REORDER_DISTANCE:
+			gv_fake_camera->priv->gvsp_reorder_distance = g_value_get_uint (value);
+			break;
+		case PROP_FRAME_HISTORY:
+			gv_fake_camera->priv->frame_history_size = g_value_get_uint (value);
+			break;
+		case PROP_RANDOM_SEED:
+			gv_fake_camera->priv->random_seed = g_value_get_uint (value);
+			break;
+		case PROP_GVSP_HIGH_RATE:
+			gv_fake_camera->priv->gvsp_high_rate = g_value_get_boolean (value);
+			break;
+		case PROP_GVSP_PAYLOAD_TYPE:
+			switch (g_value_get_enum (value)) {
+				case ARV_BUFFER_PAYLOAD_TYPE_IMAGE:
+				case ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER:
+				case ARV_BUFFER_PAYLOAD_TYPE_H264:
+				case ARV_BUFFER_PAYLOAD_TYPE_MULTIPART:
+					gv_fake_camera->priv->gvsp_payload_type = g_value_get_enum (value);
+					break;
+				default:
+					arv_warning_device ("[GvFakeCamera::set_property] Unsupported payload type, "
+							    "using image");
+					gv_fake_camera->priv->gvsp_payload_type = ARV_BUFFER_PAYLOAD_TYPE_IMAGE;
+					break;
+			}
+			break;
+		case PROP_GVSP_ALL_IN:
+			gv_fake_camera->priv->gvsp_all_in = g_value_get_boolean (value);
+			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
 			break;
@@ -706,10 +1531,90 @@ arv_gv_fake_camera_is_running (ArvGvFakeCamera *gv_fake_camera)
 	return gv_fake_camera->priv->is_running;
 }
 
+/**
+ * arv_gv_fake_camera_get_stream_statistics:
+ * @gv_fake_camera: a #ArvGvFakeCamera
+ * @n_frames: (out) (optional): number of frames sent since the acquisition start
+ * @n_packets: (out) (optional): number of packets sent since the acquisition start
+ * @frame_rate: (out) (optional): frame rate, in frames per second
+ * @packet_rate: (out) (optional): packet rate, in packets per second
+ * @data_rate: (out) (optional): data rate, including the GVSP headers, in bytes per second
+ *
+ * Retrieves the stream statistics of the fake camera. The values are updated every second during the
+ * acquisition, and the rates are reset to zero when the acquisition stops.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_gv_fake_camera_get_stream_statistics (ArvGvFakeCamera *gv_fake_camera,
+					  guint64 *n_frames, guint64 *n_packets,
+					  double *frame_rate, double *packet_rate, double *data_rate)
+{
+	ArvGvFakeCameraPrivate *priv;
+
+	g_return_if_fail (ARV_IS_GV_FAKE_CAMERA (gv_fake_camera));
+
+	priv = gv_fake_camera->priv;
+
+	g_mutex_lock (&priv->statistics_mutex);
+	if (n_frames != NULL)
+		*n_frames = priv->published_n_frames;
+	if (n_packets != NULL)
+		*n_packets = priv->published_n_packets;
+	if (frame_rate != NULL)
+		*frame_rate = priv->frame_rate;
+	if (packet_rate != NULL)
+		*packet_rate = priv->packet_rate;
+	if (data_rate != NULL)
+		*data_rate = priv->data_rate;
+	g_mutex_unlock (&priv->statistics_mutex);
+}
+
+/**
+ * arv_gv_fake_camera_get_control_statistics:
+ * @gv_fake_camera: a #ArvGvFakeCamera
+ * @n_read_register_commands: (out) (optional): number of handled read register commands
+ * @n_read_registers: (out) (optional): number of registers read by these commands
+ * @n_write_register_commands: (out) (optional): number of handled write register commands
+ * @n_written_registers: (out) (optional): number of registers written by these commands
+ *
+ * Retrieves the register access statistics of the control channel, counted since the creation of the fake camera.
+ * A command may carry several register addresses.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_gv_fake_camera_get_control_statistics (ArvGvFakeCamera *gv_fake_camera,
+					   guint64 *n_read_register_commands, guint64 *n_read_registers,
+					   guint64 *n_write_register_commands, guint64 *n_written_registers)
+{
+	ArvGvFakeCameraPrivate *priv;
+
+	g_return_if_fail (ARV_IS_GV_FAKE_CAMERA (gv_fake_camera));
+
+	priv = gv_fake_camera->priv;
+
+	g_mutex_lock (&priv->statistics_mutex);
+	if (n_read_register_commands != NULL)
+		*n_read_register_commands = priv->n_read_register_commands;
+	if (n_read_registers != NULL)
+		*n_read_registers = priv->n_read_registers;
+	if (n_write_register_commands != NULL)
+		*n_write_register_commands = priv->n_write_register_commands;
+	if (n_written_registers != NULL)
+		*n_written_registers = priv->n_written_registers;
+	g_mutex_unlock (&priv->statistics_mutex);
+}
+
 static void
 arv_gv_fake_camera_init (ArvGvFakeCamera *gv_fake_camera)
 {
 	gv_fake_camera->priv = arv_gv_fake_camera_get_instance_private (gv_fake_camera);
+
+	gv_fake_camera->priv->rand = g_rand_new ();
+	g_mutex_init (&gv_fake_camera->priv->statistics_mutex);
 }
 
 static void
@@ -720,6 +1625,17 @@ _constructed (GObject *gobject)
 	G_OBJECT_CLASS (arv_gv_fake_camera_parent_class)->constructed (gobject);
 
 	gv_fake_camera->priv->camera = arv_fake_camera_new_full (gv_fake_camera->priv->serial_number, gv_fake_camera->priv->genicam_filename);
+
+	/* Packet resend requests are served from the frame history */
+	if (ARV_IS_FAKE_CAMERA (gv_fake_camera->priv->camera)) {
+		guint32 capabilities = 0;
+
+		arv_fake_camera_read_register (gv_fake_camera->priv->camera, ARV_GVBS_GVCP_CAPABILITY_OFFSET,
+					       &capabilities);
+		arv_fake_camera_write_register (gv_fake_camera->priv->camera, ARV_GVBS_GVCP_CAPABILITY_OFFSET,
+						capabilities | ARV_GVBS_GVCP_CAPABILITY_PACKET_RESEND);
+	}
+
 	gv_fake_camera->priv->is_running = arv_gv_fake_camera_start (gv_fake_camera);
 }
 
@@ -737,6 +1653,8 @@ _finalize (GObject *object)
 	g_clear_pointer (&gv_fake_camera->priv->interface_name, g_free);
 	g_clear_pointer (&gv_fake_camera->priv->serial_number, g_free);
 	g_clear_pointer (&gv_fake_camera->priv->genicam_filename, g_free);
+	g_clear_pointer (&gv_fake_camera->priv->rand, g_rand_free);
+	g_mutex_clear (&gv_fake_camera->priv->statistics_mutex);
 
 	G_OBJECT_CLASS (arv_gv_fake_camera_parent_class)->finalize (object);
 }
@@ -786,4 +1704,145 @@ arv_gv_fake_camera_class_init (ArvGvFakeCameraClass *this_class)
 							      G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
 							      G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
 							      G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-burst-length:
+	 *
+	 * Number of consecutive packets dropped by each loss event.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_BURST_LENGTH,
+					 g_param_spec_uint ("gvsp-burst-length",
+							    "GVSP burst length",
+							    "GVSP lost packet burst length",
+							    1, G_MAXUINT, 1,
+							    G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							    G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							    G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-reorder-ratio:
+	 *
+	 * Ratio of the packets sent out of order.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_REORDER_RATIO,
+					 g_param_spec_double ("gvsp-reorder-ratio",
+							      "GVSP reordered packet ratio",
+							      "GVSP reordered packet ratio",
+							      0.0, 1.0, 0.0,
+							      G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							      G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							      G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-reorder-distance:
+	 *
+	 * Number of packets sent before a reordered packet. Reordered packets are
+	 * always sent before the end of their frame.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_REORDER_DISTANCE,
+					 g_param_spec_uint ("gvsp-reorder-distance",
+							    "GVSP reorder distance",
+							    "GVSP reordered packet distance",
+							    1, G_MAXUINT, 4,
+							    G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							    G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							    G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:frame-history:
+	 *
+	 * Number of frames kept for the packet resend requests. A change is
+	 * taken into account at the next acquisition start.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_FRAME_HISTORY,
+					 g_param_spec_uint ("frame-history",
+							    "Frame history",
+							    "Number of frames kept for packet resend",
+							    1, ARV_GV_FAKE_CAMERA_FRAME_HISTORY_MAX,
+							    ARV_GV_FAKE_CAMERA_FRAME_HISTORY_DEFAULT,
+							    G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							    G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							    G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:random-seed:
+	 *
+	 * Seed of the packet loss and reordering generator, applied at each
+	 * acquisition start. 0 means a random seed.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_RANDOM_SEED,
+					 g_param_spec_uint ("random-seed",
+							    "Random seed",
+							    "Packet loss and reordering random seed",
+							    0, G_MAXUINT32, 0,
+							    G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							    G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							    G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-high-rate:
+	 *
+	 * Enable the high rate stream mode, for the use of the fake camera as a load generator. The image data of
+	 * the frame history is generated once per acquisition, and the packets are sent by batches, without copy
+	 * of the payload data, using sendmmsg and UDP segmentation offload when available. A change is taken into
+	 * account at the next acquisition start.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_HIGH_RATE,
+					 g_param_spec_boolean ("gvsp-high-rate",
+							       "GVSP high rate",
+							       "GVSP high rate mode",
+							       FALSE,
+							       G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							       G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							       G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-payload-type:
+	 *
+	 * Payload type of the stream, either %ARV_BUFFER_PAYLOAD_TYPE_IMAGE, %ARV_BUFFER_PAYLOAD_TYPE_H264,
+	 * %ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER or %ARV_BUFFER_PAYLOAD_TYPE_MULTIPART. The H264 data packets transport the image data unchanged, and
+	 * the GenDC container is made of a single image component. %ARV_BUFFER_PAYLOAD_TYPE_MULTIPART is only
+	 * meant for error handling tests: in all-in mode, the image is sent with a leader announcing a multipart
+	 * payload. A change is taken into account at the next acquisition start.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_PAYLOAD_TYPE,
+					 g_param_spec_enum ("gvsp-payload-type",
+							    "GVSP payload type",
+							    "GVSP payload type",
+							    ARV_TYPE_BUFFER_PAYLOAD_TYPE,
+							    ARV_BUFFER_PAYLOAD_TYPE_IMAGE,
+							    G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							    G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							    G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-all-in:
+	 *
+	 * Send the images in a single all-in packet, when they fit in the stream packet size. Only used for the
+	 * image and multipart payload types. A change is taken into account at the next acquisition start.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_ALL_IN,
+					 g_param_spec_boolean ("gvsp-all-in",
+							       "GVSP all-in",
+							       "GVSP all-in transfer mode",
+							       FALSE,
+							       G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							       G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							       G_PARAM_STATIC_BLURB));
 }
@@ -42,6 +42,15 @@ ARV_API ArvGvFakeCamera *		arv_gv_fake_camera_new			(const char *interface_name,
 ARV_API ArvGvFakeCamera *		arv_gv_fake_camera_new_full		(const char *interface_name, const char *serial_number, const char *genicam_filename);
 ARV_API gboolean			arv_gv_fake_camera_is_running		(ArvGvFakeCamera *gv_fake_camera);
 ARV_API ArvFakeCamera *			arv_gv_fake_camera_get_fake_camera	(ArvGvFakeCamera *gv_fake_camera);
+ARV_API void				arv_gv_fake_camera_get_stream_statistics	(ArvGvFakeCamera *gv_fake_camera,
+										 guint64 *n_frames, guint64 *n_packets,
+										 double *frame_rate, double *packet_rate,
+										 double *data_rate);
+ARV_API void				arv_gv_fake_camera_get_control_statistics	(ArvGvFakeCamera *gv_fake_camera,
+										 guint64 *n_read_register_commands,
+										 guint64 *n_read_registers,
+										 guint64 *n_write_register_commands,
+										 guint64 *n_written_registers);
 
 G_END_DECLS
 
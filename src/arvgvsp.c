@@ -68,6 +68,26 @@ arv_gvsp_packet_new (ArvGvspContentType content_type,
 	return packet;
 }
 
+static void
+arv_gvsp_image_leader_fill (ArvGvspImageLeader *leader,
+			    guint64 timestamp, ArvPixelFormat pixel_format,
+			    guint32 width, guint32 height,
+			    guint32 x_offset, guint32 y_offset,
+			    guint32 x_padding, guint32 y_padding)
+{
+	leader->flags = 0;
+	leader->payload_type = g_htons (ARV_BUFFER_PAYLOAD_TYPE_IMAGE);
+	leader->timestamp_high = g_htonl (((guint64) timestamp >> 32));
+	leader->timestamp_low  = g_htonl ((guint64) timestamp & 0xffffffff);
+	leader->infos.pixel_format = g_htonl (pixel_format);
+	leader->infos.width = g_htonl (width);
+	leader->infos.height = g_htonl (height);
+	leader->infos.x_offset = g_htonl (x_offset);
+	leader->infos.y_offset = g_htonl (y_offset);
+	leader->infos.x_padding = g_htonl (x_padding);
+	leader->infos.y_padding = g_htonl (y_padding);
+}
+
 ArvGvspPacket *
 arv_gvsp_packet_new_image_leader (guint16 frame_id, guint32 packet_id,
                                   guint64 timestamp, ArvPixelFormat pixel_format,
@@ -86,21 +106,72 @@ arv_gvsp_packet_new_image_leader (guint16 frame_id, guint32 packet_id,
         if (packet_size != NULL)
                 *packet_size = size;
 
+	if (packet != NULL)
+		arv_gvsp_image_leader_fill (arv_gvsp_packet_get_data (packet, size), timestamp, pixel_format,
+					    width, height, x_offset, y_offset, x_padding, y_padding);
+
+	return packet;
+}
+
+/* Leader without payload specific informations, for the GenDC and H264 payloads */
+
+ArvGvspPacket *
+arv_gvsp_packet_new_generic_leader (guint16 frame_id, guint32 packet_id,
+				    ArvBufferPayloadType payload_type, guint64 timestamp,
+				    void *buffer, size_t buffer_size,
+				    size_t *packet_size)
+{
+        ArvGvspPacket *packet;
+        size_t size;
+
+	packet = arv_gvsp_packet_new (ARV_GVSP_CONTENT_TYPE_LEADER,
+				      frame_id, packet_id, sizeof (ArvGvspLeader), buffer, buffer_size, &size);
+
+        if (packet_size != NULL)
+                *packet_size = size;
+
 	if (packet != NULL) {
-		ArvGvspImageLeader *leader;
+		ArvGvspLeader *leader;
 
 		leader = arv_gvsp_packet_get_data (packet, size);
 		leader->flags = 0;
-		leader->payload_type = g_htons (ARV_BUFFER_PAYLOAD_TYPE_IMAGE);
+		leader->payload_type = g_htons (payload_type);
 		leader->timestamp_high = g_htonl (((guint64) timestamp >> 32));
 		leader->timestamp_low  = g_htonl ((guint64) timestamp & 0xffffffff);
-		leader->infos.pixel_format = g_htonl (pixel_format);
-		leader->infos.width = g_htonl (width);
-		leader->infos.height = g_htonl (height);
-		leader->infos.x_offset = g_htonl (x_offset);
-		leader->infos.y_offset = g_htonl (y_offset);
-		leader->infos.x_padding = g_htonl (x_padding);
-		leader->infos.y_padding = g_htonl (y_padding);
+	}
+
+	return packet;
+}
+
+/* All-in packet, transporting a whole image: the image leader data, directly followed by the image data */
+
+ArvGvspPacket *
+arv_gvsp_packet_new_image_all_in (guint16 frame_id, guint32 packet_id,
+				  guint64 timestamp, ArvPixelFormat pixel_format,
+				  guint32 width, guint32 height,
+				  guint32 x_offset, guint32 y_offset,
+				  guint32 x_padding, guint32 y_padding,
+				  size_t data_size, const void *data,
+				  void *buffer, size_t buffer_size,
+				  size_t *packet_size)
+{
+        ArvGvspPacket *packet;
+        size_t size;
+
+	packet = arv_gvsp_packet_new (ARV_GVSP_CONTENT_TYPE_ALL_IN,
+				      frame_id, packet_id, sizeof (ArvGvspImageLeader) + data_size,
+				      buffer, buffer_size, &size);
+
+        if (packet_size != NULL)
+                *packet_size = size;
+
+	if (packet != NULL) {
+		ArvGvspImageLeader *leader;
+
+		leader = arv_gvsp_packet_get_data (packet, size);
+		arv_gvsp_image_leader_fill (leader, timestamp, pixel_format,
+					    width, height, x_offset, y_offset, x_padding, y_padding);
+		memcpy ((char *) leader + sizeof (ArvGvspImageLeader), data, data_size);
 	}
 
 	return packet;
@@ -152,6 +223,72 @@ arv_gvsp_packet_new_payload (guint16 frame_id, guint32 packet_id,
 	return packet;
 }
 
+/* H264 data packets are sequential blocks of the stream, like the image payload packets */
+
+ArvGvspPacket *
+arv_gvsp_packet_new_h264_payload (guint16 frame_id, guint32 packet_id,
+				  size_t payload_size, const void *data,
+				  void *buffer, size_t buffer_size,
+				  size_t *packet_size)
+{
+        ArvGvspPacket *packet;
+        size_t size;
+
+	packet = arv_gvsp_packet_new (ARV_GVSP_CONTENT_TYPE_H264,
+				      frame_id, packet_id, payload_size, buffer, buffer_size, &size);
+
+        if (packet_size != NULL)
+                *packet_size = size;
+
+	if (packet != NULL)
+		memcpy (arv_gvsp_packet_get_data (packet, size), data, payload_size);
+
+	return packet;
+}
+
+/* GenDC data packet, transporting @data_size bytes located at @offset in the container */
+
+ArvGvspPacket *
+arv_gvsp_packet_new_gendc (guint16 frame_id, guint32 packet_id,
+			   guint64 offset, size_t data_size, const void *data,
+			   void *buffer, size_t buffer_size,
+			   size_t *packet_size)
+{
+        ArvGvspPacket *packet;
+        size_t size;
+
+	packet = arv_gvsp_packet_new (ARV_GVSP_CONTENT_TYPE_GENDC,
+				      frame_id, packet_id, sizeof (ArvGvspGendc) + data_size,
+				      buffer, buffer_size, &size);
+
+        if (packet_size != NULL)
+                *packet_size = size;
+
+	if (packet != NULL) {
+		ArvGvspGendc *gendc;
+
+		gendc = arv_gvsp_packet_get_data (packet, size);
+		gendc->flags = 0;
+		gendc->reserved = 0;
+		gendc->offset_high = g_htons ((offset >> 32) & 0xffff);
+		gendc->offset_low = g_htonl (offset & 0xffffffff);
+		memcpy ((char *) gendc + sizeof (ArvGvspGendc), data, data_size);
+	}
+
+	return packet;
+}
+
+/* Payload packet header only, for senders passing the payload data separately */
+
+ArvGvspPacket *
+arv_gvsp_packet_new_payload_header (guint16 frame_id, guint32 packet_id,
+				    void *buffer, size_t buffer_size,
+				    size_t *packet_size)
+{
+	return arv_gvsp_packet_new (ARV_GVSP_CONTENT_TYPE_PAYLOAD,
+				    frame_id, packet_id, 0, buffer, buffer_size, packet_size);
+}
+
 static const char *
 arv_enum_to_string (GType type,
 		    guint enum_value)
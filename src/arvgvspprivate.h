@@ -227,6 +227,15 @@ typedef struct {
         guint32 offset_low;
 } ArvGvspMultipart;
 
+/* GenDC data packet header, followed by the container bytes located at the given offset */
+
+typedef struct {
+        guint8 flags;
+        guint8 reserved;
+        guint16 offset_high;
+        guint32 offset_low;
+} ArvGvspGendc;
+
 /**
  * ArvGvspTrailer:
  * @payload_type: ID of the payload type
@@ -278,6 +287,8 @@ typedef struct {
                                                                  sizeof (ArvGvspPacket) + \
                                                                  sizeof (ArvGvspHeader) + \
                                                                  sizeof (ArvGvspMultipart))
+#define ARV_GVSP_GENDC_PACKET_PROTOCOL_OVERHEAD(ext_ids)	(ARV_GVSP_PACKET_PROTOCOL_OVERHEAD(ext_ids) + \
+                                                                 sizeof (ArvGvspGendc))
 
 #pragma pack(pop)
 
@@ -288,6 +299,18 @@ ArvGvspPacket *		arv_gvsp_packet_new_image_leader	(guint16 frame_id, guint32 pac
 								 guint32 x_padding, guint32 y_padding,
 								 void *buffer, size_t buffer_size,
                                                                  size_t *packet_size);
+ArvGvspPacket *		arv_gvsp_packet_new_generic_leader	(guint16 frame_id, guint32 packet_id,
+								 ArvBufferPayloadType payload_type, guint64 timestamp,
+								 void *buffer, size_t buffer_size,
+								 size_t *packet_size);
+ArvGvspPacket *		arv_gvsp_packet_new_image_all_in	(guint16 frame_id, guint32 packet_id,
+								 guint64 timestamp, ArvPixelFormat pixel_format,
+								 guint32 width, guint32 height,
+								 guint32 x_offset, guint32 y_offset,
+								 guint32 x_padding, guint32 y_padding,
+								 size_t data_size, const void *data,
+								 void *buffer, size_t buffer_size,
+								 size_t *packet_size);
 ArvGvspPacket *		arv_gvsp_packet_new_data_trailer	(guint16 frame_id, guint32 packet_id, guint32 height,
 								 void *buffer, size_t buffer_size,
                                                                  size_t *packet_size);
@@ -295,6 +318,17 @@ ArvGvspPacket *		arv_gvsp_packet_new_payload		(guint16 frame_id, guint32 packet_
 								 size_t payload_size, void *data,
 								 void *buffer, size_t buffer_size,
                                                                  size_t *packet_size);
+ArvGvspPacket *		arv_gvsp_packet_new_h264_payload	(guint16 frame_id, guint32 packet_id,
+								 size_t payload_size, const void *data,
+								 void *buffer, size_t buffer_size,
+								 size_t *packet_size);
+ArvGvspPacket *		arv_gvsp_packet_new_gendc		(guint16 frame_id, guint32 packet_id,
+								 guint64 offset, size_t data_size, const void *data,
+								 void *buffer, size_t buffer_size,
+								 size_t *packet_size);
+ArvGvspPacket *		arv_gvsp_packet_new_payload_header	(guint16 frame_id, guint32 packet_id,
+								 void *buffer, size_t buffer_size,
+                                                                 size_t *packet_size);
 char * 			arv_gvsp_packet_to_string 		(const ArvGvspPacket *packet, size_t packet_size);
 void 			arv_gvsp_packet_debug 			(const ArvGvspPacket *packet, size_t packet_size,
 								 ArvDebugLevel level);
@@ -424,10 +458,20 @@ arv_gvsp_packet_get_data_size (const ArvGvspPacket *packet, size_t packet_size)
         return 0;
 }
 
+/* All-in packets start with the leader data */
+
+static inline gboolean
+arv_gvsp_packet_has_leader_data (const ArvGvspPacket *packet, size_t packet_size)
+{
+        ArvGvspContentType content_type = arv_gvsp_packet_get_content_type (packet, packet_size);
+
+        return content_type == ARV_GVSP_CONTENT_TYPE_LEADER || content_type == ARV_GVSP_CONTENT_TYPE_ALL_IN;
+}
+
 static inline ArvBufferPayloadType
 arv_gvsp_leader_packet_get_buffer_payload_type (const ArvGvspPacket *packet, size_t packet_size, gboolean *has_chunks)
 {
-        if (G_LIKELY (arv_gvsp_packet_get_content_type (packet, packet_size) == ARV_GVSP_CONTENT_TYPE_LEADER)) {
+        if (G_LIKELY (arv_gvsp_packet_has_leader_data (packet, packet_size))) {
                 ArvGvspLeader *leader;
                 guint16 payload_type;
 
@@ -451,7 +495,7 @@ arv_gvsp_leader_packet_get_buffer_payload_type (const ArvGvspPacket *packet, siz
 static inline guint64
 arv_gvsp_leader_packet_get_timestamp (const ArvGvspPacket *packet, size_t packet_size)
 {
-        if (G_LIKELY (arv_gvsp_packet_get_content_type (packet, packet_size) == ARV_GVSP_CONTENT_TYPE_LEADER)) {
+        if (G_LIKELY (arv_gvsp_packet_has_leader_data (packet, packet_size))) {
                 ArvGvspLeader *leader;
 
                 leader = (ArvGvspLeader *) arv_gvsp_packet_get_data (packet, packet_size);
@@ -635,7 +679,11 @@ arv_gvsp_leader_packet_get_image_infos (const ArvGvspPacket *packet,
 static inline size_t
 arv_gvsp_payload_packet_get_data_size (const ArvGvspPacket *packet, size_t packet_size)
 {
-        if (G_LIKELY(arv_gvsp_packet_get_content_type (packet, packet_size) == ARV_GVSP_CONTENT_TYPE_PAYLOAD)) {
+        ArvGvspContentType content_type = arv_gvsp_packet_get_content_type (packet, packet_size);
+
+        /* H264 data packets are sequential payload blocks */
+        if (G_LIKELY(content_type == ARV_GVSP_CONTENT_TYPE_PAYLOAD ||
+                     content_type == ARV_GVSP_CONTENT_TYPE_H264)) {
                 if (arv_gvsp_packet_has_extended_ids (packet, packet_size)) {
                         if (G_LIKELY(packet_size >= sizeof (ArvGvspPacket) + sizeof (ArvGvspExtendedHeader)))
                                 return packet_size - sizeof (ArvGvspPacket) - sizeof (ArvGvspExtendedHeader);
@@ -725,6 +773,50 @@ arv_gvsp_multipart_packet_get_data (const ArvGvspPacket *packet, size_t packet_s
         return NULL;
 }
 
+static inline gboolean
+arv_gvsp_gendc_packet_get_offset (const ArvGvspPacket *packet, size_t packet_size, ptrdiff_t *offset)
+{
+        ArvGvspGendc *gendc;
+
+        g_return_val_if_fail (offset != NULL, FALSE);
+
+        if (G_LIKELY (arv_gvsp_packet_get_content_type (packet, packet_size) == ARV_GVSP_CONTENT_TYPE_GENDC)) {
+                gendc = (ArvGvspGendc *) arv_gvsp_packet_get_data (packet, packet_size);
+
+                if (G_LIKELY (gendc != NULL) &&
+                    arv_gvsp_packet_get_data_size (packet, packet_size) >= sizeof (ArvGvspGendc)) {
+                        *offset = ((guint64) g_ntohs (gendc->offset_high) << 32) + g_ntohl (gendc->offset_low);
+                        return TRUE;
+                }
+        }
+
+        *offset = 0;
+        return FALSE;
+}
+
+static inline size_t
+arv_gvsp_gendc_packet_get_data_size (const ArvGvspPacket *packet, size_t packet_size)
+{
+        if (G_LIKELY (arv_gvsp_packet_get_content_type (packet, packet_size) == ARV_GVSP_CONTENT_TYPE_GENDC)) {
+                size_t data_size = arv_gvsp_packet_get_data_size (packet, packet_size);
+
+                if (G_LIKELY (data_size >= sizeof (ArvGvspGendc)))
+                        return data_size - sizeof (ArvGvspGendc);
+        }
+
+        return 0;
+}
+
+static inline void *
+arv_gvsp_gendc_packet_get_data (const ArvGvspPacket *packet, size_t packet_size)
+{
+        if (G_LIKELY (arv_gvsp_packet_get_content_type (packet, packet_size) == ARV_GVSP_CONTENT_TYPE_GENDC &&
+                      arv_gvsp_packet_get_data_size (packet, packet_size) >= sizeof (ArvGvspGendc)))
+                return (char *) arv_gvsp_packet_get_data (packet, packet_size) + sizeof (ArvGvspGendc);
+
+        return NULL;
+}
+
 static inline guint64
 arv_gvsp_timestamp_to_ns (guint64 timestamp, guint64 timestamp_tick_frequency)
 {
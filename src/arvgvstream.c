@@ -56,11 +56,51 @@
 #include <linux/filter.h>
 #include <sys/types.h>
 #include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if ARAVIS_HAS_XDP
+#include <linux/if_xdp.h>
+#include <linux/if_link.h>
+#include <linux/bpf.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#ifndef AF_XDP
+#define AF_XDP			44
+#endif
+#ifndef SOL_XDP
+#define SOL_XDP			283
+#endif
+#ifndef BPF_JMP32
+#define BPF_JMP32		0x06
+#endif
+#endif
+
+#if ARAVIS_HAS_PACKET_SOCKET && defined (SO_ATTACH_REUSEPORT_CBPF) && defined (PACKET_FANOUT_CBPF)
+#define ARV_GV_STREAM_HAS_RECEIVE_WORKERS	1
+#else
+#define ARV_GV_STREAM_HAS_RECEIVE_WORKERS	0
 #endif
 
 #define ARV_GV_STREAM_DISCARD_LATE_FRAME_THRESHOLD	100
 #define ARV_GV_STREAM_BUFFER_SIZE_PROTOCOL_OVERHEAD     1024 /* Some room for protocol overhead (IP + UDP + GV) */
 #define ARV_GV_STREAM_MIN_BUFFER_SIZE                   20 * 1024
+#define ARV_GV_STREAM_PACKET_RATE_PERIOD_US		1000000
+#define ARV_GV_STREAM_XDP_N_FRAMES			4096
+#define ARV_GV_STREAM_XDP_FRAME_SIZE			4096
+#define ARV_GV_STREAM_XDP_N_QUEUES_MAX			64
+#define ARV_GV_STREAM_RING_BLOCK_SIZE_MAX		(4 << 20)
+#define ARV_GV_STREAM_RING_SIZE_MAX			(256 << 20)
+#define ARV_GV_STREAM_RING_N_BLOCKS_MIN			8
+#define ARV_GV_STREAM_RING_BLOCK_DURATION_US		1000
+#define ARV_GV_STREAM_RING_DURATION_US			100000
+#define ARV_GV_STREAM_RING_BLOCK_TIMEOUT_MS_MAX		8
+#define ARV_GV_STREAM_RING_AUTO_FRAME_SIZE		2048
+#define ARV_GV_STREAM_FRAME_RING_SIZE			64
+#define ARV_GV_STREAM_TIMER_WHEEL_N_SLOTS		256
+#define ARV_GV_STREAM_TIMER_WHEEL_TICK_US		250
+#define ARV_GV_STREAM_TIMER_NONE			G_MAXUINT32
 
 enum {
 	ARV_GV_STREAM_PROPERTY_0,
@@ -70,7 +110,15 @@ enum {
 	ARV_GV_STREAM_PROPERTY_PACKET_REQUEST_RATIO,
 	ARV_GV_STREAM_PROPERTY_INITIAL_PACKET_TIMEOUT,
 	ARV_GV_STREAM_PROPERTY_PACKET_TIMEOUT,
-	ARV_GV_STREAM_PROPERTY_FRAME_RETENTION
+	ARV_GV_STREAM_PROPERTY_FRAME_RETENTION,
+	ARV_GV_STREAM_PROPERTY_RECEIVE_THREADS,
+	ARV_GV_STREAM_PROPERTY_ZERO_COPY,
+	ARV_GV_STREAM_PROPERTY_XDP_QUEUE,
+	ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_RING,
+	ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_SIZE,
+	ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_COUNT,
+	ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_FRAME_SIZE,
+	ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_TIMEOUT
 } ArvGvStreamProperties;
 
 typedef struct _ArvGvStreamThreadData ArvGvStreamThreadData;
@@ -80,7 +128,6 @@ typedef struct {
 
         guint stream_channel;
 
-	GThread *thread;
 	ArvGvStreamThreadData *thread_data;
 } ArvGvStreamPrivate;
 
@@ -96,16 +143,15 @@ G_DEFINE_TYPE_WITH_CODE (ArvGvStream, arv_gv_stream, ARV_TYPE_STREAM, G_ADD_PRIV
 
 /* Acquisition thread */
 
-typedef struct {
-	gboolean received;
-        gboolean resend_requested;
-	guint64 abs_timeout_us;
-} ArvGvStreamPacketData;
+typedef struct _ArvGvStreamFrameData ArvGvStreamFrameData;
 
-typedef struct {
+struct _ArvGvStreamFrameData {
 	ArvBuffer *buffer;
 	guint64 frame_id;
 
+	/* Incremented each time the frame ring slot is reused */
+	guint32 generation;
+
         gboolean leader_received;
 
         gsize received_size;
@@ -117,20 +163,136 @@ typedef struct {
 	gboolean disable_resend_request;
 
 	guint n_packets;
-	ArvGvStreamPacketData *packet_data;
+	guint32 next_packet_id;
+	guint32 n_scheduled_packets;
+
+	/* Packet state bitmaps, kept allocated across the successive frames of a ring slot */
+	guint64 *received_packets;
+	guint64 *resend_requested_packets;
+	guint n_bitmap_words;
 
 	guint n_packet_resend_requests;
 	gboolean resend_ratio_reached;
 
 	gboolean extended_ids;
-} ArvGvStreamFrameData;
+
+	/* In flight frames, in reception order */
+	ArvGvStreamFrameData *previous;
+	ArvGvStreamFrameData *next;
+};
+
+/* Resend deadline of a range of missing packets. Timers are stored in a hashed timer wheel, and refer to their frame
+ * using its ring index and generation, which allows to leave them in place when the frame is closed. */
+
+typedef struct {
+	guint32 next;
+	guint32 frame_index;
+	guint32 generation;
+	guint32 first_packet;
+	guint32 last_packet;
+	guint64 deadline_us;
+} ArvGvStreamResendTimer;
+
+typedef enum {
+	ARV_GV_STREAM_BACKEND_SOCKET,
+	ARV_GV_STREAM_BACKEND_PACKET_SOCKET,
+	ARV_GV_STREAM_BACKEND_XDP,
+	ARV_GV_STREAM_N_BACKENDS
+} ArvGvStreamBackend;
+
+static const struct {
+	const char *n_packets;
+	const char *packet_rate;
+} arv_gv_stream_backend_infos[ARV_GV_STREAM_N_BACKENDS] = {
+	{"n_socket_packets",		"socket_packet_rate"},
+	{"n_packet_socket_packets",	"packet_socket_packet_rate"},
+	{"n_xdp_packets",		"xdp_packet_rate"}
+};
+
+typedef struct {
+	guint64 n_completed_buffers;
+	guint64 n_failures;
+	guint64 n_underruns;
+	guint64 n_timeouts;
+	guint64 n_aborted;
+	guint64 n_missing_frames;
+
+	guint64 n_size_mismatch_errors;
+
+	guint64 n_received_packets;
+	guint64 n_missing_packets;
+	guint64 n_error_packets;
+	guint64 n_ignored_packets;
+	guint64 n_resend_requests;
+	guint64 n_resent_packets;
+	guint64 n_resend_ratio_reached;
+        guint64 n_resend_disabled;
+	guint64 n_duplicated_packets;
+
+        guint64 n_transferred_bytes;
+        guint64 n_ignored_bytes;
+
+	guint64 n_backend_packets[ARV_GV_STREAM_N_BACKENDS];
+
+	/* Packet socket ring statistics */
+	guint64 n_kernel_drops;
+	guint64 n_kernel_queue_freezes;
+	guint64 n_ring_blocks;
+	guint64 n_ring_block_timeouts;
+	guint64 ring_block_latency_us;
+} ArvGvStreamStatistics;
+
+/* A receive worker owns a subset of the stream frames. When several workers are used, the frames are dispatched by
+ * the kernel using their frame id, either through a SO_REUSEPORT socket group or a PACKET_FANOUT group, which means
+ * all the packets of a given frame are always handled by the same worker, without any locking. */
+
+typedef struct {
+	ArvGvStreamThreadData *thread_data;
+
+	guint index;
+	GThread *thread;
+
+	GSocket *socket;
+	int current_socket_buffer_size;
+
+	guint16 packet_id;
+
+	/* In flight frames, preallocated and indexed by frame id */
+	ArvGvStreamFrameData *frame_ring;
+	ArvGvStreamFrameData *first_frame;
+	ArvGvStreamFrameData *last_frame;
+
+	ArvGvStreamResendTimer *timers;
+	guint n_allocated_timers;
+	guint32 free_timer;
+	guint32 timer_wheel[ARV_GV_STREAM_TIMER_WHEEL_N_SLOTS];
+	guint64 timer_wheel_tick;
+
+	gboolean first_packet;
+	guint64 last_frame_id;
+
+	/* Frame the payload of the pending received packets is directly written into, if any */
+	ArvGvStreamFrameData *zero_copy_frame;
+
+	/* Only the first worker feeds the histogram, which is not thread safe */
+	ArvHistogram *histogram;
+
+	/* Packet socket ring peak values, since the last statistics flush */
+	double ring_fill_level;
+	guint64 ring_block_latency_max_us;
+
+	/* Points either to the stream statistics, or to local_statistics if several workers are running */
+	ArvGvStreamStatistics *statistics;
+	ArvGvStreamStatistics local_statistics;
+} ArvGvStreamWorker;
 
 struct _ArvGvStreamThreadData {
 	GCancellable *cancellable;
 
 	ArvStream *stream;
 
-        gboolean thread_started;
+        guint n_started_workers;
+        guint n_failed_workers;
         GMutex thread_started_mutex;
         GCond thread_started_cond;
 
@@ -138,6 +300,7 @@ struct _ArvGvStreamThreadData {
 	void *callback_data;
 
 	GSocket *socket;
+	gboolean socket_reuse_port;
 	GInetAddress *interface_address;
 	GSocketAddress *interface_socket_address;
 	GInetAddress *device_address;
@@ -154,60 +317,132 @@ struct _ArvGvStreamThreadData {
 	guint64 timestamp_tick_frequency;
 	guint scps_packet_size;
 
-	guint16 packet_id;
+	gboolean use_packet_socket;
+	gboolean packet_socket_in_use;
 
-	GSList *frames;
-	gboolean first_packet;
-	guint64 last_frame_id;
+	ArvGvStreamPacketSocketRing packet_socket_ring;
+	guint packet_socket_block_size;
+	guint packet_socket_block_count;
+	guint packet_socket_frame_size;
+	guint packet_socket_block_timeout_ms;
 
-	gboolean use_packet_socket;
+	/* Packet socket ring geometry of the current acquisition */
+	guint ring_block_size;
+	guint ring_block_count;
+	guint ring_frame_size;
+	guint ring_block_timeout_ms;
 
-	/* Statistics */
+	gboolean use_xdp;
+	guint xdp_queue;
 
-	guint64 n_completed_buffers;
-	guint64 n_failures;
-	guint64 n_underruns;
-	guint64 n_timeouts;
-	guint64 n_aborted;
-	guint64 n_missing_frames;
+	gboolean zero_copy;
 
-	guint64 n_size_mismatch_errors;
+	guint n_receive_threads;
+	guint n_workers;
+	ArvGvStreamWorker *workers;
 
-	guint64 n_received_packets;
-	guint64 n_missing_packets;
-	guint64 n_error_packets;
-	guint64 n_ignored_packets;
-	guint64 n_resend_requests;
-	guint64 n_resent_packets;
-	guint64 n_resend_ratio_reached;
-        guint64 n_resend_disabled;
-	guint64 n_duplicated_packets;
+	/* Statistics */
 
-        guint64 n_transferred_bytes;
-        guint64 n_ignored_bytes;
+	ArvGvStreamStatistics statistics;
+	GMutex statistics_mutex;
+
+	guint64 rate_time_us;
+	guint64 rate_n_packets[ARV_GV_STREAM_N_BACKENDS];
+	double packet_rates[ARV_GV_STREAM_N_BACKENDS];
+
+	guint64 rate_n_ring_blocks;
+	guint64 rate_ring_block_latency_us;
+	double ring_fill_level_peak;
+	guint64 ring_block_latency_max_peak_us;
+	double ring_fill_level;
+	double ring_block_latency_mean;
+	double ring_block_latency_max;
 
 	ArvHistogram *histogram;
 	guint32 statistic_count;
 
 	ArvGvStreamSocketBuffer socket_buffer_option;
 	int socket_buffer_size;
-	int current_socket_buffer_size;
 };
 
+/* Must be called with the statistics mutex locked */
+
+static void
+_update_periodic_statistics (ArvGvStreamThreadData *thread_data, guint64 time_us)
+{
+	guint64 elapsed_time_us;
+	guint64 n_ring_blocks;
+	unsigned int i;
+
+	elapsed_time_us = time_us - thread_data->rate_time_us;
+	if (elapsed_time_us < ARV_GV_STREAM_PACKET_RATE_PERIOD_US)
+		return;
+
+	for (i = 0; i < ARV_GV_STREAM_N_BACKENDS; i++) {
+		guint64 n_packets = thread_data->statistics.n_backend_packets[i];
+
+		thread_data->packet_rates[i] = thread_data->rate_time_us == 0 ? 0.0 :
+			(double) (n_packets - thread_data->rate_n_packets[i]) * 1e6 / (double) elapsed_time_us;
+		thread_data->rate_n_packets[i] = n_packets;
+	}
+
+	n_ring_blocks = thread_data->statistics.n_ring_blocks - thread_data->rate_n_ring_blocks;
+	thread_data->ring_block_latency_mean = n_ring_blocks == 0 ? 0.0 :
+		(double) (thread_data->statistics.ring_block_latency_us - thread_data->rate_ring_block_latency_us) /
+		(double) n_ring_blocks;
+	thread_data->rate_n_ring_blocks = thread_data->statistics.n_ring_blocks;
+	thread_data->rate_ring_block_latency_us = thread_data->statistics.ring_block_latency_us;
+
+	thread_data->ring_fill_level = thread_data->ring_fill_level_peak;
+	thread_data->ring_block_latency_max = thread_data->ring_block_latency_max_peak_us;
+	thread_data->ring_fill_level_peak = 0.0;
+	thread_data->ring_block_latency_max_peak_us = 0;
+
+	thread_data->rate_time_us = time_us;
+}
+
+static void
+_flush_statistics (ArvGvStreamWorker *worker)
+{
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+	guint64 *local = (guint64 *) &worker->local_statistics;
+	guint64 *total = (guint64 *) &thread_data->statistics;
+	unsigned int i;
+
+	g_mutex_lock (&thread_data->statistics_mutex);
+
+	if (worker->statistics == &worker->local_statistics) {
+		for (i = 0; i < sizeof (ArvGvStreamStatistics) / sizeof (guint64); i++)
+			total[i] += local[i];
+		memset (&worker->local_statistics, 0, sizeof (ArvGvStreamStatistics));
+	}
+
+	thread_data->ring_fill_level_peak = MAX (thread_data->ring_fill_level_peak, worker->ring_fill_level);
+	thread_data->ring_block_latency_max_peak_us = MAX (thread_data->ring_block_latency_max_peak_us,
+							   worker->ring_block_latency_max_us);
+	worker->ring_fill_level = 0.0;
+	worker->ring_block_latency_max_us = 0;
+
+	_update_periodic_statistics (thread_data, g_get_monotonic_time ());
+
+	g_mutex_unlock (&thread_data->statistics_mutex);
+}
+
 static void
-_send_packet_request (ArvGvStreamThreadData *thread_data,
+_send_packet_request (ArvGvStreamWorker *worker,
 		      guint64 frame_id,
 		      guint32 first_block,
 		      guint32 last_block,
 		      gboolean extended_ids)
 {
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
 	ArvGvcpPacket *packet;
 	size_t packet_size;
 
-	thread_data->packet_id = arv_gvcp_next_packet_id (thread_data->packet_id);
+	worker->packet_id = arv_gvcp_next_packet_id (worker->packet_id);
 
 	packet = arv_gvcp_packet_new_packet_resend_cmd (frame_id, first_block, last_block, extended_ids,
-							thread_data->packet_id, &packet_size);
+							worker->packet_id, &packet_size);
 
 	arv_debug_stream_thread ("[GvStream::send_packet_request] frame_id = %" G_GUINT64_FORMAT
 			       " (from packet %" G_GUINT32_FORMAT " to %" G_GUINT32_FORMAT ")",
@@ -215,23 +450,24 @@ _send_packet_request (ArvGvStreamThreadData *thread_data,
 
 	arv_gvcp_packet_debug (packet, ARV_DEBUG_LEVEL_DEBUG);
 
-	g_socket_send_to (thread_data->socket, thread_data->device_socket_address, (const char *) packet, packet_size,
+	g_socket_send_to (worker->socket, thread_data->device_socket_address, (const char *) packet, packet_size,
 			  NULL, NULL);
 
 	arv_gvcp_packet_free (packet);
 }
 
 static void
-_update_socket (ArvGvStreamThreadData *thread_data, ArvBuffer *buffer)
+_update_socket (ArvGvStreamWorker *worker, ArvBuffer *buffer)
 {
-	int buffer_size = thread_data->current_socket_buffer_size;
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+	int buffer_size = worker->current_socket_buffer_size;
 	int fd;
 
 	if (thread_data->socket_buffer_option == ARV_GV_STREAM_SOCKET_BUFFER_FIXED &&
 	    thread_data->socket_buffer_size <= 0)
 		return;
 
-	fd = g_socket_get_fd (thread_data->socket);
+	fd = g_socket_get_fd (worker->socket);
 
 	switch (thread_data->socket_buffer_option) {
 		case ARV_GV_STREAM_SOCKET_BUFFER_FIXED:
@@ -249,12 +485,12 @@ _update_socket (ArvGvStreamThreadData *thread_data, ArvBuffer *buffer)
 
         buffer_size = MAX (buffer_size, ARV_GV_STREAM_MIN_BUFFER_SIZE);
 
-	if (buffer_size != thread_data->current_socket_buffer_size) {
+	if (buffer_size != worker->current_socket_buffer_size) {
 		gboolean result;
 
 		result = arv_socket_set_recv_buffer_size (fd, buffer_size);
 		if (result) {
-			thread_data->current_socket_buffer_size = buffer_size;
+			worker->current_socket_buffer_size = buffer_size;
 			arv_info_stream_thread ("[GvStream::update_socket] Socket buffer size set to %d", buffer_size);
 		} else {
 			arv_warning_stream_thread ("[GvStream::update_socket] Failed to set socket buffer size to %d (%d)",
@@ -279,9 +515,13 @@ _compute_n_expected_packets (const ArvGvspPacket *packet, size_t allocated_size,
                         payload_type = arv_gvsp_leader_packet_get_buffer_payload_type(packet, packet_size, NULL);
                         if (payload_type == ARV_BUFFER_PAYLOAD_TYPE_IMAGE ||
                             payload_type == ARV_BUFFER_PAYLOAD_TYPE_EXTENDED_CHUNK_DATA ||
-                            payload_type == ARV_BUFFER_PAYLOAD_TYPE_CHUNK_DATA) {
+                            payload_type == ARV_BUFFER_PAYLOAD_TYPE_CHUNK_DATA ||
+                            payload_type == ARV_BUFFER_PAYLOAD_TYPE_H264) {
                                 block_size = packet_size - ARV_GVSP_PAYLOAD_PACKET_PROTOCOL_OVERHEAD (extended_ids);
                                 return (allocated_size + block_size - 1) / block_size + (2 /* leader + trailer */);
+                        } else if (payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER) {
+                                block_size = packet_size - ARV_GVSP_GENDC_PACKET_PROTOCOL_OVERHEAD (extended_ids);
+                                return (allocated_size + block_size - 1) / block_size + (2 /* leader + trailer */);
                         } else if (payload_type == ARV_BUFFER_PAYLOAD_TYPE_MULTIPART) {
                                 unsigned int n_parts;
                                 unsigned int n_packets = 0;
@@ -301,8 +541,12 @@ _compute_n_expected_packets (const ArvGvspPacket *packet, size_t allocated_size,
                         }
                         break;
                 case ARV_GVSP_CONTENT_TYPE_PAYLOAD:
+                case ARV_GVSP_CONTENT_TYPE_H264:
                         block_size = packet_size - ARV_GVSP_PAYLOAD_PACKET_PROTOCOL_OVERHEAD (extended_ids);
                         return (allocated_size + block_size - 1) / block_size + (2 /* leader + trailer */);
+                case ARV_GVSP_CONTENT_TYPE_GENDC:
+                        block_size = packet_size - ARV_GVSP_GENDC_PACKET_PROTOCOL_OVERHEAD (extended_ids);
+                        return (allocated_size + block_size - 1) / block_size + (2 /* leader + trailer */);
                 case ARV_GVSP_CONTENT_TYPE_MULTIPART:
                         block_size = packet_size - ARV_GVSP_MULTIPART_PACKET_PROTOCOL_OVERHEAD (extended_ids);
                         return (allocated_size + block_size - 1) / block_size +
@@ -313,8 +557,6 @@ _compute_n_expected_packets (const ArvGvspPacket *packet, size_t allocated_size,
                         break;
                 case ARV_GVSP_CONTENT_TYPE_ALL_IN:
                         return 1;
-                case ARV_GVSP_CONTENT_TYPE_H264:
-                case ARV_GVSP_CONTENT_TYPE_GENDC:
                 case ARV_GVSP_CONTENT_TYPE_MULTIZONE:
                 case ARV_GVSP_CONTENT_TYPE_UNKNOWN:
                         break;
@@ -323,8 +565,291 @@ _compute_n_expected_packets (const ArvGvspPacket *packet, size_t allocated_size,
         return 0;
 }
 
+static inline guint
+_count_trailing_zeros (guint64 value)
+{
+#if defined (__GNUC__) || defined (__clang__)
+	return __builtin_ctzll (value);
+#else
+	guint n = 0;
+
+	while ((value & 1) == 0) {
+		value >>= 1;
+		n++;
+	}
+
+	return n;
+#endif
+}
+
+static inline guint
+_count_ones (guint64 value)
+{
+#if defined (__GNUC__) || defined (__clang__)
+	return __builtin_popcountll (value);
+#else
+	value = value - ((value >> 1) & G_GUINT64_CONSTANT (0x5555555555555555));
+	value = (value & G_GUINT64_CONSTANT (0x3333333333333333)) +
+		((value >> 2) & G_GUINT64_CONSTANT (0x3333333333333333));
+	value = (value + (value >> 4)) & G_GUINT64_CONSTANT (0x0f0f0f0f0f0f0f0f);
+
+	return (value * G_GUINT64_CONSTANT (0x0101010101010101)) >> 56;
+#endif
+}
+
+static inline gboolean
+_bitmap_get (const guint64 *bitmap, guint32 bit)
+{
+	return (bitmap[bit >> 6] >> (bit & 63)) & 1;
+}
+
+static inline void
+_bitmap_set (guint64 *bitmap, guint32 bit)
+{
+	bitmap[bit >> 6] |= G_GUINT64_CONSTANT (1) << (bit & 63);
+}
+
+/* Returns the index of the first bit equal to @value in the [@start, @end[ range, or @end if there is none */
+
+static guint32
+_bitmap_find (const guint64 *bitmap, guint32 start, guint32 end, gboolean value)
+{
+	guint64 invert = value ? 0 : G_MAXUINT64;
+	guint32 word_index;
+	guint64 word;
+	guint32 bit;
+
+	if (start >= end)
+		return end;
+
+	word_index = start >> 6;
+	word = (bitmap[word_index] ^ invert) & (G_MAXUINT64 << (start & 63));
+
+	while (word == 0) {
+		word_index++;
+		if (word_index << 6 >= end)
+			return end;
+		word = bitmap[word_index] ^ invert;
+	}
+
+	bit = (word_index << 6) + _count_trailing_zeros (word);
+
+	return MIN (bit, end);
+}
+
+/* Returns the number of set bits in the [0, @end[ range */
+
+static guint32
+_bitmap_count (const guint64 *bitmap, guint32 end)
+{
+	guint32 count = 0;
+	guint32 i;
+
+	for (i = 0; i < end >> 6; i++)
+		count += _count_ones (bitmap[i]);
+
+	if ((end & 63) != 0)
+		count += _count_ones (bitmap[i] & ((G_GUINT64_CONSTANT (1) << (end & 63)) - 1));
+
+	return count;
+}
+
+static void _close_frame (ArvGvStreamWorker *worker, guint64 time_us, ArvGvStreamFrameData *frame);
+
+/* With several workers, each one only sees every n_workers frame */
+
+static inline ArvGvStreamFrameData *
+_get_frame_slot (ArvGvStreamWorker *worker, guint64 frame_id)
+{
+	return &worker->frame_ring[(frame_id / worker->thread_data->n_workers) & (ARV_GV_STREAM_FRAME_RING_SIZE - 1)];
+}
+
+/* Signed distance between two frame ids, taking into account the counter wrap and the fact 0 is not a valid
+ * frame id. */
+
+static gint64
+_frame_id_distance (guint64 from, guint64 to, gboolean extended_ids)
+{
+	gint64 distance;
+
+	if (extended_ids) {
+		distance = (gint64) (to - from);
+		if ((gint64) to > 0 && (gint64) from < 0)
+			distance--;
+	} else {
+		distance = (gint16) (guint16) (to - from);
+		if (from > to && distance > 0)
+			distance--;
+		else if (from < to && distance < 0)
+			distance++;
+	}
+
+	return distance;
+}
+
+/* Next frame id dispatched to the same worker. Workers are selected on the raw frame id value, so after the 16 bit
+ * counter wrap, the next frame of a worker is the first valid id with the same remainder. */
+
+static guint64
+_next_worker_frame_id (guint64 frame_id, guint n_workers, gboolean extended_ids)
+{
+	guint64 next = frame_id + n_workers;
+
+	if (!extended_ids && next > G_MAXUINT16)
+		next = (frame_id % n_workers) == 0 ? n_workers : frame_id % n_workers;
+
+	return next;
+}
+
+/* Frame id preceding the given one in the worker sequence, used for the initialization of the worker state on the
+ * first received packet. */
+
+static guint64
+_previous_worker_frame_id (guint64 frame_id, guint n_workers, gboolean extended_ids)
+{
+	if (!extended_ids && frame_id <= n_workers)
+		return frame_id + G_MAXUINT16 - n_workers;
+
+	return frame_id - n_workers;
+}
+
+static void
+_init_frame_slot (ArvGvStreamFrameData *frame, guint n_packets)
+{
+	guint64 *received_packets = frame->received_packets;
+	guint64 *resend_requested_packets = frame->resend_requested_packets;
+	guint n_bitmap_words = frame->n_bitmap_words;
+	guint32 generation = frame->generation;
+	guint n_words;
+
+	n_words = (n_packets + 63) / 64;
+	if (n_words > n_bitmap_words) {
+		g_free (received_packets);
+		g_free (resend_requested_packets);
+		received_packets = g_new (guint64, n_words);
+		resend_requested_packets = g_new (guint64, n_words);
+		n_bitmap_words = n_words;
+	}
+
+	memset (received_packets, 0, n_words * sizeof (guint64));
+	memset (resend_requested_packets, 0, n_words * sizeof (guint64));
+
+	memset (frame, 0, sizeof (ArvGvStreamFrameData));
+
+	frame->received_packets = received_packets;
+	frame->resend_requested_packets = resend_requested_packets;
+	frame->n_bitmap_words = n_bitmap_words;
+	frame->generation = generation + 1;
+	frame->n_packets = n_packets;
+	frame->last_valid_packet = -1;
+}
+
+static void
+_init_frame_tracking (ArvGvStreamWorker *worker)
+{
+	guint i;
+
+	worker->frame_ring = g_new0 (ArvGvStreamFrameData, ARV_GV_STREAM_FRAME_RING_SIZE);
+	worker->first_frame = NULL;
+	worker->last_frame = NULL;
+
+	worker->timers = NULL;
+	worker->n_allocated_timers = 0;
+	worker->free_timer = ARV_GV_STREAM_TIMER_NONE;
+	for (i = 0; i < ARV_GV_STREAM_TIMER_WHEEL_N_SLOTS; i++)
+		worker->timer_wheel[i] = ARV_GV_STREAM_TIMER_NONE;
+	worker->timer_wheel_tick = g_get_monotonic_time () / ARV_GV_STREAM_TIMER_WHEEL_TICK_US;
+}
+
+static void
+_clear_frame_tracking (ArvGvStreamWorker *worker)
+{
+	guint i;
+
+	for (i = 0; i < ARV_GV_STREAM_FRAME_RING_SIZE; i++) {
+		g_free (worker->frame_ring[i].received_packets);
+		g_free (worker->frame_ring[i].resend_requested_packets);
+	}
+
+	g_clear_pointer (&worker->frame_ring, g_free);
+	g_clear_pointer (&worker->timers, g_free);
+	worker->n_allocated_timers = 0;
+}
+
+static gboolean
+_can_request_resend (ArvGvStreamThreadData *thread_data, ArvGvStreamFrameData *frame)
+{
+	return thread_data->packet_resend != ARV_GV_STREAM_PACKET_RESEND_NEVER &&
+		!frame->disable_resend_request &&
+		!frame->resend_ratio_reached &&
+		(int) (frame->n_packets * thread_data->packet_request_ratio) > 0;
+}
+
+static void
+_schedule_resend_timer (ArvGvStreamWorker *worker, guint32 timer, guint64 deadline_us)
+{
+	guint64 tick;
+	guint slot;
+
+	/* Never in a slot already processed for the current tick */
+	tick = MAX (deadline_us / ARV_GV_STREAM_TIMER_WHEEL_TICK_US, worker->timer_wheel_tick + 1);
+	slot = tick % ARV_GV_STREAM_TIMER_WHEEL_N_SLOTS;
+
+	worker->timers[timer].deadline_us = deadline_us;
+	worker->timers[timer].next = worker->timer_wheel[slot];
+	worker->timer_wheel[slot] = timer;
+}
+
+static void
+_add_resend_timer (ArvGvStreamWorker *worker,
+		   ArvGvStreamFrameData *frame,
+		   guint32 first_packet,
+		   guint32 last_packet,
+		   guint64 deadline_us)
+{
+	guint32 timer;
+
+	if (worker->free_timer == ARV_GV_STREAM_TIMER_NONE) {
+		guint n_timers = MAX (64, 2 * worker->n_allocated_timers);
+		guint i;
+
+		worker->timers = g_renew (ArvGvStreamResendTimer, worker->timers, n_timers);
+		for (i = worker->n_allocated_timers; i < n_timers; i++)
+			worker->timers[i].next = i + 1 < n_timers ? i + 1 : ARV_GV_STREAM_TIMER_NONE;
+		worker->free_timer = worker->n_allocated_timers;
+		worker->n_allocated_timers = n_timers;
+	}
+
+	timer = worker->free_timer;
+	worker->free_timer = worker->timers[timer].next;
+
+	worker->timers[timer].frame_index = frame - worker->frame_ring;
+	worker->timers[timer].generation = frame->generation;
+	worker->timers[timer].first_packet = first_packet;
+	worker->timers[timer].last_packet = last_packet;
+
+	_schedule_resend_timer (worker, timer, deadline_us);
+}
+
+/* Packets from the last scheduled one up to @end, excluded, are not received yet. Arm a resend timer for them. */
+
+static void
+_schedule_missing_packets (ArvGvStreamWorker *worker,
+			   ArvGvStreamFrameData *frame,
+			   guint32 end,
+			   guint64 time_us)
+{
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+
+	if (end > frame->n_scheduled_packets && _can_request_resend (thread_data, frame))
+		_add_resend_timer (worker, frame, frame->n_scheduled_packets, end - 1,
+				   time_us + thread_data->initial_packet_timeout_us);
+
+	frame->n_scheduled_packets = MAX (frame->n_scheduled_packets, end);
+}
+
 static ArvGvStreamFrameData *
-_find_frame_data (ArvGvStreamThreadData *thread_data,
+_find_frame_data (ArvGvStreamWorker *worker,
 		  const ArvGvspPacket *packet,
 		  size_t packet_size,
 		  guint64 frame_id,
@@ -332,49 +857,40 @@ _find_frame_data (ArvGvStreamThreadData *thread_data,
 		  size_t read_count,
 		  guint64 time_us)
 {
-	ArvGvStreamFrameData *frame = NULL;
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+	ArvGvStreamFrameData *frame;
 	ArvBuffer *buffer;
-	GSList *iter;
 	guint n_packets = 0;
 	gint64 frame_id_inc;
+	gint64 n_missed_ids;
         gboolean extended_ids;
 
-	extended_ids = arv_gvsp_packet_has_extended_ids (packet, packet_size);
-
-	for (iter = thread_data->frames; iter != NULL; iter = iter->next) {
-		frame = iter->data;
-		if (frame->frame_id == frame_id) {
-                        arv_histogram_fill (thread_data->histogram, 1, time_us - frame->first_packet_time_us);
-                        arv_histogram_fill (thread_data->histogram, 2, time_us - frame->last_packet_time_us);
-
-			frame->last_packet_time_us = time_us;
-			return frame;
+	frame = _get_frame_slot (worker, frame_id);
+	if (frame->buffer != NULL && frame->frame_id == frame_id) {
+		if (worker->histogram != NULL) {
+			arv_histogram_fill (worker->histogram, 1, time_us - frame->first_packet_time_us);
+			arv_histogram_fill (worker->histogram, 2, time_us - frame->last_packet_time_us);
 		}
-	}
 
-	if (extended_ids) {
-		frame_id_inc = (gint64) frame_id - (gint64) thread_data->last_frame_id;
-		/* Frame id 0 is not a valid value */
-		if ((gint64) frame_id > 0 && (gint64) thread_data->last_frame_id < 0)
-			frame_id_inc--;
-	} else {
-		frame_id_inc = (gint16) frame_id - (gint16) thread_data->last_frame_id;
-		/* Frame id 0 is not a valid value */
-		if ((gint16) frame_id > 0 && (gint16) thread_data->last_frame_id < 0)
-			frame_id_inc--;
+		frame->last_packet_time_us = time_us;
+		return frame;
 	}
 
+	extended_ids = arv_gvsp_packet_has_extended_ids (packet, packet_size);
+
+	frame_id_inc = _frame_id_distance (worker->last_frame_id, frame_id, extended_ids);
+
 	if (frame_id_inc < 1  && frame_id_inc > -ARV_GV_STREAM_DISCARD_LATE_FRAME_THRESHOLD) {
 		arv_info_stream_thread ("[GvStream::find_frame_data] Discard late frame %" G_GUINT64_FORMAT
 					 " (last: %" G_GUINT64_FORMAT ")",
-					 frame_id, thread_data->last_frame_id);
+					 frame_id, worker->last_frame_id);
 		arv_gvsp_packet_debug (packet, packet_size, ARV_DEBUG_LEVEL_INFO);
 		return NULL;
 	}
 
 	buffer = arv_stream_pop_input_buffer (thread_data->stream);
 	if (buffer == NULL) {
-		thread_data->n_underruns++;
+		worker->statistics->n_underruns++;
 
 		return NULL;
 	}
@@ -392,56 +908,72 @@ _find_frame_data (ArvGvStreamThreadData *thread_data,
                 return NULL;
         }
 
-	frame = g_new0 (ArvGvStreamFrameData, 1);
+	/* The ring slot is still used by a frame much older than this one */
+	if (frame->buffer != NULL) {
+		frame->buffer->priv->status = ARV_BUFFER_STATUS_MISSING_PACKETS;
+		arv_info_stream_thread ("[GvStream::find_frame_data] Incomplete frame %" G_GUINT64_FORMAT
+					" evicted by frame %" G_GUINT64_FORMAT, frame->frame_id, frame_id);
+		_close_frame (worker, time_us, frame);
+	}
 
-	frame->disable_resend_request = FALSE;
+	_init_frame_slot (frame, n_packets);
 
 	frame->frame_id = frame_id;
-	frame->last_valid_packet = -1;
 
 	frame->buffer = buffer;
-	_update_socket (thread_data, frame->buffer);
+	_update_socket (worker, frame->buffer);
 	frame->buffer->priv->status = ARV_BUFFER_STATUS_FILLING;
 
 	frame->first_packet_time_us = time_us;
 	frame->last_packet_time_us = time_us;
 
-	frame->packet_data = g_new0 (ArvGvStreamPacketData, n_packets);
-	frame->n_packets = n_packets;
-
 	if (thread_data->callback != NULL &&
 	    frame->buffer != NULL)
 		thread_data->callback (thread_data->callback_data,
 				       ARV_STREAM_CALLBACK_TYPE_START_BUFFER,
 				       NULL);
 
-	thread_data->last_frame_id = frame_id;
+	/* With several workers, each one only sees every n_workers frame */
+	n_missed_ids = _frame_id_distance (_next_worker_frame_id (worker->last_frame_id, thread_data->n_workers,
+								  extended_ids),
+					   frame_id, extended_ids);
 
-	if (frame_id_inc > 1) {
-		thread_data->n_missing_frames++;
+	worker->last_frame_id = frame_id;
+
+	if (n_missed_ids > 0) {
+		worker->statistics->n_missing_frames++;
 		arv_debug_stream_thread ("[GvStream::find_frame_data] Missed %" G_GINT64_FORMAT
                                          " frame(s) before %" G_GUINT64_FORMAT,
-                                         frame_id_inc - 1, frame_id);
+                                         (n_missed_ids + thread_data->n_workers - 1) / thread_data->n_workers,
+                                         frame_id);
 	}
 
-	thread_data->frames = g_slist_append (thread_data->frames, frame);
+	frame->previous = worker->last_frame;
+	if (worker->last_frame != NULL)
+		worker->last_frame->next = frame;
+	else
+		worker->first_frame = frame;
+	worker->last_frame = frame;
 
 	arv_debug_stream_thread ("[GvStream::find_frame_data] Start frame %" G_GUINT64_FORMAT, frame_id);
 
 	frame->extended_ids = extended_ids;
 
-        arv_histogram_fill (thread_data->histogram, 1, 0);
+        if (worker->histogram != NULL)
+                arv_histogram_fill (worker->histogram, 1, 0);
 
 	return frame;
 }
 
 static void
-_process_data_leader (ArvGvStreamThreadData *thread_data,
+_process_data_leader (ArvGvStreamWorker *worker,
 		      ArvGvStreamFrameData *frame,
 		      const ArvGvspPacket *packet,
                       size_t packet_size,
 		      guint32 packet_id)
 {
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+
 	if (frame->buffer->priv->status != ARV_BUFFER_STATUS_FILLING)
 		return;
 
@@ -456,6 +988,7 @@ _process_data_leader (ArvGvStreamThreadData *thread_data,
                 (packet, packet_size, &frame->buffer->priv->has_chunks);
 	frame->buffer->priv->frame_id = frame->frame_id;
 	frame->buffer->priv->chunk_endianness = G_BIG_ENDIAN;
+	frame->buffer->priv->has_gendc = FALSE;
 
 	frame->buffer->priv->system_timestamp_ns = g_get_real_time() * 1000LL;
 
@@ -526,24 +1059,49 @@ _process_data_leader (ArvGvStreamThreadData *thread_data,
                                 arv_gvsp_timestamp_to_ns (timestamp, thread_data->timestamp_tick_frequency);
 		else
 			frame->buffer->priv->timestamp_ns = frame->buffer->priv->system_timestamp_ns;
-        } else {
-                frame->buffer->priv->timestamp_ns = frame->buffer->priv->system_timestamp_ns;
-        }
+        } else if (frame->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER ||
+                   frame->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_H264) {
+                guint64 timestamp;
 
-	if (frame->packet_data[packet_id].resend_requested) {
-		thread_data->n_resent_packets++;
-		arv_debug_stream_thread ("[GvStream::process_data_leader] Received resent packet %u for frame %" G_GUINT64_FORMAT,
-				       packet_id, frame->frame_id);
-	}
-}
+                /* The part informations of a GenDC container are only known from its descriptor, which is parsed on
+                 * frame completion. A H264 stream is exposed as a single opaque part. */
+                arv_buffer_set_n_parts (frame->buffer, 1);
 
-static void
-_process_payload_block (ArvGvStreamThreadData *thread_data,
-		     ArvGvStreamFrameData *frame,
-		     const ArvGvspPacket *packet,
-                     size_t packet_size,
+                timestamp = arv_gvsp_leader_packet_get_timestamp(packet, packet_size);
+
+                frame->buffer->priv->parts[0].data_offset = 0;
+                frame->buffer->priv->parts[0].component_id = 0;
+                frame->buffer->priv->parts[0].data_type =
+                        frame->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_H264 ?
+                        ARV_BUFFER_PART_DATA_TYPE_UNKNOWN :
+                        ARV_BUFFER_PART_DATA_TYPE_2D_IMAGE;
+
+		if (G_LIKELY (thread_data->timestamp_tick_frequency != 0))
+			frame->buffer->priv->timestamp_ns =
+                                arv_gvsp_timestamp_to_ns (timestamp, thread_data->timestamp_tick_frequency);
+		else
+			frame->buffer->priv->timestamp_ns = frame->buffer->priv->system_timestamp_ns;
+        } else {
+                frame->buffer->priv->timestamp_ns = frame->buffer->priv->system_timestamp_ns;
+        }
+
+	if (_bitmap_get (frame->resend_requested_packets, packet_id)) {
+		worker->statistics->n_resent_packets++;
+		arv_debug_stream_thread ("[GvStream::process_data_leader] Received resent packet %u for frame %" G_GUINT64_FORMAT,
+				       packet_id, frame->frame_id);
+	}
+}
+
+static void
+_process_payload_block (ArvGvStreamWorker *worker,
+		     ArvGvStreamFrameData *frame,
+		     const ArvGvspPacket *packet,
+                     size_t packet_size,
+                     const void *payload_data,
 		     guint32 packet_id)
 {
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+	char *block_data;
 	size_t block_size;
 	ptrdiff_t block_offset;
 	ptrdiff_t block_end;
@@ -570,27 +1128,30 @@ _process_payload_block (ArvGvStreamThreadData *thread_data,
 					 " for frame %" G_GUINT64_FORMAT,
 					 block_end - frame->buffer->priv->allocated_size,
 					 packet_id, frame->frame_id);
-		thread_data->n_size_mismatch_errors++;
+		worker->statistics->n_size_mismatch_errors++;
 
 		block_end = frame->buffer->priv->allocated_size;
 		block_size = block_end - block_offset;
 	}
 
-	memcpy (((char *) frame->buffer->priv->data) + block_offset,
-                arv_gvsp_packet_get_data (packet, packet_size),
-                block_size);
+	/* Payload data already received at its final location does not need to be copied */
+	block_data = ((char *) frame->buffer->priv->data) + block_offset;
+	if (payload_data == NULL)
+		payload_data = arv_gvsp_packet_get_data (packet, packet_size);
+	if (payload_data != block_data)
+		memcpy (block_data, payload_data, block_size);
 
         frame->received_size += block_size;
 
-	if (frame->packet_data[packet_id].resend_requested) {
-		thread_data->n_resent_packets++;
+	if (_bitmap_get (frame->resend_requested_packets, packet_id)) {
+		worker->statistics->n_resent_packets++;
 		arv_debug_stream_thread ("[GvStream::process_data_block] Received resent packet %u for frame %" G_GUINT64_FORMAT,
 				       packet_id, frame->frame_id);
 	}
 }
 
 static void
-_process_multipart_block (ArvGvStreamThreadData *thread_data,
+_process_multipart_block (ArvGvStreamWorker *worker,
                           ArvGvStreamFrameData *frame,
                           const ArvGvspPacket *packet,
                           size_t packet_size,
@@ -627,8 +1188,113 @@ _process_multipart_block (ArvGvStreamThreadData *thread_data,
         }
 }
 
+/* GenDC data packets carry an explicit offset in the container, the data is written directly at its final location */
+
+static void
+_process_gendc_block (ArvGvStreamWorker *worker,
+                      ArvGvStreamFrameData *frame,
+                      const ArvGvspPacket *packet,
+                      size_t packet_size,
+                      guint32 packet_id)
+{
+        ptrdiff_t block_offset;
+
+	if (frame->buffer->priv->status != ARV_BUFFER_STATUS_FILLING)
+		return;
+
+	if (packet_id > frame->n_packets - 2 || packet_id < 1) {
+		arv_gvsp_packet_debug (packet, packet_size, ARV_DEBUG_LEVEL_INFO);
+		frame->buffer->priv->status = ARV_BUFFER_STATUS_WRONG_PACKET_ID;
+		return;
+	}
+
+        if (arv_gvsp_gendc_packet_get_offset (packet, packet_size, &block_offset)) {
+                size_t block_size;
+                ptrdiff_t block_end;
+
+                block_size = arv_gvsp_gendc_packet_get_data_size (packet, packet_size);
+                block_end = block_offset + block_size;
+
+                if (block_end > frame->buffer->priv->allocated_size) {
+                        arv_info_stream_thread ("[GvStream::process_gendc_block] %" G_GINTPTR_FORMAT
+                                                " unexpected bytes in packet %u "
+                                                " for frame %" G_GUINT64_FORMAT,
+                                                block_end - frame->buffer->priv->allocated_size,
+                                                packet_id, frame->frame_id);
+                        worker->statistics->n_size_mismatch_errors++;
+                        return;
+                }
+
+                memcpy ((char *) frame->buffer->priv->data + block_offset,
+                        arv_gvsp_gendc_packet_get_data (packet, packet_size), block_size);
+
+                frame->received_size += block_size;
+        }
+
+	if (_bitmap_get (frame->resend_requested_packets, packet_id)) {
+		worker->statistics->n_resent_packets++;
+		arv_debug_stream_thread ("[GvStream::process_gendc_block] Received resent packet %u for frame %" G_GUINT64_FORMAT,
+				       packet_id, frame->frame_id);
+	}
+}
+
+/* All-in packets transport a whole frame, made of the leader data directly followed by the payload data */
+
+static void
+_process_all_in (ArvGvStreamWorker *worker,
+                 ArvGvStreamFrameData *frame,
+                 const ArvGvspPacket *packet,
+                 size_t packet_size,
+                 guint32 packet_id)
+{
+        size_t leader_size;
+        size_t data_size;
+
+        _process_data_leader (worker, frame, packet, packet_size, packet_id);
+
+	if (frame->buffer->priv->status != ARV_BUFFER_STATUS_FILLING)
+		return;
+
+        switch (frame->buffer->priv->payload_type) {
+                case ARV_BUFFER_PAYLOAD_TYPE_IMAGE:
+                case ARV_BUFFER_PAYLOAD_TYPE_EXTENDED_CHUNK_DATA:
+                        leader_size = sizeof (ArvGvspImageLeader);
+                        break;
+                case ARV_BUFFER_PAYLOAD_TYPE_CHUNK_DATA:
+                case ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER:
+                case ARV_BUFFER_PAYLOAD_TYPE_H264:
+                        leader_size = sizeof (ArvGvspLeader);
+                        break;
+                default:
+                        arv_info_stream_thread ("[GvStream::process_all_in] Unsupported payload type 0x%04x "
+                                                "for frame %" G_GUINT64_FORMAT,
+                                                frame->buffer->priv->payload_type, frame->frame_id);
+                        frame->buffer->priv->status = ARV_BUFFER_STATUS_PAYLOAD_NOT_SUPPORTED;
+                        return;
+        }
+
+        data_size = arv_gvsp_packet_get_data_size (packet, packet_size);
+        if (data_size < leader_size) {
+                frame->buffer->priv->status = ARV_BUFFER_STATUS_SIZE_MISMATCH;
+                return;
+        }
+
+        data_size -= leader_size;
+        if (data_size > frame->buffer->priv->allocated_size) {
+		arv_info_stream_thread ("[GvStream::process_all_in] %zu unexpected bytes for frame %" G_GUINT64_FORMAT,
+					data_size - frame->buffer->priv->allocated_size, frame->frame_id);
+		worker->statistics->n_size_mismatch_errors++;
+                data_size = frame->buffer->priv->allocated_size;
+        }
+
+        memcpy (frame->buffer->priv->data,
+                (const char *) arv_gvsp_packet_get_data (packet, packet_size) + leader_size, data_size);
+
+        frame->received_size = data_size;
+}
+
 static void
-_process_data_trailer (ArvGvStreamThreadData *thread_data,
+_process_data_trailer (ArvGvStreamWorker *worker,
 		       ArvGvStreamFrameData *frame,
 		       guint32 packet_id)
 {
@@ -647,124 +1313,157 @@ _process_data_trailer (ArvGvStreamThreadData *thread_data,
                 frame->n_packets = packet_id + 1;
         }
 
-	if (frame->packet_data[packet_id].resend_requested) {
-		thread_data->n_resent_packets++;
+	if (_bitmap_get (frame->resend_requested_packets, packet_id)) {
+		worker->statistics->n_resent_packets++;
 		arv_debug_stream_thread ("[GvStream::process_data_trailer] Received resent packet %u for frame %"
                                          G_GUINT64_FORMAT,
                                          packet_id, frame->frame_id);
         }
 }
 
-static void
-_missing_packet_check (ArvGvStreamThreadData *thread_data,
-		       ArvGvStreamFrameData *frame,
-		       guint32 packet_id,
-		       guint64 time_us)
+/* Sends resend requests for the packets of the [@first_packet, @last_packet] range still not received. Returns TRUE if
+ * some requests were sent. */
+
+static gboolean
+_request_missing_packets (ArvGvStreamWorker *worker,
+			  ArvGvStreamFrameData *frame,
+			  guint32 first_packet,
+			  guint32 last_packet,
+			  guint64 time_us)
 {
-	int i;
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+	guint32 first_missing;
+	gboolean requested = FALSE;
+
+	if (!_can_request_resend (thread_data, frame))
+		return FALSE;
+
+	if (last_packet >= frame->n_packets)
+		last_packet = frame->n_packets - 1;
+
+	first_missing = _bitmap_find (frame->received_packets, first_packet, last_packet + 1, FALSE);
+	while (first_missing <= last_packet) {
+		guint32 last_missing;
+		guint32 n_missing_packets;
+		guint32 i;
+
+		last_missing = _bitmap_find (frame->received_packets, first_missing, last_packet + 1, TRUE) - 1;
+		n_missing_packets = last_missing - first_missing + 1;
+
+		if (frame->n_packet_resend_requests + n_missing_packets >
+		    (frame->n_packets * thread_data->packet_request_ratio)) {
+			frame->n_packet_resend_requests += n_missing_packets;
+
+			arv_info_stream_thread ("[GvStream::request_missing_packets]"
+						 " Maximum number of requests "
+						 "reached at dt = %" G_GINT64_FORMAT
+						 ", n_packet_requests = %u (%u packets/frame), frame_id = %"
+						 G_GUINT64_FORMAT,
+						 time_us - frame->first_packet_time_us,
+						 frame->n_packet_resend_requests, frame->n_packets,
+						 frame->frame_id);
 
-	if (thread_data->packet_resend == ARV_GV_STREAM_PACKET_RESEND_NEVER ||
-	    frame->disable_resend_request ||
-	    frame->resend_ratio_reached)
-		return;
+			worker->statistics->n_resend_ratio_reached++;
+			frame->resend_ratio_reached = TRUE;
 
-	if ((int) (frame->n_packets * thread_data->packet_request_ratio) <= 0)
-		return;
+			return FALSE;
+		}
 
-	if (packet_id < frame->n_packets) {
-		int first_missing = -1;
+		arv_debug_stream_thread ("[GvStream::request_missing_packets]"
+					 " Resend request at dt = %" G_GINT64_FORMAT
+					 ", packet id = %u to %u (%u packets/frame)",
+					 time_us - frame->first_packet_time_us,
+					 first_missing, last_missing, frame->n_packets);
 
-		for (i = frame->last_valid_packet + 1; i <= packet_id + 1; i++) {
-			gboolean need_resend;
+		_send_packet_request (worker,
+				      frame->frame_id,
+				      first_missing,
+				      last_missing,
+				      frame->extended_ids);
 
-			if (i <= packet_id && !frame->packet_data[i].received) {
-                                if (frame->packet_data[i].abs_timeout_us == 0)
-                                        frame->packet_data[i].abs_timeout_us = time_us +
-                                                thread_data->initial_packet_timeout_us;
-                                need_resend = time_us > frame->packet_data[i].abs_timeout_us;
-                        } else
-                                need_resend = FALSE;
+		for (i = first_missing; i <= last_missing; i++)
+			_bitmap_set (frame->resend_requested_packets, i);
 
-			if (need_resend) {
-				if (first_missing < 0)
-					first_missing = i;
-			}
+		worker->statistics->n_resend_requests += n_missing_packets;
+		requested = TRUE;
 
-			if (i > packet_id || !need_resend) {
-				if (first_missing >= 0) {
-					int last_missing;
-					int n_missing_packets;
-					int j;
-
-					last_missing = i - 1;
-					n_missing_packets = last_missing - first_missing + 1;
-
-					if (frame->n_packet_resend_requests + n_missing_packets >
-					    (frame->n_packets * thread_data->packet_request_ratio)) {
-						frame->n_packet_resend_requests += n_missing_packets;
-
-						arv_info_stream_thread ("[GvStream::missing_packet_check]"
-									 " Maximum number of requests "
-									 "reached at dt = %" G_GINT64_FORMAT
-									 ", n_packet_requests = %u (%u packets/frame), frame_id = %"
-									 G_GUINT64_FORMAT,
-									 time_us - frame->first_packet_time_us,
-									 frame->n_packet_resend_requests, frame->n_packets,
-									 frame->frame_id);
-
-						thread_data->n_resend_ratio_reached++;
-						frame->resend_ratio_reached = TRUE;
-
-						return;
-					}
-
-					arv_debug_stream_thread ("[GvStream::missing_packet_check]"
-							       " Resend request at dt = %" G_GINT64_FORMAT
-							       ", packet id = %u (%u packets/frame)",
-							       time_us - frame->first_packet_time_us,
-							       packet_id, frame->n_packets);
-
-					_send_packet_request (thread_data,
-							      frame->frame_id,
-							      first_missing,
-							      last_missing,
-							      frame->extended_ids);
-
-					for (j = first_missing; j <= last_missing; j++) {
-						frame->packet_data[j].abs_timeout_us = time_us +
-                                                        thread_data->packet_timeout_us;
-                                                frame->packet_data[j].resend_requested = TRUE;
-                                        }
+		first_missing = _bitmap_find (frame->received_packets, last_missing + 1, last_packet + 1, FALSE);
+	}
 
-					thread_data->n_resend_requests += n_missing_packets;
+	return requested;
+}
+
+/* Expired timers of frames still in flight send the resend requests, and are rearmed with the packet timeout if some
+ * packets are still missing. */
 
-					first_missing = -1;
-				}
+static void
+_process_resend_timers (ArvGvStreamWorker *worker, guint64 time_us)
+{
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+	guint64 tick;
+	guint64 first_tick;
+	guint64 n_ticks;
+	guint64 i;
+
+	tick = time_us / ARV_GV_STREAM_TIMER_WHEEL_TICK_US;
+	if (tick <= worker->timer_wheel_tick)
+		return;
+
+	first_tick = worker->timer_wheel_tick + 1;
+	n_ticks = MIN (tick - worker->timer_wheel_tick, ARV_GV_STREAM_TIMER_WHEEL_N_SLOTS);
+	worker->timer_wheel_tick = tick;
+
+	for (i = 0; i < n_ticks; i++) {
+		guint slot = (first_tick + i) % ARV_GV_STREAM_TIMER_WHEEL_N_SLOTS;
+		guint32 timer;
+
+		timer = worker->timer_wheel[slot];
+		worker->timer_wheel[slot] = ARV_GV_STREAM_TIMER_NONE;
+
+		while (timer != ARV_GV_STREAM_TIMER_NONE) {
+			ArvGvStreamResendTimer *entry = &worker->timers[timer];
+			ArvGvStreamFrameData *frame = &worker->frame_ring[entry->frame_index];
+			guint32 next = entry->next;
+
+			if (entry->deadline_us > time_us) {
+				_schedule_resend_timer (worker, timer, entry->deadline_us);
+			} else if (frame->buffer != NULL && frame->generation == entry->generation &&
+				   _request_missing_packets (worker, frame, entry->first_packet, entry->last_packet,
+							     time_us)) {
+				_schedule_resend_timer (worker, timer, time_us + thread_data->packet_timeout_us);
+			} else {
+				entry->next = worker->free_timer;
+				worker->free_timer = timer;
 			}
+
+			timer = next;
 		}
 	}
 }
 
 static void
-_close_frame (ArvGvStreamThreadData *thread_data,
+_close_frame (ArvGvStreamWorker *worker,
               guint64 time_us,
               ArvGvStreamFrameData *frame)
 {
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+
 	if (frame->buffer->priv->status == ARV_BUFFER_STATUS_SUCCESS)
-		thread_data->n_completed_buffers++;
+		worker->statistics->n_completed_buffers++;
 	else
 		if (frame->buffer->priv->status != ARV_BUFFER_STATUS_ABORTED)
-			thread_data->n_failures++;
+			worker->statistics->n_failures++;
 
 	if (frame->buffer->priv->status == ARV_BUFFER_STATUS_TIMEOUT)
-		thread_data->n_timeouts++;
+		worker->statistics->n_timeouts++;
 
 	if (frame->buffer->priv->status == ARV_BUFFER_STATUS_ABORTED)
-		thread_data->n_aborted++;
+		worker->statistics->n_aborted++;
 
 	if (frame->buffer->priv->status != ARV_BUFFER_STATUS_SUCCESS &&
 	    frame->buffer->priv->status != ARV_BUFFER_STATUS_ABORTED)
-		thread_data->n_missing_packets += (int) frame->n_packets - (frame->last_valid_packet + 1);
+		worker->statistics->n_missing_packets += frame->n_packets -
+			_bitmap_count (frame->received_packets, frame->n_packets);
 
 	arv_stream_push_output_buffer (thread_data->stream, frame->buffer);
 	if (thread_data->callback != NULL)
@@ -772,59 +1471,80 @@ _close_frame (ArvGvStreamThreadData *thread_data,
 				       ARV_STREAM_CALLBACK_TYPE_BUFFER_DONE,
 				       frame->buffer);
 
-        arv_histogram_fill (thread_data->histogram, 0,
-                            time_us - frame->first_packet_time_us);
+        if (worker->histogram != NULL)
+                arv_histogram_fill (worker->histogram, 0,
+                                    time_us - frame->first_packet_time_us);
 
 	arv_debug_stream_thread ("[GvStream::close_frame] Close frame %" G_GUINT64_FORMAT, frame->frame_id);
 
+	if (worker->zero_copy_frame == frame)
+		worker->zero_copy_frame = NULL;
+
+	if (frame->previous != NULL)
+		frame->previous->next = frame->next;
+	else
+		worker->first_frame = frame->next;
+	if (frame->next != NULL)
+		frame->next->previous = frame->previous;
+	else
+		worker->last_frame = frame->previous;
+
+	/* The slot and its packet bitmaps are reused by a next frame */
+	frame->previous = NULL;
+	frame->next = NULL;
 	frame->buffer = NULL;
 	frame->frame_id = 0;
 
-	g_free (frame->packet_data);
-	g_free (frame);
+	_flush_statistics (worker);
 }
 
 static void
-_check_frame_completion (ArvGvStreamThreadData *thread_data,
+_check_frame_completion (ArvGvStreamWorker *worker,
 			 guint64 time_us,
 			 ArvGvStreamFrameData *current_frame)
 {
-	GSList *iter;
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
 	ArvGvStreamFrameData *frame;
+	ArvGvStreamFrameData *next;
 	gboolean can_close_frame = TRUE;
 
-	for (iter = thread_data->frames; iter != NULL;) {
-		frame = iter->data;
+	_process_resend_timers (worker, time_us);
+
+	for (frame = worker->first_frame; frame != NULL; frame = next) {
+		next = frame->next;
 
 		if (can_close_frame &&
 		    thread_data->packet_resend == ARV_GV_STREAM_PACKET_RESEND_NEVER &&
-		    iter->next != NULL) {
+		    frame->next != NULL) {
 			frame->buffer->priv->status = ARV_BUFFER_STATUS_MISSING_PACKETS;
 			arv_info_stream_thread ("[GvStream::check_frame_completion] Incomplete frame %" G_GUINT64_FORMAT,
 						 frame->frame_id);
-			_close_frame (thread_data, time_us, frame);
-			thread_data->frames = iter->next;
-			g_slist_free_1 (iter);
-			iter = thread_data->frames;
+			_close_frame (worker, time_us, frame);
 			continue;
 		}
 
 		if (can_close_frame &&
 		    frame->last_valid_packet == frame->n_packets - 1) {
-			frame->buffer->priv->status = ARV_BUFFER_STATUS_SUCCESS;
+			/* Keep the error status set during the frame reception, e.g. for an unsupported all-in
+			 * payload */
+			if (frame->buffer->priv->status == ARV_BUFFER_STATUS_FILLING)
+				frame->buffer->priv->status = ARV_BUFFER_STATUS_SUCCESS;
                         frame->buffer->priv->received_size = frame->received_size;
 
                         if (frame->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_IMAGE ||
-                            frame->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_EXTENDED_CHUNK_DATA) {
+                            frame->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_EXTENDED_CHUNK_DATA ||
+                            frame->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_H264) {
                                 frame->buffer->priv->parts[0].size = frame->received_size;
+                        } else if (frame->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER) {
+                                /* The part size is given by the container descriptor, if it has an intensity
+                                 * component */
+                                frame->buffer->priv->parts[0].size = frame->received_size;
+                                arv_buffer_update_gendc_infos (frame->buffer, frame->received_size);
                         }
 
 			arv_debug_stream_thread ("[GvStream::check_frame_completion] Completed frame %" G_GUINT64_FORMAT,
 					       frame->frame_id);
-			_close_frame (thread_data, time_us, frame);
-			thread_data->frames = iter->next;
-			g_slist_free_1 (iter);
-			iter = thread_data->frames;
+			_close_frame (worker, time_us, frame);
 			continue;
 		}
 
@@ -832,81 +1552,58 @@ _check_frame_completion (ArvGvStreamThreadData *thread_data,
                     /* Do not timeout on the most recent frame if the LEADER packet is so far the ONLY
                      * valid packet received. This is needed by some devices sending the leader packet early, at
                      * acquisition start. */
-                    (frame->frame_id != thread_data->last_frame_id || frame->last_valid_packet != 0) &&
+                    (frame->frame_id != worker->last_frame_id || frame->last_valid_packet != 0) &&
 		    time_us - frame->last_packet_time_us >= thread_data->frame_retention_us) {
 			frame->buffer->priv->status = ARV_BUFFER_STATUS_TIMEOUT;
 			arv_warning_stream_thread ("[GvStream::check_frame_completion] Timeout for frame %"
 						   G_GUINT64_FORMAT " at dt = %" G_GUINT64_FORMAT,
 						   frame->frame_id, time_us - frame->first_packet_time_us);
-#if 0
-			if (arv_debug_check (&arv_debug_category_stream_thread, ARV_DEBUG_LEVEL_LOG)) {
-				int i;
-				arv_debug_stream_thread ("frame_id          = %Lu", frame->frame_id);
-				arv_debug_stream_thread ("last_valid_packet = %d", frame->last_valid_packet);
-				for (i = 0; i < frame->n_packets; i++) {
-					arv_debug_stream_thread ("%d - time = %Lu%s", i,
-							       frame->packet_data[i].time_us,
-							       frame->packet_data[i].received ? " - OK" : "");
-				}
-			}
-#endif
-			_close_frame (thread_data, time_us, frame);
-			thread_data->frames = iter->next;
-			g_slist_free_1 (iter);
-			iter = thread_data->frames;
+			_close_frame (worker, time_us, frame);
 			continue;
 		}
 
 		can_close_frame = FALSE;
 
+		/* The last packets of the frame are missing */
 		if (frame != current_frame &&
-		    time_us - frame->last_packet_time_us >= thread_data->packet_timeout_us) {
-			_missing_packet_check (thread_data, frame, frame->n_packets - 1, time_us);
-			iter = iter->next;
-			continue;
-		}
-
-		iter = iter->next;
+		    time_us - frame->last_packet_time_us >= thread_data->packet_timeout_us)
+			_schedule_missing_packets (worker, frame, frame->n_packets, time_us);
 	}
 }
 
 static void
-_flush_frames (ArvGvStreamThreadData *thread_data,
+_flush_frames (ArvGvStreamWorker *worker,
                guint64 time_us)
 {
-	GSList *iter;
-	ArvGvStreamFrameData *frame;
-
-	for (iter = thread_data->frames; iter != NULL; iter = iter->next) {
-		frame = iter->data;
-		frame->buffer->priv->status = ARV_BUFFER_STATUS_ABORTED;
-		_close_frame (thread_data, time_us, frame);
+	while (worker->first_frame != NULL) {
+		worker->first_frame->buffer->priv->status = ARV_BUFFER_STATUS_ABORTED;
+		_close_frame (worker, time_us, worker->first_frame);
 	}
-
-	g_slist_free (thread_data->frames);
-	thread_data->frames = NULL;
 }
 
 static ArvGvStreamFrameData *
-_process_packet (ArvGvStreamThreadData *thread_data, const ArvGvspPacket *packet, size_t packet_size, guint64 time_us)
+_process_packet (ArvGvStreamWorker *worker, const ArvGvspPacket *packet, size_t packet_size,
+                 const void *payload_data, guint64 time_us)
 
 {
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
 	ArvGvStreamFrameData *frame;
 	guint32 packet_id;
 	guint64 frame_id;
-	int i;
 
-	thread_data->n_received_packets++;
+	worker->statistics->n_received_packets++;
 
 	frame_id = arv_gvsp_packet_get_frame_id (packet, packet_size);
 	packet_id = arv_gvsp_packet_get_packet_id (packet, packet_size);
 
-	if (thread_data->first_packet) {
-		thread_data->last_frame_id = frame_id - 1;
-		thread_data->first_packet = FALSE;
+	if (worker->first_packet) {
+		worker->last_frame_id = _previous_worker_frame_id (frame_id, thread_data->n_workers,
+								   arv_gvsp_packet_has_extended_ids (packet,
+												     packet_size));
+		worker->first_packet = FALSE;
 	}
 
-	frame = _find_frame_data (thread_data, packet, packet_size, frame_id, packet_id, packet_size, time_us);
+	frame = _find_frame_data (worker, packet, packet_size, frame_id, packet_id, packet_size, time_us);
 
 	if (frame != NULL) {
 		ArvGvspPacketStatus packet_status = arv_gvsp_packet_get_status (packet, packet_size);
@@ -923,91 +1620,248 @@ _process_packet (ArvGvStreamThreadData *thread_data, const ArvGvspPacket *packet
                             packet_status == ARV_GVSP_PACKET_STATUS_PACKET_REMOVED_FROM_MEMORY ||
                             packet_status == ARV_GVSP_PACKET_STATUS_PACKET_UNAVAILABLE) {
                                 frame->disable_resend_request = TRUE;
-                                thread_data->n_resend_disabled++;
+                                worker->statistics->n_resend_disabled++;
                         }
 
-			thread_data->n_error_packets++;
-                        thread_data->n_transferred_bytes += packet_size;
+			worker->statistics->n_error_packets++;
+                        worker->statistics->n_transferred_bytes += packet_size;
 		} else if (packet_id < frame->n_packets &&
-		           frame->packet_data[packet_id].received) {
+		           _bitmap_get (frame->received_packets, packet_id)) {
 			/* Ignore duplicate packet */
-			thread_data->n_duplicated_packets++;
+			worker->statistics->n_duplicated_packets++;
 			arv_debug_stream_thread ("[GvStream::process_packet] Duplicated packet %d for frame %" G_GUINT64_FORMAT,
 						 packet_id, frame->frame_id);
 			arv_gvsp_packet_debug (packet, packet_size, ARV_DEBUG_LEVEL_DEBUG);
 
-                        thread_data->n_transferred_bytes += packet_size;
+                        worker->statistics->n_transferred_bytes += packet_size;
 		} else {
 			ArvGvspContentType content_type;
 
                         if (packet_id < frame->n_packets) {
-                                frame->packet_data[packet_id].received = TRUE;
+                                _bitmap_set (frame->received_packets, packet_id);
+                                if (packet_id >= frame->next_packet_id)
+                                        frame->next_packet_id = packet_id + 1;
                         }
 
                         /* Keep track of last packet of a continuous block starting from packet 0 */
-                        for (i = frame->last_valid_packet + 1; i < frame->n_packets; i++)
-                                if (!frame->packet_data[i].received)
-                                        break;
-                        frame->last_valid_packet = i - 1;
+                        frame->last_valid_packet = (gint32) _bitmap_find (frame->received_packets,
+                                                                          frame->last_valid_packet + 1,
+                                                                          frame->n_packets, FALSE) - 1;
 
                         content_type = arv_gvsp_packet_get_content_type (packet, packet_size);
 
                         arv_gvsp_packet_debug (packet, packet_size,
                                                content_type == ARV_GVSP_CONTENT_TYPE_LEADER ||
-                                               content_type == ARV_GVSP_CONTENT_TYPE_TRAILER ?
+                                               content_type == ARV_GVSP_CONTENT_TYPE_TRAILER ||
+                                               content_type == ARV_GVSP_CONTENT_TYPE_ALL_IN ?
                                                ARV_DEBUG_LEVEL_DEBUG :
                                                ARV_DEBUG_LEVEL_TRACE);
 
                         switch (content_type) {
                                 case ARV_GVSP_CONTENT_TYPE_LEADER:
-                                        _process_data_leader (thread_data, frame, packet, packet_size, packet_id);
-                                        thread_data->n_transferred_bytes += packet_size;
+                                        _process_data_leader (worker, frame, packet, packet_size, packet_id);
+                                        worker->statistics->n_transferred_bytes += packet_size;
                                         break;
                                 case ARV_GVSP_CONTENT_TYPE_PAYLOAD:
-                                        _process_payload_block (thread_data, frame, packet, packet_size, packet_id);
-                                        thread_data->n_transferred_bytes += packet_size;
+                                case ARV_GVSP_CONTENT_TYPE_H264:
+                                        _process_payload_block (worker, frame, packet, packet_size,
+                                                                payload_data, packet_id);
+                                        worker->statistics->n_transferred_bytes += packet_size;
                                         break;
                                 case ARV_GVSP_CONTENT_TYPE_MULTIPART:
-                                        _process_multipart_block (thread_data, frame, packet, packet_size, packet_id);
-                                        thread_data->n_transferred_bytes += packet_size;
+                                        _process_multipart_block (worker, frame, packet, packet_size, packet_id);
+                                        worker->statistics->n_transferred_bytes += packet_size;
+                                        break;
+                                case ARV_GVSP_CONTENT_TYPE_GENDC:
+                                        _process_gendc_block (worker, frame, packet, packet_size, packet_id);
+                                        worker->statistics->n_transferred_bytes += packet_size;
                                         break;
                                 case ARV_GVSP_CONTENT_TYPE_TRAILER:
-                                        _process_data_trailer (thread_data, frame, packet_id);
-                                        thread_data->n_transferred_bytes += packet_size;
+                                        _process_data_trailer (worker, frame, packet_id);
+                                        worker->statistics->n_transferred_bytes += packet_size;
+                                        break;
+                                case ARV_GVSP_CONTENT_TYPE_ALL_IN:
+                                        _process_all_in (worker, frame, packet, packet_size, packet_id);
+                                        worker->statistics->n_transferred_bytes += packet_size;
                                         break;
                                 default:
-                                        thread_data->n_ignored_packets++;
-                                        thread_data->n_ignored_bytes += packet_size;
+                                        worker->statistics->n_ignored_packets++;
+                                        worker->statistics->n_ignored_bytes += packet_size;
                                         break;
                         }
 
-                        _missing_packet_check (thread_data, frame, packet_id, time_us);
+                        if (packet_id < frame->n_packets && packet_id >= frame->n_scheduled_packets) {
+                                _schedule_missing_packets (worker, frame, packet_id, time_us);
+                                frame->n_scheduled_packets = packet_id + 1;
+                        }
 		}
 	} else {
-                thread_data->n_ignored_packets++;
-                thread_data->n_ignored_bytes += packet_size;
+                worker->statistics->n_ignored_packets++;
+                worker->statistics->n_ignored_bytes += packet_size;
         }
 
 	return frame;
 }
 
 static void
-_loop (ArvGvStreamThreadData *thread_data)
+_signal_worker_started (ArvGvStreamThreadData *thread_data)
+{
+        g_mutex_lock (&thread_data->thread_started_mutex);
+        thread_data->n_started_workers++;
+        g_cond_broadcast (&thread_data->thread_started_cond);
+        g_mutex_unlock (&thread_data->thread_started_mutex);
+}
+
+static void
+_signal_worker_failed (ArvGvStreamThreadData *thread_data)
 {
+        g_mutex_lock (&thread_data->thread_started_mutex);
+        thread_data->n_failed_workers++;
+        thread_data->n_started_workers++;
+        g_cond_broadcast (&thread_data->thread_started_cond);
+        g_mutex_unlock (&thread_data->thread_started_mutex);
+}
+
+typedef struct {
+	ArvGvStreamFrameData *frame;
+	guint32 packet_id;
+	size_t header_size;
+	char *block_data;
+	size_t block_size;
+} ArvGvStreamZeroCopySlot;
+
+/* In zero copy mode, the reception vectors of each message are setup for receiving the next expected payload packets
+ * of the most recent frame. The packet header lands in the message scratch buffer, and the payload is directly written
+ * at its final location in the frame buffer. Any remaining data is received in the scratch buffer, right after the
+ * header and the room reserved for the payload, which allows to rebuild a contiguous packet if the guess was wrong. */
+
+static void
+_prepare_zero_copy_vectors (ArvGvStreamWorker *worker,
+                            GInputMessage *packet_im,
+                            GInputVector *packet_iv,
+                            ArvGvStreamZeroCopySlot *slots,
+                            char *packet_buffers,
+                            guint packet_buffer_size)
+{
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+	ArvGvStreamFrameData *frame = NULL;
+	size_t header_size = 0;
+	size_t payload_size = 0;
+	int i;
+
+	if (worker->last_frame != NULL) {
+		frame = worker->last_frame;
+
+		if (!frame->leader_received ||
+		    frame->buffer->priv->status != ARV_BUFFER_STATUS_FILLING ||
+		    frame->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_MULTIPART)
+			frame = NULL;
+	}
+
+	if (frame != NULL) {
+		header_size = ARV_GVSP_PAYLOAD_PACKET_PROTOCOL_OVERHEAD (frame->extended_ids) -
+			ARV_GVSP_PACKET_UDP_OVERHEAD;
+		payload_size = thread_data->scps_packet_size -
+			ARV_GVSP_PAYLOAD_PACKET_PROTOCOL_OVERHEAD (frame->extended_ids);
+	}
+
+	worker->zero_copy_frame = frame;
+
+	for (i = 0; i < ARV_GV_STREAM_NUM_BUFFERS; i++) {
+		char *scratch = packet_buffers + i * packet_buffer_size;
+		guint32 packet_id;
+		ptrdiff_t block_offset;
+
+		slots[i].frame = NULL;
+		packet_im[i].vectors = &packet_iv[3 * i];
+
+		packet_id = frame != NULL ? frame->next_packet_id + i : 0;
+
+		/* Payload packets only, and never over already received data */
+		if (packet_id >= 1 && packet_id + 1 < frame->n_packets &&
+		    !_bitmap_get (frame->received_packets, packet_id)) {
+			block_offset = (ptrdiff_t) (packet_id - 1) * (ptrdiff_t) payload_size;
+
+			if (block_offset < (ptrdiff_t) frame->buffer->priv->allocated_size) {
+				slots[i].frame = frame;
+				slots[i].packet_id = packet_id;
+				slots[i].header_size = header_size;
+				slots[i].block_data = (char *) frame->buffer->priv->data + block_offset;
+				slots[i].block_size = MIN (payload_size,
+							   frame->buffer->priv->allocated_size - block_offset);
+
+				packet_iv[3 * i].buffer = scratch;
+				packet_iv[3 * i].size = header_size;
+				packet_iv[3 * i + 1].buffer = slots[i].block_data;
+				packet_iv[3 * i + 1].size = slots[i].block_size;
+				packet_iv[3 * i + 2].buffer = scratch + header_size + slots[i].block_size;
+				packet_iv[3 * i + 2].size = packet_buffer_size - header_size - slots[i].block_size;
+				packet_im[i].num_vectors = 3;
+				continue;
+			}
+		}
+
+		packet_iv[3 * i].buffer = scratch;
+		packet_iv[3 * i].size = packet_buffer_size;
+		packet_im[i].num_vectors = 1;
+	}
+}
+
+/* Returns the payload location of a message received in zero copy mode, or NULL if the packet is now contiguous in the
+ * scratch buffer. */
+
+static const void *
+_check_zero_copy_slot (ArvGvStreamZeroCopySlot *slot,
+                       ArvGvspPacket *packet,
+                       size_t packet_size)
+{
+	size_t received_block_size;
+
+	if (slot->frame == NULL)
+		return NULL;
+
+	if (packet_size > slot->header_size &&
+	    packet_size - slot->header_size <= slot->block_size &&
+	    arv_gvsp_packet_has_extended_ids (packet, packet_size) == slot->frame->extended_ids &&
+	    !arv_gvsp_packet_status_is_error (arv_gvsp_packet_get_status (packet, packet_size)) &&
+	    (arv_gvsp_packet_get_content_type (packet, packet_size) == ARV_GVSP_CONTENT_TYPE_PAYLOAD ||
+	     arv_gvsp_packet_get_content_type (packet, packet_size) == ARV_GVSP_CONTENT_TYPE_H264) &&
+	    arv_gvsp_packet_get_frame_id (packet, packet_size) == slot->frame->frame_id &&
+	    arv_gvsp_packet_get_packet_id (packet, packet_size) == slot->packet_id)
+		return slot->block_data;
+
+	/* Wrong guess, move the payload back to the scratch buffer */
+	if (packet_size > slot->header_size) {
+		received_block_size = MIN (packet_size - slot->header_size, slot->block_size);
+		memcpy ((char *) packet + slot->header_size, slot->block_data, received_block_size);
+	}
+
+	slot->frame = NULL;
+
+	return NULL;
+}
+
+static void
+_loop (ArvGvStreamWorker *worker)
+{
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
 	ArvGvStreamFrameData *frame;
 	ArvGvspPacket *packet_buffers;
 	GPollFD poll_fd[2];
 	guint64 time_us;
 	gboolean use_poll;
 	int i;
-	GInputVector packet_iv[ARV_GV_STREAM_NUM_BUFFERS] = { {NULL, 0}, };
+	GInputVector packet_iv[3 * ARV_GV_STREAM_NUM_BUFFERS] = { {NULL, 0}, };
 	GInputMessage packet_im[ARV_GV_STREAM_NUM_BUFFERS] = { {NULL, NULL, 0, 0, 0, NULL, NULL}, };
+	ArvGvStreamZeroCopySlot zero_copy_slots[ARV_GV_STREAM_NUM_BUFFERS];
+	const void *payload_data[ARV_GV_STREAM_NUM_BUFFERS];
 	// we don't need to consider the IP and UDP header size
 	guint packet_buffer_size = thread_data->scps_packet_size - 20 - 8;
 
-	arv_info_stream ("[GvStream::loop] Standard socket method");
+	arv_info_stream ("[GvStream::loop] Standard socket method (worker %u%s)", worker->index,
+			 thread_data->zero_copy ? ", zero copy" : "");
 
-	poll_fd[0].fd = g_socket_get_fd (thread_data->socket);
+	poll_fd[0].fd = g_socket_get_fd (worker->socket);
 	poll_fd[0].events =  G_IO_IN;
 	poll_fd[0].revents = 0;
 
@@ -1016,25 +1870,23 @@ _loop (ArvGvStreamThreadData *thread_data)
 	packet_buffers = g_malloc0 (packet_buffer_size * ARV_GV_STREAM_NUM_BUFFERS);
 
 	for (i = 0; i < ARV_GV_STREAM_NUM_BUFFERS; i++) {
-		packet_iv[i].buffer = (char *) packet_buffers + i * packet_buffer_size;
-		packet_iv[i].size = packet_buffer_size;
-		packet_im[i].vectors = &packet_iv[i];
+		packet_iv[3 * i].buffer = (char *) packet_buffers + i * packet_buffer_size;
+		packet_iv[3 * i].size = packet_buffer_size;
+		packet_im[i].vectors = &packet_iv[3 * i];
 		packet_im[i].num_vectors = 1;
+		zero_copy_slots[i].frame = NULL;
 	}
 
 	use_poll = g_cancellable_make_pollfd (thread_data->cancellable, &poll_fd[1]);
 
-        g_mutex_lock (&thread_data->thread_started_mutex);
-        thread_data->thread_started = TRUE;
-        g_cond_signal (&thread_data->thread_started_cond);
-        g_mutex_unlock (&thread_data->thread_started_mutex);
+        _signal_worker_started (thread_data);
 
 	do {
                 int timeout_ms;
 		int n_events;
 		int errsv;
 
-		if (thread_data->frames != NULL)
+		if (worker->first_frame != NULL)
 			timeout_ms = thread_data->packet_timeout_us / 1000;
 		else
 			timeout_ms = ARV_GV_STREAM_POLL_TIMEOUT_US / 1000;
@@ -1050,8 +1902,12 @@ _loop (ArvGvStreamThreadData *thread_data)
                         GError *error = NULL;
                         int n_msgs;
 
-			arv_gpollfd_clear_one (&poll_fd[0], thread_data->socket);
-			n_msgs = g_socket_receive_messages (thread_data->socket,
+                        if (thread_data->zero_copy)
+                                _prepare_zero_copy_vectors (worker, packet_im, packet_iv, zero_copy_slots,
+                                                            (char *) packet_buffers, packet_buffer_size);
+
+			arv_gpollfd_clear_one (&poll_fd[0], worker->socket);
+			n_msgs = g_socket_receive_messages (worker->socket,
 		 					    packet_im,
 		 					    ARV_GV_STREAM_NUM_BUFFERS,
 		 					    G_SOCKET_MSG_NONE,
@@ -1059,22 +1915,45 @@ _loop (ArvGvStreamThreadData *thread_data)
 		 					    &error);
 
                         if (G_LIKELY(n_msgs > 0)) {
+                                worker->statistics->n_backend_packets[ARV_GV_STREAM_BACKEND_SOCKET] += n_msgs;
+
+                                /* Wrong guesses must all be moved back to their scratch buffer before processing, as
+                                 * processing may overwrite the frame buffer location of the following messages */
+                                for (i = 0; i < n_msgs; i++)
+                                        payload_data[i] = _check_zero_copy_slot (&zero_copy_slots[i],
+                                                                                 packet_iv[3 * i].buffer,
+                                                                                 packet_im[i].bytes_received);
+
                                 time_us = g_get_monotonic_time ();
                                 for (i = 0; i < n_msgs; i++) {
-                                        frame = _process_packet (thread_data,
-                                                                 packet_iv[i].buffer,
+                                        /* The frame was closed while processing the previous messages */
+                                        if (payload_data[i] != NULL &&
+                                            worker->zero_copy_frame != zero_copy_slots[i].frame) {
+                                                worker->statistics->n_ignored_packets++;
+                                                worker->statistics->n_ignored_bytes += packet_im[i].bytes_received;
+                                                continue;
+                                        }
+
+                                        frame = _process_packet (worker,
+                                                                 packet_iv[3 * i].buffer,
                                                                  packet_im[i].bytes_received,
+                                                                 payload_data[i],
                                                                  time_us);
-                                        _check_frame_completion (thread_data, time_us, frame);
+                                        _check_frame_completion (worker, time_us, frame);
                                 }
                         } else {
                                 arv_warning_stream_thread ("[GvStream::loop] receive_messages failed: %s",
                                                            error != NULL ? error->message : "Unknown reason");
                                 g_clear_error (&error);
                         }
+
+                        for (i = 0; i < ARV_GV_STREAM_NUM_BUFFERS; i++)
+                                zero_copy_slots[i].frame = NULL;
+                        worker->zero_copy_frame = NULL;
                 } else {
                         time_us = g_get_monotonic_time ();
-                        _check_frame_completion (thread_data, time_us, NULL);
+                        _check_frame_completion (worker, time_us, NULL);
+                        _flush_statistics (worker);
                 }
 
 	} while (!g_cancellable_is_cancelled (thread_data->cancellable));
@@ -1204,117 +2083,810 @@ _interface_index_from_address (guint32 ip)
 		ifa->ifa_addr->sa_family == AF_INET) {
 		    struct sockaddr_in *sa;
 
-		    sa = (struct sockaddr_in *) (ifa->ifa_addr);
-		    if (ip == g_ntohl (sa->sin_addr.s_addr)) {
-			    index = if_nametoindex (ifa->ifa_name);
-			    break;
-		    }
-	    }
-    }
+		    sa = (struct sockaddr_in *) (ifa->ifa_addr);
+		    if (ip == g_ntohl (sa->sin_addr.s_addr)) {
+			    index = if_nametoindex (ifa->ifa_name);
+			    break;
+		    }
+	    }
+    }
+
+    freeifaddrs (ifaddr);
+
+    return index;
+}
+
+#if ARV_GV_STREAM_HAS_RECEIVE_WORKERS
+
+/* Classic BPF program returning the frame id of a GVSP packet, modulo the number of workers. For a SO_REUSEPORT
+ * socket group, the program is run on the UDP payload. For a packet socket fanout group, it is run on the ethernet
+ * frame, and the variable IP header length has to be taken into account. As 0 is not a valid 16 bit frame id, the
+ * frame sequence of a worker is not regular across the counter wrap, which is handled by _next_worker_frame_id. */
+
+static guint
+_build_worker_dispatch_filter (struct sock_filter *bpf, guint n_workers, gboolean from_ethernet)
+{
+	guint mode = from_ethernet ? BPF_IND : BPF_ABS;
+	guint gvsp_offset = from_ethernet ? ETH_HLEN + sizeof (struct udphdr) : 0;
+	guint n = 0;
+
+	if (from_ethernet)
+		bpf[n++] = (struct sock_filter) BPF_STMT (BPF_LDX | BPF_B | BPF_MSH, ETH_HLEN);
+	/* Extended id flag */
+	bpf[n++] = (struct sock_filter) BPF_STMT (BPF_LD | BPF_B | mode, gvsp_offset + 4);
+	bpf[n++] = (struct sock_filter) BPF_JUMP (BPF_JMP | BPF_JSET | BPF_K, 0x80, 0, 2);
+	/* Least significant bits of the 64 bit frame id */
+	bpf[n++] = (struct sock_filter) BPF_STMT (BPF_LD | BPF_W | mode, gvsp_offset + 12);
+	bpf[n++] = (struct sock_filter) BPF_JUMP (BPF_JMP | BPF_JA, 1, 0, 0);
+	/* 16 bit frame id */
+	bpf[n++] = (struct sock_filter) BPF_STMT (BPF_LD | BPF_H | mode, gvsp_offset + 2);
+	bpf[n++] = (struct sock_filter) BPF_STMT (BPF_ALU | BPF_MOD | BPF_K, n_workers);
+	bpf[n++] = (struct sock_filter) BPF_STMT (BPF_RET | BPF_A, 0);
+
+	return n;
+}
+
+static gboolean
+_join_fanout_group (ArvGvStreamThreadData *thread_data, int fd, gboolean set_program)
+{
+	int fanout;
+
+	fanout = thread_data->stream_port | (PACKET_FANOUT_CBPF << 16);
+	if (setsockopt (fd, SOL_PACKET, PACKET_FANOUT, &fanout, sizeof (fanout)) != 0) {
+		arv_warning_stream_thread ("[GvStream::join_fanout_group] Failed to join packet fanout group (%s)",
+					   strerror (errno));
+		return FALSE;
+	}
+
+	if (set_program) {
+		struct sock_filter bpf[8];
+		struct sock_fprog bpf_prog;
+
+		bpf_prog.len = _build_worker_dispatch_filter (bpf, thread_data->n_workers, TRUE);
+		bpf_prog.filter = bpf;
+
+		if (setsockopt (fd, SOL_PACKET, PACKET_FANOUT_DATA, &bpf_prog, sizeof (bpf_prog)) != 0) {
+			arv_warning_stream_thread ("[GvStream::join_fanout_group] Failed to set fanout program (%s)",
+						   strerror (errno));
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+/* Joins and leaves a fanout group before the workers are started, in order to fall back to a single receive thread
+ * if packet fanout is not available. */
+
+static gboolean
+_probe_fanout_support (ArvGvStreamThreadData *thread_data)
+{
+	gboolean success;
+	int fd;
+
+	fd = socket (PF_PACKET, SOCK_RAW, g_htons (ETH_P_ALL));
+	if (fd < 0)
+		return FALSE;
+
+	success = _join_fanout_group (thread_data, fd, TRUE);
+
+	close (fd);
+
+	return success;
+}
+
+static GSocket *
+_bind_stream_socket (GSocketAddress *socket_address, gboolean allow_reuse, GError **error)
+{
+	GSocket *socket;
+
+	socket = g_socket_new (G_SOCKET_FAMILY_IPV4, G_SOCKET_TYPE_DATAGRAM, G_SOCKET_PROTOCOL_UDP, error);
+	if (socket == NULL)
+		return NULL;
+
+	g_socket_set_blocking (socket, FALSE);
+	if (!g_socket_bind (socket, socket_address, allow_reuse, error)) {
+		g_object_unref (socket);
+		return NULL;
+	}
+
+	return socket;
+}
+
+static gboolean
+_open_worker_sockets (ArvGvStreamThreadData *thread_data)
+{
+	struct sock_filter bpf[8];
+	struct sock_fprog bpf_prog;
+	GSocketAddress *socket_address;
+	GError *error = NULL;
+	gboolean success = FALSE;
+	guint i;
+
+	socket_address = g_inet_socket_address_new (thread_data->interface_address, thread_data->stream_port);
+
+	/* SO_REUSEPORT must be set on all the sockets of the group before they are bound, including the one that was
+	 * created at stream instantiation. g_socket_bind sets it for datagram sockets when address reuse is allowed.
+	 * As the port can not be shared with the original socket, it has to be closed first. If the new socket can
+	 * not be bound, a plain socket is bound again to the stream port for the single thread fallback. */
+	if (!thread_data->socket_reuse_port) {
+		GSocket *socket;
+
+		g_clear_object (&thread_data->socket);
+
+		socket = _bind_stream_socket (socket_address, TRUE, &error);
+		if (socket == NULL) {
+			arv_warning_stream ("[GvStream::open_worker_sockets] Failed to rebind stream socket (%s)",
+					    error->message);
+			g_clear_error (&error);
+
+			thread_data->socket = _bind_stream_socket (socket_address, FALSE, &error);
+			if (thread_data->socket == NULL) {
+				arv_warning_stream ("[GvStream::open_worker_sockets] Failed to restore stream socket (%s)",
+						    error->message);
+				g_clear_error (&error);
+			}
+			goto out;
+		}
+
+		thread_data->socket = socket;
+		thread_data->socket_reuse_port = TRUE;
+	}
+
+	thread_data->workers[0].socket = g_object_ref (thread_data->socket);
+
+	for (i = 1; i < thread_data->n_workers; i++) {
+		GSocket *socket;
+
+		socket = g_socket_new (G_SOCKET_FAMILY_IPV4, G_SOCKET_TYPE_DATAGRAM, G_SOCKET_PROTOCOL_UDP, NULL);
+		g_socket_set_blocking (socket, FALSE);
+		if (!g_socket_bind (socket, socket_address, TRUE, &error)) {
+			arv_warning_stream ("[GvStream::open_worker_sockets] Failed to bind worker socket (%s)",
+					    error->message);
+			g_clear_error (&error);
+			g_object_unref (socket);
+			goto out;
+		}
+		thread_data->workers[i].socket = socket;
+	}
+
+	bpf_prog.len = _build_worker_dispatch_filter (bpf, thread_data->n_workers, FALSE);
+	bpf_prog.filter = bpf;
+
+	if (setsockopt (g_socket_get_fd (thread_data->socket), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF,
+			&bpf_prog, sizeof (bpf_prog)) != 0) {
+		arv_warning_stream ("[GvStream::open_worker_sockets] Failed to attach reuseport program (%s)",
+				    strerror (errno));
+		goto out;
+	}
+
+	success = TRUE;
+
+out:
+	g_object_unref (socket_address);
+
+	return success;
+}
+
+#endif /* ARV_GV_STREAM_HAS_RECEIVE_WORKERS */
+
+typedef struct {
+	guint32 version;
+	guint32 offset_to_priv;
+	struct tpacket_hdr_v1 h1;
+} ArvGvStreamBlockDescriptor;
+
+/* Compute the packet socket ring geometry. In auto mode, a block holds about 1 ms of stream data, in order to keep the
+ * latency low at low data rates while limiting the number of poll wakeups at high data rates, and the ring holds
+ * about 100 ms of stream data, and at least two frames. @payload_size and @frame_rate are ignored if zero. */
+
+static void
+_compute_ring_geometry (ArvGvStreamThreadData *thread_data, guint64 payload_size, double frame_rate)
+{
+	long page_size;
+	guint frame_size_min;
+
+	page_size = sysconf (_SC_PAGESIZE);
+	if (page_size <= 0)
+		page_size = 4096;
+
+	frame_size_min = TPACKET_ALIGN (TPACKET3_HDRLEN);
+
+	if (thread_data->packet_socket_ring == ARV_GV_STREAM_PACKET_SOCKET_RING_AUTO) {
+		guint64 slot_size;
+		guint64 packet_data_size;
+		guint64 frame_bytes = 0;
+		double data_rate = 0.0;
+		guint64 block_size;
+		guint64 ring_size;
+		guint64 block_count;
+		guint block_timeout_ms;
+
+		slot_size = TPACKET_ALIGN (TPACKET3_HDRLEN) + TPACKET_ALIGN (ETH_HLEN + thread_data->scps_packet_size);
+
+		packet_data_size = thread_data->scps_packet_size - ARV_GVSP_PAYLOAD_PACKET_PROTOCOL_OVERHEAD (FALSE);
+		if (payload_size > 0 && packet_data_size > 0) {
+			/* Payload packets, plus leader and trailer */
+			frame_bytes = ((payload_size + packet_data_size - 1) / packet_data_size + 2) * slot_size;
+			/* Each worker has its own ring, and receives a share of the frames */
+			if (frame_rate > 0.0)
+				data_rate = (double) frame_bytes * frame_rate / thread_data->n_workers;
+		}
+
+		if (data_rate > 0.0)
+			block_size = data_rate * ARV_GV_STREAM_RING_BLOCK_DURATION_US / 1e6;
+		else
+			block_size = ARV_GV_STREAM_PACKET_SOCKET_BLOCK_SIZE_DEFAULT;
+		block_size = CLAMP (block_size, MAX ((guint64) page_size, 8 * slot_size),
+				    ARV_GV_STREAM_RING_BLOCK_SIZE_MAX);
+		/* Power of two, hence also a multiple of the page size */
+		block_size = (guint64) 1 << g_bit_storage (block_size - 1);
+
+		if (data_rate > 0.0)
+			ring_size = MAX (data_rate * ARV_GV_STREAM_RING_DURATION_US / 1e6, 2 * frame_bytes);
+		else
+			ring_size = MAX (ARV_GV_STREAM_PACKET_SOCKET_BLOCK_SIZE_DEFAULT *
+					 ARV_GV_STREAM_PACKET_SOCKET_BLOCK_COUNT_DEFAULT, 2 * frame_bytes);
+		block_count = (ring_size + block_size - 1) / block_size;
+		block_count = CLAMP (block_count, ARV_GV_STREAM_RING_N_BLOCKS_MIN,
+				     MAX (ARV_GV_STREAM_RING_N_BLOCKS_MIN, ARV_GV_STREAM_RING_SIZE_MAX / block_size));
+
+		if (data_rate > 0.0)
+			block_timeout_ms = CLAMP ((guint) (block_size * 1000.0 / data_rate) + 1, 1,
+						  ARV_GV_STREAM_RING_BLOCK_TIMEOUT_MS_MAX);
+		else
+			block_timeout_ms = ARV_GV_STREAM_PACKET_SOCKET_BLOCK_TIMEOUT_MS_DEFAULT;
+
+		thread_data->ring_block_size = block_size;
+		thread_data->ring_block_count = block_count;
+		thread_data->ring_frame_size = ARV_GV_STREAM_RING_AUTO_FRAME_SIZE;
+		thread_data->ring_block_timeout_ms = block_timeout_ms;
+	} else {
+		thread_data->ring_block_size = ((thread_data->packet_socket_block_size + page_size - 1) / page_size) *
+			page_size;
+		thread_data->ring_block_count = thread_data->packet_socket_block_count;
+		thread_data->ring_frame_size = TPACKET_ALIGN (MAX (thread_data->packet_socket_frame_size,
+								   frame_size_min));
+		thread_data->ring_frame_size = MIN (thread_data->ring_frame_size, thread_data->ring_block_size);
+		thread_data->ring_block_timeout_ms = thread_data->packet_socket_block_timeout_ms;
+	}
+
+	arv_info_stream ("[GvStream::compute_ring_geometry] %s mode, %u blocks of %u bytes, frame size = %u, "
+			 "block timeout = %u ms",
+			 thread_data->packet_socket_ring == ARV_GV_STREAM_PACKET_SOCKET_RING_AUTO ? "Auto" : "Fixed",
+			 thread_data->ring_block_count, thread_data->ring_block_size,
+			 thread_data->ring_frame_size, thread_data->ring_block_timeout_ms);
+}
+
+/* The kernel resets its counters at each read */
+
+static void
+_read_kernel_statistics (ArvGvStreamWorker *worker, int fd)
+{
+	struct tpacket_stats_v3 stats = {0};
+	socklen_t length = sizeof (stats);
+
+	if (getsockopt (fd, SOL_PACKET, PACKET_STATISTICS, &stats, &length) != 0)
+		return;
+
+	worker->statistics->n_kernel_drops += stats.tp_drops;
+	worker->statistics->n_kernel_queue_freezes += stats.tp_freeze_q_cnt;
+
+	if (stats.tp_drops > 0)
+		arv_debug_stream_thread ("[GvStream::read_kernel_statistics] %u packet(s) dropped by the kernel "
+					 "(worker %u)", stats.tp_drops, worker->index);
+}
+
+static void
+_ring_buffer_loop (ArvGvStreamWorker *worker)
+{
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+	GPollFD poll_fd[2];
+	char *buffer;
+	struct tpacket_req3 req;
+	struct sockaddr_ll local_address = {0};
+	enum tpacket_versions version;
+	int fd;
+	unsigned block_id;
+	const guint8 *bytes;
+	guint32 interface_address;
+	guint32 device_address;
+	guint64 kernel_statistics_time_us;
+	gboolean use_poll;
+	gboolean started = FALSE;
+
+	arv_info_stream ("[GvStream::loop] Packet socket method (worker %u)", worker->index);
+
+	fd = socket (PF_PACKET, SOCK_RAW, g_htons (ETH_P_ALL));
+	if (fd < 0) {
+		arv_warning_stream_thread ("[GvStream::loop] Failed to create AF_PACKET socket");
+		goto af_packet_error;
+	}
+
+	version = TPACKET_V3;
+	if (setsockopt (fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0) {
+		arv_warning_stream_thread ("[GvStream::loop] Failed to set packet version");
+		goto socket_option_error;
+	}
+
+	req.tp_block_size = thread_data->ring_block_size;
+	req.tp_frame_size = thread_data->ring_frame_size;
+	req.tp_block_nr = thread_data->ring_block_count;
+	req.tp_frame_nr = (req.tp_block_size / req.tp_frame_size) * req.tp_block_nr;
+	req.tp_sizeof_priv = 0;
+	req.tp_retire_blk_tov = thread_data->ring_block_timeout_ms;
+	req.tp_feature_req_word = TP_FT_REQ_FILL_RXHASH;
+	if (setsockopt (fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) < 0) {
+		arv_warning_stream_thread ("[GvStream::loop] Failed to set packet rx ring (%s)", strerror (errno));
+		goto socket_option_error;
+	}
+
+	buffer = mmap (NULL, (size_t) req.tp_block_size * req.tp_block_nr, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+	if (buffer == MAP_FAILED) {
+		arv_warning_stream_thread ("[GvStream::loop] Failed to map ring buffer");
+		goto map_error;
+	}
+
+	bytes = g_inet_address_to_bytes (thread_data->interface_address);
+	interface_address = g_ntohl (*((guint32 *) bytes));
+	bytes = g_inet_address_to_bytes (thread_data->device_address);
+	device_address = g_ntohl (*((guint32 *) bytes));
+
+	local_address.sll_family   = AF_PACKET;
+	local_address.sll_protocol = g_htons(ETH_P_IP);
+	local_address.sll_ifindex  = _interface_index_from_address (interface_address);
+	local_address.sll_hatype   = 0;
+	local_address.sll_pkttype  = 0;
+	local_address.sll_halen    = 0;
+	if (bind (fd, (struct sockaddr *) &local_address, sizeof(local_address)) == -1) {
+		arv_warning_stream_thread ("[GvStream::loop] Failed to bind packet socket");
+		goto bind_error;
+	}
+
+	_set_socket_filter (fd, device_address, thread_data->source_stream_port, interface_address, thread_data->stream_port);
+
+#if ARV_GV_STREAM_HAS_RECEIVE_WORKERS
+	if (thread_data->n_workers > 1 && !_join_fanout_group (thread_data, fd, worker->index == 0))
+		goto bind_error;
+#endif
+
+	poll_fd[0].fd = fd;
+	poll_fd[0].events =  G_IO_IN;
+	poll_fd[0].revents = 0;
+
+	use_poll = g_cancellable_make_pollfd (thread_data->cancellable, &poll_fd[1]);
+
+	/* Discard the packets counted before the ring setup */
+	{
+		struct tpacket_stats_v3 stats;
+		socklen_t length = sizeof (stats);
+
+		getsockopt (fd, SOL_PACKET, PACKET_STATISTICS, &stats, &length);
+	}
+	kernel_statistics_time_us = g_get_monotonic_time ();
+
+        _signal_worker_started (thread_data);
+	started = TRUE;
+
+	block_id = 0;
+	do {
+		ArvGvStreamBlockDescriptor *descriptor;
+		guint64 time_us;
+
+		time_us = g_get_monotonic_time ();
+
+		if (time_us - kernel_statistics_time_us >= ARV_GV_STREAM_PACKET_RATE_PERIOD_US) {
+			_read_kernel_statistics (worker, fd);
+			kernel_statistics_time_us = time_us;
+		}
+
+		descriptor = (void *) (buffer + (size_t) block_id * req.tp_block_size);
+		if ((descriptor->h1.block_status & TP_STATUS_USER) == 0) {
+                        int timeout_ms;
+			int n_events;
+			int errsv;
+
+			_check_frame_completion (worker, time_us, NULL);
+
+                        if (worker->first_frame != NULL)
+                                timeout_ms = thread_data->packet_timeout_us / 1000;
+                        else
+                                timeout_ms = ARV_GV_STREAM_POLL_TIMEOUT_US / 1000;
+
+			do {
+				n_events = g_poll (poll_fd, use_poll ? 2 : 1,  timeout_ms);
+				errsv = errno;
+			} while (n_events < 0 && errsv == EINTR);
+		} else {
+			ArvGvStreamFrameData *frame;
+			const struct tpacket3_hdr *header;
+			ArvGvStreamBlockDescriptor *next_descriptor;
+			gint64 latency_us;
+			unsigned n_user_blocks;
+			unsigned i;
+
+			/* Number of blocks waiting for processing, including this one */
+			n_user_blocks = 1;
+			do {
+				next_descriptor = (void *) (buffer + (size_t) ((block_id + n_user_blocks) %
+									       req.tp_block_nr) * req.tp_block_size);
+			} while ((next_descriptor->h1.block_status & TP_STATUS_USER) != 0 &&
+				 ++n_user_blocks < req.tp_block_nr);
+			worker->ring_fill_level = MAX (worker->ring_fill_level,
+						       (double) n_user_blocks / (double) req.tp_block_nr);
+
+			latency_us = g_get_real_time () -
+				((gint64) descriptor->h1.ts_first_pkt.ts_sec * G_USEC_PER_SEC +
+				 descriptor->h1.ts_first_pkt.ts_nsec / 1000);
+			if (latency_us < 0)
+				latency_us = 0;
+			worker->statistics->n_ring_blocks++;
+			worker->statistics->ring_block_latency_us += latency_us;
+			worker->ring_block_latency_max_us = MAX (worker->ring_block_latency_max_us, (guint64) latency_us);
+			if ((descriptor->h1.block_status & TP_STATUS_BLK_TMO) != 0)
+				worker->statistics->n_ring_block_timeouts++;
+
+			header = (void *) (((char *) descriptor) + descriptor->h1.offset_to_first_pkt);
+
+			for (i = 0; i < descriptor->h1.num_pkts; i++) {
+				const struct iphdr *ip;
+				const ArvGvspPacket *packet;
+				size_t size;
+
+				ip = (void *) (((char *) header) + header->tp_mac + ETH_HLEN);
+				packet = (void *) (((char *) ip) + sizeof (struct iphdr) + sizeof (struct udphdr));
+				size = g_ntohs (ip->tot_len) -  sizeof (struct iphdr) - sizeof (struct udphdr);
+
+				worker->statistics->n_backend_packets[ARV_GV_STREAM_BACKEND_PACKET_SOCKET]++;
+				frame = _process_packet (worker, packet, size, NULL, time_us);
+
+				_check_frame_completion (worker, time_us, frame);
+
+				header = (void *) (((char *) header) + header->tp_next_offset);
+			}
+
+			descriptor->h1.block_status = TP_STATUS_KERNEL;
+			block_id = (block_id + 1) % req.tp_block_nr;
+		}
+	} while (!g_cancellable_is_cancelled (thread_data->cancellable));
+
+	_read_kernel_statistics (worker, fd);
+
+	if (use_poll)
+		g_cancellable_release_fd (thread_data->cancellable);
+
+bind_error:
+	munmap (buffer, (size_t) req.tp_block_size * req.tp_block_nr);
+socket_option_error:
+map_error:
+	close (fd);
+af_packet_error:
+	if (!started)
+		_signal_worker_failed (thread_data);
+}
+
+#endif /* ARAVIS_HAS_PACKET_SOCKET */
+
+#if ARAVIS_HAS_XDP
+
+typedef struct {
+	guint32 *producer;
+	guint32 *consumer;
+	void *descs;
+	guint32 mask;
+	void *map;
+	size_t map_size;
+} ArvGvStreamXdpRing;
+
+typedef struct {
+	int map_fd;
+	int program_fd;
+	int link_fd;
+	int socket_fd;
+	char *umem;
+	ArvGvStreamXdpRing rx_ring;
+	ArvGvStreamXdpRing fill_ring;
+	ArvGvStreamXdpRing completion_ring;
+} ArvGvStreamXdp;
+
+#define ARV_BPF_INSN(code,dst,src,offset,imm) ((struct bpf_insn) {(code), (dst), (src), (offset), (imm)})
+
+static int
+_bpf (int cmd, union bpf_attr *attr)
+{
+	return syscall (__NR_bpf, cmd, attr, sizeof (*attr));
+}
+
+/* XDP program redirecting the GVSP packets of the stream to the AF_XDP socket bound to the receive queue, and letting
+ * the other packets go through the kernel network stack. IP options are not supported. */
 
-    freeifaddrs (ifaddr);
+static int
+_xdp_load_program (int map_fd, guint32 device_address, guint16 device_port, guint16 stream_port)
+{
+	struct bpf_insn program[] = {
+		/* 0 */  ARV_BPF_INSN (BPF_ALU64 | BPF_MOV | BPF_X, BPF_REG_6, BPF_REG_1, 0, 0),
+		/* 1 */  ARV_BPF_INSN (BPF_LDX | BPF_MEM | BPF_W, BPF_REG_2, BPF_REG_6, offsetof (struct xdp_md, data), 0),
+		/* 2 */  ARV_BPF_INSN (BPF_LDX | BPF_MEM | BPF_W, BPF_REG_3, BPF_REG_6,
+				     offsetof (struct xdp_md, data_end), 0),
+		/* Ethernet + IP + UDP headers */
+		/* 3 */  ARV_BPF_INSN (BPF_ALU64 | BPF_MOV | BPF_X, BPF_REG_4, BPF_REG_2, 0, 0),
+		/* 4 */  ARV_BPF_INSN (BPF_ALU64 | BPF_ADD | BPF_K, BPF_REG_4, 0, 0,
+				     ETH_HLEN + sizeof (struct iphdr) + sizeof (struct udphdr)),
+		/* 5 */  ARV_BPF_INSN (BPF_JMP | BPF_JGT | BPF_X, BPF_REG_4, BPF_REG_3, 18, 0),
+		/* Ethernet protocol */
+		/* 6 */  ARV_BPF_INSN (BPF_LDX | BPF_MEM | BPF_H, BPF_REG_5, BPF_REG_2, 12, 0),
+		/* 7 */  ARV_BPF_INSN (BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 16, g_htons (ETH_P_IP)),
+		/* IPv4 without options */
+		/* 8 */  ARV_BPF_INSN (BPF_LDX | BPF_MEM | BPF_B, BPF_REG_5, BPF_REG_2, ETH_HLEN, 0),
+		/* 9 */  ARV_BPF_INSN (BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 14, 0x45),
+		/* UDP */
+		/* 10 */ ARV_BPF_INSN (BPF_LDX | BPF_MEM | BPF_B, BPF_REG_5, BPF_REG_2, ETH_HLEN + 9, 0),
+		/* 11 */ ARV_BPF_INSN (BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 12, IPPROTO_UDP),
+		/* Source address */
+		/* 12 */ ARV_BPF_INSN (BPF_LDX | BPF_MEM | BPF_W, BPF_REG_5, BPF_REG_2, ETH_HLEN + 12, 0),
+		/* 13 */ ARV_BPF_INSN (BPF_JMP32 | BPF_JNE | BPF_K, BPF_REG_5, 0, 10,
+				     (gint32) g_htonl (device_address)),
+		/* Source port */
+		/* 14 */ ARV_BPF_INSN (BPF_LDX | BPF_MEM | BPF_H, BPF_REG_5, BPF_REG_2, ETH_HLEN + 20, 0),
+		/* 15 */ ARV_BPF_INSN (BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 8, g_htons (device_port)),
+		/* Destination port */
+		/* 16 */ ARV_BPF_INSN (BPF_LDX | BPF_MEM | BPF_H, BPF_REG_5, BPF_REG_2, ETH_HLEN + 22, 0),
+		/* 17 */ ARV_BPF_INSN (BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 6, g_htons (stream_port)),
+		/* bpf_redirect_map (map, rx_queue_index, XDP_PASS) */
+		/* 18 */ ARV_BPF_INSN (BPF_LDX | BPF_MEM | BPF_W, BPF_REG_2, BPF_REG_6,
+				     offsetof (struct xdp_md, rx_queue_index), 0),
+		/* 19 */ ARV_BPF_INSN (BPF_LD | BPF_DW | BPF_IMM, BPF_REG_1, BPF_PSEUDO_MAP_FD, 0, map_fd),
+		/* 20 */ ARV_BPF_INSN (0, 0, 0, 0, 0),
+		/* 21 */ ARV_BPF_INSN (BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_3, 0, 0, XDP_PASS),
+		/* 22 */ ARV_BPF_INSN (BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map),
+		/* 23 */ ARV_BPF_INSN (BPF_JMP | BPF_EXIT, 0, 0, 0, 0),
+		/* Let the packet go through the network stack */
+		/* 24 */ ARV_BPF_INSN (BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_0, 0, 0, XDP_PASS),
+		/* 25 */ ARV_BPF_INSN (BPF_JMP | BPF_EXIT, 0, 0, 0, 0),
+	};
+	union bpf_attr attr;
 
-    return index;
+	memset (&attr, 0, sizeof (attr));
+	attr.prog_type = BPF_PROG_TYPE_XDP;
+	attr.insns = (guint64) (uintptr_t) program;
+	attr.insn_cnt = G_N_ELEMENTS (program);
+	attr.license = (guint64) (uintptr_t) "LGPL";
+
+	return _bpf (BPF_PROG_LOAD, &attr);
 }
 
-typedef struct {
-	guint32 version;
-	guint32 offset_to_priv;
-	struct tpacket_hdr_v1 h1;
-} ArvGvStreamBlockDescriptor;
+static gboolean
+_xdp_map_ring (int fd, ArvGvStreamXdpRing *ring, const struct xdp_ring_offset *offset,
+	       size_t desc_size, off_t page_offset)
+{
+	ring->map_size = offset->desc + ARV_GV_STREAM_XDP_N_FRAMES * desc_size;
+	ring->map = mmap (NULL, ring->map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, page_offset);
+	if (ring->map == MAP_FAILED) {
+		ring->map = NULL;
+		return FALSE;
+	}
+
+	ring->producer = (guint32 *) ((char *) ring->map + offset->producer);
+	ring->consumer = (guint32 *) ((char *) ring->map + offset->consumer);
+	ring->descs = (char *) ring->map + offset->desc;
+	ring->mask = ARV_GV_STREAM_XDP_N_FRAMES - 1;
+
+	return TRUE;
+}
 
 static void
-_ring_buffer_loop (ArvGvStreamThreadData *thread_data)
+_xdp_close (ArvGvStreamXdp *xdp)
 {
-	GPollFD poll_fd[2];
-	char *buffer;
-	struct tpacket_req3 req;
-	struct sockaddr_ll local_address = {0};
-	enum tpacket_versions version;
-	int fd;
-	unsigned block_id;
+	if (xdp->link_fd >= 0)
+		close (xdp->link_fd);
+	if (xdp->program_fd >= 0)
+		close (xdp->program_fd);
+	if (xdp->map_fd >= 0)
+		close (xdp->map_fd);
+	if (xdp->rx_ring.map != NULL)
+		munmap (xdp->rx_ring.map, xdp->rx_ring.map_size);
+	if (xdp->fill_ring.map != NULL)
+		munmap (xdp->fill_ring.map, xdp->fill_ring.map_size);
+	if (xdp->completion_ring.map != NULL)
+		munmap (xdp->completion_ring.map, xdp->completion_ring.map_size);
+	if (xdp->socket_fd >= 0)
+		close (xdp->socket_fd);
+	if (xdp->umem != NULL)
+		munmap (xdp->umem, ARV_GV_STREAM_XDP_N_FRAMES * ARV_GV_STREAM_XDP_FRAME_SIZE);
+}
+
+static gboolean
+_xdp_open (ArvGvStreamThreadData *thread_data, ArvGvStreamXdp *xdp)
+{
+	struct xdp_umem_reg umem_reg = {0};
+	struct xdp_mmap_offsets offsets;
+	struct sockaddr_xdp socket_address = {0};
+	union bpf_attr attr;
+	socklen_t optlen;
 	const guint8 *bytes;
 	guint32 interface_address;
 	guint32 device_address;
-	gboolean use_poll;
+	unsigned ifindex;
+	guint32 queue;
+	int n_frames = ARV_GV_STREAM_XDP_N_FRAMES;
+	gboolean generic_mode = FALSE;
+	unsigned int i;
+
+	xdp->map_fd = xdp->program_fd = xdp->link_fd = xdp->socket_fd = -1;
+	xdp->umem = NULL;
+	memset (&xdp->rx_ring, 0, sizeof (ArvGvStreamXdpRing));
+	memset (&xdp->fill_ring, 0, sizeof (ArvGvStreamXdpRing));
+	memset (&xdp->completion_ring, 0, sizeof (ArvGvStreamXdpRing));
+
+	if (thread_data->scps_packet_size + ETH_HLEN > ARV_GV_STREAM_XDP_FRAME_SIZE - XDP_PACKET_HEADROOM) {
+		arv_warning_stream_thread ("[GvStream::xdp_open] Packet size too large for AF_XDP (%u bytes)",
+					   thread_data->scps_packet_size);
+		return FALSE;
+	}
 
-	arv_info_stream ("[GvStream::loop] Packet socket method");
+	bytes = g_inet_address_to_bytes (thread_data->interface_address);
+	interface_address = g_ntohl (*((guint32 *) bytes));
+	bytes = g_inet_address_to_bytes (thread_data->device_address);
+	device_address = g_ntohl (*((guint32 *) bytes));
 
-	fd = socket (PF_PACKET, SOCK_RAW, g_htons (ETH_P_ALL));
-	if (fd < 0) {
-		arv_warning_stream_thread ("[GvStream::loop] Failed to create AF_PACKET socket");
-		goto af_packet_error;
+	ifindex = _interface_index_from_address (interface_address);
+	queue = thread_data->xdp_queue;
+
+	memset (&attr, 0, sizeof (attr));
+	attr.map_type = BPF_MAP_TYPE_XSKMAP;
+	attr.key_size = sizeof (guint32);
+	attr.value_size = sizeof (int);
+	attr.max_entries = ARV_GV_STREAM_XDP_N_QUEUES_MAX;
+	xdp->map_fd = _bpf (BPF_MAP_CREATE, &attr);
+	if (xdp->map_fd < 0) {
+		arv_warning_stream_thread ("[GvStream::xdp_open] Failed to create socket map (%s)", strerror (errno));
+		goto error;
 	}
 
-	version = TPACKET_V3;
-	if (setsockopt (fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0) {
-		arv_warning_stream_thread ("[GvStream::loop] Failed to set packet version");
-		goto socket_option_error;
+	xdp->program_fd = _xdp_load_program (xdp->map_fd, device_address, thread_data->source_stream_port,
+					     thread_data->stream_port);
+	if (xdp->program_fd < 0) {
+		arv_warning_stream_thread ("[GvStream::xdp_open] Failed to load XDP program (%s)", strerror (errno));
+		goto error;
 	}
 
-	req.tp_block_size = 1 << 21;
-	req.tp_frame_size = 1024;
-	req.tp_block_nr = 16;
-	req.tp_frame_nr = (req.tp_block_size * req.tp_block_nr) / req.tp_frame_size;
-	req.tp_sizeof_priv = 0;
-	req.tp_retire_blk_tov = 5;
-	req.tp_feature_req_word = TP_FT_REQ_FILL_RXHASH;
-	if (setsockopt (fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) < 0) {
-		arv_warning_stream_thread ("[GvStream::loop] Failed to set packet rx ring");
-		goto socket_option_error;
+	xdp->socket_fd = socket (AF_XDP, SOCK_RAW, 0);
+	if (xdp->socket_fd < 0) {
+		arv_warning_stream_thread ("[GvStream::xdp_open] Failed to create AF_XDP socket (%s)", strerror (errno));
+		goto error;
 	}
 
-	buffer = mmap (NULL, req.tp_block_size * req.tp_block_nr, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
-	if (buffer == MAP_FAILED) {
-		arv_warning_stream_thread ("[GvStream::loop] Failed to map ring buffer");
-		goto map_error;
+	xdp->umem = mmap (NULL, ARV_GV_STREAM_XDP_N_FRAMES * ARV_GV_STREAM_XDP_FRAME_SIZE,
+			  PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (xdp->umem == MAP_FAILED) {
+		xdp->umem = NULL;
+		arv_warning_stream_thread ("[GvStream::xdp_open] Failed to allocate UMEM");
+		goto error;
 	}
 
-	bytes = g_inet_address_to_bytes (thread_data->interface_address);
-	interface_address = g_ntohl (*((guint32 *) bytes));
-	bytes = g_inet_address_to_bytes (thread_data->device_address);
-	device_address = g_ntohl (*((guint32 *) bytes));
+	umem_reg.addr = (guint64) (uintptr_t) xdp->umem;
+	umem_reg.len = ARV_GV_STREAM_XDP_N_FRAMES * ARV_GV_STREAM_XDP_FRAME_SIZE;
+	umem_reg.chunk_size = ARV_GV_STREAM_XDP_FRAME_SIZE;
+	umem_reg.headroom = 0;
+
+	optlen = sizeof (offsets);
+	if (setsockopt (xdp->socket_fd, SOL_XDP, XDP_UMEM_REG, &umem_reg, sizeof (umem_reg)) != 0 ||
+	    setsockopt (xdp->socket_fd, SOL_XDP, XDP_UMEM_FILL_RING, &n_frames, sizeof (n_frames)) != 0 ||
+	    setsockopt (xdp->socket_fd, SOL_XDP, XDP_UMEM_COMPLETION_RING, &n_frames, sizeof (n_frames)) != 0 ||
+	    setsockopt (xdp->socket_fd, SOL_XDP, XDP_RX_RING, &n_frames, sizeof (n_frames)) != 0 ||
+	    getsockopt (xdp->socket_fd, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &optlen) != 0) {
+		arv_warning_stream_thread ("[GvStream::xdp_open] Failed to setup UMEM (%s)", strerror (errno));
+		goto error;
+	}
 
-	local_address.sll_family   = AF_PACKET;
-	local_address.sll_protocol = g_htons(ETH_P_IP);
-	local_address.sll_ifindex  = _interface_index_from_address (interface_address);
-	local_address.sll_hatype   = 0;
-	local_address.sll_pkttype  = 0;
-	local_address.sll_halen    = 0;
-	if (bind (fd, (struct sockaddr *) &local_address, sizeof(local_address)) == -1) {
-		arv_warning_stream_thread ("[GvStream::loop] Failed to bind packet socket");
-		goto bind_error;
+	if (!_xdp_map_ring (xdp->socket_fd, &xdp->rx_ring, &offsets.rx, sizeof (struct xdp_desc),
+			    XDP_PGOFF_RX_RING) ||
+	    !_xdp_map_ring (xdp->socket_fd, &xdp->fill_ring, &offsets.fr, sizeof (guint64),
+			    XDP_UMEM_PGOFF_FILL_RING) ||
+	    !_xdp_map_ring (xdp->socket_fd, &xdp->completion_ring, &offsets.cr, sizeof (guint64),
+			    XDP_UMEM_PGOFF_COMPLETION_RING)) {
+		arv_warning_stream_thread ("[GvStream::xdp_open] Failed to map rings (%s)", strerror (errno));
+		goto error;
 	}
 
-	_set_socket_filter (fd, device_address, thread_data->source_stream_port, interface_address, thread_data->stream_port);
+	/* Give all the UMEM frames to the kernel */
+	for (i = 0; i < ARV_GV_STREAM_XDP_N_FRAMES; i++)
+		((guint64 *) xdp->fill_ring.descs)[i] = (guint64) i * ARV_GV_STREAM_XDP_FRAME_SIZE;
+	__atomic_store_n (xdp->fill_ring.producer, ARV_GV_STREAM_XDP_N_FRAMES, __ATOMIC_RELEASE);
+
+	/* Try native mode first, then fall back to generic mode, which works with any driver */
+	memset (&attr, 0, sizeof (attr));
+	attr.link_create.prog_fd = xdp->program_fd;
+	attr.link_create.target_fd = ifindex;
+	attr.link_create.attach_type = BPF_XDP;
+	attr.link_create.flags = XDP_FLAGS_DRV_MODE;
+	xdp->link_fd = _bpf (BPF_LINK_CREATE, &attr);
+	if (xdp->link_fd < 0) {
+		attr.link_create.flags = XDP_FLAGS_SKB_MODE;
+		xdp->link_fd = _bpf (BPF_LINK_CREATE, &attr);
+		generic_mode = TRUE;
+	}
+	if (xdp->link_fd < 0) {
+		arv_warning_stream_thread ("[GvStream::xdp_open] Failed to attach XDP program to interface %u (%s)",
+					   ifindex, strerror (errno));
+		goto error;
+	}
 
-	poll_fd[0].fd = fd;
+	socket_address.sxdp_family = AF_XDP;
+	socket_address.sxdp_ifindex = ifindex;
+	socket_address.sxdp_queue_id = queue;
+	socket_address.sxdp_flags = generic_mode ? XDP_COPY : 0;
+	if (bind (xdp->socket_fd, (struct sockaddr *) &socket_address, sizeof (socket_address)) != 0) {
+		arv_warning_stream_thread ("[GvStream::xdp_open] Failed to bind AF_XDP socket to queue %u (%s)",
+					   queue, strerror (errno));
+		goto error;
+	}
+
+	memset (&attr, 0, sizeof (attr));
+	attr.map_fd = xdp->map_fd;
+	attr.key = (guint64) (uintptr_t) &queue;
+	attr.value = (guint64) (uintptr_t) &xdp->socket_fd;
+	attr.flags = BPF_ANY;
+	if (_bpf (BPF_MAP_UPDATE_ELEM, &attr) != 0) {
+		arv_warning_stream_thread ("[GvStream::xdp_open] Failed to register AF_XDP socket (%s)",
+					   strerror (errno));
+		goto error;
+	}
+
+	arv_info_stream_thread ("[GvStream::xdp_open] AF_XDP socket bound to interface %u, queue %u (%s mode)",
+				ifindex, queue, generic_mode ? "generic" : "native");
+
+	return TRUE;
+
+error:
+	_xdp_close (xdp);
+
+	return FALSE;
+}
+
+/* Returns FALSE if the AF_XDP socket could not be setup, in which case another reception method has to be used */
+
+static gboolean
+_xdp_loop (ArvGvStreamWorker *worker)
+{
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+	ArvGvStreamXdp xdp;
+	GPollFD poll_fd[2];
+	gboolean use_poll;
+
+	if (!_xdp_open (thread_data, &xdp))
+		return FALSE;
+
+	arv_info_stream ("[GvStream::loop] AF_XDP socket method");
+
+	poll_fd[0].fd = xdp.socket_fd;
 	poll_fd[0].events =  G_IO_IN;
 	poll_fd[0].revents = 0;
 
 	use_poll = g_cancellable_make_pollfd (thread_data->cancellable, &poll_fd[1]);
 
-        g_mutex_lock (&thread_data->thread_started_mutex);
-        thread_data->thread_started = TRUE;
-        g_cond_signal (&thread_data->thread_started_cond);
-        g_mutex_unlock (&thread_data->thread_started_mutex);
+        _signal_worker_started (thread_data);
 
-	block_id = 0;
 	do {
-		ArvGvStreamBlockDescriptor *descriptor;
+		guint32 rx_consumer;
+		guint32 rx_producer;
+		guint32 fill_producer;
 		guint64 time_us;
 
+		rx_consumer = *xdp.rx_ring.consumer;
+		rx_producer = __atomic_load_n (xdp.rx_ring.producer, __ATOMIC_ACQUIRE);
+
 		time_us = g_get_monotonic_time ();
 
-		descriptor = (void *) (buffer + block_id * req.tp_block_size);
-		if ((descriptor->h1.block_status & TP_STATUS_USER) == 0) {
+		if (rx_consumer == rx_producer) {
                         int timeout_ms;
 			int n_events;
 			int errsv;
 
-			_check_frame_completion (thread_data, time_us, NULL);
+			_check_frame_completion (worker, time_us, NULL);
+			_flush_statistics (worker);
 
-                        if (thread_data->frames != NULL)
+                        if (worker->first_frame != NULL)
                                 timeout_ms = thread_data->packet_timeout_us / 1000;
                         else
                                 timeout_ms = ARV_GV_STREAM_POLL_TIMEOUT_US / 1000;
@@ -1323,75 +2895,87 @@ _ring_buffer_loop (ArvGvStreamThreadData *thread_data)
 				n_events = g_poll (poll_fd, use_poll ? 2 : 1,  timeout_ms);
 				errsv = errno;
 			} while (n_events < 0 && errsv == EINTR);
-		} else {
-			ArvGvStreamFrameData *frame;
-			const struct tpacket3_hdr *header;
-			unsigned i;
 
-			header = (void *) (((char *) descriptor) + descriptor->h1.offset_to_first_pkt);
+			continue;
+		}
 
-			for (i = 0; i < descriptor->h1.num_pkts; i++) {
-				const struct iphdr *ip;
-				const ArvGvspPacket *packet;
-				size_t size;
+		fill_producer = *xdp.fill_ring.producer;
 
-				ip = (void *) (((char *) header) + header->tp_mac + ETH_HLEN);
-				packet = (void *) (((char *) ip) + sizeof (struct iphdr) + sizeof (struct udphdr));
-				size = g_ntohs (ip->tot_len) -  sizeof (struct iphdr) - sizeof (struct udphdr);
+		for (; rx_consumer != rx_producer; rx_consumer++) {
+			const struct xdp_desc *desc;
+			const struct iphdr *ip;
+			const ArvGvspPacket *packet;
+			ArvGvStreamFrameData *frame;
+			size_t header_size;
+			size_t size;
 
-				frame = _process_packet (thread_data, packet, size, time_us);
+			desc = &((const struct xdp_desc *) xdp.rx_ring.descs)[rx_consumer & xdp.rx_ring.mask];
 
-				_check_frame_completion (thread_data, time_us, frame);
+			ip = (const void *) (xdp.umem + desc->addr + ETH_HLEN);
+			header_size = ETH_HLEN + ip->ihl * 4 + sizeof (struct udphdr);
+			if (desc->len > header_size) {
+				packet = (const void *) (xdp.umem + desc->addr + header_size);
+				size = MIN (g_ntohs (ip->tot_len) - ip->ihl * 4 - sizeof (struct udphdr),
+					    desc->len - header_size);
 
-				header = (void *) (((char *) header) + header->tp_next_offset);
+				worker->statistics->n_backend_packets[ARV_GV_STREAM_BACKEND_XDP]++;
+				frame = _process_packet (worker, packet, size, NULL, time_us);
+
+				_check_frame_completion (worker, time_us, frame);
 			}
 
-			descriptor->h1.block_status = TP_STATUS_KERNEL;
-			block_id = (block_id + 1) % req.tp_block_nr;
+			/* Give the frame back to the kernel */
+			((guint64 *) xdp.fill_ring.descs)[fill_producer & xdp.fill_ring.mask] =
+				desc->addr & ~((guint64) ARV_GV_STREAM_XDP_FRAME_SIZE - 1);
+			fill_producer++;
 		}
+
+		__atomic_store_n (xdp.fill_ring.producer, fill_producer, __ATOMIC_RELEASE);
+		__atomic_store_n (xdp.rx_ring.consumer, rx_consumer, __ATOMIC_RELEASE);
 	} while (!g_cancellable_is_cancelled (thread_data->cancellable));
 
 	if (use_poll)
 		g_cancellable_release_fd (thread_data->cancellable);
 
-bind_error:
-	munmap (buffer, req.tp_block_size * req.tp_block_nr);
-socket_option_error:
-map_error:
-	close (fd);
-af_packet_error:
-        g_mutex_lock (&thread_data->thread_started_mutex);
-        thread_data->thread_started = TRUE;
-        g_cond_signal (&thread_data->thread_started_cond);
-        g_mutex_unlock (&thread_data->thread_started_mutex);
+	_xdp_close (&xdp);
+
+	return TRUE;
 }
 
-#endif /* ARAVIS_HAS_PACKET_SOCKET */
+#endif /* ARAVIS_HAS_XDP */
 
 static void *
 arv_gv_stream_thread (void *data)
 {
-	ArvGvStreamThreadData *thread_data = data;
-#if ARAVIS_HAS_PACKET_SOCKET
-	int fd;
-#endif
+	ArvGvStreamWorker *worker = data;
+	ArvGvStreamThreadData *thread_data = worker->thread_data;
+	gboolean done = FALSE;
 
-	thread_data->frames = NULL;
-	thread_data->last_frame_id = 0;
-	thread_data->first_packet = TRUE;
+	_init_frame_tracking (worker);
+	worker->last_frame_id = 0;
+	worker->first_packet = TRUE;
 
 	if (thread_data->callback != NULL)
 		thread_data->callback (thread_data->callback_data, ARV_STREAM_CALLBACK_TYPE_INIT, NULL);
 
+#if ARAVIS_HAS_XDP
+	if (thread_data->use_xdp)
+		done = _xdp_loop (worker);
+#endif
+
+	if (!done) {
 #if ARAVIS_HAS_PACKET_SOCKET
-	if (thread_data->use_packet_socket && (fd = socket (PF_PACKET, SOCK_RAW, g_htons (ETH_P_ALL))) >= 0) {
-		close (fd);
-		_ring_buffer_loop (thread_data);
-	} else
+		if (thread_data->packet_socket_in_use)
+			_ring_buffer_loop (worker);
+		else
 #endif
-		_loop (thread_data);
+			_loop (worker);
+	}
 
-	_flush_frames (thread_data, g_get_monotonic_time ());
+	_flush_frames (worker, g_get_monotonic_time ());
+	_flush_statistics (worker);
+
+	_clear_frame_tracking (worker);
 
 	if (thread_data->callback != NULL)
 		thread_data->callback (thread_data->callback_data, ARV_STREAM_CALLBACK_TYPE_EXIT, NULL);
@@ -1411,27 +2995,155 @@ arv_gv_stream_get_port (ArvGvStream *gv_stream)
 	return priv->thread_data->stream_port;
 }
 
+static void
+_free_workers (ArvGvStreamThreadData *thread_data)
+{
+	guint i;
+
+	if (thread_data->workers == NULL)
+		return;
+
+	for (i = 0; i < thread_data->n_workers; i++)
+		g_clear_object (&thread_data->workers[i].socket);
+
+	g_clear_pointer (&thread_data->workers, g_free);
+}
+
 static gboolean
 arv_gv_stream_start_acquisition (ArvStream *stream, GError **error)
 {
 	ArvGvStreamPrivate *priv = arv_gv_stream_get_instance_private (ARV_GV_STREAM (stream));
 	ArvGvStreamThreadData *thread_data;
+	guint i;
 
-	g_return_val_if_fail (priv->thread == NULL, FALSE);
 	g_return_val_if_fail (priv->thread_data != NULL, FALSE);
+	g_return_val_if_fail (priv->thread_data->workers == NULL, FALSE);
 
 	thread_data = priv->thread_data;
 
-        thread_data->thread_started = FALSE;
+	thread_data->packet_socket_in_use = FALSE;
+#if ARAVIS_HAS_PACKET_SOCKET
+	if (thread_data->use_packet_socket) {
+		int fd;
+
+		fd = socket (PF_PACKET, SOCK_RAW, g_htons (ETH_P_ALL));
+		if (fd >= 0) {
+			thread_data->packet_socket_in_use = TRUE;
+			close (fd);
+		}
+	}
+#endif
+
+	thread_data->n_workers = thread_data->n_receive_threads;
+#if !ARV_GV_STREAM_HAS_RECEIVE_WORKERS
+	if (thread_data->n_workers > 1) {
+		arv_warning_stream ("[GvStream::start_acquisition] Multiple receive threads not supported on this platform");
+		thread_data->n_workers = 1;
+	}
+#endif
+
+#if ARAVIS_HAS_XDP
+	if (thread_data->use_xdp && thread_data->n_workers > 1) {
+		arv_info_stream ("[GvStream::start_acquisition] AF_XDP method uses a single receive thread");
+		thread_data->n_workers = 1;
+	}
+#endif
+
+#if ARV_GV_STREAM_HAS_RECEIVE_WORKERS
+	if (thread_data->n_workers > 1 && thread_data->packet_socket_in_use &&
+	    !_probe_fanout_support (thread_data)) {
+		arv_warning_stream ("[GvStream::start_acquisition] Packet fanout not available, "
+				    "fall back to a single receive thread");
+		thread_data->n_workers = 1;
+	}
+#endif
+
+#if ARAVIS_HAS_PACKET_SOCKET
+	if (thread_data->packet_socket_in_use) {
+		guint64 payload_size = 0;
+		double frame_rate = 0.0;
+
+		if (thread_data->packet_socket_ring == ARV_GV_STREAM_PACKET_SOCKET_RING_AUTO) {
+			GError *local_error = NULL;
+			gint64 value;
+
+			value = arv_device_get_integer_feature_value (ARV_DEVICE (priv->gv_device), "PayloadSize",
+								      &local_error);
+			if (local_error == NULL && value > 0)
+				payload_size = value;
+			g_clear_error (&local_error);
+
+			frame_rate = arv_device_get_float_feature_value (ARV_DEVICE (priv->gv_device),
+									 "AcquisitionFrameRate", &local_error);
+			if (local_error != NULL)
+				frame_rate = 0.0;
+			g_clear_error (&local_error);
+		}
+
+		_compute_ring_geometry (thread_data, payload_size, frame_rate);
+	}
+#endif
+
+	thread_data->workers = g_new0 (ArvGvStreamWorker, thread_data->n_workers);
+
+#if ARV_GV_STREAM_HAS_RECEIVE_WORKERS
+	if (thread_data->n_workers > 1 && !thread_data->packet_socket_in_use &&
+	    !_open_worker_sockets (thread_data)) {
+		arv_warning_stream ("[GvStream::start_acquisition] Fall back to a single receive thread");
+		_free_workers (thread_data);
+		thread_data->n_workers = 1;
+		thread_data->workers = g_new0 (ArvGvStreamWorker, 1);
+	}
+#endif
+
+	if (thread_data->socket == NULL) {
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_TRANSFER_ERROR,
+			     "Stream socket is not bound to port %u", thread_data->stream_port);
+		_free_workers (thread_data);
+		return FALSE;
+	}
+
+	for (i = 0; i < thread_data->n_workers; i++) {
+		ArvGvStreamWorker *worker = &thread_data->workers[i];
+
+		worker->thread_data = thread_data;
+		worker->index = i;
+		if (worker->socket == NULL)
+			worker->socket = g_object_ref (thread_data->socket);
+		worker->packet_id = 65300;
+		worker->histogram = i == 0 ? thread_data->histogram : NULL;
+		worker->statistics = thread_data->n_workers > 1 ? &worker->local_statistics : &thread_data->statistics;
+	}
+
+	arv_info_stream ("[GvStream::start_acquisition] Start %u receive thread(s)", thread_data->n_workers);
+
+        thread_data->n_started_workers = 0;
+        thread_data->n_failed_workers = 0;
 	thread_data->cancellable = g_cancellable_new ();
-	priv->thread = g_thread_new ("arv_gv_stream", arv_gv_stream_thread, priv->thread_data);
+
+	for (i = 0; i < thread_data->n_workers; i++)
+		thread_data->workers[i].thread = g_thread_new ("arv_gv_stream", arv_gv_stream_thread,
+								&thread_data->workers[i]);
 
         g_mutex_lock (&thread_data->thread_started_mutex);
-        while (!thread_data->thread_started)
+        while (thread_data->n_started_workers < thread_data->n_workers)
                 g_cond_wait (&thread_data->thread_started_cond,
                              &thread_data->thread_started_mutex);
         g_mutex_unlock (&thread_data->thread_started_mutex);
 
+	/* Frames dispatched to a worker that failed to start would be lost */
+	if (thread_data->n_failed_workers > 0) {
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_TRANSFER_ERROR,
+			     "%u of %u receive thread(s) failed to start",
+			     thread_data->n_failed_workers, thread_data->n_workers);
+		g_cancellable_cancel (thread_data->cancellable);
+		for (i = 0; i < thread_data->n_workers; i++)
+			g_thread_join (thread_data->workers[i].thread);
+		g_clear_object (&thread_data->cancellable);
+		_free_workers (thread_data);
+		return FALSE;
+	}
+
         return TRUE;
 }
 
@@ -1440,17 +3152,19 @@ arv_gv_stream_stop_acquisition (ArvStream *stream, GError **error)
 {
 	ArvGvStreamPrivate *priv = arv_gv_stream_get_instance_private (ARV_GV_STREAM (stream));
 	ArvGvStreamThreadData *thread_data;
+	guint i;
 
-	g_return_val_if_fail (priv->thread != NULL, FALSE);
 	g_return_val_if_fail (priv->thread_data != NULL, FALSE);
+	g_return_val_if_fail (priv->thread_data->workers != NULL, FALSE);
 
 	thread_data = priv->thread_data;
 
 	g_cancellable_cancel (thread_data->cancellable);
-	g_thread_join (priv->thread);
+	for (i = 0; i < thread_data->n_workers; i++)
+		g_thread_join (thread_data->workers[i].thread);
 	g_clear_object (&thread_data->cancellable);
 
-	priv->thread = NULL;
+	_free_workers (thread_data);
 
         return TRUE;
 }
@@ -1498,9 +3212,9 @@ arv_gv_stream_get_statistics (ArvGvStream *gv_stream,
 	thread_data = priv->thread_data;
 
 	if (n_resent_packets != NULL)
-		*n_resent_packets = thread_data->n_resent_packets;
+		*n_resent_packets = thread_data->statistics.n_resent_packets;
 	if (n_missing_packets != NULL)
-		*n_missing_packets = thread_data->n_missing_packets;
+		*n_missing_packets = thread_data->statistics.n_missing_packets;
 }
 
 static void
@@ -1534,6 +3248,30 @@ arv_gv_stream_set_property (GObject * object, guint prop_id,
 		case ARV_GV_STREAM_PROPERTY_FRAME_RETENTION:
 			thread_data->frame_retention_us = g_value_get_uint (value);
 			break;
+		case ARV_GV_STREAM_PROPERTY_RECEIVE_THREADS:
+			thread_data->n_receive_threads = g_value_get_uint (value);
+			break;
+		case ARV_GV_STREAM_PROPERTY_ZERO_COPY:
+			thread_data->zero_copy = g_value_get_boolean (value);
+			break;
+		case ARV_GV_STREAM_PROPERTY_XDP_QUEUE:
+			thread_data->xdp_queue = g_value_get_uint (value);
+			break;
+		case ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_RING:
+			thread_data->packet_socket_ring = g_value_get_enum (value);
+			break;
+		case ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_SIZE:
+			thread_data->packet_socket_block_size = g_value_get_uint (value);
+			break;
+		case ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_COUNT:
+			thread_data->packet_socket_block_count = g_value_get_uint (value);
+			break;
+		case ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_FRAME_SIZE:
+			thread_data->packet_socket_frame_size = g_value_get_uint (value);
+			break;
+		case ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_TIMEOUT:
+			thread_data->packet_socket_block_timeout_ms = g_value_get_uint (value);
+			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
 			break;
@@ -1571,6 +3309,30 @@ arv_gv_stream_get_property (GObject * object, guint prop_id,
 		case ARV_GV_STREAM_PROPERTY_FRAME_RETENTION:
 			g_value_set_uint (value, thread_data->frame_retention_us);
 			break;
+		case ARV_GV_STREAM_PROPERTY_RECEIVE_THREADS:
+			g_value_set_uint (value, thread_data->n_receive_threads);
+			break;
+		case ARV_GV_STREAM_PROPERTY_ZERO_COPY:
+			g_value_set_boolean (value, thread_data->zero_copy);
+			break;
+		case ARV_GV_STREAM_PROPERTY_XDP_QUEUE:
+			g_value_set_uint (value, thread_data->xdp_queue);
+			break;
+		case ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_RING:
+			g_value_set_enum (value, thread_data->packet_socket_ring);
+			break;
+		case ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_SIZE:
+			g_value_set_uint (value, thread_data->packet_socket_block_size);
+			break;
+		case ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_COUNT:
+			g_value_set_uint (value, thread_data->packet_socket_block_count);
+			break;
+		case ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_FRAME_SIZE:
+			g_value_set_uint (value, thread_data->packet_socket_frame_size);
+			break;
+		case ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_TIMEOUT:
+			g_value_set_uint (value, thread_data->packet_socket_block_timeout_ms);
+			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
 			break;
@@ -1583,6 +3345,8 @@ arv_gv_stream_init (ArvGvStream *gv_stream)
 	ArvGvStreamPrivate *priv = arv_gv_stream_get_instance_private (gv_stream);
 
 	priv->thread_data = g_new0 (ArvGvStreamThreadData, 1);
+
+	g_mutex_init (&priv->thread_data->statistics_mutex);
 }
 
 static void
@@ -1599,6 +3363,7 @@ arv_gv_stream_constructed (GObject *object)
 	const guint8 *address_bytes;
 	GInetSocketAddress *local_address;
 	guint packet_size;
+	unsigned int i;
 
 	G_OBJECT_CLASS (arv_gv_stream_parent_class)->constructed (object);
 
@@ -1644,8 +3409,7 @@ arv_gv_stream_constructed (GObject *object)
 	priv->thread_data->timestamp_tick_frequency = timestamp_tick_frequency;
 	priv->thread_data->scps_packet_size = packet_size;
 	priv->thread_data->use_packet_socket = (options & ARV_GV_STREAM_OPTION_PACKET_SOCKET_DISABLED) == 0;
-
-	priv->thread_data->packet_id = 65300;
+	priv->thread_data->use_xdp = (options & ARV_GV_STREAM_OPTION_XDP_ENABLED) != 0;
 
 	priv->thread_data->histogram = arv_histogram_new (3, 100, 2000, 0);
 
@@ -1664,8 +3428,12 @@ arv_gv_stream_constructed (GObject *object)
 	priv->thread_data->device_socket_address = g_inet_socket_address_new (device_address, ARV_GVCP_PORT);
 	g_socket_set_blocking (priv->thread_data->socket, FALSE);
 
+	/* Allow the creation of a SO_REUSEPORT socket group if several receive threads were requested at construction */
+	priv->thread_data->socket_reuse_port = priv->thread_data->n_receive_threads > 1;
 	priv->thread_data->interface_socket_address = arv_socket_bind_with_range (priv->thread_data->socket,
-                                                                                  interface_address, 0, FALSE, NULL);
+                                                                                  interface_address, 0,
+                                                                                  priv->thread_data->socket_reuse_port,
+                                                                                  NULL);
 
 	local_address = G_INET_SOCKET_ADDRESS (g_socket_get_local_address (priv->thread_data->socket, NULL));
 	priv->thread_data->stream_port = g_inet_socket_address_get_port (local_address);
@@ -1683,41 +3451,63 @@ arv_gv_stream_constructed (GObject *object)
 	arv_info_stream ("[GvStream::stream_new] Source stream port = %d", priv->thread_data->source_stream_port);
 
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_completed_buffers",
-                                 G_TYPE_UINT64, &priv->thread_data->n_completed_buffers);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_completed_buffers);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_failures",
-                                 G_TYPE_UINT64, &priv->thread_data->n_failures);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_failures);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_underruns",
-                                 G_TYPE_UINT64, &priv->thread_data->n_underruns);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_underruns);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_timeouts",
-                                 G_TYPE_UINT64, &priv->thread_data->n_timeouts);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_timeouts);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_aborted",
-                                 G_TYPE_UINT64, &priv->thread_data->n_aborted);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_aborted);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_missing_frames",
-                                 G_TYPE_UINT64, &priv->thread_data->n_missing_frames);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_missing_frames);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_size_mismatch_errors",
-                                 G_TYPE_UINT64, &priv->thread_data->n_size_mismatch_errors);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_size_mismatch_errors);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_received_packets",
-                                 G_TYPE_UINT64, &priv->thread_data->n_received_packets);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_received_packets);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_missing_packets",
-                                 G_TYPE_UINT64, &priv->thread_data->n_missing_packets);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_missing_packets);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_error_packets",
-                                 G_TYPE_UINT64, &priv->thread_data->n_error_packets);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_error_packets);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_ignored_packets",
-                                 G_TYPE_UINT64, &priv->thread_data->n_ignored_packets);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_ignored_packets);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_resend_requests",
-                                 G_TYPE_UINT64, &priv->thread_data->n_resend_requests);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_resend_requests);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_resent_packets",
-                                 G_TYPE_UINT64, &priv->thread_data->n_resent_packets);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_resent_packets);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_resend_ratio_reached",
-                                 G_TYPE_UINT64, &priv->thread_data->n_resend_ratio_reached);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_resend_ratio_reached);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_resend_disabled",
-                                 G_TYPE_UINT64, &priv->thread_data->n_resend_disabled);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_resend_disabled);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_duplicated_packets",
-                                 G_TYPE_UINT64, &priv->thread_data->n_duplicated_packets);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_duplicated_packets);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_transferred_bytes",
-                                 G_TYPE_UINT64, &priv->thread_data->n_transferred_bytes);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_transferred_bytes);
         arv_stream_declare_info (ARV_STREAM (gv_stream), "n_ignored_bytes",
-                                 G_TYPE_UINT64, &priv->thread_data->n_ignored_bytes);
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_ignored_bytes);
+
+        for (i = 0; i < ARV_GV_STREAM_N_BACKENDS; i++) {
+                arv_stream_declare_info (ARV_STREAM (gv_stream), arv_gv_stream_backend_infos[i].n_packets,
+                                         G_TYPE_UINT64, &priv->thread_data->statistics.n_backend_packets[i]);
+                arv_stream_declare_info (ARV_STREAM (gv_stream), arv_gv_stream_backend_infos[i].packet_rate,
+                                         G_TYPE_DOUBLE, &priv->thread_data->packet_rates[i]);
+        }
+
+        arv_stream_declare_info (ARV_STREAM (gv_stream), "n_kernel_drops",
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_kernel_drops);
+        arv_stream_declare_info (ARV_STREAM (gv_stream), "n_kernel_queue_freezes",
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_kernel_queue_freezes);
+        arv_stream_declare_info (ARV_STREAM (gv_stream), "n_ring_blocks",
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_ring_blocks);
+        arv_stream_declare_info (ARV_STREAM (gv_stream), "n_ring_block_timeouts",
+                                 G_TYPE_UINT64, &priv->thread_data->statistics.n_ring_block_timeouts);
+        arv_stream_declare_info (ARV_STREAM (gv_stream), "ring_fill_level",
+                                 G_TYPE_DOUBLE, &priv->thread_data->ring_fill_level);
+        arv_stream_declare_info (ARV_STREAM (gv_stream), "ring_block_latency_mean",
+                                 G_TYPE_DOUBLE, &priv->thread_data->ring_block_latency_mean);
+        arv_stream_declare_info (ARV_STREAM (gv_stream), "ring_block_latency_max",
+                                 G_TYPE_DOUBLE, &priv->thread_data->ring_block_latency_max);
 }
 
 static void
@@ -1726,7 +3516,7 @@ arv_gv_stream_finalize (GObject *object)
 	ArvGvStreamPrivate *priv = arv_gv_stream_get_instance_private (ARV_GV_STREAM (object));
         GError *error = NULL;
 
-        if (priv->thread != NULL)
+        if (priv->thread_data->workers != NULL)
                 arv_gv_stream_stop_acquisition (ARV_STREAM (object), NULL);
 
         /* Stop the stream channel. We use a raw register write here, as the Genicam based access rely on
@@ -1750,45 +3540,56 @@ arv_gv_stream_finalize (GObject *object)
 		arv_histogram_unref (thread_data->histogram);
 
 		arv_info_stream ("[GvStream::finalize] n_completed_buffers    = %" G_GUINT64_FORMAT,
-				  thread_data->n_completed_buffers);
+				  thread_data->statistics.n_completed_buffers);
 		arv_info_stream ("[GvStream::finalize] n_failures             = %" G_GUINT64_FORMAT,
-				  thread_data->n_failures);
+				  thread_data->statistics.n_failures);
 		arv_info_stream ("[GvStream::finalize] n_underruns            = %" G_GUINT64_FORMAT,
-				  thread_data->n_underruns);
+				  thread_data->statistics.n_underruns);
 		arv_info_stream ("[GvStream::finalize] n_timeouts             = %" G_GUINT64_FORMAT,
-				  thread_data->n_timeouts);
+				  thread_data->statistics.n_timeouts);
 		arv_info_stream ("[GvStream::finalize] n_aborted              = %" G_GUINT64_FORMAT,
-				  thread_data->n_aborted);
+				  thread_data->statistics.n_aborted);
 		arv_info_stream ("[GvStream::finalize] n_missing_frames       = %" G_GUINT64_FORMAT,
-				  thread_data->n_missing_frames);
+				  thread_data->statistics.n_missing_frames);
 
 		arv_info_stream ("[GvStream::finalize] n_size_mismatch_errors = %" G_GUINT64_FORMAT,
-				  thread_data->n_size_mismatch_errors);
+				  thread_data->statistics.n_size_mismatch_errors);
 
 		arv_info_stream ("[GvStream::finalize] n_received_packets     = %" G_GUINT64_FORMAT,
-				  thread_data->n_received_packets);
+				  thread_data->statistics.n_received_packets);
 		arv_info_stream ("[GvStream::finalize] n_missing_packets      = %" G_GUINT64_FORMAT,
-				  thread_data->n_missing_packets);
+				  thread_data->statistics.n_missing_packets);
 		arv_info_stream ("[GvStream::finalize] n_error_packets        = %" G_GUINT64_FORMAT,
-				  thread_data->n_error_packets);
+				  thread_data->statistics.n_error_packets);
 		arv_info_stream ("[GvStream::finalize] n_ignored_packets      = %" G_GUINT64_FORMAT,
-				  thread_data->n_ignored_packets);
+				  thread_data->statistics.n_ignored_packets);
 
 		arv_info_stream ("[GvStream::finalize] n_resend_requests      = %" G_GUINT64_FORMAT,
-				  thread_data->n_resend_requests);
+				  thread_data->statistics.n_resend_requests);
 		arv_info_stream ("[GvStream::finalize] n_resent_packets       = %" G_GUINT64_FORMAT,
-				  thread_data->n_resent_packets);
+				  thread_data->statistics.n_resent_packets);
 		arv_info_stream ("[GvStream::finalize] n_resend_ratio_reached = %" G_GUINT64_FORMAT,
-				  thread_data->n_resend_ratio_reached);
+				  thread_data->statistics.n_resend_ratio_reached);
 		arv_info_stream ("[GvStream::finalize] n_resend_disabled      = %" G_GUINT64_FORMAT,
-				  thread_data->n_resend_disabled);
+				  thread_data->statistics.n_resend_disabled);
 		arv_info_stream ("[GvStream::finalize] n_duplicated_packets   = %" G_GUINT64_FORMAT,
-				  thread_data->n_duplicated_packets);
+				  thread_data->statistics.n_duplicated_packets);
 
 		arv_info_stream ("[GvStream::finalize] n_transferred_bytes    = %" G_GUINT64_FORMAT,
-				  thread_data->n_transferred_bytes);
+				  thread_data->statistics.n_transferred_bytes);
 		arv_info_stream ("[GvStream::finalize] n_ignored_bytes        = %" G_GUINT64_FORMAT,
-				  thread_data->n_ignored_bytes);
+				  thread_data->statistics.n_ignored_bytes);
+
+		if (thread_data->statistics.n_ring_blocks > 0) {
+			arv_info_stream ("[GvStream::finalize] n_kernel_drops         = %" G_GUINT64_FORMAT,
+					  thread_data->statistics.n_kernel_drops);
+			arv_info_stream ("[GvStream::finalize] n_kernel_queue_freezes = %" G_GUINT64_FORMAT,
+					  thread_data->statistics.n_kernel_queue_freezes);
+			arv_info_stream ("[GvStream::finalize] n_ring_blocks          = %" G_GUINT64_FORMAT,
+					  thread_data->statistics.n_ring_blocks);
+			arv_info_stream ("[GvStream::finalize] n_ring_block_timeouts  = %" G_GUINT64_FORMAT,
+					  thread_data->statistics.n_ring_block_timeouts);
+		}
 
 		g_clear_object (&thread_data->device_address);
 		g_clear_object (&thread_data->interface_address);
@@ -1796,6 +3597,8 @@ arv_gv_stream_finalize (GObject *object)
 		g_clear_object (&thread_data->interface_socket_address);
 		g_clear_object (&thread_data->socket);
 
+		g_mutex_clear (&thread_data->statistics_mutex);
+
 		g_clear_pointer (&thread_data, g_free);
 	}
 
@@ -1918,4 +3721,144 @@ arv_gv_stream_class_init (ArvGvStreamClass *gv_stream_class)
 				   ARV_GV_STREAM_FRAME_RETENTION_US_DEFAULT,
 				   G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
 		);
+        /**
+         * ArvGvStream:receive-threads:
+         *
+         * Number of threads receiving the stream packets. When greater than one, the incoming packets are dispatched
+         * by the kernel to the receive threads using their frame id, allowing to sustain higher frame rates. The stream
+         * callback is then called from each of these threads, and buffers may be pushed in the output queue out of
+         * order. The new value is taken into account at the next acquisition start.
+         *
+         * Since: 0.10.0
+         */
+	g_object_class_install_property (
+		object_class, ARV_GV_STREAM_PROPERTY_RECEIVE_THREADS,
+		g_param_spec_uint ("receive-threads", "Receive threads",
+				   "Number of receive threads",
+				   1,
+				   ARV_GV_STREAM_N_RECEIVE_THREADS_MAX,
+				   ARV_GV_STREAM_N_RECEIVE_THREADS_DEFAULT,
+				   G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
+		);
+        /**
+         * ArvGvStream:zero-copy:
+         *
+         * Receive the payload packets directly at their final location in the buffer memory, instead of copying
+         * them from an intermediate packet buffer. The location of each incoming packet is guessed from the last
+         * received packets of the current frame, and the data is only copied when packets arrive out of order. This
+         * only applies to the standard socket method, the packet socket method always copies the payload from the
+         * kernel ring buffer. Multipart payloads are not received in place.
+         *
+         * Since: 0.10.0
+         */
+	g_object_class_install_property (
+		object_class, ARV_GV_STREAM_PROPERTY_ZERO_COPY,
+		g_param_spec_boolean ("zero-copy", "Zero copy",
+				      "Receive payload directly into buffer memory",
+				      FALSE,
+				      G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
+		);
+        /**
+         * ArvGvStream:xdp-queue:
+         *
+         * Index of the network interface receive queue the AF_XDP socket is bound to, when
+         * %ARV_GV_STREAM_OPTION_XDP_ENABLED is set. On multiqueue network adapters, the stream packets should be
+         * steered to this queue, for example using an ethtool ntuple rule.
+         *
+         * Since: 0.10.0
+         */
+	g_object_class_install_property (
+		object_class, ARV_GV_STREAM_PROPERTY_XDP_QUEUE,
+		g_param_spec_uint ("xdp-queue", "XDP queue",
+				   "AF_XDP receive queue index",
+				   0,
+				   ARV_GV_STREAM_XDP_N_QUEUES_MAX - 1,
+				   0,
+				   G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
+		);
+        /**
+         * ArvGvStream:packet-socket-ring:
+         *
+         * Packet socket ring geometry policy. In auto mode, the ring block size, block count and block timeout are
+         * computed at acquisition start from the payload size, the packet size and the frame rate, and the
+         * packet-socket-* size properties are ignored.
+         *
+         * Since: 0.10.0
+         */
+	g_object_class_install_property (
+		object_class, ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_RING,
+		g_param_spec_enum ("packet-socket-ring", "Packet socket ring",
+				   "Packet socket ring behaviour",
+				   ARV_TYPE_GV_STREAM_PACKET_SOCKET_RING,
+				   ARV_GV_STREAM_PACKET_SOCKET_RING_FIXED,
+				   G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
+		);
+        /**
+         * ArvGvStream:packet-socket-block-size:
+         *
+         * Size of the packet socket ring blocks, rounded up to a multiple of the page size. A block is handed to the
+         * receiving thread when it is full, or when the block timeout expires.
+         *
+         * Since: 0.10.0
+         */
+	g_object_class_install_property (
+		object_class, ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_SIZE,
+		g_param_spec_uint ("packet-socket-block-size", "Packet socket block size",
+				   "Packet socket ring block size, in bytes",
+				   4096,
+				   1 << 30,
+				   ARV_GV_STREAM_PACKET_SOCKET_BLOCK_SIZE_DEFAULT,
+				   G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
+		);
+        /**
+         * ArvGvStream:packet-socket-block-count:
+         *
+         * Number of blocks of the packet socket ring.
+         *
+         * Since: 0.10.0
+         */
+	g_object_class_install_property (
+		object_class, ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_COUNT,
+		g_param_spec_uint ("packet-socket-block-count", "Packet socket block count",
+				   "Number of packet socket ring blocks",
+				   2,
+				   65536,
+				   ARV_GV_STREAM_PACKET_SOCKET_BLOCK_COUNT_DEFAULT,
+				   G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
+		);
+        /**
+         * ArvGvStream:packet-socket-frame-size:
+         *
+         * Nominal frame size of the packet socket ring. With the TPACKET_V3 ring used by Aravis, packets are stored
+         * contiguously in the blocks, and this value is only used for the ring setup. It is rounded to the packet
+         * header alignment.
+         *
+         * Since: 0.10.0
+         */
+	g_object_class_install_property (
+		object_class, ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_FRAME_SIZE,
+		g_param_spec_uint ("packet-socket-frame-size", "Packet socket frame size",
+				   "Packet socket ring frame size, in bytes",
+				   128,
+				   65536,
+				   ARV_GV_STREAM_PACKET_SOCKET_FRAME_SIZE_DEFAULT,
+				   G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
+		);
+        /**
+         * ArvGvStream:packet-socket-block-timeout:
+         *
+         * Delay after which a partially filled packet socket ring block is handed to the receiving thread. Lower
+         * values decrease the frame latency at low data rates. A value of 0 lets the kernel choose the timeout.
+         *
+         * Since: 0.10.0
+         */
+	g_object_class_install_property (
+		object_class, ARV_GV_STREAM_PROPERTY_PACKET_SOCKET_BLOCK_TIMEOUT,
+		g_param_spec_uint ("packet-socket-block-timeout", "Packet socket block timeout",
+				   "Packet socket ring block timeout, in ms",
+				   0,
+				   1000,
+				   ARV_GV_STREAM_PACKET_SOCKET_BLOCK_TIMEOUT_MS_DEFAULT,
+				   G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
+		);
 }
@@ -37,11 +37,14 @@ G_BEGIN_DECLS
  * ArvGvStreamOption:
  * @ARV_GV_STREAM_OPTION_NONE: no option specified
  * @ARV_GV_STREAM_OPTION_PACKET_SOCKET_DISABLED: use of packet socket is disabled
+ * @ARV_GV_STREAM_OPTION_XDP_ENABLED: use of AF_XDP socket is enabled, with a fallback to the packet socket or
+ * standard socket methods if not available (Since: 0.10.0)
  */
 
 typedef enum {
 	ARV_GV_STREAM_OPTION_NONE =                             0,
 	ARV_GV_STREAM_OPTION_PACKET_SOCKET_DISABLED =           1 << 0,
+	ARV_GV_STREAM_OPTION_XDP_ENABLED =                      1 << 1,
 } ArvGvStreamOption;
 
 /**
@@ -56,6 +59,23 @@ typedef enum {
 	ARV_GV_STREAM_SOCKET_BUFFER_AUTO
 } ArvGvStreamSocketBuffer;
 
+/**
+ * ArvGvStreamPacketSocketRing:
+ * @ARV_GV_STREAM_PACKET_SOCKET_RING_FIXED: packet socket ring geometry is set using the
+ * [property@Aravis.GvStream:packet-socket-block-size], [property@Aravis.GvStream:packet-socket-block-count],
+ * [property@Aravis.GvStream:packet-socket-frame-size] and [property@Aravis.GvStream:packet-socket-block-timeout]
+ * values
+ * @ARV_GV_STREAM_PACKET_SOCKET_RING_AUTO: packet socket ring geometry is computed from the payload size, the packet
+ * size and the frame rate
+ *
+ * Since: 0.10.0
+ */
+
+typedef enum {
+	ARV_GV_STREAM_PACKET_SOCKET_RING_FIXED,
+	ARV_GV_STREAM_PACKET_SOCKET_RING_AUTO
+} ArvGvStreamPacketSocketRing;
+
 /**
  * ArvGvStreamPacketResend:
  * @ARV_GV_STREAM_PACKET_RESEND_NEVER: never request a packet resend
@@ -34,6 +34,13 @@ G_BEGIN_DECLS
 #define ARV_GV_STREAM_PACKET_TIMEOUT_US_DEFAULT		20000
 #define ARV_GV_STREAM_FRAME_RETENTION_US_DEFAULT	100000
 #define ARV_GV_STREAM_PACKET_REQUEST_RATIO_DEFAULT	0.25
+#define ARV_GV_STREAM_N_RECEIVE_THREADS_DEFAULT		1
+#define ARV_GV_STREAM_N_RECEIVE_THREADS_MAX		16
+
+#define ARV_GV_STREAM_PACKET_SOCKET_BLOCK_SIZE_DEFAULT		(1 << 21)
+#define ARV_GV_STREAM_PACKET_SOCKET_BLOCK_COUNT_DEFAULT		16
+#define ARV_GV_STREAM_PACKET_SOCKET_FRAME_SIZE_DEFAULT		1024
+#define ARV_GV_STREAM_PACKET_SOCKET_BLOCK_TIMEOUT_MS_DEFAULT	5
 
 ArvStream * 	arv_gv_stream_new		(ArvGvDevice *gv_device, ArvStreamCallback callback, void *callback_data, GDestroyNotify destroy, GError **error);
 
@@ -22,6 +22,7 @@
 
 #include <arvmiscprivate.h>
 #include <arvdebugprivate.h>
+#include <arvdevice.h>
 #include <arvversion.h>
 #include <string.h>
 #include <math.h>
@@ -1567,6 +1568,89 @@ arv_regex_new_from_glob_pattern (const char *glob, gboolean caseless)
 	return regex;
 }
 
+typedef struct {
+	ArvOpenFunc open_func;
+	const char *id;
+	GObject *object;
+	GError *error;
+} ArvOpenJob;
+
+static void *
+_open_thread (void *user_data)
+{
+	ArvOpenJob *job = user_data;
+
+	job->object = job->open_func (job->id, &job->error);
+
+	return NULL;
+}
+
+/*
+ * arv_open_in_parallel:
+ * @ids: a %NULL terminated list of identifiers
+ * @open_func: the function creating an object from an identifier
+ * @error: a #GError placeholder, %NULL to ignore
+ *
+ * Calls @open_func for each identifier of @ids, each call running in its own thread. If one of the calls fails, the
+ * first error in @ids order is propagated, and the successfully created objects are released.
+ *
+ * Returns: (transfer full): an array of the created objects, in @ids order, %NULL on error.
+ */
+
+GPtrArray *
+arv_open_in_parallel (const char **ids, ArvOpenFunc open_func, GError **error)
+{
+	ArvOpenJob *jobs;
+	GThread **threads;
+	GPtrArray *objects;
+	GError *local_error = NULL;
+	guint n_ids;
+	guint i;
+
+	g_return_val_if_fail (open_func != NULL, NULL);
+
+	n_ids = ids != NULL ? g_strv_length ((char **) ids) : 0;
+
+	jobs = g_new0 (ArvOpenJob, n_ids);
+	threads = g_new0 (GThread *, n_ids);
+
+	for (i = 0; i < n_ids; i++) {
+		jobs[i].open_func = open_func;
+		jobs[i].id = ids[i];
+		threads[i] = g_thread_new ("arv_open", _open_thread, &jobs[i]);
+	}
+
+	objects = g_ptr_array_new_full (n_ids, g_object_unref);
+
+	for (i = 0; i < n_ids; i++) {
+		g_thread_join (threads[i]);
+
+		if (jobs[i].object != NULL)
+			g_ptr_array_add (objects, jobs[i].object);
+		else if (jobs[i].error == NULL)
+			g_set_error (&jobs[i].error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_NOT_FOUND,
+				     "Failed to open '%s'", ids[i]);
+
+		if (jobs[i].error != NULL) {
+			if (local_error == NULL)
+				local_error = jobs[i].error;
+			else
+				g_error_free (jobs[i].error);
+		}
+	}
+
+	g_free (threads);
+	g_free (jobs);
+
+	if (local_error != NULL) {
+		g_propagate_error (error, local_error);
+		g_ptr_array_unref (objects);
+		return NULL;
+	}
+
+	return objects;
+}
+
 char *
 arv_g_string_free_and_steal (GString *string)
 {
@@ -67,6 +67,10 @@ double 		arv_value_get_double 		(ArvValue *value);
 gboolean 	arv_value_holds_int64 		(ArvValue *value);
 double 		arv_value_holds_double 		(ArvValue *value);
 
+typedef GObject * (*ArvOpenFunc) (const char *id, GError **error);
+
+GPtrArray *	arv_open_in_parallel		(const char **ids, ArvOpenFunc open_func, GError **error);
+
 /* Compatibility functions */
 
 char *          arv_g_string_free_and_steal     (GString *string) G_GNUC_WARN_UNUSED_RESULT;
@@ -0,0 +1,405 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+/*< private >
+ * SECTION:arvqueue
+ * @title: ArvQueue
+ * @short_description: lock-free multi-producer multi-consumer queue
+ *
+ * #ArvQueue is a FIFO queue of pointers, used for the transfer of buffers between the application threads and the
+ * stream receiving threads. Push and pop operations are lock-free in the common case, using a bounded ring of cells
+ * with per-cell sequence numbers. If the ring is full, the extra items are stored in a mutex protected overflow
+ * queue, which is moved back to the ring as soon as possible, preserving the FIFO order.
+ *
+ * Blocking pops wait on an #ArvWakeup, which is only signaled by the producers when some consumers are waiting, such
+ * that no system call is done in the non blocking case.
+ */
+
+#include <arvqueueprivate.h>
+#include <arvwakeupprivate.h>
+
+#define ARV_QUEUE_RING_SIZE		1024
+#define ARV_QUEUE_CACHE_LINE_SIZE	64
+
+typedef struct {
+	gint sequence;
+	gpointer data;
+} ArvQueueCell;
+
+struct _ArvQueue {
+	ArvQueueCell *cells;
+	guint mask;
+
+	char padding_0[ARV_QUEUE_CACHE_LINE_SIZE];
+	gint enqueue_position;
+	char padding_1[ARV_QUEUE_CACHE_LINE_SIZE];
+	gint dequeue_position;
+	char padding_2[ARV_QUEUE_CACHE_LINE_SIZE];
+
+	gint length;
+	gint n_waiters;
+	gint n_overflow_items;
+
+	GMutex overflow_mutex;
+	GQueue overflow;
+
+	ArvWakeup *wakeup;
+};
+
+/**
+ * arv_queue_new:
+ *
+ * Returns: a new empty #ArvQueue
+ *
+ * Since: 0.10.0
+ */
+
+ArvQueue *
+arv_queue_new (void)
+{
+	ArvQueue *queue;
+	guint i;
+
+	queue = g_new0 (ArvQueue, 1);
+	queue->cells = g_new (ArvQueueCell, ARV_QUEUE_RING_SIZE);
+	queue->mask = ARV_QUEUE_RING_SIZE - 1;
+
+	for (i = 0; i < ARV_QUEUE_RING_SIZE; i++) {
+		queue->cells[i].sequence = i;
+		queue->cells[i].data = NULL;
+	}
+
+	g_mutex_init (&queue->overflow_mutex);
+	g_queue_init (&queue->overflow);
+
+	queue->wakeup = arv_wakeup_new ();
+
+	return queue;
+}
+
+/**
+ * arv_queue_free:
+ * @queue: a #ArvQueue
+ *
+ * Frees @queue. The queue is expected to be empty, and not used by any other thread.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_queue_free (ArvQueue *queue)
+{
+	if (queue == NULL)
+		return;
+
+	arv_wakeup_free (queue->wakeup);
+	g_queue_clear (&queue->overflow);
+	g_mutex_clear (&queue->overflow_mutex);
+	g_free (queue->cells);
+	g_free (queue);
+}
+
+static gboolean
+_ring_push (ArvQueue *queue, gpointer data)
+{
+	guint position;
+
+	position = g_atomic_int_get (&queue->enqueue_position);
+	for (;;) {
+		ArvQueueCell *cell = &queue->cells[position & queue->mask];
+		gint difference;
+
+		difference = (gint) ((guint) g_atomic_int_get (&cell->sequence) - position);
+		if (difference == 0) {
+			if (g_atomic_int_compare_and_exchange (&queue->enqueue_position, position, position + 1)) {
+				cell->data = data;
+				g_atomic_int_set (&cell->sequence, position + 1);
+				return TRUE;
+			}
+		} else if (difference < 0) {
+			/* Full */
+			return FALSE;
+		}
+
+		position = g_atomic_int_get (&queue->enqueue_position);
+	}
+}
+
+static gpointer
+_ring_pop (ArvQueue *queue)
+{
+	guint position;
+
+	position = g_atomic_int_get (&queue->dequeue_position);
+	for (;;) {
+		ArvQueueCell *cell = &queue->cells[position & queue->mask];
+		gint difference;
+
+		difference = (gint) ((guint) g_atomic_int_get (&cell->sequence) - (position + 1));
+		if (difference == 0) {
+			if (g_atomic_int_compare_and_exchange (&queue->dequeue_position, position, position + 1)) {
+				gpointer data = cell->data;
+
+				g_atomic_int_set (&cell->sequence, position + queue->mask + 1);
+				return data;
+			}
+		} else if (difference < 0) {
+			/* Empty */
+			return NULL;
+		}
+
+		position = g_atomic_int_get (&queue->dequeue_position);
+	}
+}
+
+/**
+ * arv_queue_push:
+ * @queue: a #ArvQueue
+ * @data: (not nullable): an item
+ *
+ * Pushes @data at the end of @queue. This function is thread safe.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_queue_push (ArvQueue *queue, gpointer data)
+{
+	g_return_if_fail (queue != NULL);
+	g_return_if_fail (data != NULL);
+
+	/* Once items are in the overflow queue, the next ones must follow them there */
+	if (g_atomic_int_get (&queue->n_overflow_items) > 0 ||
+	    !_ring_push (queue, data)) {
+		g_mutex_lock (&queue->overflow_mutex);
+		g_queue_push_tail (&queue->overflow, data);
+		g_atomic_int_inc (&queue->n_overflow_items);
+		g_mutex_unlock (&queue->overflow_mutex);
+	}
+
+	/* Full barrier, which orders the item publication before the waiter check */
+	g_atomic_int_inc (&queue->length);
+
+	if (g_atomic_int_get (&queue->n_waiters) > 0)
+		arv_wakeup_signal (queue->wakeup);
+}
+
+/**
+ * arv_queue_try_pop:
+ * @queue: a #ArvQueue
+ *
+ * Pops the first item of @queue, without blocking. This function is thread safe.
+ *
+ * Returns: the first item, %NULL if @queue is empty.
+ *
+ * Since: 0.10.0
+ */
+
+gpointer
+arv_queue_try_pop (ArvQueue *queue)
+{
+	gpointer data;
+
+	g_return_val_if_fail (queue != NULL, NULL);
+
+	data = _ring_pop (queue);
+
+	if (data == NULL && g_atomic_int_get (&queue->n_overflow_items) > 0) {
+		g_mutex_lock (&queue->overflow_mutex);
+
+		/* The ring may have been filled again while waiting for the lock */
+		data = _ring_pop (queue);
+		if (data == NULL) {
+			data = g_queue_pop_head (&queue->overflow);
+			if (data != NULL)
+				g_atomic_int_add (&queue->n_overflow_items, -1);
+		}
+
+		/* Move the overflow items back to the ring, which is the fast path */
+		while (!g_queue_is_empty (&queue->overflow) &&
+		       _ring_push (queue, g_queue_peek_head (&queue->overflow))) {
+			g_queue_pop_head (&queue->overflow);
+			g_atomic_int_add (&queue->n_overflow_items, -1);
+		}
+
+		g_mutex_unlock (&queue->overflow_mutex);
+	}
+
+	if (data != NULL)
+		g_atomic_int_add (&queue->length, -1);
+
+	return data;
+}
+
+/* A negative @end_time means no timeout. The wait is also interrupted as soon as one of the @n_fds additional
+ * descriptors has some of its requested events pending. */
+
+static gpointer
+_blocking_pop (ArvQueue *queue, GPollFD *fds, guint n_fds, gint64 end_time)
+{
+	GPollFD *poll_fds;
+	gpointer data;
+	guint i;
+
+	data = arv_queue_try_pop (queue);
+	if (data != NULL)
+		return data;
+
+	poll_fds = g_newa (GPollFD, n_fds + 1);
+	arv_wakeup_get_pollfd (queue->wakeup, &poll_fds[0]);
+	for (i = 0; i < n_fds; i++) {
+		poll_fds[i + 1] = fds[i];
+		fds[i].revents = 0;
+	}
+
+	/* Full barrier, which orders the waiter registration before the queue check */
+	g_atomic_int_inc (&queue->n_waiters);
+
+	for (;;) {
+		gboolean is_interrupted = FALSE;
+		gint timeout_ms = -1;
+
+		data = arv_queue_try_pop (queue);
+		if (data != NULL)
+			break;
+
+		for (i = 0; i < n_fds; i++) {
+			if (poll_fds[i + 1].revents != 0) {
+				fds[i].revents = poll_fds[i + 1].revents;
+				is_interrupted = TRUE;
+			}
+		}
+		if (is_interrupted)
+			break;
+
+		if (end_time >= 0) {
+			gint64 now = g_get_monotonic_time ();
+
+			if (now >= end_time)
+				break;
+
+			timeout_ms = MIN ((end_time - now + 999) / 1000, G_MAXINT);
+		}
+
+		for (i = 0; i <= n_fds; i++)
+			poll_fds[i].revents = 0;
+		g_poll (poll_fds, n_fds + 1, timeout_ms);
+		if (poll_fds[0].revents != 0)
+			arv_wakeup_acknowledge (queue->wakeup);
+	}
+
+	/* An acknowledged signal may have been intended for another waiter */
+	if (!g_atomic_int_dec_and_test (&queue->n_waiters) &&
+	    data != NULL &&
+	    g_atomic_int_get (&queue->length) > 0)
+		arv_wakeup_signal (queue->wakeup);
+
+	return data;
+}
+
+/**
+ * arv_queue_pop:
+ * @queue: a #ArvQueue
+ *
+ * Pops the first item of @queue, waiting until one is available. This function is thread safe.
+ *
+ * Returns: the first item
+ *
+ * Since: 0.10.0
+ */
+
+gpointer
+arv_queue_pop (ArvQueue *queue)
+{
+	g_return_val_if_fail (queue != NULL, NULL);
+
+	return _blocking_pop (queue, NULL, 0, -1);
+}
+
+/**
+ * arv_queue_timeout_pop:
+ * @queue: a #ArvQueue
+ * @timeout_us: timeout, in µs
+ *
+ * Pops the first item of @queue, waiting no more than @timeout_us for an item to be available. This function is
+ * thread safe.
+ *
+ * Returns: the first item, %NULL if @queue is still empty after @timeout_us
+ *
+ * Since: 0.10.0
+ */
+
+gpointer
+arv_queue_timeout_pop (ArvQueue *queue, guint64 timeout_us)
+{
+	g_return_val_if_fail (queue != NULL, NULL);
+
+	if (timeout_us == 0)
+		return arv_queue_try_pop (queue);
+
+	return _blocking_pop (queue, NULL, 0, g_get_monotonic_time () + MIN (timeout_us, G_MAXINT64 / 2));
+}
+
+/**
+ * arv_queue_poll_pop:
+ * @queue: a #ArvQueue
+ * @fds: (array length=n_fds): additional file descriptors to wait on
+ * @n_fds: number of elements in @fds
+ * @timeout_us: timeout, in µs
+ *
+ * Pops the first item of @queue, waiting no more than @timeout_us for an item to be available, or for one of the
+ * descriptors of @fds to have some of its requested events pending. This allows a consumer thread to wait on its own
+ * event sources and on @queue at the same time, without any periodic polling. On return, the revents fields of @fds
+ * are only set if the wait was interrupted by the corresponding descriptor. This function is thread safe.
+ *
+ * Returns: the first item, %NULL if @queue is still empty after @timeout_us, or if an event is pending on one of
+ * @fds
+ *
+ * Since: 0.10.0
+ */
+
+gpointer
+arv_queue_poll_pop (ArvQueue *queue, GPollFD *fds, guint n_fds, guint64 timeout_us)
+{
+	g_return_val_if_fail (queue != NULL, NULL);
+	g_return_val_if_fail (fds != NULL || n_fds == 0, NULL);
+
+	return _blocking_pop (queue, fds, n_fds, g_get_monotonic_time () + MIN (timeout_us, G_MAXINT64 / 2));
+}
+
+/**
+ * arv_queue_get_length:
+ * @queue: a #ArvQueue
+ *
+ * Returns: the number of items in @queue. If other threads are using @queue, this is only a snapshot.
+ *
+ * Since: 0.10.0
+ */
+
+gint
+arv_queue_get_length (ArvQueue *queue)
+{
+	g_return_val_if_fail (queue != NULL, 0);
+
+	/* The length is updated after the item is pushed, and may be transiently negative */
+	return MAX (g_atomic_int_get (&queue->length), 0);
+}
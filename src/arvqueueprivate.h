@@ -0,0 +1,45 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+#ifndef ARV_QUEUE_PRIVATE_H
+#define ARV_QUEUE_PRIVATE_H
+
+#include <arvapi.h>
+#include <arvtypes.h>
+
+G_BEGIN_DECLS
+
+typedef struct _ArvQueue ArvQueue;
+
+ARV_API ArvQueue *	arv_queue_new			(void);
+ARV_API void		arv_queue_free			(ArvQueue *queue);
+
+ARV_API void		arv_queue_push			(ArvQueue *queue, gpointer data);
+ARV_API gpointer	arv_queue_pop			(ArvQueue *queue);
+ARV_API gpointer	arv_queue_try_pop		(ArvQueue *queue);
+ARV_API gpointer	arv_queue_timeout_pop		(ArvQueue *queue, guint64 timeout_us);
+ARV_API gpointer	arv_queue_poll_pop		(ArvQueue *queue, GPollFD *fds, guint n_fds, guint64 timeout_us);
+ARV_API gint		arv_queue_get_length		(ArvQueue *queue);
+
+G_END_DECLS
+
+#endif
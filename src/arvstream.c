@@ -26,7 +26,7 @@
  *
  * #ArvStream provides an abstract base class for the implementation of video
  * stream reception threads. The interface between the reception thread and the
- * main thread is done using asynchronous queues, containing #ArvBuffer
+ * main thread is done using lock-free queues, containing #ArvBuffer
  * objects.
  */
 
@@ -34,6 +34,7 @@
 #include <arvbuffer.h>
 #include <arvdevice.h>
 #include <arvdebugprivate.h>
+#include <arvqueueprivate.h>
 #include <gio/gio.h>
 
 typedef struct {
@@ -60,8 +61,8 @@ enum {
 } ArvStreamProperties;
 
 typedef struct {
-	GAsyncQueue *input_queue;
-	GAsyncQueue *output_queue;
+	ArvQueue *input_queue;
+	ArvQueue *output_queue;
         gint n_buffer_filling;
 	GRecMutex mutex;
 	gboolean emit_signals;
@@ -103,7 +104,7 @@ arv_stream_push_buffer (ArvStream *stream, ArvBuffer *buffer)
 	g_return_if_fail (ARV_IS_STREAM (stream));
 	g_return_if_fail (ARV_IS_BUFFER (buffer));
 
-	g_async_queue_push (priv->input_queue, buffer);
+	arv_queue_push (priv->input_queue, buffer);
 }
 
 /**
@@ -128,7 +129,7 @@ arv_stream_pop_buffer (ArvStream *stream)
 
 	g_return_val_if_fail (ARV_IS_STREAM (stream), NULL);
 
-	return g_async_queue_pop (priv->output_queue);
+	return arv_queue_pop (priv->output_queue);
 }
 
 /**
@@ -153,7 +154,7 @@ arv_stream_try_pop_buffer (ArvStream *stream)
 
 	g_return_val_if_fail (ARV_IS_STREAM (stream), NULL);
 
-	return g_async_queue_try_pop (priv->output_queue);
+	return arv_queue_try_pop (priv->output_queue);
 }
 
 /**
@@ -178,7 +179,7 @@ arv_stream_timeout_pop_buffer (ArvStream *stream, guint64 timeout)
 
 	g_return_val_if_fail (ARV_IS_STREAM (stream), NULL);
 
-	return g_async_queue_timeout_pop (priv->output_queue, timeout);
+	return arv_queue_timeout_pop (priv->output_queue, timeout);
 }
 
 /**
@@ -198,11 +199,9 @@ arv_stream_pop_input_buffer (ArvStream *stream)
 
 	g_return_val_if_fail (ARV_IS_STREAM (stream), NULL);
 
-        g_async_queue_lock(priv->input_queue);
-	data = g_async_queue_try_pop_unlocked (priv->input_queue);
+	data = arv_queue_try_pop (priv->input_queue);
         if (data != NULL)
-                priv->n_buffer_filling++;
-        g_async_queue_unlock(priv->input_queue);
+                g_atomic_int_inc (&priv->n_buffer_filling);
 
         return data;
 }
@@ -215,11 +214,27 @@ arv_stream_timeout_pop_input_buffer (ArvStream *stream, guint64 timeout)
 
 	g_return_val_if_fail (ARV_IS_STREAM (stream), NULL);
 
-        g_async_queue_lock(priv->input_queue);
-	data = g_async_queue_timeout_pop_unlocked (priv->input_queue, timeout);
+	data = arv_queue_timeout_pop (priv->input_queue, timeout);
         if (data != NULL)
-                priv->n_buffer_filling++;
-        g_async_queue_unlock(priv->input_queue);
+                g_atomic_int_inc (&priv->n_buffer_filling);
+
+        return data;
+}
+
+/* Same as arv_stream_timeout_pop_input_buffer(), but also returns as soon as an event is pending on one of @fds, which
+ * lets the stream threads wait for the returned buffers and for their own events at the same time. */
+
+ArvBuffer *
+arv_stream_poll_pop_input_buffer (ArvStream *stream, GPollFD *fds, guint n_fds, guint64 timeout)
+{
+	ArvStreamPrivate *priv = arv_stream_get_instance_private (stream);
+        void *data;
+
+	g_return_val_if_fail (ARV_IS_STREAM (stream), NULL);
+
+	data = arv_queue_poll_pop (priv->input_queue, fds, n_fds, timeout);
+        if (data != NULL)
+                g_atomic_int_inc (&priv->n_buffer_filling);
 
         return data;
 }
@@ -232,10 +247,8 @@ arv_stream_push_output_buffer (ArvStream *stream, ArvBuffer *buffer)
 	g_return_if_fail (ARV_IS_STREAM (stream));
 	g_return_if_fail (ARV_IS_BUFFER (buffer));
 
-        g_async_queue_lock (priv->output_queue);
-	g_async_queue_push_unlocked (priv->output_queue, buffer);
-        priv->n_buffer_filling--;
-        g_async_queue_unlock(priv->output_queue);
+	arv_queue_push (priv->output_queue, buffer);
+        g_atomic_int_add (&priv->n_buffer_filling, -1);
 
 	g_rec_mutex_lock (&priv->mutex);
 
@@ -252,7 +265,8 @@ arv_stream_push_output_buffer (ArvStream *stream, ArvBuffer *buffer)
  * @n_output_buffers: (out) (allow-none): output queue length
  * @n_buffer_filling: (out) (allow-none): number of buffer owned by the stream receiving thread
  *
- * An accessor to the number of buffer owned by the stream instance.
+ * An accessor to the number of buffer owned by the stream instance. The queues are not locked, and while the
+ * acquisition is running, the returned values are only a snapshot, which may be transiently inconsistent.
  *
  * Since: 0.10.0
  */
@@ -272,16 +286,12 @@ arv_stream_get_n_owned_buffers (ArvStream *stream, gint *n_input_buffers, gint *
 		return;
 	}
 
-        g_async_queue_lock (priv->input_queue);
-        g_async_queue_lock (priv->output_queue);
 	if (n_input_buffers != NULL)
-		*n_input_buffers = g_async_queue_length_unlocked (priv->input_queue);
+		*n_input_buffers = arv_queue_get_length (priv->input_queue);
 	if (n_output_buffers != NULL)
-		*n_output_buffers = g_async_queue_length_unlocked (priv->output_queue);
+		*n_output_buffers = arv_queue_get_length (priv->output_queue);
         if (n_buffer_filling != NULL)
-                *n_buffer_filling = priv->n_buffer_filling;
-        g_async_queue_unlock (priv->output_queue);
-        g_async_queue_unlock (priv->input_queue);
+                *n_buffer_filling = MAX (g_atomic_int_get (&priv->n_buffer_filling), 0);
 }
 
 /**
@@ -348,8 +358,9 @@ arv_stream_stop_acquisition (ArvStream *stream, GError **error)
 
 	success = stream_class->stop_acquisition (stream, error);
 
-        if (success && priv->n_buffer_filling != 0) {
-                g_critical ("Buffer filling count must be 0 after acquisition stop (was %d)", priv->n_buffer_filling);
+        if (success && g_atomic_int_get (&priv->n_buffer_filling) != 0) {
+                g_critical ("Buffer filling count must be 0 after acquisition stop (was %d)",
+                            g_atomic_int_get (&priv->n_buffer_filling));
         }
         if (!success)
                 arv_warning_stream ("Failed to stop stream acquisition ");
@@ -380,16 +391,13 @@ arv_stream_delete_buffers (ArvStream *stream)
 
         g_return_val_if_fail (ARV_IS_STREAM(stream), 0);
 
-	g_async_queue_lock (priv->input_queue);
-	g_async_queue_lock (priv->output_queue);
-
 	arv_info_stream ("[Stream::delete_buffers] Delete %d buffer[s] in input queue",
-                         g_async_queue_length_unlocked(priv->input_queue));
+                         arv_queue_get_length (priv->input_queue));
 	arv_info_stream ("[Stream::delete_buffers] Delete %d buffer[s] in output queue",
-                         g_async_queue_length_unlocked(priv->output_queue));
+                         arv_queue_get_length (priv->output_queue));
 
 	do {
-		buffer = g_async_queue_try_pop_unlocked (priv->input_queue);
+		buffer = arv_queue_try_pop (priv->input_queue);
 		if (ARV_IS_BUFFER(buffer)) {
 			g_object_unref (buffer);
 			n_deleted++;
@@ -397,16 +405,13 @@ arv_stream_delete_buffers (ArvStream *stream)
 	} while (buffer != NULL);
 
 	do {
-		buffer = g_async_queue_try_pop_unlocked (priv->output_queue);
+		buffer = arv_queue_try_pop (priv->output_queue);
 		if (ARV_IS_BUFFER(buffer)) {
 			g_object_unref (buffer);
 			n_deleted++;
 		}
 	} while (buffer != NULL);
 
-	g_async_queue_unlock (priv->output_queue);
-	g_async_queue_unlock (priv->input_queue);
-
 	return n_deleted;
 }
 
@@ -839,8 +844,8 @@ arv_stream_init (ArvStream *stream)
 {
 	ArvStreamPrivate *priv = arv_stream_get_instance_private (stream);
 
-	priv->input_queue = g_async_queue_new ();
-	priv->output_queue = g_async_queue_new ();
+	priv->input_queue = arv_queue_new ();
+	priv->output_queue = arv_queue_new ();
 
 	priv->emit_signals = FALSE;
 
@@ -862,8 +867,8 @@ arv_stream_finalize (GObject *object)
 
         arv_stream_delete_buffers (stream);
 
-	g_async_queue_unref (priv->input_queue);
-	g_async_queue_unref (priv->output_queue);
+	g_clear_pointer (&priv->input_queue, arv_queue_free);
+	g_clear_pointer (&priv->output_queue, arv_queue_free);
 
 	g_rec_mutex_clear (&priv->mutex);
 
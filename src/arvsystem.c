@@ -34,10 +34,13 @@
 #include <arvdevice.h>
 #include <arvdebugprivate.h>
 #include <string.h>
-#include <arvmisc.h>
+#include <arvmiscprivate.h>
 #include <arvdomimplementation.h>
 
-static GMutex arv_system_mutex;
+/* Device opening only needs a read access to the interface device lists, which allows to open several devices in
+ * parallel. The lists are only modified during arv_update_device_list. */
+
+static GRWLock arv_system_lock;
 
 /**
  * SECTION: arv
@@ -291,7 +294,7 @@ arv_update_device_list (void)
 {
 	unsigned int i;
 
-	g_mutex_lock (&arv_system_mutex);
+	g_rw_lock_writer_lock (&arv_system_lock);
 
 	for (i = 0; i < G_N_ELEMENTS (interfaces); i++) {
 		ArvInterface *interface;
@@ -302,7 +305,7 @@ arv_update_device_list (void)
 		}
 	}
 
-	g_mutex_unlock (&arv_system_mutex);
+	g_rw_lock_writer_unlock (&arv_system_lock);
 }
 
 /**
@@ -320,7 +323,7 @@ arv_get_n_devices (void)
 	unsigned int n_devices = 0;
 	unsigned int i;
 
-	g_mutex_lock (&arv_system_mutex);
+	g_rw_lock_reader_lock (&arv_system_lock);
 
 	for (i = 0; i < G_N_ELEMENTS (interfaces); i++) {
 		ArvInterface *interface;
@@ -331,7 +334,7 @@ arv_get_n_devices (void)
 		}
 	}
 
-	g_mutex_unlock (&arv_system_mutex);
+	g_rw_lock_reader_unlock (&arv_system_lock);
 
 	return n_devices;
 }
@@ -343,7 +346,7 @@ arv_get_info (unsigned int index, const char *get_info (ArvInterface *, guint))
 	unsigned int i;
 	const char *info;
 
-	g_mutex_lock (&arv_system_mutex);
+	g_rw_lock_reader_lock (&arv_system_lock);
 
 	for (i = 0; i < G_N_ELEMENTS (interfaces); i++) {
 		ArvInterface *interface;
@@ -356,7 +359,7 @@ arv_get_info (unsigned int index, const char *get_info (ArvInterface *, guint))
 			if (index - offset < n_devices) {
 				info = get_info (interface, index - offset);
 
-				g_mutex_unlock (&arv_system_mutex);
+				g_rw_lock_reader_unlock (&arv_system_lock);
 
 				return info;
 			}
@@ -365,7 +368,7 @@ arv_get_info (unsigned int index, const char *get_info (ArvInterface *, guint))
 		}
 	}
 
-	g_mutex_unlock (&arv_system_mutex);
+	g_rw_lock_reader_unlock (&arv_system_lock);
 
 	return NULL;
 }
@@ -542,7 +545,7 @@ arv_open_device (const char *device_id, GError **error)
 {
 	unsigned int i;
 
-	g_mutex_lock (&arv_system_mutex);
+	g_rw_lock_reader_lock (&arv_system_lock);
 
 	for (i = 0; i < G_N_ELEMENTS (interfaces); i++) {
 		ArvInterface *interface;
@@ -556,13 +559,13 @@ arv_open_device (const char *device_id, GError **error)
 			if (ARV_IS_DEVICE (device) || local_error != NULL) {
 				if (local_error != NULL)
 					g_propagate_error (error, local_error);
-				g_mutex_unlock (&arv_system_mutex);
+				g_rw_lock_reader_unlock (&arv_system_lock);
 				return device;
 			}
 		}
 	}
 
-	g_mutex_unlock (&arv_system_mutex);
+	g_rw_lock_reader_unlock (&arv_system_lock);
 
 	if (device_id != NULL)
 		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_NOT_FOUND,
@@ -574,6 +577,34 @@ arv_open_device (const char *device_id, GError **error)
 	return NULL;
 }
 
+static GObject *
+_open_device (const char *device_id, GError **error)
+{
+	return (GObject *) arv_open_device (device_id, error);
+}
+
+/**
+ * arv_open_devices:
+ * @device_ids: (array zero-terminated=1): a %NULL terminated list of device identifier strings
+ * @error: a #GError placeholder, %NULL to ignore
+ *
+ * Open the devices corresponding to the given identifiers. The devices are opened concurrently, which overlaps the
+ * discovery, the Genicam data download and parsing of each device. If any of the devices can't be opened, the
+ * already opened ones are released, and the error of the first failing identifier is returned.
+ *
+ * Return value: (transfer full) (element-type ArvDevice): an array of new #ArvDevice instances, in @device_ids order.
+ *
+ * Since: 0.10.0
+ */
+
+GPtrArray *
+arv_open_devices (const char **device_ids, GError **error)
+{
+	g_return_val_if_fail (device_ids != NULL, NULL);
+
+	return arv_open_in_parallel (device_ids, _open_device, error);
+}
+
 /**
  * arv_shutdown:
  *
@@ -587,12 +618,12 @@ arv_shutdown (void)
 {
 	unsigned int i;
 
-	g_mutex_lock (&arv_system_mutex);
+	g_rw_lock_writer_lock (&arv_system_lock);
 
 	for (i = 0; i < G_N_ELEMENTS (interfaces); i++)
 		interfaces[i].destroy_interface_instance ();
 
 	arv_dom_implementation_cleanup ();
 
-	g_mutex_unlock (&arv_system_mutex);
+	g_rw_lock_writer_unlock (&arv_system_lock);
 }
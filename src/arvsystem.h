@@ -54,6 +54,7 @@ ARV_API const char *	arv_get_device_serial_nbr	        (unsigned int index);
 ARV_API const char *	arv_get_device_protocol		        (unsigned int index);
 
 ARV_API ArvDevice *	arv_open_device			        (const char *device_id, GError **error);
+ARV_API GPtrArray *	arv_open_devices		        (const char **device_ids, GError **error);
 
 ARV_API void		arv_shutdown			        (void);
 
@@ -681,6 +681,8 @@ arv_tool_execute_command (int argc, char **argv, ArvDevice *device,
                         GRegex *regex;
 
                         regex = arv_regex_new_from_glob_pattern (argc == 3 ? argv[2] : "*", TRUE);
+                        /* Only effective with the register cache enabled */
+                        arv_device_prefetch_features (device, (const char *[]) {"Root", NULL}, NULL);
                         arv_tool_list_features (genicam, "Root", ARV_TOOL_LIST_MODE_VALUES, regex, 0);
                         g_regex_unref (regex);
                 }
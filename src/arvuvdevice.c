@@ -29,6 +29,7 @@
 #include <arvuvdeviceprivate.h>
 #include <arvuvinterfaceprivate.h>
 #include <arvuvcpprivate.h>
+#include <arvuvfaketransportprivate.h>
 #include <arvgc.h>
 #include <arvdebug.h>
 #include <arvenumtypes.h>
@@ -36,6 +37,7 @@
 #include <string.h>
 #include <arvstr.h>
 #include <arvzip.h>
+#include <arvgenicamcacheprivate.h>
 #include <arvmisc.h>
 
 enum
@@ -44,7 +46,8 @@ enum
 	PROP_UV_DEVICE_VENDOR,
 	PROP_UV_DEVICE_PRODUCT,
 	PROP_UV_DEVICE_SERIAL_NUMBER,
-	PROP_UV_DEVICE_GUID
+	PROP_UV_DEVICE_GUID,
+	PROP_UV_DEVICE_FAKE_TRANSPORT
 };
 
 #define ARV_UV_DEVICE_N_TRIES_MAX	5
@@ -63,6 +66,8 @@ typedef struct {
 
        	libusb_hotplug_callback_handle hotplug_cb_handle;
 
+	ArvUvFakeTransport *fake_transport;
+
 	ArvGc *genicam;
 
 	char *genicam_xml;
@@ -82,6 +87,7 @@ typedef struct {
 
 	ArvUvUsbMode usb_mode;
         guint64 maximum_transfer_size;
+        gboolean transfer_tuning;
 
 	int event_thread_run;
 	GThread* event_thread;
@@ -133,7 +139,8 @@ arv_uv_device_is_connected (ArvUvDevice *uv_device)
 {
         ArvUvDevicePrivate *priv = arv_uv_device_get_instance_private (uv_device);
 
-        return !priv->disconnected;
+        return !priv->disconnected &&
+                (priv->fake_transport == NULL || arv_uv_fake_transport_is_connected (priv->fake_transport));
 }
 
 void
@@ -181,8 +188,12 @@ arv_uv_device_bulk_transfer (ArvUvDevice *uv_device, ArvUvEndpointType endpoint_
 	} else {
 		endpoint = priv->data_endpoint;
 	}
-	result = libusb_bulk_transfer (priv->usb_device, endpoint, data, size, &transferred,
-				       timeout_ms > 0 ? timeout_ms : priv->timeout_ms);
+	if (priv->fake_transport != NULL)
+		result = arv_uv_fake_transport_bulk_transfer (priv->fake_transport, endpoint, data, size, &transferred,
+							      timeout_ms > 0 ? timeout_ms : priv->timeout_ms);
+	else
+		result = libusb_bulk_transfer (priv->usb_device, endpoint, data, size, &transferred,
+					       timeout_ms > 0 ? timeout_ms : priv->timeout_ms);
 
 	success = result >= 0;
 
@@ -203,11 +214,37 @@ arv_uv_device_bulk_transfer (ArvUvDevice *uv_device, ArvUvEndpointType endpoint_
 	return success;
 }
 
+int
+arv_uv_device_submit_transfer (ArvUvDevice *uv_device, struct libusb_transfer *transfer)
+{
+	ArvUvDevicePrivate *priv = arv_uv_device_get_instance_private (uv_device);
+
+        if (priv->fake_transport != NULL)
+                return arv_uv_fake_transport_submit_transfer (priv->fake_transport, transfer);
+
+        return libusb_submit_transfer (transfer);
+}
+
+int
+arv_uv_device_cancel_transfer (ArvUvDevice *uv_device, struct libusb_transfer *transfer)
+{
+	ArvUvDevicePrivate *priv = arv_uv_device_get_instance_private (uv_device);
+
+        if (priv->fake_transport != NULL)
+                return arv_uv_fake_transport_cancel_transfer (priv->fake_transport, transfer);
+
+        return libusb_cancel_transfer (transfer);
+}
+
 void *
 arv_uv_device_usb_mem_alloc (ArvUvDevice *uv_device, size_t size)
 {
 	ArvUvDevicePrivate *priv = arv_uv_device_get_instance_private (uv_device);
 
+        /* No device memory for the fake transport, the callers fall back to system memory */
+        if (priv->fake_transport != NULL)
+                return NULL;
+
         return libusb_dev_mem_alloc (priv->usb_device, size);
 }
 
@@ -216,6 +253,9 @@ arv_uv_device_usb_mem_free (ArvUvDevice *uv_device, void *data, size_t size)
 {
 	ArvUvDevicePrivate *priv = arv_uv_device_get_instance_private (uv_device);
 
+        if (priv->fake_transport != NULL)
+                return;
+
         libusb_dev_mem_free (priv->usb_device, data, size);
 }
 
@@ -224,7 +264,7 @@ arv_uv_device_create_stream (ArvDevice *device, ArvStreamCallback callback, void
 {
 	ArvUvDevicePrivate *priv = arv_uv_device_get_instance_private (ARV_UV_DEVICE (device));
 	return arv_uv_stream_new (ARV_UV_DEVICE (device), callback, user_data, destroy,
-                                  priv->usb_mode, priv->maximum_transfer_size, error);
+                                  priv->usb_mode, priv->maximum_transfer_size, priv->transfer_tuning, error);
 }
 
 static gboolean
@@ -434,6 +474,18 @@ _send_cmd_and_receive_ack (ArvUvDevice *uv_device, ArvUvcpCommand command,
 	return success;
 }
 
+/* Maximum data size of a single memory read command */
+
+guint32
+arv_uv_device_get_memory_data_size_max (ArvUvDevice *uv_device)
+{
+	ArvUvDevicePrivate *priv = arv_uv_device_get_instance_private (uv_device);
+
+	g_return_val_if_fail (ARV_IS_UV_DEVICE (uv_device), 0);
+
+	return priv->ack_packet_size_max - sizeof (ArvUvcpHeader);
+}
+
 static gboolean
 arv_uv_device_read_memory (ArvDevice *device, guint64 address, guint32 size, void *buffer, GError **error)
 {
@@ -520,18 +572,28 @@ _bootstrap (ArvUvDevice *uv_device)
 	GString *string;
 	void *data;
 	char manufacturer[64];
+	char model[64];
+	char device_version[64];
+	char *entry_digest;
+	char *cache_key;
 	gboolean success = TRUE;
         char *genicam_url = NULL;
 
 	arv_info_device ("Get genicam");
 
 	success = success && arv_device_read_memory(device, ARV_ABRM_MANUFACTURER_NAME, 64, &manufacturer, NULL);
+	success = success && arv_device_read_memory(device, ARV_ABRM_MODEL_NAME, 64, &model, NULL);
+	success = success && arv_device_read_memory(device, ARV_ABRM_DEVICE_VERSION, 64, &device_version, NULL);
 	if (!success) {
 		arv_warning_device ("[UvDevice::_bootstrap] Error during memory read");
 		return FALSE;
 	}
 	manufacturer[63] = 0;
+	model[63] = 0;
+	device_version[63] = 0;
 	arv_info_device ("MANUFACTURER_NAME =        '%s'", manufacturer);
+	arv_info_device ("MODEL_NAME =               '%s'", model);
+	arv_info_device ("DEVICE_VERSION =           '%s'", device_version);
 
 	success = success && arv_device_read_memory (device, ARV_ABRM_SBRM_ADDRESS,
                                                      sizeof (offset), &offset, NULL);
@@ -632,83 +694,80 @@ _bootstrap (ArvUvDevice *uv_device)
 	arv_info_device ("genicam address =          0x%016" G_GINT64_MODIFIER "x", entry.address);
 	arv_info_device ("genicam size    =          0x%016" G_GINT64_MODIFIER "x", entry.size);
 
-	data = g_malloc0 (entry.size);
-	success = success && arv_device_read_memory (device, entry.address, entry.size, data, NULL);
-	if (!success){
-		arv_warning_device ("[UvDevice::_bootstrap] Error during memory read");
-		g_free(data);
-		return FALSE;
+	schema_type = arv_uvcp_manifest_entry_get_schema_type (&entry);
+
+	switch (schema_type) {
+		case ARV_UVCP_SCHEMA_ZIP:
+		case ARV_UVCP_SCHEMA_RAW:
+			break;
+		default:
+			arv_warning_device ("Unknown USB3Vision manifest schema type (%d)", schema_type);
+			return TRUE;
 	}
 
+	/* The manifest entry includes the file version, location and checksum */
+	entry_digest = g_compute_checksum_for_data (G_CHECKSUM_SHA1, (const guchar *) &entry, sizeof (entry));
+	cache_key = arv_genicam_cache_compute_key ("USB3Vision", manufacturer, model, device_version, entry_digest,
+						   NULL);
+	g_free (entry_digest);
+
+	priv->genicam_xml = arv_genicam_cache_load (cache_key, &priv->genicam_xml_size);
+
+	if (priv->genicam_xml == NULL) {
+		data = g_malloc0 (entry.size);
+		success = success && arv_device_read_memory (device, entry.address, entry.size, data, NULL);
+		if (!success){
+			arv_warning_device ("[UvDevice::_bootstrap] Error during memory read");
+			g_free (data);
+			g_free (cache_key);
+			return FALSE;
+		}
+
 #if 0
-	string = g_string_new ("");
-	arv_g_string_append_hex_dump (string, data, entry.size);
-	arv_info_device ("GENICAM\n%s", string->str);
-	g_string_free (string, TRUE);
+		string = g_string_new ("");
+		arv_g_string_append_hex_dump (string, data, entry.size);
+		arv_info_device ("GENICAM\n%s", string->str);
+		g_string_free (string, TRUE);
 #endif
 
-	schema_type = arv_uvcp_manifest_entry_get_schema_type (&entry);
+		if (schema_type == ARV_UVCP_SCHEMA_ZIP) {
+			ArvZip *zip;
+			const GSList *zip_files;
 
-	switch (schema_type) {
-		case ARV_UVCP_SCHEMA_ZIP:
-			{
-				ArvZip *zip;
-				const GSList *zip_files;
+			zip = arv_zip_new (data, entry.size);
+			zip_files = arv_zip_get_file_list (zip);
 
-				zip = arv_zip_new (data, entry.size);
-				zip_files = arv_zip_get_file_list (zip);
+			if (zip_files != NULL) {
+				const char *zip_filename;
 
-				if (zip_files != NULL) {
-					const char *zip_filename;
+				zip_filename = arv_zip_file_get_name (zip_files->data);
+				priv->genicam_xml = arv_zip_get_file (zip, zip_filename, &priv->genicam_xml_size);
 
-					zip_filename = arv_zip_file_get_name (zip_files->data);
-                                        priv->genicam_xml = arv_zip_get_file (zip,
-                                                                              zip_filename,
-                                                                              &priv->genicam_xml_size);
+				arv_info_device ("zip file =                 %s", zip_filename);
+			}
 
-					arv_info_device ("zip file =                 %s", zip_filename);
+			arv_zip_free (zip);
+			g_free (data);
+		} else {
+			priv->genicam_xml = data;
+			priv->genicam_xml_size = entry.size;
+		}
 
-#if 0
-					string = g_string_new ("");
-					arv_g_string_append_hex_dump (string, priv->genicam_xml,
-								      priv->genicam_xml_size);
-					arv_info_device ("GENICAM\n%s", string->str);
-					g_string_free (string, TRUE);
-#endif
+		if (priv->genicam_xml != NULL)
+			arv_genicam_cache_save (cache_key, priv->genicam_xml, priv->genicam_xml_size);
+	}
 
-					priv->genicam = arv_gc_new (ARV_DEVICE (uv_device),
-								    priv->genicam_xml,
-								    priv->genicam_xml_size);
+	g_free (cache_key);
 
-                                        genicam_url = g_strdup_printf("local:///DeviceU3V.zip;%"
-                                                                      G_GINT64_MODIFIER "x;%" G_GINT64_MODIFIER "x",
-                                                                      entry.address, entry.size);
-                                        arv_dom_document_set_url(ARV_DOM_DOCUMENT(priv->genicam), genicam_url);
-                                        g_free (genicam_url);
-				}
+	if (priv->genicam_xml != NULL) {
+		priv->genicam = arv_gc_new (ARV_DEVICE (uv_device), priv->genicam_xml, priv->genicam_xml_size);
 
-				arv_zip_free (zip);
-				g_free (data);
-			}
-			break;
-		case ARV_UVCP_SCHEMA_RAW:
-			{
-				priv->genicam_xml = data;
-				priv->genicam_xml_size = entry.size;
-				priv->genicam = arv_gc_new (ARV_DEVICE (uv_device),
-							    priv->genicam_xml,
-							    priv->genicam_xml_size);
-                                genicam_url =
-                                        g_strdup_printf("local:///DeviceU3V.xml;%" G_GINT64_MODIFIER "x;%"
-                                                        G_GINT64_MODIFIER "x",
-                                                        entry.address, entry.size);
-                                arv_dom_document_set_url(ARV_DOM_DOCUMENT(priv->genicam), genicam_url);
-                                g_free (genicam_url);
-                        }
-                        break;
-                default:
-                        arv_warning_device ("Unknown USB3Vision manifest schema type (%d)", schema_type);
-        }
+		genicam_url = g_strdup_printf ("local:///DeviceU3V.%s;%" G_GINT64_MODIFIER "x;%" G_GINT64_MODIFIER "x",
+					       schema_type == ARV_UVCP_SCHEMA_ZIP ? "zip" : "xml",
+					       entry.address, entry.size);
+		arv_dom_document_set_url (ARV_DOM_DOCUMENT (priv->genicam), genicam_url);
+		g_free (genicam_url);
+	}
 
 #if 0
 	arv_info_device("GENICAM\n:%s", priv->genicam_xml);
@@ -771,7 +830,10 @@ arv_uv_device_reset_stream_endpoint (ArvUvDevice *device)
 
         g_return_val_if_fail(ARV_IS_UV_DEVICE(device), FALSE);
 
-        reset_endpoint (priv->usb_device, priv->data_endpoint);
+        if (priv->fake_transport != NULL)
+                arv_uv_fake_transport_reset_stream (priv->fake_transport);
+        else
+                reset_endpoint (priv->usb_device, priv->data_endpoint);
 
         return TRUE;
 }
@@ -994,6 +1056,29 @@ arv_uv_device_set_maximum_transfer_size (ArvUvDevice *uv_device, guint64 size)
 
 	priv->maximum_transfer_size = size;
 }
+
+/**
+ * arv_uv_device_set_transfer_tuning:
+ * @uv_device: a #ArvUvDevice
+ * @enable: enable transfer tuning
+ *
+ * Enables the runtime adjustment of the USB bulk transfer size and of the number of queued transfers, based on the
+ * measured transfer latencies. The maximum transfer size set using [method@Aravis.UvDevice.set_maximum_transfer_size]
+ * is used as the upper limit. The chosen values and the transfer latency histogram are available as stream
+ * informations. It only applies to the @ARV_UV_USB_MODE_ASYNC mode, and to the streams created afterwards.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_uv_device_set_transfer_tuning (ArvUvDevice *uv_device, gboolean enable)
+{
+	ArvUvDevicePrivate *priv = arv_uv_device_get_instance_private (uv_device);
+
+	g_return_if_fail (ARV_IS_UV_DEVICE (uv_device));
+
+	priv->transfer_tuning = enable;
+}
 /**
  * arv_uv_device_new:
  * @vendor: USB3 vendor string
@@ -1034,6 +1119,19 @@ arv_uv_device_new_from_guid (const char *guid, GError **error)
 			       NULL);
 }
 
+/* Creates a device communicating with a simulated device instead of a USB device, for testing purposes. The device
+ * takes the ownership of the transport. */
+
+ArvDevice *
+arv_uv_device_new_with_fake_transport (ArvUvFakeTransport *transport, GError **error)
+{
+	g_return_val_if_fail (transport != NULL, NULL);
+
+	return g_initable_new (ARV_TYPE_UV_DEVICE, NULL, error,
+			       "fake-transport", transport,
+			       NULL);
+}
+
 static int LIBUSB_CALL _disconnect_event (libusb_context *ctx,
                               libusb_device *device,
                               libusb_hotplug_event event,
@@ -1063,6 +1161,47 @@ arv_uv_device_constructed (GObject *object)
 
         g_mutex_init (&priv->transfer_mutex);
 
+        if (priv->fake_transport != NULL) {
+                g_clear_pointer (&priv->vendor, g_free);
+                g_clear_pointer (&priv->product, g_free);
+                g_clear_pointer (&priv->serial_number, g_free);
+                priv->vendor = g_strdup ("Aravis");
+                priv->product = g_strdup ("Fake USB3Vision device");
+                priv->serial_number = g_strdup (arv_uv_fake_transport_get_serial_number (priv->fake_transport));
+
+                arv_info_device ("[UvDevice::new] Fake transport, S/N = %s", priv->serial_number);
+
+                priv->control_endpoint_out = ARV_UV_FAKE_TRANSPORT_CONTROL_ENDPOINT_OUT;
+                priv->control_endpoint_in = ARV_UV_FAKE_TRANSPORT_CONTROL_ENDPOINT_IN;
+                priv->data_endpoint = ARV_UV_FAKE_TRANSPORT_DATA_ENDPOINT;
+                priv->usb_major_version = 3;
+
+                priv->packet_id = 65300;
+                priv->timeout_ms = 32;
+
+                if (!_bootstrap (uv_device)) {
+                        arv_device_take_init_error (ARV_DEVICE (uv_device),
+                                                    g_error_new (ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_PROTOCOL_ERROR,
+                                                                 "Failed to bootstrap fake USB device '%s'",
+                                                                 priv->serial_number));
+                        return;
+                }
+
+                if (!ARV_IS_GC (priv->genicam)) {
+                        arv_device_take_init_error (ARV_DEVICE (uv_device),
+                                                    g_error_new (ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_GENICAM_NOT_FOUND,
+                                                                 "Failed to load Genicam data for fake USB device '%s'",
+                                                                 priv->serial_number));
+                        return;
+                }
+
+                /* The transfers are completed by the fake transport, there is no libusb event to handle */
+                priv->usb_mode = ARV_UV_USB_MODE_DEFAULT;
+                priv->maximum_transfer_size = ARV_UV_STREAM_MAXIMUM_TRANSFER_SIZE_DEFAULT;
+
+                return;
+        }
+
 	result = libusb_init (&priv->usb);
         if (result != 0) {
                 arv_device_take_init_error (ARV_DEVICE (uv_device),
@@ -1169,12 +1308,15 @@ arv_uv_device_finalize (GObject *object)
 
 	ArvUvDevicePrivate *priv = arv_uv_device_get_instance_private (uv_device);
 
-        libusb_hotplug_deregister_callback (priv->usb, priv->hotplug_cb_handle);
+        if (priv->usb != NULL)
+                libusb_hotplug_deregister_callback (priv->usb, priv->hotplug_cb_handle);
 
 	priv->event_thread_run = 0;
         if (priv->event_thread)
                 g_thread_join (priv->event_thread);
 
+        g_clear_pointer (&priv->fake_transport, arv_uv_fake_transport_free);
+
 	g_clear_object (&priv->genicam);
 
 	g_clear_pointer (&priv->vendor, g_free);
@@ -1217,6 +1359,9 @@ arv_uv_device_set_property (GObject *self, guint prop_id, const GValue *value, G
 			g_free (priv->guid);
 			priv->guid = g_value_dup_string (value);
 			break;
+		case PROP_UV_DEVICE_FAKE_TRANSPORT:
+			priv->fake_transport = g_value_get_pointer (value);
+			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (self, prop_id, pspec);
 			break;
@@ -1273,4 +1418,11 @@ arv_uv_device_class_init (ArvUvDeviceClass *uv_device_class)
 				      "USB3 device GUID",
 				      NULL,
 				      G_PARAM_WRITABLE | G_PARAM_CONSTRUCT_ONLY));
+	g_object_class_install_property
+		(object_class,
+		 PROP_UV_DEVICE_FAKE_TRANSPORT,
+		 g_param_spec_pointer ("fake-transport",
+				       "Fake transport",
+				       "Simulated USB3 device",
+				       G_PARAM_WRITABLE | G_PARAM_CONSTRUCT_ONLY));
 }
@@ -42,6 +42,7 @@ ARV_API ArvDevice * 	arv_uv_device_new_from_guid	(const char *guid, GError **err
 
 ARV_API void 		arv_uv_device_set_usb_mode	        (ArvUvDevice *uv_device, ArvUvUsbMode usb_mode);
 ARV_API void            arv_uv_device_set_maximum_transfer_size (ArvUvDevice *uv_device, guint64 size);
+ARV_API void            arv_uv_device_set_transfer_tuning       (ArvUvDevice *uv_device, gboolean enable);
 
 G_END_DECLS
 
@@ -0,0 +1,1076 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+/*< private >
+ * SECTION:arvuvfaketransport
+ * @title: ArvUvFakeTransport
+ * @short_description: in process USB3Vision device simulation
+ *
+ * #ArvUvFakeTransport replaces the libusb device of an #ArvUvDevice by a USB3Vision device simulated on top of an
+ * #ArvFakeCamera. It answers the UVCP memory read and write commands sent on the control endpoint, and sends the
+ * UVSP leader, payload and trailer of the generated frames on the data endpoint, either through the synchronous bulk
+ * transfers, or through the asynchronous transfers submitted by the stream thread, which are completed from an
+ * internal thread as the libusb event thread would do.
+ *
+ * The bootstrap registers of the fake camera are a GigE Vision bootstrap register map, which overlaps the
+ * USB3Vision one. Only the accesses starting at the address of a technology agnostic bootstrap register used by
+ * #ArvUvDevice are answered by the transport, the other ones are forwarded to the fake camera. The streaming
+ * bootstrap registers, the streaming interface registers and the manifest table are located above the 32 bit
+ * address space of the fake camera, and the manifest points to its Genicam data.
+ *
+ * The data endpoint is a byte stream. A transfer ends when it is full, or at the end of the leader, of the payload or
+ * of the trailer of a frame, like a short packet would do on a real device. The link bandwidth, a fixed transfer
+ * latency and a transfer error rate can be set for testing and benchmarking purposes. A failed transfer still
+ * consumes the data it should have received.
+ */
+
+#include <arvuvfaketransportprivate.h>
+#include <arvuvcpprivate.h>
+#include <arvuvspprivate.h>
+#include <arvbufferprivate.h>
+#include <arvfakecamera.h>
+#include <arvversion.h>
+#include <arvdebug.h>
+#include <string.h>
+
+#define ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_ADDRESS		G_GUINT64_CONSTANT (0x100000000)
+#define ARV_UV_FAKE_TRANSPORT_SBRM_OFFSET		0x000
+#define ARV_UV_FAKE_TRANSPORT_SIRM_OFFSET		0x100
+#define ARV_UV_FAKE_TRANSPORT_SIRM_SIZE			0x030
+#define ARV_UV_FAKE_TRANSPORT_MANIFEST_OFFSET		0x200
+#define ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_SIZE		0x300
+#define ARV_UV_FAKE_TRANSPORT_ABRM_SIZE			ARV_ABRM_DEVICE_CONFIGURATION
+
+#define ARV_UV_FAKE_TRANSPORT_MAX_TRANSFER_SIZE		1024
+#define ARV_UV_FAKE_TRANSPORT_RESPONSE_TIME_MS		200
+#define ARV_UV_FAKE_TRANSPORT_ALIGNMENT_SHIFT		3
+#define ARV_UV_FAKE_TRANSPORT_N_FRAMES_MAX		4
+#define ARV_UV_FAKE_TRANSPORT_POLL_PERIOD_US		100000
+#define ARV_UV_FAKE_TRANSPORT_RANDOM_SEED		1234
+
+typedef enum {
+	ARV_UV_FAKE_TRANSPORT_SEGMENT_LEADER,
+	ARV_UV_FAKE_TRANSPORT_SEGMENT_PAYLOAD,
+	ARV_UV_FAKE_TRANSPORT_SEGMENT_TRAILER,
+	ARV_UV_FAKE_TRANSPORT_SEGMENT_END
+} ArvUvFakeTransportSegment;
+
+typedef struct {
+	ArvUvspLeader leader;
+	ArvUvspTrailer trailer;
+	ArvBuffer *buffer;
+
+	size_t leader_size;
+	size_t payload_size;
+	size_t trailer_size;
+
+	ArvUvFakeTransportSegment segment;
+	size_t offset;
+} ArvUvFakeTransportFrame;
+
+typedef struct {
+	struct libusb_transfer *transfer;
+	gboolean is_started;
+	gboolean is_cancelled;
+	enum libusb_transfer_status status;
+	gint64 completion_time_us;
+} ArvUvFakeTransportTransfer;
+
+struct _ArvUvFakeTransport {
+	ArvFakeCamera *camera;
+	char *serial_number;
+	size_t genicam_xml_size;
+
+	guint8 abrm[ARV_UV_FAKE_TRANSPORT_ABRM_SIZE];
+	guint8 bootstrap[ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_SIZE];
+
+	GMutex mutex;
+	GCond cond;
+	GCond frame_cond;
+
+	gboolean is_connected;
+	gboolean cancel;
+
+	guint64 bandwidth;
+	guint64 latency_us;
+	double error_rate;
+	GRand *rand;
+
+	guint8 ack[ARV_UV_FAKE_TRANSPORT_MAX_TRANSFER_SIZE];
+	size_t ack_size;
+	gint64 ack_time_us;
+
+	GQueue *frames;
+	GQueue *transfers;
+	gint64 link_available_time_us;
+
+	guint64 n_frames;
+	guint64 n_dropped_frames;
+	guint64 n_transfer_errors;
+
+	GThread *frame_thread;
+	GThread *transfer_thread;
+};
+
+static const guint32 arv_uv_fake_transport_abrm_registers[] = {
+	ARV_ABRM_GENCP_VERSION,
+	ARV_ABRM_MANUFACTURER_NAME,
+	ARV_ABRM_MODEL_NAME,
+	ARV_ABRM_FAMILY_NAME,
+	ARV_ABRM_DEVICE_VERSION,
+	ARV_ABRM_SERIAL_NUMBER,
+	ARV_ABRM_DEVICE_CAPABILITY,
+	ARV_ABRM_MAX_DEVICE_RESPONSE_TIME,
+	ARV_ABRM_MANIFEST_TABLE_ADDRESS,
+	ARV_ABRM_SBRM_ADDRESS
+};
+
+static void
+_set_uint32 (guint8 *memory, guint32 offset, guint32 value)
+{
+	value = GUINT32_TO_LE (value);
+	memcpy (memory + offset, &value, sizeof (value));
+}
+
+static void
+_set_uint64 (guint8 *memory, guint32 offset, guint64 value)
+{
+	value = GUINT64_TO_LE (value);
+	memcpy (memory + offset, &value, sizeof (value));
+}
+
+static guint32
+_get_uint32 (const guint8 *memory, guint32 offset)
+{
+	guint32 value;
+
+	memcpy (&value, memory + offset, sizeof (value));
+
+	return GUINT32_FROM_LE (value);
+}
+
+static void
+_set_string (guint8 *memory, guint32 offset, const char *string)
+{
+	g_strlcpy ((char *) memory + offset, string, 64);
+}
+
+static void
+_init_registers (ArvUvFakeTransport *transport)
+{
+	ArvUvcpManifestEntry entry = {0};
+	guint32 sbrm = ARV_UV_FAKE_TRANSPORT_SBRM_OFFSET;
+	guint32 sirm = ARV_UV_FAKE_TRANSPORT_SIRM_OFFSET;
+	guint32 manifest = ARV_UV_FAKE_TRANSPORT_MANIFEST_OFFSET;
+
+	_set_uint32 (transport->abrm, ARV_ABRM_GENCP_VERSION, 0x00010000);
+	_set_string (transport->abrm, ARV_ABRM_MANUFACTURER_NAME, "Aravis");
+	_set_string (transport->abrm, ARV_ABRM_MODEL_NAME, "FakeU3V");
+	_set_string (transport->abrm, ARV_ABRM_FAMILY_NAME, "Aravis");
+	_set_string (transport->abrm, ARV_ABRM_DEVICE_VERSION, ARAVIS_VERSION);
+	_set_string (transport->abrm, ARV_ABRM_SERIAL_NUMBER, transport->serial_number);
+	_set_uint64 (transport->abrm, ARV_ABRM_DEVICE_CAPABILITY, 0);
+	_set_uint32 (transport->abrm, ARV_ABRM_MAX_DEVICE_RESPONSE_TIME, ARV_UV_FAKE_TRANSPORT_RESPONSE_TIME_MS);
+	_set_uint64 (transport->abrm, ARV_ABRM_MANIFEST_TABLE_ADDRESS,
+		     ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_ADDRESS + manifest);
+	_set_uint64 (transport->abrm, ARV_ABRM_SBRM_ADDRESS, ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_ADDRESS + sbrm);
+
+	_set_uint32 (transport->bootstrap, sbrm + ARV_SBRM_U3V_VERSION, 0x00010000);
+	_set_uint64 (transport->bootstrap, sbrm + ARV_SBRM_U3VCP_CAPABILITY, 0);
+	_set_uint32 (transport->bootstrap, sbrm + ARV_SBRM_MAX_CMD_TRANSFER, ARV_UV_FAKE_TRANSPORT_MAX_TRANSFER_SIZE);
+	_set_uint32 (transport->bootstrap, sbrm + ARV_SBRM_MAX_ACK_TRANSFER, ARV_UV_FAKE_TRANSPORT_MAX_TRANSFER_SIZE);
+	_set_uint32 (transport->bootstrap, sbrm + ARV_SBRM_NUM_STREAM_CHANNELS, 1);
+	_set_uint64 (transport->bootstrap, sbrm + ARV_SBRM_SIRM_ADDRESS, ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_ADDRESS + sirm);
+	_set_uint32 (transport->bootstrap, sbrm + ARV_SBRM_SIRM_LENGTH, ARV_UV_FAKE_TRANSPORT_SIRM_SIZE);
+
+	_set_uint32 (transport->bootstrap, sirm + ARV_SIRM_INFO,
+		     ARV_UV_FAKE_TRANSPORT_ALIGNMENT_SHIFT << ARV_SIRM_INFO_ALIGNMENT_SHIFT);
+	_set_uint32 (transport->bootstrap, sirm + ARV_SIRM_REQ_LEADER_SIZE, sizeof (ArvUvspLeader));
+	_set_uint32 (transport->bootstrap, sirm + ARV_SIRM_REQ_TRAILER_SIZE, sizeof (ArvUvspTrailer));
+
+	/* A single uncompressed Genicam file, the fake camera data located after its register memory */
+	entry.file_version_major = 1;
+	entry.schema = GUINT32_TO_LE (ARV_UVCP_SCHEMA_RAW << 10);
+	entry.address = GUINT64_TO_LE (ARV_FAKE_CAMERA_MEMORY_SIZE);
+	entry.size = GUINT64_TO_LE (transport->genicam_xml_size);
+
+	_set_uint64 (transport->bootstrap, manifest, 1);
+	memcpy (transport->bootstrap + manifest + 0x08, &entry, sizeof (entry));
+}
+
+static gboolean
+_is_stream_enabled (ArvUvFakeTransport *transport)
+{
+	return (_get_uint32 (transport->bootstrap, ARV_UV_FAKE_TRANSPORT_SIRM_OFFSET + ARV_SIRM_CONTROL) &
+		ARV_SIRM_CONTROL_STREAM_ENABLE) != 0;
+}
+
+static gboolean
+_is_abrm_register (guint64 address)
+{
+	unsigned int i;
+
+	for (i = 0; i < G_N_ELEMENTS (arv_uv_fake_transport_abrm_registers); i++)
+		if (arv_uv_fake_transport_abrm_registers[i] == address)
+			return TRUE;
+
+	return FALSE;
+}
+
+static void
+_frame_free (gpointer data)
+{
+	ArvUvFakeTransportFrame *frame = data;
+
+	g_clear_object (&frame->buffer);
+	g_free (frame);
+}
+
+static void
+_flush_frames (ArvUvFakeTransport *transport)
+{
+	ArvUvFakeTransportFrame *frame;
+
+	while ((frame = g_queue_pop_head (transport->frames)) != NULL)
+		_frame_free (frame);
+}
+
+static ArvUvcpStatus
+_read_memory (ArvUvFakeTransport *transport, guint64 address, guint32 size, void *data)
+{
+	if (address >= ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_ADDRESS) {
+		guint64 offset = address - ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_ADDRESS;
+
+		if (offset + size > ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_SIZE)
+			return ARV_UVCP_STATUS_INVALID_ADDRESS;
+
+		_set_uint64 (transport->bootstrap, ARV_UV_FAKE_TRANSPORT_SIRM_OFFSET + ARV_SIRM_REQ_PAYLOAD_SIZE,
+			     arv_fake_camera_get_payload (transport->camera));
+
+		memcpy (data, transport->bootstrap + offset, size);
+
+		return ARV_UVCP_STATUS_SUCCESS;
+	}
+
+	if (_is_abrm_register (address) && address + size <= ARV_UV_FAKE_TRANSPORT_ABRM_SIZE) {
+		memcpy (data, transport->abrm + address, size);
+
+		return ARV_UVCP_STATUS_SUCCESS;
+	}
+
+	if (address + size > ARV_FAKE_CAMERA_MEMORY_SIZE + transport->genicam_xml_size)
+		return ARV_UVCP_STATUS_INVALID_ADDRESS;
+
+	arv_fake_camera_read_memory (transport->camera, address, size, data);
+
+	return ARV_UVCP_STATUS_SUCCESS;
+}
+
+static ArvUvcpStatus
+_write_memory (ArvUvFakeTransport *transport, guint64 address, guint32 size, const void *data)
+{
+	if (address >= ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_ADDRESS) {
+		guint64 offset = address - ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_ADDRESS;
+		guint64 sirm = ARV_UV_FAKE_TRANSPORT_SIRM_OFFSET;
+
+		/* Only the streaming interface control and transfer size registers are writable */
+		if ((offset < sirm + ARV_SIRM_CONTROL || offset + size > sirm + ARV_SIRM_REQ_PAYLOAD_SIZE) &&
+		    (offset < sirm + ARV_SIRM_MAX_LEADER_SIZE || offset + size > sirm + ARV_UV_FAKE_TRANSPORT_SIRM_SIZE))
+			return offset + size > ARV_UV_FAKE_TRANSPORT_BOOTSTRAP_SIZE ?
+				ARV_UVCP_STATUS_INVALID_ADDRESS : ARV_UVCP_STATUS_WRITE_PROTECT;
+
+		memcpy (transport->bootstrap + offset, data, size);
+
+		if (!_is_stream_enabled (transport))
+			_flush_frames (transport);
+
+		return ARV_UVCP_STATUS_SUCCESS;
+	}
+
+	if (_is_abrm_register (address))
+		return ARV_UVCP_STATUS_WRITE_PROTECT;
+
+	if (address + size > ARV_FAKE_CAMERA_MEMORY_SIZE)
+		return address + size > ARV_FAKE_CAMERA_MEMORY_SIZE + transport->genicam_xml_size ?
+			ARV_UVCP_STATUS_INVALID_ADDRESS : ARV_UVCP_STATUS_WRITE_PROTECT;
+
+	arv_fake_camera_write_memory (transport->camera, address, size, data);
+
+	return ARV_UVCP_STATUS_SUCCESS;
+}
+
+/* Control endpoint */
+
+static int
+_handle_command (ArvUvFakeTransport *transport, const void *data, int length)
+{
+	const ArvUvcpPacket *packet = data;
+	ArvUvcpPacket *ack = (ArvUvcpPacket *) transport->ack;
+	ArvUvcpCommand command;
+	ArvUvcpCommand ack_command;
+	ArvUvcpStatus status;
+	guint16 ack_data_size = 0;
+
+	if (length < sizeof (ArvUvcpHeader) ||
+	    GUINT32_FROM_LE (packet->header.magic) != ARV_UVCP_MAGIC ||
+	    length < sizeof (ArvUvcpHeader) + GUINT16_FROM_LE (packet->header.size)) {
+		arv_warning_device ("[UvFakeTransport::handle_command] Invalid command packet");
+		return LIBUSB_SUCCESS;
+	}
+
+	command = arv_uvcp_packet_get_command (packet);
+
+	switch (command) {
+		case ARV_UVCP_COMMAND_READ_MEMORY_CMD:
+			{
+				const ArvUvcpReadMemoryCmd *cmd = data;
+				guint16 size = GUINT16_FROM_LE (cmd->infos.size);
+
+				ack_command = ARV_UVCP_COMMAND_READ_MEMORY_ACK;
+				if (length < sizeof (ArvUvcpReadMemoryCmd) || size < 1 ||
+				    arv_uvcp_packet_get_read_memory_ack_size (size) > sizeof (transport->ack))
+					status = ARV_UVCP_STATUS_INVALID_PARAMETER;
+				else
+					status = _read_memory (transport, GUINT64_FROM_LE (cmd->infos.address), size,
+							       arv_uvcp_packet_get_read_memory_ack_data (ack));
+				if (status == ARV_UVCP_STATUS_SUCCESS)
+					ack_data_size = size;
+			}
+			break;
+		case ARV_UVCP_COMMAND_WRITE_MEMORY_CMD:
+			{
+				const ArvUvcpWriteMemoryCmd *cmd = data;
+				ArvUvcpWriteMemoryAck *write_ack = (ArvUvcpWriteMemoryAck *) ack;
+				guint16 size = GUINT16_FROM_LE (packet->header.size);
+
+				ack_command = ARV_UVCP_COMMAND_WRITE_MEMORY_ACK;
+				if (size <= sizeof (ArvUvcpWriteMemoryCmdInfos)) {
+					status = ARV_UVCP_STATUS_INVALID_PARAMETER;
+					size = 0;
+				} else {
+					size -= sizeof (ArvUvcpWriteMemoryCmdInfos);
+					status = _write_memory (transport, GUINT64_FROM_LE (cmd->infos.address), size,
+								arv_uvcp_packet_get_write_memory_cmd_data (packet));
+				}
+				write_ack->infos.unknown = 0;
+				write_ack->infos.bytes_written = GUINT16_TO_LE (status == ARV_UVCP_STATUS_SUCCESS ? size : 0);
+				ack_data_size = sizeof (ArvUvcpWriteMemoryAckInfos);
+			}
+			break;
+		default:
+			ack_command = command + 1;
+			status = ARV_UVCP_STATUS_NOT_IMPLEMENTED;
+			break;
+	}
+
+	ack->header.magic = GUINT32_TO_LE (ARV_UVCP_MAGIC);
+	ack->header.status = GUINT16_TO_LE (status);
+	ack->header.command = GUINT16_TO_LE (ack_command);
+	ack->header.size = GUINT16_TO_LE (ack_data_size);
+	ack->header.id = packet->header.id;
+
+	transport->ack_size = sizeof (ArvUvcpHeader) + ack_data_size;
+	transport->ack_time_us = g_get_monotonic_time () + transport->latency_us;
+
+	g_cond_broadcast (&transport->cond);
+
+	return LIBUSB_SUCCESS;
+}
+
+static int
+_receive_ack (ArvUvFakeTransport *transport, void *data, int length, int *transferred, gint64 end_time)
+{
+	size_t size;
+
+	while (transport->is_connected &&
+	       (transport->ack_size == 0 || g_get_monotonic_time () < transport->ack_time_us)) {
+		if (g_get_monotonic_time () >= end_time)
+			return LIBUSB_ERROR_TIMEOUT;
+		g_cond_wait_until (&transport->cond, &transport->mutex,
+				   transport->ack_size == 0 ? end_time : MIN (end_time, transport->ack_time_us));
+	}
+
+	if (!transport->is_connected)
+		return LIBUSB_ERROR_NO_DEVICE;
+
+	size = MIN (length, transport->ack_size);
+	memcpy (data, transport->ack, size);
+	*transferred = size;
+
+	if (size < transport->ack_size) {
+		transport->ack_size = 0;
+		return LIBUSB_ERROR_OVERFLOW;
+	}
+
+	transport->ack_size = 0;
+
+	return LIBUSB_SUCCESS;
+}
+
+/* Data endpoint */
+
+static void
+_push_frame (ArvUvFakeTransport *transport)
+{
+	ArvUvFakeTransportFrame *frame;
+	ArvBufferPartInfos *part;
+	guint32 max_leader_size;
+	guint32 max_trailer_size;
+	size_t payload;
+
+	/* Like a device without any room left in its frame memory */
+	if (g_queue_get_length (transport->frames) >= ARV_UV_FAKE_TRANSPORT_N_FRAMES_MAX) {
+		transport->n_dropped_frames++;
+		return;
+	}
+
+	payload = arv_fake_camera_get_payload (transport->camera);
+
+	frame = g_new0 (ArvUvFakeTransportFrame, 1);
+	frame->buffer = arv_buffer_new (payload, NULL);
+	arv_fake_camera_fill_buffer (transport->camera, frame->buffer, NULL);
+
+	part = &frame->buffer->priv->parts[0];
+
+	frame->leader.header.magic = GUINT32_TO_LE (ARV_UVSP_LEADER_MAGIC);
+	frame->leader.header.size = GUINT16_TO_LE (sizeof (ArvUvspLeader));
+	frame->leader.header.frame_id = GUINT64_TO_LE (frame->buffer->priv->frame_id);
+	frame->leader.infos.payload_type = GUINT16_TO_LE (ARV_UVSP_PAYLOAD_TYPE_IMAGE);
+	frame->leader.infos.timestamp = GUINT64_TO_LE (frame->buffer->priv->timestamp_ns);
+	frame->leader.infos.pixel_format = GUINT32_TO_LE (part->pixel_format);
+	frame->leader.infos.width = GUINT32_TO_LE (part->width);
+	frame->leader.infos.height = GUINT32_TO_LE (part->height);
+	frame->leader.infos.x_offset = GUINT32_TO_LE (part->x_offset);
+	frame->leader.infos.y_offset = GUINT32_TO_LE (part->y_offset);
+	frame->leader.infos.x_padding = GUINT16_TO_LE (part->x_padding);
+
+	frame->trailer.header.magic = GUINT32_TO_LE (ARV_UVSP_TRAILER_MAGIC);
+	frame->trailer.header.size = GUINT16_TO_LE (sizeof (ArvUvspTrailer));
+	frame->trailer.header.frame_id = GUINT64_TO_LE (frame->buffer->priv->frame_id);
+	frame->trailer.infos.payload_size = GUINT64_TO_LE (payload);
+
+	max_leader_size = _get_uint32 (transport->bootstrap,
+				       ARV_UV_FAKE_TRANSPORT_SIRM_OFFSET + ARV_SIRM_MAX_LEADER_SIZE);
+	max_trailer_size = _get_uint32 (transport->bootstrap,
+					ARV_UV_FAKE_TRANSPORT_SIRM_OFFSET + ARV_SIRM_MAX_TRAILER_SIZE);
+
+	frame->leader_size = max_leader_size > 0 ?
+		MIN (sizeof (ArvUvspLeader), max_leader_size) : sizeof (ArvUvspLeader);
+	frame->payload_size = payload;
+	frame->trailer_size = max_trailer_size > 0 ?
+		MIN (sizeof (ArvUvspTrailer), max_trailer_size) : sizeof (ArvUvspTrailer);
+	frame->segment = ARV_UV_FAKE_TRANSPORT_SEGMENT_LEADER;
+	frame->offset = 0;
+
+	g_queue_push_tail (transport->frames, frame);
+	transport->n_frames++;
+
+	arv_debug_device ("[UvFakeTransport::push_frame] Frame %" G_GUINT64_FORMAT " (%" G_GSIZE_FORMAT " bytes)",
+			  frame->buffer->priv->frame_id, payload);
+
+	g_cond_broadcast (&transport->cond);
+}
+
+static gboolean
+_has_stream_data (ArvUvFakeTransport *transport)
+{
+	return !g_queue_is_empty (transport->frames);
+}
+
+/* Reads at most @size bytes of the current frame segment */
+
+static size_t
+_read_stream_data (ArvUvFakeTransport *transport, void *data, size_t size)
+{
+	ArvUvFakeTransportFrame *frame;
+	const char *segment_data;
+	size_t segment_size;
+	size_t n_bytes;
+
+	frame = g_queue_peek_head (transport->frames);
+	if (frame == NULL)
+		return 0;
+
+	switch (frame->segment) {
+		case ARV_UV_FAKE_TRANSPORT_SEGMENT_LEADER:
+			segment_data = (const char *) &frame->leader;
+			segment_size = frame->leader_size;
+			break;
+		case ARV_UV_FAKE_TRANSPORT_SEGMENT_PAYLOAD:
+			segment_data = (const char *) frame->buffer->priv->data;
+			segment_size = frame->payload_size;
+			break;
+		default:
+			segment_data = (const char *) &frame->trailer;
+			segment_size = frame->trailer_size;
+			break;
+	}
+
+	n_bytes = MIN (size, segment_size - frame->offset);
+	memcpy (data, segment_data + frame->offset, n_bytes);
+	frame->offset += n_bytes;
+
+	if (frame->offset >= segment_size) {
+		frame->segment++;
+		frame->offset = 0;
+
+		if (frame->segment == ARV_UV_FAKE_TRANSPORT_SEGMENT_END) {
+			g_queue_pop_head (transport->frames);
+			_frame_free (frame);
+		}
+	}
+
+	return n_bytes;
+}
+
+/* The transfers share the link bandwidth in their submission order, the latency is added to their completion time */
+
+static gint64
+_schedule_transfer (ArvUvFakeTransport *transport, size_t size, gint64 time_us)
+{
+	gint64 start_time_us = MAX (time_us, transport->link_available_time_us);
+
+	if (transport->bandwidth > 0)
+		transport->link_available_time_us = start_time_us +
+			(gint64) ((guint64) size * G_USEC_PER_SEC / transport->bandwidth);
+	else
+		transport->link_available_time_us = start_time_us;
+
+	return transport->link_available_time_us + transport->latency_us;
+}
+
+static gboolean
+_inject_error (ArvUvFakeTransport *transport)
+{
+	if (transport->error_rate <= 0.0 ||
+	    g_rand_double (transport->rand) >= transport->error_rate)
+		return FALSE;
+
+	transport->n_transfer_errors++;
+
+	return TRUE;
+}
+
+static int
+_receive_data (ArvUvFakeTransport *transport, void *data, int length, int *transferred, gint64 end_time)
+{
+	gint64 completion_time_us;
+	gint64 time_us;
+	gboolean is_error;
+	size_t n_bytes;
+
+	while (transport->is_connected && !_has_stream_data (transport)) {
+		if (g_get_monotonic_time () >= end_time)
+			return LIBUSB_ERROR_TIMEOUT;
+		g_cond_wait_until (&transport->cond, &transport->mutex, end_time);
+	}
+
+	if (!transport->is_connected)
+		return LIBUSB_ERROR_NO_DEVICE;
+
+	n_bytes = _read_stream_data (transport, data, length);
+	completion_time_us = _schedule_transfer (transport, n_bytes, g_get_monotonic_time ());
+	is_error = _inject_error (transport);
+
+	time_us = g_get_monotonic_time ();
+	if (completion_time_us > time_us) {
+		g_mutex_unlock (&transport->mutex);
+		g_usleep (completion_time_us - time_us);
+		g_mutex_lock (&transport->mutex);
+	}
+
+	if (is_error)
+		return LIBUSB_ERROR_IO;
+
+	*transferred = n_bytes;
+
+	return LIBUSB_SUCCESS;
+}
+
+static void
+_start_transfers (ArvUvFakeTransport *transport, gint64 time_us)
+{
+	GList *iter;
+
+	for (iter = transport->transfers->head; iter != NULL && _has_stream_data (transport); iter = iter->next) {
+		ArvUvFakeTransportTransfer *fake_transfer = iter->data;
+		struct libusb_transfer *transfer = fake_transfer->transfer;
+		size_t n_bytes;
+
+		if (fake_transfer->is_started || fake_transfer->is_cancelled)
+			continue;
+
+		n_bytes = _read_stream_data (transport, transfer->buffer, transfer->length);
+
+		fake_transfer->is_started = TRUE;
+		fake_transfer->completion_time_us = _schedule_transfer (transport, n_bytes, time_us);
+		if (_inject_error (transport)) {
+			fake_transfer->status = LIBUSB_TRANSFER_ERROR;
+			transfer->actual_length = 0;
+		} else {
+			fake_transfer->status = LIBUSB_TRANSFER_COMPLETED;
+			transfer->actual_length = n_bytes;
+		}
+	}
+}
+
+/* Completes the submitted transfers, like the libusb event thread of a real device */
+
+static void *
+_transfer_thread (void *data)
+{
+	ArvUvFakeTransport *transport = data;
+
+	g_mutex_lock (&transport->mutex);
+
+	while (!transport->cancel) {
+		ArvUvFakeTransportTransfer *fake_transfer = NULL;
+		struct libusb_transfer *transfer;
+		gint64 time_us = g_get_monotonic_time ();
+		gint64 end_time = time_us + ARV_UV_FAKE_TRANSPORT_POLL_PERIOD_US;
+		GList *iter;
+
+		/* The cancelled transfers, and all of them after a disconnection, are completed at once */
+		for (iter = transport->transfers->head; iter != NULL; iter = iter->next) {
+			ArvUvFakeTransportTransfer *candidate = iter->data;
+
+			if (candidate->is_cancelled || !transport->is_connected) {
+				candidate->status = transport->is_connected ?
+					LIBUSB_TRANSFER_CANCELLED : LIBUSB_TRANSFER_NO_DEVICE;
+				if (!candidate->is_started)
+					candidate->transfer->actual_length = 0;
+				fake_transfer = candidate;
+				break;
+			}
+		}
+
+		if (fake_transfer == NULL) {
+			ArvUvFakeTransportTransfer *head;
+
+			_start_transfers (transport, time_us);
+
+			head = g_queue_peek_head (transport->transfers);
+			if (head != NULL && head->is_started) {
+				if (head->completion_time_us <= time_us)
+					fake_transfer = head;
+				else
+					end_time = MIN (end_time, head->completion_time_us);
+			}
+		}
+
+		if (fake_transfer == NULL) {
+			g_cond_wait_until (&transport->cond, &transport->mutex, end_time);
+			continue;
+		}
+
+		g_queue_remove (transport->transfers, fake_transfer);
+
+		transfer = fake_transfer->transfer;
+		transfer->status = fake_transfer->status;
+		g_free (fake_transfer);
+
+		g_mutex_unlock (&transport->mutex);
+		transfer->callback (transfer);
+		g_mutex_lock (&transport->mutex);
+	}
+
+	g_mutex_unlock (&transport->mutex);
+
+	return NULL;
+}
+
+/* Generates the frames, following the acquisition and trigger logic of the GigE Vision fake camera */
+
+static void *
+_frame_thread (void *data)
+{
+	ArvUvFakeTransport *transport = data;
+	gboolean is_streaming = FALSE;
+
+	g_mutex_lock (&transport->mutex);
+
+	while (!transport->cancel) {
+		guint64 next_timestamp_us;
+
+		if (is_streaming)
+			arv_fake_camera_get_sleep_time_for_next_frame (transport->camera, &next_timestamp_us);
+		else
+			next_timestamp_us = g_get_real_time () + ARV_UV_FAKE_TRANSPORT_POLL_PERIOD_US;
+
+		/* The frame period is based on the real time clock, as in the fake camera */
+		while (!transport->cancel && g_get_real_time () < next_timestamp_us) {
+			gint64 sleep_time_us = MIN ((gint64) next_timestamp_us - g_get_real_time (),
+						    ARV_UV_FAKE_TRANSPORT_POLL_PERIOD_US);
+
+			g_cond_wait_until (&transport->frame_cond, &transport->mutex,
+					   g_get_monotonic_time () + sleep_time_us);
+		}
+
+		if (transport->cancel)
+			break;
+
+		is_streaming = transport->is_connected &&
+			_is_stream_enabled (transport) &&
+			arv_fake_camera_get_acquisition_status (transport->camera) != 0;
+
+		if (is_streaming &&
+		    (arv_fake_camera_is_in_free_running_mode (transport->camera) ||
+		     (arv_fake_camera_is_in_software_trigger_mode (transport->camera) &&
+		      arv_fake_camera_check_and_acknowledge_software_trigger (transport->camera))))
+			_push_frame (transport);
+	}
+
+	g_mutex_unlock (&transport->mutex);
+
+	return NULL;
+}
+
+/**
+ * arv_uv_fake_transport_new:
+ * @serial_number: the serial number of the simulated device
+ *
+ * Creates a simulated USB3Vision device, based on a new #ArvFakeCamera. The returned transport is meant to be given
+ * to arv_uv_device_new_with_fake_transport().
+ *
+ * Returns: a new #ArvUvFakeTransport
+ *
+ * Since: 0.10.0
+ */
+
+ArvUvFakeTransport *
+arv_uv_fake_transport_new (const char *serial_number)
+{
+	ArvUvFakeTransport *transport;
+
+	g_return_val_if_fail (serial_number != NULL, NULL);
+
+	transport = g_new0 (ArvUvFakeTransport, 1);
+
+	transport->serial_number = g_strdup (serial_number);
+	transport->camera = arv_fake_camera_new (serial_number);
+	arv_fake_camera_get_genicam_xml (transport->camera, &transport->genicam_xml_size);
+
+	_init_registers (transport);
+
+	g_mutex_init (&transport->mutex);
+	g_cond_init (&transport->cond);
+	g_cond_init (&transport->frame_cond);
+
+	transport->is_connected = TRUE;
+	transport->rand = g_rand_new_with_seed (ARV_UV_FAKE_TRANSPORT_RANDOM_SEED);
+	transport->frames = g_queue_new ();
+	transport->transfers = g_queue_new ();
+
+	transport->frame_thread = g_thread_new ("arv_uv_fake_frames", _frame_thread, transport);
+	transport->transfer_thread = g_thread_new ("arv_uv_fake_transfers", _transfer_thread, transport);
+
+	return transport;
+}
+
+/**
+ * arv_uv_fake_transport_free:
+ * @transport: a #ArvUvFakeTransport
+ *
+ * Stops the simulation and frees @transport. No transfer is expected to be still submitted.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_uv_fake_transport_free (ArvUvFakeTransport *transport)
+{
+	g_return_if_fail (transport != NULL);
+
+	g_mutex_lock (&transport->mutex);
+	transport->cancel = TRUE;
+	g_cond_broadcast (&transport->cond);
+	g_cond_broadcast (&transport->frame_cond);
+	g_mutex_unlock (&transport->mutex);
+
+	g_thread_join (transport->frame_thread);
+	g_thread_join (transport->transfer_thread);
+
+	if (!g_queue_is_empty (transport->transfers))
+		arv_warning_device ("[UvFakeTransport::free] %u transfers still submitted",
+				    g_queue_get_length (transport->transfers));
+
+	g_queue_free_full (transport->transfers, g_free);
+	g_queue_free_full (transport->frames, _frame_free);
+
+	g_rand_free (transport->rand);
+	g_object_unref (transport->camera);
+	g_free (transport->serial_number);
+
+	g_mutex_clear (&transport->mutex);
+	g_cond_clear (&transport->cond);
+	g_cond_clear (&transport->frame_cond);
+
+	g_free (transport);
+}
+
+/**
+ * arv_uv_fake_transport_set_bandwidth:
+ * @transport: a #ArvUvFakeTransport
+ * @bytes_per_second: link bandwidth, 0 for no limit
+ *
+ * Sets the bandwidth of the data endpoint. The data transfers are serialized on the simulated link, and a transfer
+ * is completed once all its bytes would have been sent at this rate.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_uv_fake_transport_set_bandwidth (ArvUvFakeTransport *transport, guint64 bytes_per_second)
+{
+	g_return_if_fail (transport != NULL);
+
+	g_mutex_lock (&transport->mutex);
+	transport->bandwidth = bytes_per_second;
+	g_mutex_unlock (&transport->mutex);
+}
+
+/**
+ * arv_uv_fake_transport_set_transfer_latency:
+ * @transport: a #ArvUvFakeTransport
+ * @latency_us: transfer latency, in µs
+ *
+ * Sets a fixed delay added to the completion of every data transfer and to the acknowledge of every control command.
+ * Unlike the bandwidth, the latency doesn't limit the throughput when enough transfers are queued. It should stay
+ * well below the device response time of 200 ms.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_uv_fake_transport_set_transfer_latency (ArvUvFakeTransport *transport, guint64 latency_us)
+{
+	g_return_if_fail (transport != NULL);
+
+	g_mutex_lock (&transport->mutex);
+	transport->latency_us = latency_us;
+	g_mutex_unlock (&transport->mutex);
+}
+
+/**
+ * arv_uv_fake_transport_set_error_rate:
+ * @transport: a #ArvUvFakeTransport
+ * @error_rate: probability of failure of a data transfer, between 0 and 1
+ *
+ * Makes a fraction of the data transfers fail, with a %LIBUSB_TRANSFER_ERROR status for the asynchronous transfers,
+ * and a %LIBUSB_ERROR_IO error for the synchronous ones. The data of a failed transfer is lost. The failures are
+ * drawn from a random generator with a fixed seed, making the test runs reproducible.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_uv_fake_transport_set_error_rate (ArvUvFakeTransport *transport, double error_rate)
+{
+	g_return_if_fail (transport != NULL);
+
+	g_mutex_lock (&transport->mutex);
+	transport->error_rate = CLAMP (error_rate, 0.0, 1.0);
+	g_mutex_unlock (&transport->mutex);
+}
+
+/**
+ * arv_uv_fake_transport_disconnect:
+ * @transport: a #ArvUvFakeTransport
+ *
+ * Simulates the unplugging of the device. The submitted transfers complete with a %LIBUSB_TRANSFER_NO_DEVICE status,
+ * and all the subsequent transfers fail with %LIBUSB_ERROR_NO_DEVICE.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_uv_fake_transport_disconnect (ArvUvFakeTransport *transport)
+{
+	g_return_if_fail (transport != NULL);
+
+	g_mutex_lock (&transport->mutex);
+	transport->is_connected = FALSE;
+	_flush_frames (transport);
+	g_cond_broadcast (&transport->cond);
+	g_mutex_unlock (&transport->mutex);
+}
+
+/**
+ * arv_uv_fake_transport_get_statistics:
+ * @transport: a #ArvUvFakeTransport
+ * @n_frames: (out) (optional): number of frames sent by the device
+ * @n_dropped_frames: (out) (optional): number of frames dropped because the device frame memory was full
+ * @n_transfer_errors: (out) (optional): number of injected transfer errors
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_uv_fake_transport_get_statistics (ArvUvFakeTransport *transport,
+				      guint64 *n_frames, guint64 *n_dropped_frames, guint64 *n_transfer_errors)
+{
+	g_return_if_fail (transport != NULL);
+
+	g_mutex_lock (&transport->mutex);
+	if (n_frames != NULL)
+		*n_frames = transport->n_frames;
+	if (n_dropped_frames != NULL)
+		*n_dropped_frames = transport->n_dropped_frames;
+	if (n_transfer_errors != NULL)
+		*n_transfer_errors = transport->n_transfer_errors;
+	g_mutex_unlock (&transport->mutex);
+}
+
+const char *
+arv_uv_fake_transport_get_serial_number (ArvUvFakeTransport *transport)
+{
+	g_return_val_if_fail (transport != NULL, NULL);
+
+	return transport->serial_number;
+}
+
+gboolean
+arv_uv_fake_transport_is_connected (ArvUvFakeTransport *transport)
+{
+	gboolean is_connected;
+
+	g_return_val_if_fail (transport != NULL, FALSE);
+
+	g_mutex_lock (&transport->mutex);
+	is_connected = transport->is_connected;
+	g_mutex_unlock (&transport->mutex);
+
+	return is_connected;
+}
+
+int
+arv_uv_fake_transport_bulk_transfer (ArvUvFakeTransport *transport, guint8 endpoint,
+				     void *data, int length, int *transferred, unsigned int timeout_ms)
+{
+	gint64 end_time;
+	int result;
+
+	g_return_val_if_fail (transport != NULL, LIBUSB_ERROR_INVALID_PARAM);
+	g_return_val_if_fail (data != NULL, LIBUSB_ERROR_INVALID_PARAM);
+	g_return_val_if_fail (transferred != NULL, LIBUSB_ERROR_INVALID_PARAM);
+
+	*transferred = 0;
+
+	/* As for libusb, a zero timeout means no timeout */
+	end_time = timeout_ms > 0 ? g_get_monotonic_time () + timeout_ms * (gint64) 1000 : G_MAXINT64;
+
+	g_mutex_lock (&transport->mutex);
+
+	if (!transport->is_connected) {
+		result = LIBUSB_ERROR_NO_DEVICE;
+	} else {
+		switch (endpoint) {
+			case ARV_UV_FAKE_TRANSPORT_CONTROL_ENDPOINT_OUT:
+				result = _handle_command (transport, data, length);
+				if (result == LIBUSB_SUCCESS)
+					*transferred = length;
+				break;
+			case ARV_UV_FAKE_TRANSPORT_CONTROL_ENDPOINT_IN:
+				result = _receive_ack (transport, data, length, transferred, end_time);
+				break;
+			case ARV_UV_FAKE_TRANSPORT_DATA_ENDPOINT:
+				result = _receive_data (transport, data, length, transferred, end_time);
+				break;
+			default:
+				result = LIBUSB_ERROR_INVALID_PARAM;
+				break;
+		}
+	}
+
+	g_mutex_unlock (&transport->mutex);
+
+	return result;
+}
+
+int
+arv_uv_fake_transport_submit_transfer (ArvUvFakeTransport *transport, struct libusb_transfer *transfer)
+{
+	ArvUvFakeTransportTransfer *fake_transfer;
+	int result;
+
+	g_return_val_if_fail (transport != NULL, LIBUSB_ERROR_INVALID_PARAM);
+	g_return_val_if_fail (transfer != NULL, LIBUSB_ERROR_INVALID_PARAM);
+
+	if (transfer->endpoint != ARV_UV_FAKE_TRANSPORT_DATA_ENDPOINT)
+		return LIBUSB_ERROR_NOT_SUPPORTED;
+
+	g_mutex_lock (&transport->mutex);
+
+	if (transport->is_connected) {
+		fake_transfer = g_new0 (ArvUvFakeTransportTransfer, 1);
+		fake_transfer->transfer = transfer;
+		transfer->actual_length = 0;
+
+		g_queue_push_tail (transport->transfers, fake_transfer);
+		g_cond_broadcast (&transport->cond);
+
+		result = LIBUSB_SUCCESS;
+	} else {
+		result = LIBUSB_ERROR_NO_DEVICE;
+	}
+
+	g_mutex_unlock (&transport->mutex);
+
+	return result;
+}
+
+int
+arv_uv_fake_transport_cancel_transfer (ArvUvFakeTransport *transport, struct libusb_transfer *transfer)
+{
+	GList *iter;
+	int result = LIBUSB_ERROR_NOT_FOUND;
+
+	g_return_val_if_fail (transport != NULL, LIBUSB_ERROR_INVALID_PARAM);
+	g_return_val_if_fail (transfer != NULL, LIBUSB_ERROR_INVALID_PARAM);
+
+	g_mutex_lock (&transport->mutex);
+
+	for (iter = transport->transfers->head; iter != NULL; iter = iter->next) {
+		ArvUvFakeTransportTransfer *fake_transfer = iter->data;
+
+		if (fake_transfer->transfer == transfer) {
+			fake_transfer->is_cancelled = TRUE;
+			g_cond_broadcast (&transport->cond);
+			result = LIBUSB_SUCCESS;
+			break;
+		}
+	}
+
+	g_mutex_unlock (&transport->mutex);
+
+	return result;
+}
+
+void
+arv_uv_fake_transport_reset_stream (ArvUvFakeTransport *transport)
+{
+	g_return_if_fail (transport != NULL);
+
+	g_mutex_lock (&transport->mutex);
+	_flush_frames (transport);
+	g_mutex_unlock (&transport->mutex);
+}
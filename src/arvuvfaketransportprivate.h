@@ -0,0 +1,71 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+#ifndef ARV_UV_FAKE_TRANSPORT_PRIVATE_H
+#define ARV_UV_FAKE_TRANSPORT_PRIVATE_H
+
+#include <arvapi.h>
+#include <arvtypes.h>
+#include <libusb.h>
+
+G_BEGIN_DECLS
+
+#define ARV_UV_FAKE_TRANSPORT_CONTROL_ENDPOINT_OUT	0x01
+#define ARV_UV_FAKE_TRANSPORT_CONTROL_ENDPOINT_IN	0x81
+#define ARV_UV_FAKE_TRANSPORT_DATA_ENDPOINT		0x82
+
+typedef struct _ArvUvFakeTransport ArvUvFakeTransport;
+
+ARV_API ArvUvFakeTransport *	arv_uv_fake_transport_new			(const char *serial_number);
+ARV_API void			arv_uv_fake_transport_free			(ArvUvFakeTransport *transport);
+
+ARV_API void			arv_uv_fake_transport_set_bandwidth		(ArvUvFakeTransport *transport,
+										 guint64 bytes_per_second);
+ARV_API void			arv_uv_fake_transport_set_transfer_latency	(ArvUvFakeTransport *transport,
+										 guint64 latency_us);
+ARV_API void			arv_uv_fake_transport_set_error_rate		(ArvUvFakeTransport *transport,
+										 double error_rate);
+ARV_API void			arv_uv_fake_transport_disconnect		(ArvUvFakeTransport *transport);
+ARV_API void			arv_uv_fake_transport_get_statistics		(ArvUvFakeTransport *transport,
+										 guint64 *n_frames,
+										 guint64 *n_dropped_frames,
+										 guint64 *n_transfer_errors);
+
+ARV_API ArvDevice *		arv_uv_device_new_with_fake_transport		(ArvUvFakeTransport *transport,
+										 GError **error);
+
+/* Used by ArvUvDevice, same semantic as the corresponding libusb functions */
+
+const char *	arv_uv_fake_transport_get_serial_number		(ArvUvFakeTransport *transport);
+gboolean	arv_uv_fake_transport_is_connected		(ArvUvFakeTransport *transport);
+int		arv_uv_fake_transport_bulk_transfer		(ArvUvFakeTransport *transport, guint8 endpoint,
+								 void *data, int length, int *transferred,
+								 unsigned int timeout_ms);
+int		arv_uv_fake_transport_submit_transfer		(ArvUvFakeTransport *transport,
+								 struct libusb_transfer *transfer);
+int		arv_uv_fake_transport_cancel_transfer		(ArvUvFakeTransport *transport,
+								 struct libusb_transfer *transfer);
+void		arv_uv_fake_transport_reset_stream		(ArvUvFakeTransport *transport);
+
+G_END_DECLS
+
+#endif
@@ -110,6 +110,8 @@ arv_uv_interface_device_infos_unref (ArvUvInterfaceDeviceInfos *infos)
 typedef struct {
 	GHashTable *devices;
 	libusb_context *usb;
+
+	GMutex mutex;
 } ArvUvInterfacePrivate;
 
 struct _ArvUvInterface {
@@ -371,14 +373,11 @@ arv_uv_interface_update_device_list (ArvInterface *interface, GArray *device_ids
 	_discover (uv_interface, device_ids);
 }
 
-static ArvDevice *
-_open_device (ArvInterface *interface, const char *key, GError **error)
+static char *
+_dup_device_guid (ArvUvInterface *uv_interface, const char *key)
 {
-	ArvUvInterface *uv_interface;
 	ArvUvInterfaceDeviceInfos *device_infos;
 
-	uv_interface = ARV_UV_INTERFACE (interface);
-
 	if (key == NULL) {
 		GList *device_list;
 
@@ -388,28 +387,35 @@ _open_device (ArvInterface *interface, const char *key, GError **error)
 	} else
 		device_infos = g_hash_table_lookup (uv_interface->priv->devices, key);
 
-	if (device_infos == NULL)
-		return NULL;
-
-	return arv_uv_device_new_from_guid (device_infos->guid, error);
+	return device_infos != NULL ? g_strdup (device_infos->guid) : NULL;
 }
 
 static ArvDevice *
 arv_uv_interface_open_device (ArvInterface *interface, const char *key, GError **error)
 {
+	ArvUvInterface *uv_interface = ARV_UV_INTERFACE (interface);
 	ArvDevice *device;
-	GError *local_error = NULL;
+	char *guid;
 
-	device = _open_device (interface, key, error);
-	if (ARV_IS_DEVICE (device) || local_error != NULL) {
-		if (local_error != NULL)
-			g_propagate_error (error, local_error);
-		return device;
+	/* Only the device list access is serialized, several devices can be opened concurrently */
+	g_mutex_lock (&uv_interface->priv->mutex);
+
+	guid = _dup_device_guid (uv_interface, key);
+	if (guid == NULL) {
+		_discover (uv_interface, NULL);
+		guid = _dup_device_guid (uv_interface, key);
 	}
 
-	_discover (ARV_UV_INTERFACE (interface), NULL);
+	g_mutex_unlock (&uv_interface->priv->mutex);
+
+	if (guid == NULL)
+		return NULL;
+
+	device = arv_uv_device_new_from_guid (guid, error);
+
+	g_free (guid);
 
-	return _open_device (interface, key, error);
+	return device;
 }
 
 static ArvInterface *arv_uv_interface = NULL;
@@ -462,6 +468,8 @@ arv_uv_interface_init (ArvUvInterface *uv_interface)
 
 	uv_interface->priv->devices = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
 							     (GDestroyNotify) arv_uv_interface_device_infos_unref);
+
+	g_mutex_init (&uv_interface->priv->mutex);
 }
 
 static void
@@ -470,6 +478,7 @@ arv_uv_interface_finalize (GObject *object)
 	ArvUvInterface *uv_interface = ARV_UV_INTERFACE (object);
 
 	g_hash_table_unref (uv_interface->priv->devices);
+	g_mutex_clear (&uv_interface->priv->mutex);
 
 	G_OBJECT_CLASS (arv_uv_interface_parent_class)->finalize (object);
 
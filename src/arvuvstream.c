@@ -33,16 +33,50 @@
 #include <arvuvcpprivate.h>
 #include <arvdebug.h>
 #include <arvmisc.h>
+#include <arvwakeupprivate.h>
 #include <libusb.h>
 #include <string.h>
 
-#define ARV_UV_STREAM_POP_INPUT_BUFFER_TIMEOUT_MS       10
-#define ARV_UV_STREAM_TRANSFER_WAIT_TIMEOUT_MS          10
+#define ARV_UV_STREAM_CONNECTION_CHECK_TIMEOUT_MS       100
+#define ARV_UV_STREAM_TRANSFER_WAIT_TIMEOUT_MS          100
+
+/* Transfer tuning. The device side payload transfer size can only be changed while the stream is disabled. In tuning
+ * mode, it is set to a small unit, and a runtime adjusted number of units is read by each host side transfer, which is
+ * possible because the payload transfers only contain full size packets. The number of units is adjusted in order to
+ * keep the mean payload transfer latency between ARV_UV_STREAM_TUNING_LATENCY_MIN_US and
+ * ARV_UV_STREAM_TUNING_LATENCY_MAX_US. The queue depth is doubled each time the transfer queue runs empty during a
+ * buffer reception, and slowly decreased otherwise. */
+
+#define ARV_UV_STREAM_TUNING_UNIT_SIZE                  (64 * 1024)
+#define ARV_UV_STREAM_TUNING_WINDOW_N_BUFFERS           8
+#define ARV_UV_STREAM_TUNING_STABLE_N_WINDOWS           4
+#define ARV_UV_STREAM_TUNING_LATENCY_MIN_US             250
+#define ARV_UV_STREAM_TUNING_LATENCY_MAX_US             2000
+#define ARV_UV_STREAM_TUNING_N_MINIMUM_SUBMITS          2
+#define ARV_UV_STREAM_TUNING_N_MAXIMUM_SUBMITS          64
+
+/* Payload transfer latency histogram, with power of two bins starting at 125 us */
+
+#define ARV_UV_STREAM_LATENCY_BIN_US                    125
+#define ARV_UV_STREAM_N_LATENCY_BINS                    9
+
+static const char *arv_uv_stream_latency_infos[ARV_UV_STREAM_N_LATENCY_BINS] = {
+        "n_transfer_latency_lt_125us",
+        "n_transfer_latency_lt_250us",
+        "n_transfer_latency_lt_500us",
+        "n_transfer_latency_lt_1ms",
+        "n_transfer_latency_lt_2ms",
+        "n_transfer_latency_lt_4ms",
+        "n_transfer_latency_lt_8ms",
+        "n_transfer_latency_lt_16ms",
+        "n_transfer_latency_ge_16ms"
+};
 
 enum {
        ARV_UV_STREAM_PROPERTY_0,
        ARV_UV_STREAM_PROPERTY_USB_MODE,
        ARV_UV_STREAM_PROPERTY_MAXIMUM_TRANSFER_SIZE,
+       ARV_UV_STREAM_PROPERTY_TRANSFER_TUNING,
 } ArvUvStreamProperties;
 
 /* Acquisition thread */
@@ -55,13 +89,12 @@ typedef struct {
 
         guint64 n_transferred_bytes;
         guint64 n_ignored_bytes;
-} ArvStreamStatistics;
 
-typedef struct {
-        ArvUvDevice *uv_device;
-        void *data;
-        size_t allocated_size;
-} ArvUvStreamBufferData;
+        guint64 transfer_size;
+        guint64 transfer_queue_depth;
+        guint64 n_transfer_starvations;
+        guint64 n_transfer_latencies[ARV_UV_STREAM_N_LATENCY_BINS];
+} ArvStreamStatistics;
 
 typedef struct {
 	ArvStream *stream;
@@ -84,14 +117,34 @@ typedef struct {
 
 	gboolean cancel;
 
-	/* Notification for completed transfers and cancellation */
-	GMutex stream_mtx;
-	GCond stream_event;
+	/* Notification for completed transfers and cancellation, latched until acknowledged by the stream thread */
+	ArvWakeup *wakeup;
 
 	/* Statistics */
 	ArvStreamStatistics statistics;
 
         gint n_buffer_in_use;
+        gint total_submitted_bytes;
+
+        /* Transfer contexts of the buffers allocated by arv_stream_create_buffers, built once per acquisition */
+        guint acquisition_id;
+        GPtrArray *buffer_contexts;
+
+        /* Transfer tuning */
+        gboolean transfer_tuning;
+        gint payload_multiplier;
+        gint payload_multiplier_max;
+        gint queue_depth;
+        guint n_window_buffers;
+        guint n_stable_windows;
+        gboolean is_window_starved;
+        guint64 window_latency_sum_us;
+        guint64 window_n_latencies;
+        guint64 latency_sum_us;
+        guint64 n_latencies;
+        gint64 last_completion_time_us;
+        gint64 idle_submit_time_us;
+        double transfer_latency_mean;
 } ArvUvStreamThreadData;
 
 typedef struct {
@@ -99,6 +152,7 @@ typedef struct {
 	ArvUvStreamThreadData *thread_data;
 	ArvUvUsbMode usb_mode;
         guint64 maximum_transfer_size;
+        gboolean transfer_tuning;
 
         guint64 sirm_address;
 } ArvUvStreamPrivate;
@@ -118,17 +172,19 @@ typedef struct {
         ArvStreamCallback callback;
         gpointer callback_data;
 
-	GMutex* transfer_completed_mtx;
-	GCond* transfer_completed_event;
+	ArvWakeup *wakeup;
 
 	size_t total_payload_transferred;
         size_t expected_size;
 
-        guint64 maximum_submit_total;
+        ArvUvStreamThreadData *thread_data;
 
 	guint8 *leader_buffer, *trailer_buffer;
+        size_t leader_size, trailer_size;
+        gboolean is_usb_memory;
 
 	int num_payload_transfers;
+        gint payload_multiplier;
 	struct libusb_transfer *leader_transfer, *trailer_transfer, **payload_transfers;
 
 	guint num_submitted;
@@ -142,31 +198,148 @@ typedef struct {
         gint *n_buffer_in_use;
 } ArvUvStreamBufferContext;
 
+/* Attached to the buffers allocated by arv_stream_create_buffers. The transfer context is only valid during the
+ * acquisition identified by @acquisition_id, and is owned by the stream thread. */
+
+typedef struct {
+        ArvUvDevice *uv_device;
+        void *data;
+        size_t allocated_size;
+
+        ArvUvStreamBufferContext *context;
+        guint acquisition_id;
+} ArvUvStreamBufferData;
+
+static GQuark arv_uv_stream_buffer_data_quark;
+static gint arv_uv_stream_n_acquisitions = 0;
+
 G_DEFINE_TYPE_WITH_CODE (ArvUvStream, arv_uv_stream, ARV_TYPE_STREAM, G_ADD_PRIVATE (ArvUvStream))
 
+/* Only the stream thread waits on the wakeup. As the signal is latched, a completion occurring between the check of
+ * the waited condition and the wait is not lost, and the timeout is only a safety net. */
+
 static void
 arv_uv_stream_buffer_context_wait_transfer_completed (ArvUvStreamBufferContext* ctx, gint64 timeout_ms)
 {
-	g_mutex_lock( ctx->transfer_completed_mtx );
+        GPollFD poll_fd;
 
-        if (timeout_ms > 0) {
-                gint64 end_time;
+        arv_wakeup_get_pollfd (ctx->wakeup, &poll_fd);
+        poll_fd.revents = 0;
 
-                end_time = g_get_monotonic_time() + timeout_ms * G_TIME_SPAN_MILLISECOND;
-                g_cond_wait_until (ctx->transfer_completed_event, ctx->transfer_completed_mtx, end_time);
-        } else {
-                g_cond_wait( ctx->transfer_completed_event, ctx->transfer_completed_mtx );
+        if (g_poll (&poll_fd, 1, timeout_ms > 0 ? timeout_ms : -1) > 0)
+                arv_wakeup_acknowledge (ctx->wakeup);
+}
+
+static void
+arv_uv_stream_buffer_context_notify_transfer_completed (ArvUvStreamBufferContext* ctx)
+{
+        arv_wakeup_signal (ctx->wakeup);
+}
+
+static guint64
+_get_maximum_submit_total (ArvUvStreamThreadData *thread_data)
+{
+        if (!thread_data->transfer_tuning)
+                return thread_data->maximum_transfer_size * ARV_UV_STREAM_N_MAXIMUM_SUBMITS;
+
+        return (guint64) g_atomic_int_get (&thread_data->queue_depth) *
+                thread_data->payload_size * g_atomic_int_get (&thread_data->payload_multiplier);
+}
+
+/* Called from the libusb event thread, after the completion of each transfer. The latency of a transfer is measured
+ * from its submission if the queue was empty, or from the completion of the previous transfer otherwise. */
+
+static void
+_update_transfer_statistics (ArvUvStreamBufferContext *ctx, struct libusb_transfer *transfer, gboolean is_payload)
+{
+        ArvUvStreamThreadData *thread_data = ctx->thread_data;
+        gint64 time_us = g_get_monotonic_time ();
+        gint64 start_time_us;
+
+        start_time_us = MAX (thread_data->last_completion_time_us, thread_data->idle_submit_time_us);
+        thread_data->last_completion_time_us = time_us;
+
+        if (ctx->is_aborting || transfer->status != LIBUSB_TRANSFER_COMPLETED)
+                return;
+
+        if (is_payload) {
+                guint64 latency_us = MAX (time_us - start_time_us, 0);
+                guint bin;
+
+                bin = MIN (g_bit_storage (latency_us / ARV_UV_STREAM_LATENCY_BIN_US),
+                           ARV_UV_STREAM_N_LATENCY_BINS - 1);
+                thread_data->statistics.n_transfer_latencies[bin]++;
+
+                thread_data->window_latency_sum_us += latency_us;
+                thread_data->window_n_latencies++;
+                thread_data->latency_sum_us += latency_us;
+                thread_data->n_latencies++;
+                thread_data->transfer_latency_mean = (double) thread_data->latency_sum_us /
+                        (double) thread_data->n_latencies;
         }
 
-	g_mutex_unlock( ctx->transfer_completed_mtx );
+        /* The queue ran empty while a buffer is being received */
+        if (g_atomic_int_get (ctx->total_submitted_bytes) == 0 &&
+            g_atomic_int_get (ctx->n_buffer_in_use) > 0) {
+                thread_data->statistics.n_transfer_starvations++;
+                thread_data->is_window_starved = TRUE;
+        }
 }
 
+/* Called from the libusb event thread, after the completion of each buffer */
+
 static void
-arv_uv_stream_buffer_context_notify_transfer_completed (ArvUvStreamBufferContext* ctx)
+_tune_transfers (ArvUvStreamThreadData *thread_data)
 {
-	g_mutex_lock( ctx->transfer_completed_mtx );
-	g_cond_broadcast( ctx->transfer_completed_event );
-	g_mutex_unlock( ctx->transfer_completed_mtx );
+        gint multiplier;
+        gint depth;
+
+        if (!thread_data->transfer_tuning)
+                return;
+
+        thread_data->n_window_buffers++;
+        if (thread_data->n_window_buffers < ARV_UV_STREAM_TUNING_WINDOW_N_BUFFERS)
+                return;
+
+        multiplier = g_atomic_int_get (&thread_data->payload_multiplier);
+        depth = g_atomic_int_get (&thread_data->queue_depth);
+
+        if (thread_data->window_n_latencies > 0) {
+                guint64 mean_latency_us = thread_data->window_latency_sum_us / thread_data->window_n_latencies;
+
+                if (mean_latency_us < ARV_UV_STREAM_TUNING_LATENCY_MIN_US &&
+                    multiplier * 2 <= thread_data->payload_multiplier_max)
+                        multiplier *= 2;
+                else if (mean_latency_us > ARV_UV_STREAM_TUNING_LATENCY_MAX_US && multiplier > 1)
+                        multiplier /= 2;
+        }
+
+        if (thread_data->is_window_starved) {
+                depth = MIN (depth * 2, ARV_UV_STREAM_TUNING_N_MAXIMUM_SUBMITS);
+                thread_data->n_stable_windows = 0;
+        } else {
+                thread_data->n_stable_windows++;
+                if (thread_data->n_stable_windows >= ARV_UV_STREAM_TUNING_STABLE_N_WINDOWS) {
+                        depth = MAX (depth - 1, ARV_UV_STREAM_TUNING_N_MINIMUM_SUBMITS);
+                        thread_data->n_stable_windows = 0;
+                }
+        }
+
+        if (multiplier != g_atomic_int_get (&thread_data->payload_multiplier) ||
+            depth != g_atomic_int_get (&thread_data->queue_depth)) {
+                arv_debug_stream_thread ("Transfer tuning: size = %" G_GSIZE_FORMAT " bytes, queue depth = %d",
+                                         thread_data->payload_size * multiplier, depth);
+
+                g_atomic_int_set (&thread_data->payload_multiplier, multiplier);
+                g_atomic_int_set (&thread_data->queue_depth, depth);
+                thread_data->statistics.transfer_size = thread_data->payload_size * multiplier;
+                thread_data->statistics.transfer_queue_depth = depth;
+        }
+
+        thread_data->n_window_buffers = 0;
+        thread_data->is_window_starved = FALSE;
+        thread_data->window_latency_sum_us = 0;
+        thread_data->window_n_latencies = 0;
 }
 
 static
@@ -193,6 +366,7 @@ void LIBUSB_CALL arv_uv_stream_leader_cb (struct libusb_transfer *transfer)
                                 ctx->buffer->priv->payload_type = arv_uvsp_packet_get_buffer_payload_type
                                         (packet, &ctx->buffer->priv->has_chunks);
                                 ctx->buffer->priv->chunk_endianness = G_LITTLE_ENDIAN;
+                                ctx->buffer->priv->has_gendc = FALSE;
                                 if (ctx->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_IMAGE ||
                                     ctx->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_EXTENDED_CHUNK_DATA ||
 									ctx->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER ) {
@@ -224,64 +398,10 @@ void LIBUSB_CALL arv_uv_stream_leader_cb (struct libusb_transfer *transfer)
 	g_atomic_int_dec_and_test (&ctx->num_submitted);
 	g_atomic_int_add (ctx->total_submitted_bytes, -transfer->length);
 	ctx->statistics->n_transferred_bytes += transfer->length;
+        _update_transfer_statistics (ctx, transfer, FALSE);
 	arv_uv_stream_buffer_context_notify_transfer_completed (ctx);
 }
 
-static void
-_gendc_payload (ArvUvStreamBufferContext *ctx)
-{
-	int component_count;
-
-        if(!arv_uvsp_packet_is_gendc (ctx->buffer->priv->data)){
-                arv_warning_sp ("Invalid GenDC Container: Signature shows %.4s "
-                                "which is supposed to be GNDC",
-                                ctx->buffer->priv->data);
-        } else {
-                ctx->buffer->priv->has_gendc = TRUE;
-                ctx->buffer->priv->gendc_data_offset =
-                        arv_uvsp_packet_get_gendc_dataoffset(ctx->buffer->priv->data);
-                ctx->buffer->priv->gendc_descriptor_size =
-                        arv_uvsp_packet_get_gendc_descriptorsize(ctx->buffer->priv->data);
-                ctx->buffer->priv->gendc_data_size =
-                        arv_uvsp_packet_get_gendc_datasize(ctx->buffer->priv->data);
-                component_count =
-                        (int) arv_uvsp_packet_get_gendc_componentcount (ctx->buffer->priv->data);
-
-                for(int ith_component = 0; ith_component < component_count; ++ith_component){
-                        int64_t ith_component_offset =
-                                arv_uvsp_packet_get_gendc_componentoffset(ctx->buffer->priv->data, ith_component);
-
-                        if (arv_uvsp_packet_get_gendc_iscomponentvalid (ctx->buffer->priv->data + ith_component_offset)
-                            && arv_uvsp_packet_get_gendc_componenttypeid (ctx->buffer->priv->data + ith_component_offset) == 0x1 ) {
-                                guint64 partoffset = arv_uvsp_packet_get_gendc_partoffset
-                                        (ctx->buffer->priv->data + ith_component_offset, 0);
-
-                                ctx->buffer->priv->parts[0].data_offset =
-                                        arv_uvsp_packet_get_gendc_partdatapffset(ctx->buffer->priv->data + partoffset);
-                                ctx->buffer->priv->parts[0].component_id =
-                                        ith_component;
-                                ctx->buffer->priv->parts[0].data_type =
-                                        ARV_BUFFER_PART_DATA_TYPE_2D_IMAGE;
-                                ctx->buffer->priv->parts[0].pixel_format =
-                                        arv_uvsp_packet_get_gendc_componentpixelformat
-                                        (ctx->buffer->priv->data + ith_component_offset);
-                                ctx->buffer->priv->parts[0].width =
-                                        arv_uvsp_packet_get_gendc_partdimension_x(ctx->buffer->priv->data + partoffset);
-                                ctx->buffer->priv->parts[0].width =
-                                        arv_uvsp_packet_get_gendc_partdimension_y(ctx->buffer->priv->data + partoffset);
-                                ctx->buffer->priv->parts[0].x_offset = 0;
-                                ctx->buffer->priv->parts[0].y_offset = 0;
-                                ctx->buffer->priv->parts[0].x_padding =
-                                        arv_uvsp_packet_get_gendc_partpadding_x(ctx->buffer->priv->data + partoffset);
-                                ctx->buffer->priv->parts[0].y_padding =
-                                        arv_uvsp_packet_get_gendc_partpadding_y(ctx->buffer->priv->data + partoffset);
-
-                                break;
-                        }
-                }
-        }
-}
-
 static void LIBUSB_CALL
 arv_uv_stream_payload_cb (struct libusb_transfer *transfer)
 {
@@ -293,8 +413,9 @@ arv_uv_stream_payload_cb (struct libusb_transfer *transfer)
                 } else {
                         if (transfer->status == LIBUSB_TRANSFER_COMPLETED) {
                                 ctx->total_payload_transferred += transfer->actual_length;
-                                if (ctx->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER){
-                                        _gendc_payload(ctx);
+                                if (ctx->buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER &&
+                                    !ctx->buffer->priv->has_gendc) {
+                                        arv_buffer_update_gendc_infos (ctx->buffer, ctx->total_payload_transferred);
                                 }
                         } else {
                                 arv_warning_stream_thread ("Payload transfer failed (%s)",
@@ -307,6 +428,7 @@ arv_uv_stream_payload_cb (struct libusb_transfer *transfer)
 	g_atomic_int_dec_and_test( &ctx->num_submitted );
 	g_atomic_int_add (ctx->total_submitted_bytes, -transfer->length);
 	ctx->statistics->n_transferred_bytes += transfer->length;
+        _update_transfer_statistics (ctx, transfer, TRUE);
 	arv_uv_stream_buffer_context_notify_transfer_completed (ctx);
 }
 
@@ -353,6 +475,11 @@ void LIBUSB_CALL arv_uv_stream_trailer_cb (struct libusb_transfer *transfer)
                                         ctx->buffer->priv->status = ARV_BUFFER_STATUS_SUCCESS;
                                         ctx->buffer->priv->received_size = ctx->total_payload_transferred;
                                         ctx->buffer->priv->parts[0].size = ctx->total_payload_transferred;
+                                        /* The part size is given by the container descriptor, if it has an
+                                         * intensity component */
+                                        if (ctx->buffer->priv->has_gendc)
+                                                arv_buffer_update_gendc_infos (ctx->buffer,
+                                                                               ctx->total_payload_transferred);
                                         ctx->statistics->n_completed_buffers += 1;
                                         break;
                                 default:
@@ -373,15 +500,49 @@ void LIBUSB_CALL arv_uv_stream_trailer_cb (struct libusb_transfer *transfer)
 	g_atomic_int_dec_and_test( &ctx->num_submitted );
 	g_atomic_int_add (ctx->total_submitted_bytes, -transfer->length);
 	ctx->statistics->n_transferred_bytes += transfer->length;
+        _update_transfer_statistics (ctx, transfer, FALSE);
+        if (!ctx->is_aborting)
+                _tune_transfers (ctx->thread_data);
 	arv_uv_stream_buffer_context_notify_transfer_completed (ctx);
 }
 
+/* The payload transfers read @multiplier device side payload transfers each */
+
+static void
+arv_uv_stream_buffer_context_set_payload_transfers (ArvUvStreamBufferContext *ctx, ArvBuffer *buffer,
+                                                    ArvUvStreamThreadData *thread_data, gint multiplier)
+{
+        size_t transfer_size = thread_data->payload_size * multiplier;
+	size_t offset = 0;
+	int i;
+
+	for (i = 0; i < ctx->num_payload_transfers; ++i)
+		libusb_free_transfer (ctx->payload_transfers[i]);
+        g_free (ctx->payload_transfers);
+
+	ctx->num_payload_transfers = (buffer->priv->allocated_size - 1) / transfer_size + 1;
+	ctx->payload_transfers = g_malloc (ctx->num_payload_transfers * sizeof(struct libusb_transfer*));
+        ctx->payload_multiplier = multiplier;
+
+	for (i = 0; i < ctx->num_payload_transfers; ++i) {
+		size_t size = MIN (transfer_size, buffer->priv->allocated_size - offset);
+
+		ctx->payload_transfers[i] = libusb_alloc_transfer(0);
+
+		arv_uv_device_fill_bulk_transfer (ctx->payload_transfers[i], thread_data->uv_device,
+			ARV_UV_ENDPOINT_DATA, LIBUSB_ENDPOINT_IN,
+			buffer->priv->data + offset, size,
+			arv_uv_stream_payload_cb, ctx,
+			0);
+
+		offset += size;
+	}
+}
+
 static ArvUvStreamBufferContext*
-arv_uv_stream_buffer_context_new (ArvBuffer *buffer, ArvUvStreamThreadData *thread_data, gint *total_submitted_bytes)
+arv_uv_stream_buffer_context_new (ArvBuffer *buffer, ArvUvStreamThreadData *thread_data)
 {
 	ArvUvStreamBufferContext* ctx = g_malloc0 (sizeof(ArvUvStreamBufferContext));
-	int i;
-	size_t offset = 0;
 
         ctx = g_new0 (ArvUvStreamBufferContext, 1);
 
@@ -389,12 +550,24 @@ arv_uv_stream_buffer_context_new (ArvBuffer *buffer, ArvUvStreamThreadData *thre
 	ctx->stream = thread_data->stream;
         ctx->callback = thread_data->callback;
         ctx->callback_data = thread_data->callback_data;
-	ctx->transfer_completed_mtx = &thread_data->stream_mtx;
-	ctx->transfer_completed_event = &thread_data->stream_event;
+	ctx->wakeup = thread_data->wakeup;
         ctx->n_buffer_in_use = &thread_data->n_buffer_in_use;
-        ctx->maximum_submit_total = thread_data->maximum_transfer_size * ARV_UV_STREAM_N_MAXIMUM_SUBMITS;
+        ctx->thread_data = thread_data;
+
+        /* Leader and trailer are received in device memory if available, like the buffer data */
+        ctx->leader_size = thread_data->leader_size;
+        ctx->trailer_size = thread_data->trailer_size;
+        ctx->leader_buffer = arv_uv_device_usb_mem_alloc (thread_data->uv_device, ctx->leader_size);
+        ctx->trailer_buffer = ctx->leader_buffer != NULL ?
+                arv_uv_device_usb_mem_alloc (thread_data->uv_device, ctx->trailer_size) : NULL;
+        ctx->is_usb_memory = ctx->trailer_buffer != NULL;
+        if (!ctx->is_usb_memory) {
+                if (ctx->leader_buffer != NULL)
+                        arv_uv_device_usb_mem_free (thread_data->uv_device, ctx->leader_buffer, ctx->leader_size);
+                ctx->leader_buffer = g_malloc (ctx->leader_size);
+                ctx->trailer_buffer = g_malloc (ctx->trailer_size);
+        }
 
-	ctx->leader_buffer = g_malloc (thread_data->leader_size);
 	ctx->leader_transfer = libusb_alloc_transfer (0);
 	arv_uv_device_fill_bulk_transfer (ctx->leader_transfer, thread_data->uv_device,
 		ARV_UV_ENDPOINT_DATA, LIBUSB_ENDPOINT_IN,
@@ -402,24 +575,9 @@ arv_uv_stream_buffer_context_new (ArvBuffer *buffer, ArvUvStreamThreadData *thre
 		arv_uv_stream_leader_cb, ctx,
 		0);
 
-	ctx->num_payload_transfers = (buffer->priv->allocated_size - 1) / thread_data->payload_size + 1;
-	ctx->payload_transfers = g_malloc (ctx->num_payload_transfers * sizeof(struct libusb_transfer*));
-
-	for (i = 0; i < ctx->num_payload_transfers; ++i) {
-		size_t size = MIN (thread_data->payload_size, buffer->priv->allocated_size - offset);
-
-		ctx->payload_transfers[i] = libusb_alloc_transfer(0);
+        arv_uv_stream_buffer_context_set_payload_transfers (ctx, buffer, thread_data,
+                                                            g_atomic_int_get (&thread_data->payload_multiplier));
 
-		arv_uv_device_fill_bulk_transfer (ctx->payload_transfers[i], thread_data->uv_device,
-			ARV_UV_ENDPOINT_DATA, LIBUSB_ENDPOINT_IN,
-			buffer->priv->data + offset, size,
-			arv_uv_stream_payload_cb, ctx,
-			0);
-
-		offset += size;
-	}
-
-	ctx->trailer_buffer = g_malloc (thread_data->trailer_size);
 	ctx->trailer_transfer = libusb_alloc_transfer (0);
 	arv_uv_device_fill_bulk_transfer (ctx->trailer_transfer, thread_data->uv_device,
 		ARV_UV_ENDPOINT_DATA, LIBUSB_ENDPOINT_IN,
@@ -428,7 +586,7 @@ arv_uv_stream_buffer_context_new (ArvBuffer *buffer, ArvUvStreamThreadData *thre
 		0);
 
 	ctx->num_submitted = 0;
-	ctx->total_submitted_bytes = total_submitted_bytes;
+	ctx->total_submitted_bytes = &thread_data->total_submitted_bytes;
 	ctx->statistics = &thread_data->statistics;
 
 	return ctx;
@@ -448,9 +606,14 @@ arv_uv_stream_buffer_context_free (gpointer data)
 	}
 	libusb_free_transfer (ctx->trailer_transfer );
 
-	g_free (ctx->leader_buffer);
+        if (ctx->is_usb_memory) {
+                arv_uv_device_usb_mem_free (ctx->thread_data->uv_device, ctx->leader_buffer, ctx->leader_size);
+                arv_uv_device_usb_mem_free (ctx->thread_data->uv_device, ctx->trailer_buffer, ctx->trailer_size);
+        } else {
+                g_free (ctx->leader_buffer);
+                g_free (ctx->trailer_buffer);
+        }
         g_free (ctx->payload_transfers);
-	g_free (ctx->trailer_buffer);
 
         if (ctx->buffer != NULL) {
                 ctx->buffer->priv->status = ARV_BUFFER_STATUS_ABORTED;
@@ -470,12 +633,19 @@ static void
 _submit_transfer (ArvUvStreamBufferContext* ctx, struct libusb_transfer* transfer, gboolean* cancel)
 {
 	while (!g_atomic_int_get (cancel) &&
-               ((g_atomic_int_get(ctx->total_submitted_bytes) + transfer->length) > ctx->maximum_submit_total)) {
+               g_atomic_int_get (ctx->total_submitted_bytes) > 0 &&
+               ((g_atomic_int_get(ctx->total_submitted_bytes) + transfer->length) >
+                _get_maximum_submit_total (ctx->thread_data))) {
 		arv_uv_stream_buffer_context_wait_transfer_completed (ctx, ARV_UV_STREAM_TRANSFER_WAIT_TIMEOUT_MS);
 	}
 
 	while (!g_atomic_int_get (cancel)) {
-		int status = libusb_submit_transfer (transfer);
+		int status;
+
+                if (g_atomic_int_get (ctx->total_submitted_bytes) == 0)
+                        ctx->thread_data->idle_submit_time_us = g_get_monotonic_time ();
+
+                status = arv_uv_device_submit_transfer (ctx->thread_data->uv_device, transfer);
 
 		switch (status)
 		{
@@ -493,6 +663,18 @@ _submit_transfer (ArvUvStreamBufferContext* ctx, struct libusb_transfer* transfe
                          * In order to allow more memory to be used for submitted buffers, increase usbfs_memory_mb:
                          * sudo modprobe usbcore usbfs_memory_mb=1000
                         */
+                        if (ctx->thread_data->transfer_tuning) {
+                                gint64 transfer_size = ctx->thread_data->payload_size *
+                                        g_atomic_int_get (&ctx->thread_data->payload_multiplier);
+                                gint depth = g_atomic_int_get (ctx->total_submitted_bytes) / transfer_size;
+
+                                /* Stay below the kernel limit */
+                                depth = MAX (depth, ARV_UV_STREAM_TUNING_N_MINIMUM_SUBMITS);
+                                if (depth < g_atomic_int_get (&ctx->thread_data->queue_depth)) {
+                                        g_atomic_int_set (&ctx->thread_data->queue_depth, depth);
+                                        ctx->thread_data->statistics.transfer_queue_depth = depth;
+                                }
+                        }
 			arv_uv_stream_buffer_context_wait_transfer_completed (ctx, ARV_UV_STREAM_TRANSFER_WAIT_TIMEOUT_MS);
 			break;
 
@@ -519,6 +701,11 @@ arv_uv_stream_buffer_context_submit (ArvUvStreamBufferContext* ctx, ArvBuffer *b
 
         ctx->expected_size = thread_data->expected_size;
 
+        /* All the transfers of the previous use of the buffer are completed */
+        if (ctx->payload_multiplier != g_atomic_int_get (&thread_data->payload_multiplier))
+                arv_uv_stream_buffer_context_set_payload_transfers (ctx, buffer, thread_data,
+                                                                    g_atomic_int_get (&thread_data->payload_multiplier));
+
         _submit_transfer (ctx, ctx->leader_transfer, &thread_data->cancel);
 
         for (i = 0; i < ctx->num_payload_transfers; ++i) {
@@ -536,13 +723,13 @@ arv_uv_stream_buffer_context_cancel (gpointer key, gpointer value, gpointer user
 
         ctx->is_aborting = TRUE;
 
-	libusb_cancel_transfer (ctx->leader_transfer );
+	arv_uv_device_cancel_transfer (ctx->thread_data->uv_device, ctx->leader_transfer);
 
 	for (i = 0; i < ctx->num_payload_transfers; ++i) {
-		libusb_cancel_transfer (ctx->payload_transfers[i]);
+		arv_uv_device_cancel_transfer (ctx->thread_data->uv_device, ctx->payload_transfers[i]);
 	}
 
-	libusb_cancel_transfer (ctx->trailer_transfer);
+	arv_uv_device_cancel_transfer (ctx->thread_data->uv_device, ctx->trailer_transfer);
 
 	while (ctx->num_submitted > 0)
 	{
@@ -550,13 +737,54 @@ arv_uv_stream_buffer_context_cancel (gpointer key, gpointer value, gpointer user
 	}
 }
 
+static void
+_cancel_buffer_context (gpointer data, gpointer user_data)
+{
+        arv_uv_stream_buffer_context_cancel (NULL, data, user_data);
+}
+
+/* The transfer context of a buffer allocated by arv_stream_create_buffers is found through its attached data, and is
+ * built at its first submission during the acquisition. The other buffers are looked up in @ctx_lookup. */
+
+static ArvUvStreamBufferContext *
+_get_buffer_context (ArvUvStreamThreadData *thread_data, GHashTable *ctx_lookup, ArvBuffer *buffer)
+{
+        ArvUvStreamBufferData *buffer_data;
+        ArvUvStreamBufferContext *ctx;
+
+        buffer_data = g_object_get_qdata (G_OBJECT (buffer), arv_uv_stream_buffer_data_quark);
+        if (buffer_data != NULL) {
+                if (buffer_data->acquisition_id == thread_data->acquisition_id)
+                        return buffer_data->context;
+
+                ctx = arv_uv_stream_buffer_context_new (buffer, thread_data);
+                g_ptr_array_add (thread_data->buffer_contexts, ctx);
+                buffer_data->context = ctx;
+                buffer_data->acquisition_id = thread_data->acquisition_id;
+
+                return ctx;
+        }
+
+        ctx = g_hash_table_lookup (ctx_lookup, buffer);
+        if (ctx == NULL) {
+                arv_debug_stream_thread ("Stream buffer context not found for buffer %p, creating...", buffer);
+
+                ctx = arv_uv_stream_buffer_context_new (buffer, thread_data);
+
+                g_hash_table_insert (ctx_lookup, buffer, ctx);
+        }
+
+        return ctx;
+}
+
 static void *
 arv_uv_stream_thread_async (void *data)
 {
 	ArvUvStreamThreadData *thread_data = data;
 	ArvBuffer *buffer = NULL;
 	GHashTable *ctx_lookup;
-	gint total_submitted_bytes = 0;
+	GPollFD poll_fd;
+        gboolean is_underrun = FALSE;
 
 	arv_info_stream_thread ("Start async USB3Vision stream thread");
 
@@ -568,44 +796,51 @@ arv_uv_stream_thread_async (void *data)
 		thread_data->callback (thread_data->callback_data, ARV_STREAM_CALLBACK_TYPE_INIT, NULL);
 
 	ctx_lookup = g_hash_table_new_full( g_direct_hash, g_direct_equal, NULL, arv_uv_stream_buffer_context_free );
+        thread_data->buffer_contexts = g_ptr_array_new_with_free_func (arv_uv_stream_buffer_context_free);
+        thread_data->total_submitted_bytes = 0;
 
         g_mutex_lock (&thread_data->thread_started_mutex);
         thread_data->thread_started = TRUE;
         g_cond_signal (&thread_data->thread_started_cond);
         g_mutex_unlock (&thread_data->thread_started_mutex);
 
+        arv_wakeup_get_pollfd (thread_data->wakeup, &poll_fd);
+
 	while (!g_atomic_int_get (&thread_data->cancel) &&
                arv_uv_device_is_connected (thread_data->uv_device)) {
 		ArvUvStreamBufferContext* ctx;
 
-                buffer = arv_stream_timeout_pop_input_buffer (thread_data->stream,
-                                                              ARV_UV_STREAM_POP_INPUT_BUFFER_TIMEOUT_MS * 1000);
+                /* Wait for a buffer pushed back by the application, a transfer completion or a cancellation. A
+                 * returned buffer is resubmitted as soon as it is pushed, the timeout is only used for the detection
+                 * of a device disconnection without pending transfers. */
+                buffer = arv_stream_poll_pop_input_buffer (thread_data->stream, &poll_fd, 1,
+                                                           ARV_UV_STREAM_CONNECTION_CHECK_TIMEOUT_MS * 1000);
 
 		if( buffer == NULL ) {
-                        if (thread_data->n_buffer_in_use == 0)
+                        if (poll_fd.revents != 0)
+                                arv_wakeup_acknowledge (thread_data->wakeup);
+                        if (!is_underrun && g_atomic_int_get (&thread_data->n_buffer_in_use) == 0) {
                                 thread_data->statistics.n_underruns += 1;
+                                is_underrun = TRUE;
+                        }
                         /* NOTE: n_ignored_bytes is not accumulated because it doesn't submit next USB transfer if
                          * buffer is shortage. It means back pressure might be hanlded by USB slave side. */
 			continue;
 		} else {
                         g_atomic_int_inc(&thread_data->n_buffer_in_use);
+                        is_underrun = FALSE;
                 }
 
-		ctx = g_hash_table_lookup( ctx_lookup, buffer );
-		if (!ctx) {
-			arv_debug_stream_thread ("Stream buffer context not found for buffer %p, creating...", buffer);
-
-			ctx = arv_uv_stream_buffer_context_new (buffer, thread_data, &total_submitted_bytes);
-
-			g_hash_table_insert (ctx_lookup, buffer, ctx);
-		}
+                ctx = _get_buffer_context (thread_data, ctx_lookup, buffer);
 
                 arv_uv_stream_buffer_context_submit (ctx, buffer, thread_data);
 	}
 
 	g_hash_table_foreach (ctx_lookup, arv_uv_stream_buffer_context_cancel, NULL);
+        g_ptr_array_foreach (thread_data->buffer_contexts, _cancel_buffer_context, NULL);
 
 	g_hash_table_destroy (ctx_lookup);
+        g_clear_pointer (&thread_data->buffer_contexts, g_ptr_array_unref);
 
 	if (thread_data->callback != NULL)
 		thread_data->callback (thread_data->callback_data, ARV_STREAM_CALLBACK_TYPE_EXIT, NULL);
@@ -615,50 +850,6 @@ arv_uv_stream_thread_async (void *data)
 	return NULL;
 }
 
-static void
-_gendc_packet (ArvBuffer *buffer)
-{
-	int component_count;
-
-        if(!arv_uvsp_packet_is_gendc (buffer->priv->data)){
-                arv_warning_sp ("Invalid GenDC Container: Signature shows %.4s which is supposed to be GNDC", buffer->priv->data);
-        } else {
-                buffer->priv->has_gendc = TRUE;
-                buffer->priv->gendc_data_offset = arv_uvsp_packet_get_gendc_dataoffset(buffer->priv->data);
-                buffer->priv->gendc_descriptor_size = arv_uvsp_packet_get_gendc_descriptorsize(buffer->priv->data);
-                buffer->priv->gendc_data_size = arv_uvsp_packet_get_gendc_datasize(buffer->priv->data);
-
-                component_count = (int) arv_uvsp_packet_get_gendc_componentcount(buffer->priv->data);
-                for(int ith_component = 0; ith_component < component_count; ++ith_component){
-                        int64_t ith_component_offset = arv_uvsp_packet_get_gendc_componentoffset(buffer->priv->data, ith_component);
-
-                        /* only if the component is valid and have an image data (GDC_INTENSITY from SFNC) */
-                        if (arv_uvsp_packet_get_gendc_iscomponentvalid(buffer->priv->data + ith_component_offset)
-                            && arv_uvsp_packet_get_gendc_componenttypeid(buffer->priv->data + ith_component_offset) == 0x1 ){
-                                guint64 partoffset = arv_uvsp_packet_get_gendc_partoffset
-                                        (buffer->priv->data + ith_component_offset, 0);
-                                buffer->priv->parts[0].data_offset =
-                                        arv_uvsp_packet_get_gendc_partdatapffset(buffer->priv->data + partoffset);
-                                buffer->priv->parts[0].component_id = ith_component;
-                                buffer->priv->parts[0].data_type = ARV_BUFFER_PART_DATA_TYPE_2D_IMAGE;
-                                buffer->priv->parts[0].pixel_format =
-                                        arv_uvsp_packet_get_gendc_componentpixelformat(buffer->priv->data + ith_component_offset);
-                                buffer->priv->parts[0].width =
-                                        arv_uvsp_packet_get_gendc_partdimension_x(buffer->priv->data + partoffset);
-                                buffer->priv->parts[0].width =
-                                        arv_uvsp_packet_get_gendc_partdimension_y(buffer->priv->data + partoffset);
-                                buffer->priv->parts[0].x_offset = 0;
-                                buffer->priv->parts[0].y_offset = 0;
-                                buffer->priv->parts[0].x_padding =
-                                        arv_uvsp_packet_get_gendc_partpadding_x(buffer->priv->data + partoffset);
-                                buffer->priv->parts[0].y_padding =
-                                        arv_uvsp_packet_get_gendc_partpadding_y(buffer->priv->data + partoffset);
-                                break;
-                        }
-                }
-        }
-}
-
 static void *
 arv_uv_stream_thread_sync (void *data)
 {
@@ -744,6 +935,7 @@ arv_uv_stream_thread_sync (void *data)
 						buffer->priv->payload_type = arv_uvsp_packet_get_buffer_payload_type
                                                         (packet, &buffer->priv->has_chunks);
 						buffer->priv->chunk_endianness = G_LITTLE_ENDIAN;
+						buffer->priv->has_gendc = FALSE;
 						if (buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_IMAGE ||
 						    buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_EXTENDED_CHUNK_DATA ||
 							buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER) {
@@ -800,6 +992,8 @@ arv_uv_stream_thread_sync (void *data)
                                                         buffer->priv->status = ARV_BUFFER_STATUS_SUCCESS;
                                                         buffer->priv->received_size = offset;
                                                         buffer->priv->parts[0].size = offset;
+                                                        if (buffer->priv->has_gendc)
+                                                                arv_buffer_update_gendc_infos (buffer, offset);
                                                         arv_stream_push_output_buffer (thread_data->stream, buffer);
                                                         if (thread_data->callback != NULL)
                                                                 thread_data->callback (thread_data->callback_data,
@@ -821,8 +1015,9 @@ arv_uv_stream_thread_sync (void *data)
                                                         offset += transferred;
                                                         thread_data->statistics.n_transferred_bytes += transferred;
 
-                                                        if (buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER){
-                                                                _gendc_packet (buffer);
+                                                        if (buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER &&
+                                                            !buffer->priv->has_gendc) {
+                                                                arv_buffer_update_gendc_infos (buffer, offset);
                                                         }
                                                 } else {
                                                         buffer->priv->status = ARV_BUFFER_STATUS_SIZE_MISMATCH;
@@ -963,6 +1158,9 @@ arv_uv_stream_start_acquisition (ArvStream *stream, GError **error)
 	}
 
 	si_payload_size = MIN(si_req_payload_size , aligned_maximum_transfer_size);
+        if (priv->transfer_tuning)
+                si_payload_size = MIN (si_payload_size,
+                                       MAX (alignment, ARV_UV_STREAM_TUNING_UNIT_SIZE / alignment * alignment));
 	si_payload_count = si_req_payload_size / si_payload_size;
 	si_transfer1_size = align(si_req_payload_size % si_payload_size, alignment);
 	si_transfer2_size = 0;
@@ -995,6 +1193,26 @@ arv_uv_stream_start_acquisition (ArvStream *stream, GError **error)
 	thread_data->trailer_size = si_trailer_size;
         thread_data->n_buffer_in_use = 0;
 	thread_data->cancel = FALSE;
+        thread_data->acquisition_id = g_atomic_int_add (&arv_uv_stream_n_acquisitions, 1) + 1;
+
+        /* The tuned values are kept from one acquisition to the next */
+        thread_data->transfer_tuning = priv->transfer_tuning;
+        thread_data->payload_multiplier_max = MAX (1, aligned_maximum_transfer_size / si_payload_size);
+        if (!thread_data->transfer_tuning)
+                thread_data->payload_multiplier = 1;
+        thread_data->payload_multiplier = MIN (thread_data->payload_multiplier, thread_data->payload_multiplier_max);
+        thread_data->n_window_buffers = 0;
+        thread_data->n_stable_windows = 0;
+        thread_data->is_window_starved = FALSE;
+        thread_data->window_latency_sum_us = 0;
+        thread_data->window_n_latencies = 0;
+        thread_data->last_completion_time_us = 0;
+        thread_data->idle_submit_time_us = 0;
+        thread_data->statistics.transfer_size = si_payload_size * thread_data->payload_multiplier;
+        thread_data->statistics.transfer_queue_depth = thread_data->transfer_tuning ?
+                thread_data->queue_depth : ARV_UV_STREAM_N_MAXIMUM_SUBMITS;
+
+        arv_info_stream ("Transfer tuning       = %s", thread_data->transfer_tuning ? "enabled" : "disabled");
 
         arv_uv_device_reset_stream_endpoint (thread_data->uv_device);
 
@@ -1043,7 +1261,7 @@ arv_uv_stream_stop_acquisition (ArvStream *stream, GError **error)
 	thread_data = priv->thread_data;
 
 	g_atomic_int_set (&priv->thread_data->cancel, TRUE);
-	g_cond_broadcast (&priv->thread_data->stream_event);
+	arv_wakeup_signal (priv->thread_data->wakeup);
 	g_thread_join (priv->thread);
 
 	priv->thread = NULL;
@@ -1096,8 +1314,8 @@ arv_uv_stream_create_buffers (ArvStream *stream, guint n_buffers, size_t size,
                         buffer_data->data = buffer->priv->data;
                         buffer_data->allocated_size = buffer->priv->allocated_size;
 
-                        g_object_set_data_full (G_OBJECT (buffer), "uv-buffer-data",
-                                                buffer_data, _buffer_data_destroy_func);
+                        g_object_set_qdata_full (G_OBJECT (buffer), arv_uv_stream_buffer_data_quark,
+                                                 buffer_data, _buffer_data_destroy_func);
                 } else {
                         buffer = arv_buffer_new_full (size, NULL, user_data, user_data_destroy_func);
                 }
@@ -1115,6 +1333,7 @@ arv_uv_stream_create_buffers (ArvStream *stream, guint n_buffers, size_t size,
  * @destroy: callback data destroy function
  * @usb_mode: USB mode selection
  * @maximum_transfer_size: maximum transfer size, in bytes
+ * @transfer_tuning: enable the runtime adjustment of the transfer size and queue depth
  * @error: a #GError placeholder, %NULL to ignore
  *
  * Return Value: (transfer full): a new #ArvStream.
@@ -1122,7 +1341,7 @@ arv_uv_stream_create_buffers (ArvStream *stream, guint n_buffers, size_t size,
 
 ArvStream *
 arv_uv_stream_new (ArvUvDevice *uv_device, ArvStreamCallback callback, void *callback_data, GDestroyNotify destroy,
-                   ArvUvUsbMode usb_mode, guint64 maximum_transfer_size, GError **error)
+                   ArvUvUsbMode usb_mode, guint64 maximum_transfer_size, gboolean transfer_tuning, GError **error)
 {
 	return g_initable_new (ARV_TYPE_UV_STREAM, NULL, error,
 			       "device", uv_device,
@@ -1131,6 +1350,7 @@ arv_uv_stream_new (ArvUvDevice *uv_device, ArvStreamCallback callback, void *cal
                                "destroy-notify", destroy,
 			       "usb-mode", usb_mode,
                                "maximum-transfer-size", maximum_transfer_size,
+                               "transfer-tuning", transfer_tuning,
 			       NULL);
 }
 
@@ -1141,14 +1361,14 @@ arv_uv_stream_constructed (GObject *object)
 	ArvStream *stream = ARV_STREAM (uv_stream);
 	ArvUvStreamPrivate *priv = arv_uv_stream_get_instance_private (uv_stream);
 	ArvUvStreamThreadData *thread_data;
+        guint i;
 
         G_OBJECT_CLASS (arv_uv_stream_parent_class)->constructed (object);
 
 	thread_data = g_new0 (ArvUvStreamThreadData, 1);
 	thread_data->stream = stream;
 
-	g_cond_init( &thread_data->stream_event );
-	g_mutex_init( &thread_data->stream_mtx );
+	thread_data->wakeup = arv_wakeup_new ();
 
 	thread_data->statistics.n_completed_buffers = 0;
 	thread_data->statistics.n_failures = 0;
@@ -1157,6 +1377,9 @@ arv_uv_stream_constructed (GObject *object)
 	thread_data->statistics.n_transferred_bytes = 0;
 	thread_data->statistics.n_ignored_bytes = 0;
 
+        thread_data->payload_multiplier = 1;
+        thread_data->queue_depth = ARV_UV_STREAM_N_MAXIMUM_SUBMITS;
+
 	g_object_get (object,
 		      "device", &thread_data->uv_device,
 		      "callback", &thread_data->callback,
@@ -1177,6 +1400,18 @@ arv_uv_stream_constructed (GObject *object)
                                  G_TYPE_UINT64, &thread_data->statistics.n_transferred_bytes);
         arv_stream_declare_info (ARV_STREAM (uv_stream), "n_ignored_bytes",
                                  G_TYPE_UINT64, &thread_data->statistics.n_ignored_bytes);
+        arv_stream_declare_info (ARV_STREAM (uv_stream), "transfer_size",
+                                 G_TYPE_UINT64, &thread_data->statistics.transfer_size);
+        arv_stream_declare_info (ARV_STREAM (uv_stream), "transfer_queue_depth",
+                                 G_TYPE_UINT64, &thread_data->statistics.transfer_queue_depth);
+        arv_stream_declare_info (ARV_STREAM (uv_stream), "n_transfer_starvations",
+                                 G_TYPE_UINT64, &thread_data->statistics.n_transfer_starvations);
+        arv_stream_declare_info (ARV_STREAM (uv_stream), "transfer_latency_mean",
+                                 G_TYPE_DOUBLE, &thread_data->transfer_latency_mean);
+
+        for (i = 0; i < ARV_UV_STREAM_N_LATENCY_BINS; i++)
+                arv_stream_declare_info (ARV_STREAM (uv_stream), arv_uv_stream_latency_infos[i],
+                                         G_TYPE_UINT64, &thread_data->statistics.n_transfer_latencies[i]);
 }
 
 /* ArvStream implementation */
@@ -1194,6 +1429,9 @@ arv_uv_stream_set_property (GObject * object, guint prop_id,
                case ARV_UV_STREAM_PROPERTY_MAXIMUM_TRANSFER_SIZE:
                        priv->maximum_transfer_size = g_value_get_uint64(value);
                        break;
+               case ARV_UV_STREAM_PROPERTY_TRANSFER_TUNING:
+                       priv->transfer_tuning = g_value_get_boolean (value);
+                       break;
                default:
                        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
                        break;
@@ -1234,8 +1472,16 @@ arv_uv_stream_finalize (GObject *object)
 		arv_info_stream ("[UvStream::finalize] n_ignored_bytes        = %" G_GUINT64_FORMAT,
 				  thread_data->statistics.n_ignored_bytes);
 
-		g_mutex_clear (&thread_data->stream_mtx);
-		g_cond_clear (&thread_data->stream_event);
+		arv_info_stream ("[UvStream::finalize] transfer_size          = %" G_GUINT64_FORMAT,
+				  thread_data->statistics.transfer_size);
+		arv_info_stream ("[UvStream::finalize] transfer_queue_depth   = %" G_GUINT64_FORMAT,
+				  thread_data->statistics.transfer_queue_depth);
+		arv_info_stream ("[UvStream::finalize] n_transfer_starvations = %" G_GUINT64_FORMAT,
+				  thread_data->statistics.n_transfer_starvations);
+		arv_info_stream ("[UvStream::finalize] transfer_latency_mean  = %g us",
+				  thread_data->transfer_latency_mean);
+
+		arv_wakeup_free (thread_data->wakeup);
 
 		g_clear_object (&thread_data->uv_device);
 		g_clear_pointer (&priv->thread_data, g_free);
@@ -1258,6 +1504,8 @@ arv_uv_stream_class_init (ArvUvStreamClass *uv_stream_class)
 	stream_class->stop_acquisition = arv_uv_stream_stop_acquisition;
         stream_class->create_buffers = arv_uv_stream_create_buffers;
 
+        arv_uv_stream_buffer_data_quark = g_quark_from_static_string ("uv-buffer-data");
+
          /**
           * ArvUvStream:usb-mode:
           *
@@ -1285,4 +1533,20 @@ arv_uv_stream_class_init (ArvUvStreamClass *uv_stream_class)
                                      ARV_UV_STREAM_MAXIMUM_TRANSFER_SIZE_DEFAULT,
                                      G_PARAM_CONSTRUCT_ONLY | G_PARAM_WRITABLE | G_PARAM_STATIC_STRINGS)
                 );
+
+        /**
+         * ArvUvStream:transfer-tuning:
+         *
+         * Runtime adjustment of the USB bulk transfer size and of the number of queued transfers, in asynchronous
+         * mode. The maximum transfer size is used as the upper limit.
+         *
+         * Since: 0.10.0
+         */
+        g_object_class_install_property (
+                object_class, ARV_UV_STREAM_PROPERTY_TRANSFER_TUNING,
+                g_param_spec_boolean ("transfer-tuning", "Transfer tuning",
+                                      "USB transfer size and queue depth tuning",
+                                      FALSE,
+                                      G_PARAM_CONSTRUCT_ONLY | G_PARAM_WRITABLE | G_PARAM_STATIC_STRINGS)
+                );
 }
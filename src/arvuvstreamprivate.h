@@ -38,7 +38,8 @@ G_BEGIN_DECLS
 
 ArvStream * 	arv_uv_stream_new	(ArvUvDevice *uv_device,
                                          ArvStreamCallback callback, void *user_data, GDestroyNotify destroy,
-                                         ArvUvUsbMode usb_mode, guint64 maximum_transfer_size, GError **error);
+                                         ArvUvUsbMode usb_mode, guint64 maximum_transfer_size,
+                                         gboolean transfer_tuning, GError **error);
 
 G_END_DECLS
 
@@ -264,22 +264,29 @@ _open_device (ArvInterface *interface, const char *device_id, GError **error)
 	return NULL;
 }
 
+static GMutex arv_v4l2_interface_open_mutex;
+
 static ArvDevice *
 arv_v4l2_interface_open_device (ArvInterface *interface, const char *device_id, GError **error)
 {
 	ArvDevice *device;
 	GError *local_error = NULL;
 
-	device = _open_device (interface, device_id, error);
-	if (ARV_IS_DEVICE (device) || local_error != NULL) {
-		if (local_error != NULL)
-			g_propagate_error (error, local_error);
-		return device;
+	/* The device list may be refreshed here, serialize concurrent openings */
+	g_mutex_lock (&arv_v4l2_interface_open_mutex);
+
+	device = _open_device (interface, device_id, &local_error);
+	if (!ARV_IS_DEVICE (device) && local_error == NULL) {
+		_discover (ARV_V4L2_INTERFACE (interface), NULL);
+		device = _open_device (interface, device_id, &local_error);
 	}
 
-	_discover (ARV_V4L2_INTERFACE (interface), NULL);
+	g_mutex_unlock (&arv_v4l2_interface_open_mutex);
+
+	if (local_error != NULL)
+		g_propagate_error (error, local_error);
 
-	return _open_device (interface, device_id, error);
+	return device;
 }
 
 static ArvInterface *arv_v4l2_interface = NULL;
@@ -21,16 +21,17 @@
 #ifndef ARV_WAKEUP_PRIVATE_H
 #define ARV_WAKEUP_PRIVATE_H
 
+#include <arvapi.h>
 #include <arvtypes.h>
 
 typedef struct _ArvWakeup ArvWakeup;
 
-ArvWakeup * 	arv_wakeup_new            (void);
-void            arv_wakeup_free           (ArvWakeup *wakeup);
+ARV_API ArvWakeup * 	arv_wakeup_new            (void);
+ARV_API void            arv_wakeup_free           (ArvWakeup *wakeup);
 
-void            arv_wakeup_get_pollfd     (ArvWakeup *wakeup,
-					   GPollFD *poll_fd);
-void            arv_wakeup_signal         (ArvWakeup *wakeup);
-void            arv_wakeup_acknowledge    (ArvWakeup *wakeup);
+ARV_API void            arv_wakeup_get_pollfd     (ArvWakeup *wakeup,
+						   GPollFD *poll_fd);
+ARV_API void            arv_wakeup_signal         (ArvWakeup *wakeup);
+ARV_API void            arv_wakeup_acknowledge    (ArvWakeup *wakeup);
 
 #endif
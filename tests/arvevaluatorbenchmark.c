@@ -0,0 +1,158 @@
+/* SPDX-License-Identifier:Unlicense */
+
+/* Measure the evaluation throughput of the Genicam expression evaluator, using expressions similar to the ones found
+ * in the SwissKnife and Converter nodes of real device descriptions. */
+
+#include <arv.h>
+#include <arvevaluatorprivate.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int arv_option_n_iterations = 1000000;
+static char *arv_option_debug_domains = NULL;
+
+static const GOptionEntry arv_option_entries[] =
+{
+	{
+		"iterations",				'n', 0, G_OPTION_ARG_INT,
+		&arv_option_n_iterations,		"Number of evaluations per expression", NULL
+	},
+	{
+		"debug", 				'd', 0, G_OPTION_ARG_STRING,
+		&arv_option_debug_domains, 		"Debug domains", NULL
+	},
+	{ NULL }
+};
+
+static const char *expressions[] = {
+	"(24+2)*2",
+	"(0 & 1)=0?((0 & 1)+2):1",
+	"(~(~0xC2000221|0xFEFFFFFF)) ? 2:0",
+	"ROUND(10.99, 1)",
+	"X*2+Y",
+	"(X>Y)?X-Y:Y-X",
+	"((X & 0xFF) << 8) | (Y >> 8)",
+	"SUB_EXP + TEN * X",
+	"(X + 2 * OFFSET) / (SCALE * 4)",
+};
+
+static void
+run (ArvEvaluator *evaluator, const char *expression)
+{
+	GError *error = NULL;
+	gint64 start_time;
+	double int64_time;
+	double double_time;
+	gint64 v_int64;
+	double v_double;
+	int i;
+
+	arv_evaluator_set_expression (evaluator, expression);
+
+	v_int64 = arv_evaluator_evaluate_as_int64 (evaluator, NULL);
+	v_double = arv_evaluator_evaluate_as_double (evaluator, &error);
+	if (error != NULL) {
+		printf ("%-40s failed (%s)\n", expression, error->message);
+		g_clear_error (&error);
+		return;
+	}
+
+	start_time = g_get_monotonic_time ();
+	for (i = 0; i < arv_option_n_iterations; i++)
+		arv_evaluator_evaluate_as_int64 (evaluator, NULL);
+	int64_time = 1000.0 * (double) (g_get_monotonic_time () - start_time) / (double) arv_option_n_iterations;
+
+	start_time = g_get_monotonic_time ();
+	for (i = 0; i < arv_option_n_iterations; i++)
+		arv_evaluator_evaluate_as_double (evaluator, NULL);
+	double_time = 1000.0 * (double) (g_get_monotonic_time () - start_time) / (double) arv_option_n_iterations;
+
+	printf ("%-40s = %10" G_GINT64_FORMAT " %12g %8.1f ns/int64 %8.1f ns/double\n",
+		expression, v_int64, v_double, int64_time, double_time);
+}
+
+static void
+run_variables (ArvEvaluator *evaluator)
+{
+	gint64 start_time;
+	guint x_slot, y_slot;
+	int i;
+
+	arv_evaluator_set_expression (evaluator, "X*2+Y");
+
+	start_time = g_get_monotonic_time ();
+	for (i = 0; i < arv_option_n_iterations; i++) {
+		arv_evaluator_set_int64_variable (evaluator, "X", i);
+		arv_evaluator_set_int64_variable (evaluator, "Y", i + 1);
+		arv_evaluator_evaluate_as_int64 (evaluator, NULL);
+	}
+	printf ("%-40s %8.1f ns/evaluation\n", "Set by name and evaluate",
+		1000.0 * (double) (g_get_monotonic_time () - start_time) / (double) arv_option_n_iterations);
+
+	x_slot = arv_evaluator_get_variable_slot (evaluator, "X");
+	y_slot = arv_evaluator_get_variable_slot (evaluator, "Y");
+
+	start_time = g_get_monotonic_time ();
+	for (i = 0; i < arv_option_n_iterations; i++) {
+		arv_evaluator_set_int64_variable_by_slot (evaluator, x_slot, i);
+		arv_evaluator_set_int64_variable_by_slot (evaluator, y_slot, i + 1);
+		arv_evaluator_evaluate_as_int64 (evaluator, NULL);
+	}
+	printf ("%-40s %8.1f ns/evaluation\n", "Set by slot and evaluate",
+		1000.0 * (double) (g_get_monotonic_time () - start_time) / (double) arv_option_n_iterations);
+}
+
+int
+main (int argc, char **argv)
+{
+	ArvEvaluator *evaluator;
+	GOptionContext *context;
+	GError *error = NULL;
+	gint64 start_time;
+	int i;
+
+	context = g_option_context_new (NULL);
+	g_option_context_set_summary (context, "Genicam expression evaluator benchmark.");
+	g_option_context_add_main_entries (context, arv_option_entries, NULL);
+
+	if (!g_option_context_parse (context, &argc, &argv, &error)) {
+		g_option_context_free (context);
+		printf ("Option parsing failed: %s\n", error->message);
+		g_error_free (error);
+		return EXIT_FAILURE;
+	}
+
+	g_option_context_free (context);
+
+	arv_debug_enable (arv_option_debug_domains);
+
+	evaluator = arv_evaluator_new (NULL);
+
+	arv_evaluator_set_int64_variable (evaluator, "X", 1234);
+	arv_evaluator_set_int64_variable (evaluator, "Y", 567);
+	arv_evaluator_set_double_variable (evaluator, "SCALE", 0.5);
+	arv_evaluator_set_sub_expression (evaluator, "SUB_EXP", "2*Y+1");
+	arv_evaluator_set_constant (evaluator, "TEN", "10");
+	arv_evaluator_set_constant (evaluator, "OFFSET", "16");
+
+	printf ("Iterations = %d\n", arv_option_n_iterations);
+
+	start_time = g_get_monotonic_time ();
+	for (i = 0; i < G_N_ELEMENTS (expressions); i++) {
+		arv_evaluator_set_expression (evaluator, expressions[i]);
+		arv_evaluator_evaluate_as_int64 (evaluator, NULL);
+	}
+	printf ("Compilation = %.1f us/expression (including first evaluation)\n",
+		(double) (g_get_monotonic_time () - start_time) / (double) G_N_ELEMENTS (expressions));
+
+	for (i = 0; i < G_N_ELEMENTS (expressions); i++)
+		run (evaluator, expressions[i]);
+
+	run_variables (evaluator);
+
+	g_object_unref (evaluator);
+
+	arv_shutdown ();
+
+	return EXIT_SUCCESS;
+}
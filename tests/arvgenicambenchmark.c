@@ -0,0 +1,374 @@
+/* SPDX-License-Identifier:Unlicense */
+
+/* Measure the time spent in the Genicam node tree for reading integer features of a fake device. The register
+ * accesses of the fake device are memory copies, which makes the node evaluation cost dominant.
+ *
+ * The --parse option measures the time spent building the node tree from the Genicam data of the device, and the
+ * memory used by the resulting tree. The memory use is estimated from the resident set size increase after the
+ * creation of a number of trees, which is only available on Linux.
+ *
+ * The --open option compares the time needed for opening a set of devices one after the other, and concurrently
+ * using arv_open_devices. By default, the in process fake interface is used, which only measures the Genicam data
+ * parsing and the initial feature reads. With --gv, one GigE Vision fake camera is started on each of the addresses
+ * 127.0.0.1 to 127.0.0.n. Except for the first one, these addresses must be added to the loopback interface
+ * beforehand, for example with:
+ *
+ *   for i in $(seq 2 16); do sudo ip addr add 127.0.0.$i/8 dev lo; done */
+
+#include <arv.h>
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef G_OS_UNIX
+#include <unistd.h>
+#endif
+
+static char **arv_option_filenames = NULL;
+static char *arv_option_features = NULL;
+static int arv_option_n_iterations = 100000;
+static gboolean arv_option_cache = FALSE;
+static int arv_option_n_parse_iterations = 0;
+static int arv_option_n_documents = 20;
+static int arv_option_n_open_devices = 0;
+static gboolean arv_option_gv = FALSE;
+static char *arv_option_debug_domains = NULL;
+
+static const GOptionEntry arv_option_entries[] =
+{
+	{
+		G_OPTION_REMAINING,			' ', 0, G_OPTION_ARG_FILENAME_ARRAY,
+		&arv_option_filenames,			NULL, "[genicam.xml]"
+	},
+	{
+		"features",				'f', 0, G_OPTION_ARG_STRING,
+		&arv_option_features,			"Comma separated list of integer features", NULL
+	},
+	{
+		"iterations",				'n', 0, G_OPTION_ARG_INT,
+		&arv_option_n_iterations,		"Number of reads per feature", NULL
+	},
+	{
+		"cache",				'c', 0, G_OPTION_ARG_NONE,
+		&arv_option_cache,			"Enable the register and value caches", NULL
+	},
+	{
+		"parse",				'p', 0, G_OPTION_ARG_INT,
+		&arv_option_n_parse_iterations,		"Number of parsings of the Genicam data", NULL
+	},
+	{
+		"documents",				'm', 0, G_OPTION_ARG_INT,
+		&arv_option_n_documents,		"Number of simultaneous documents for memory use estimation", NULL
+	},
+	{
+		"open",					'o', 0, G_OPTION_ARG_INT,
+		&arv_option_n_open_devices,		"Number of devices for the opening benchmark", NULL
+	},
+	{
+		"gv",					'g', 0, G_OPTION_ARG_NONE,
+		&arv_option_gv,				"Use GigE Vision fake cameras for the opening benchmark", NULL
+	},
+	{
+		"debug", 				'd', 0, G_OPTION_ARG_STRING,
+		&arv_option_debug_domains, 		"Debug domains", NULL
+	},
+	{ NULL }
+};
+
+static void
+run (ArvDevice *device, const char *feature)
+{
+	GError *error = NULL;
+	gint64 start_time;
+	gint64 elapsed_time;
+	gint64 value;
+	int i;
+
+	value = arv_device_get_integer_feature_value (device, feature, &error);
+	if (error != NULL) {
+		printf ("%-32s failed (%s)\n", feature, error->message);
+		g_clear_error (&error);
+		return;
+	}
+
+	start_time = g_get_monotonic_time ();
+
+	for (i = 0; i < arv_option_n_iterations; i++)
+		arv_device_get_integer_feature_value (device, feature, NULL);
+
+	elapsed_time = g_get_monotonic_time () - start_time;
+
+	printf ("%-32s = %12" G_GINT64_FORMAT " %10.1f ns/read\n", feature, value,
+		1000.0 * (double) elapsed_time / (double) arv_option_n_iterations);
+}
+
+static gint64
+get_resident_size (void)
+{
+#ifdef G_OS_UNIX
+	unsigned long size, resident;
+	FILE *file;
+	int n_items;
+
+	file = fopen ("/proc/self/statm", "r");
+	if (file == NULL)
+		return -1;
+
+	n_items = fscanf (file, "%lu %lu", &size, &resident);
+	fclose (file);
+
+	if (n_items != 2)
+		return -1;
+
+	return (gint64) resident * (gint64) sysconf (_SC_PAGESIZE);
+#else
+	return -1;
+#endif
+}
+
+static void
+count_nodes (ArvDomNode *node, guint *n_nodes, guint *n_properties, guint *n_texts)
+{
+	ArvDomNode *iter;
+
+	(*n_nodes)++;
+	if (ARV_IS_GC_PROPERTY_NODE (node))
+		(*n_properties)++;
+	if (ARV_IS_DOM_TEXT (node))
+		(*n_texts)++;
+
+	for (iter = arv_dom_node_get_first_child (node); iter != NULL; iter = arv_dom_node_get_next_sibling (iter))
+		count_nodes (iter, n_nodes, n_properties, n_texts);
+}
+
+static void
+run_parse (const char *xml, size_t size)
+{
+	ArvGc *genicam;
+	ArvGc **documents;
+	gint64 start_time;
+	gint64 resident_size;
+	guint n_nodes = 0, n_properties = 0, n_texts = 0;
+	int i;
+
+	genicam = arv_gc_new (NULL, xml, size);
+	if (!ARV_IS_GC (genicam)) {
+		printf ("Invalid Genicam data\n");
+		return;
+	}
+	count_nodes (ARV_DOM_NODE (genicam), &n_nodes, &n_properties, &n_texts);
+	g_object_unref (genicam);
+
+	start_time = g_get_monotonic_time ();
+	for (i = 0; i < arv_option_n_parse_iterations; i++)
+		g_object_unref (arv_gc_new (NULL, xml, size));
+
+	printf ("Genicam parsing\n");
+	printf ("  XML size      = %zu bytes\n", size);
+	printf ("  DOM nodes     = %u (%u properties, %u texts)\n", n_nodes, n_properties, n_texts);
+	printf ("  Parsing time  = %.3f ms\n",
+		(double) (g_get_monotonic_time () - start_time) / (1000.0 * arv_option_n_parse_iterations));
+
+	documents = g_new0 (ArvGc *, MAX (arv_option_n_documents, 1));
+
+	resident_size = get_resident_size ();
+	for (i = 0; i < arv_option_n_documents; i++)
+		documents[i] = arv_gc_new (NULL, xml, size);
+
+	if (resident_size >= 0 && arv_option_n_documents > 0)
+		printf ("  Memory use    = %.1f kB/document\n",
+			(double) (get_resident_size () - resident_size) / (1024.0 * arv_option_n_documents));
+	else
+		printf ("  Memory use    = n/a\n");
+
+	for (i = 0; i < arv_option_n_documents; i++)
+		g_clear_object (&documents[i]);
+	g_free (documents);
+}
+
+static gint64
+open_sequentially (const char **device_ids)
+{
+	gint64 start_time;
+	int i;
+
+	start_time = g_get_monotonic_time ();
+
+	for (i = 0; device_ids[i] != NULL; i++) {
+		GError *error = NULL;
+		ArvDevice *device;
+
+		device = arv_open_device (device_ids[i], &error);
+		if (!ARV_IS_DEVICE (device)) {
+			printf ("Failed to open '%s' (%s)\n", device_ids[i],
+				error != NULL ? error->message : "Unknown error");
+			g_clear_error (&error);
+			return -1;
+		}
+
+		g_object_unref (device);
+	}
+
+	return g_get_monotonic_time () - start_time;
+}
+
+static gint64
+open_concurrently (const char **device_ids)
+{
+	GError *error = NULL;
+	GPtrArray *devices;
+	gint64 start_time;
+
+	start_time = g_get_monotonic_time ();
+
+	devices = arv_open_devices (device_ids, &error);
+	if (devices == NULL) {
+		printf ("Failed to open the devices (%s)\n", error != NULL ? error->message : "Unknown error");
+		g_clear_error (&error);
+		return -1;
+	}
+
+	g_ptr_array_unref (devices);
+
+	return g_get_monotonic_time () - start_time;
+}
+
+static gboolean
+run_open (int n_devices)
+{
+	GPtrArray *simulators;
+	char **device_ids;
+	gint64 sequential_time;
+	gint64 concurrent_time;
+	gboolean success = FALSE;
+	int i;
+
+	if (n_devices > 254) {
+		printf ("Invalid number of devices\n");
+		return FALSE;
+	}
+
+	/* Only measure the Genicam data download */
+	g_setenv ("ARV_GENICAM_CACHE", "disable", TRUE);
+
+	simulators = g_ptr_array_new_with_free_func (g_object_unref);
+	device_ids = g_new0 (char *, n_devices + 1);
+
+	for (i = 0; i < n_devices; i++) {
+		if (arv_option_gv) {
+			ArvGvFakeCamera *simulator;
+			char *serial_number;
+
+			device_ids[i] = g_strdup_printf ("127.0.0.%d", i + 1);
+			serial_number = g_strdup_printf ("GVOpen%02d", i + 1);
+
+			simulator = arv_gv_fake_camera_new (device_ids[i], serial_number);
+			g_free (serial_number);
+
+			if (!ARV_IS_GV_FAKE_CAMERA (simulator) || !arv_gv_fake_camera_is_running (simulator)) {
+				printf ("Failed to start the fake camera on %s\n", device_ids[i]);
+				g_clear_object (&simulator);
+				goto out;
+			}
+
+			g_ptr_array_add (simulators, simulator);
+		} else
+			device_ids[i] = g_strdup ("Fake_1");
+	}
+
+	if (!arv_option_gv)
+		arv_enable_interface ("Fake");
+
+	sequential_time = open_sequentially ((const char **) device_ids);
+	if (sequential_time < 0)
+		goto out;
+
+	concurrent_time = open_concurrently ((const char **) device_ids);
+	if (concurrent_time < 0)
+		goto out;
+
+	printf ("Open %d %s device(s)\n", n_devices, arv_option_gv ? "GigE Vision fake" : "fake");
+	printf ("  Sequential    = %10.3f ms\n", (double) sequential_time / 1000.0);
+	printf ("  Concurrent    = %10.3f ms\n", (double) concurrent_time / 1000.0);
+	if (concurrent_time > 0)
+		printf ("  Speedup       = %10.2f\n", (double) sequential_time / (double) concurrent_time);
+
+	success = TRUE;
+
+out:
+	g_strfreev (device_ids);
+	g_ptr_array_unref (simulators);
+
+	return success;
+}
+
+int
+main (int argc, char **argv)
+{
+	ArvDevice *device;
+	GOptionContext *context;
+	GError *error = NULL;
+	char **features;
+	gint64 start_time;
+	gboolean success = TRUE;
+	int i;
+
+	context = g_option_context_new (NULL);
+	g_option_context_set_summary (context, "Genicam integer feature read benchmark.");
+	g_option_context_add_main_entries (context, arv_option_entries, NULL);
+
+	if (!g_option_context_parse (context, &argc, &argv, &error)) {
+		g_option_context_free (context);
+		printf ("Option parsing failed: %s\n", error->message);
+		g_error_free (error);
+		return EXIT_FAILURE;
+	}
+
+	g_option_context_free (context);
+
+	arv_debug_enable (arv_option_debug_domains);
+
+	if (arv_option_filenames != NULL && arv_option_filenames[0] != NULL) {
+		arv_set_fake_camera_genicam_filename (arv_option_filenames[0]);
+		if (arv_option_features == NULL)
+			arv_option_features = g_strdup ("P_RWInteger,IntRegisterB,IntSwissKnifeTest,"
+							"MaskedIntUnsignedRegisterC,IntSwissKnifeTestSubAndConstant");
+	} else if (arv_option_features == NULL)
+		arv_option_features = g_strdup ("Width,Height,PayloadSize");
+
+	start_time = g_get_monotonic_time ();
+
+	device = arv_fake_device_new ("TEST0", &error);
+	if (!ARV_IS_DEVICE (device)) {
+		printf ("Failed to create the fake device (%s)\n", error != NULL ? error->message : "Unknown error");
+		g_clear_error (&error);
+		return EXIT_FAILURE;
+	}
+
+	printf ("Device creation = %.3f ms\n", (double) (g_get_monotonic_time () - start_time) / 1000.0);
+
+	if (arv_option_cache)
+		arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_ENABLE);
+	printf ("Iterations      = %d\n", arv_option_n_iterations);
+
+	features = g_strsplit (arv_option_features, ",", -1);
+	for (i = 0; features[i] != NULL; i++)
+		run (device, features[i]);
+	g_strfreev (features);
+
+	if (arv_option_n_parse_iterations > 0) {
+		const char *xml;
+		size_t size;
+
+		xml = arv_device_get_genicam_xml (device, &size);
+		if (xml != NULL)
+			run_parse (xml, size);
+	}
+
+	g_object_unref (device);
+
+	if (arv_option_n_open_devices > 0)
+		success = run_open (arv_option_n_open_devices);
+
+	arv_shutdown ();
+
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,249 @@
+/* SPDX-License-Identifier:Unlicense */
+
+/* Measure the GigE Vision stream receiver throughput against a fake GigE Vision camera running on the loopback
+ * interface, for an increasing number of receive threads. A reproducible packet loss and reordering pattern can be
+ * injected, and the packet resend efficiency compared by running each case with and without packet resend. */
+
+#include <arv.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int arv_option_max_threads = 4;
+static int arv_option_width = 2048;
+static int arv_option_height = 2048;
+static int arv_option_packet_size = 8192;
+static double arv_option_frame_rate = 1000.0;
+static double arv_option_duration = 5.0;
+static int arv_option_n_buffers = 50;
+static gboolean arv_option_zero_copy = FALSE;
+static gboolean arv_option_high_rate = FALSE;
+static double arv_option_lost_ratio = 0.0;
+static int arv_option_burst_length = 1;
+static double arv_option_reorder_ratio = 0.0;
+static int arv_option_frame_history = 0;
+static int arv_option_seed = 1;
+static gboolean arv_option_compare_resend = FALSE;
+static char *arv_option_debug_domains = NULL;
+
+static const GOptionEntry arv_option_entries[] =
+{
+	{
+		"max-threads",				't', 0, G_OPTION_ARG_INT,
+		&arv_option_max_threads,		"Maximum number of receive threads", NULL
+	},
+	{
+		"width",				'W', 0, G_OPTION_ARG_INT,
+		&arv_option_width,			"Image width", NULL
+	},
+	{
+		"height",				'H', 0, G_OPTION_ARG_INT,
+		&arv_option_height,			"Image height", NULL
+	},
+	{
+		"packet-size",				'p', 0, G_OPTION_ARG_INT,
+		&arv_option_packet_size,		"Stream packet size", NULL
+	},
+	{
+		"frequency",				'f', 0, G_OPTION_ARG_DOUBLE,
+		&arv_option_frame_rate,			"Acquisition frame rate", NULL
+	},
+	{
+		"duration",				'u', 0, G_OPTION_ARG_DOUBLE,
+		&arv_option_duration,			"Duration of each run, in seconds", NULL
+	},
+	{
+		"n-buffers",				'b', 0, G_OPTION_ARG_INT,
+		&arv_option_n_buffers,			"Number of stream buffers", NULL
+	},
+	{
+		"zero-copy",				'z', 0, G_OPTION_ARG_NONE,
+		&arv_option_zero_copy,			"Receive payload directly into buffer memory", NULL
+	},
+	{
+		"high-rate",				'r', 0, G_OPTION_ARG_NONE,
+		&arv_option_high_rate,			"Use the fake camera high rate stream mode", NULL
+	},
+	{
+		"lost-ratio",				'L', 0, G_OPTION_ARG_DOUBLE,
+		&arv_option_lost_ratio,			"Lost packet ratio, per thousand", NULL
+	},
+	{
+		"burst-length",				'B', 0, G_OPTION_ARG_INT,
+		&arv_option_burst_length,		"Packets lost per loss event", NULL
+	},
+	{
+		"reorder-ratio",			'O', 0, G_OPTION_ARG_DOUBLE,
+		&arv_option_reorder_ratio,		"Reordered packet ratio, per thousand", NULL
+	},
+	{
+		"frame-history",			'y', 0, G_OPTION_ARG_INT,
+		&arv_option_frame_history,		"Number of frames kept by the camera for packet resend", NULL
+	},
+	{
+		"seed",					's', 0, G_OPTION_ARG_INT,
+		&arv_option_seed,			"Packet loss random seed", NULL
+	},
+	{
+		"compare-resend",			'c', 0, G_OPTION_ARG_NONE,
+		&arv_option_compare_resend,		"Run each case without, then with packet resend", NULL
+	},
+	{
+		"debug", 				'd', 0, G_OPTION_ARG_STRING,
+		&arv_option_debug_domains, 		"Debug domains", NULL
+	},
+	{ NULL }
+};
+
+static void
+run (ArvCamera *camera, guint n_threads, ArvGvStreamPacketResend packet_resend)
+{
+	ArvStream *stream;
+	GError *error = NULL;
+	gint64 start_time;
+	gint64 end_time;
+	gint64 elapsed_time;
+	guint64 n_completed_buffers = 0;
+	guint64 n_failures;
+	guint64 n_missing_packets;
+	guint64 n_resend_requests;
+	guint64 n_resent_packets;
+	guint64 n_transferred_bytes;
+	size_t payload;
+	int i;
+
+	stream = arv_camera_create_stream (camera, NULL, NULL, NULL, &error);
+	if (!ARV_IS_STREAM (stream)) {
+		printf ("Failed to create stream (%s)\n", error != NULL ? error->message : "Unknown error");
+		g_clear_error (&error);
+		return;
+	}
+
+	g_object_set (stream,
+		      "receive-threads", n_threads,
+		      "packet-resend", packet_resend,
+		      "socket-buffer", ARV_GV_STREAM_SOCKET_BUFFER_AUTO,
+		      "zero-copy", arv_option_zero_copy,
+		      NULL);
+
+	payload = arv_camera_get_payload (camera, NULL);
+	for (i = 0; i < arv_option_n_buffers; i++)
+		arv_stream_push_buffer (stream, arv_buffer_new (payload, NULL));
+
+	arv_camera_start_acquisition (camera, &error);
+	if (error != NULL) {
+		printf ("Failed to start acquisition (%s)\n", error->message);
+		g_clear_error (&error);
+		g_object_unref (stream);
+		return;
+	}
+
+	start_time = g_get_monotonic_time ();
+	end_time = start_time + arv_option_duration * G_USEC_PER_SEC;
+
+	do {
+		ArvBuffer *buffer;
+
+		buffer = arv_stream_timeout_pop_buffer (stream, 100000);
+		if (buffer != NULL) {
+			if (arv_buffer_get_status (buffer) == ARV_BUFFER_STATUS_SUCCESS)
+				n_completed_buffers++;
+			arv_stream_push_buffer (stream, buffer);
+		}
+	} while (g_get_monotonic_time () < end_time);
+
+	elapsed_time = g_get_monotonic_time () - start_time;
+
+	arv_camera_stop_acquisition (camera, NULL);
+
+	n_failures = arv_stream_get_info_uint64_by_name (stream, "n_failures");
+	n_missing_packets = arv_stream_get_info_uint64_by_name (stream, "n_missing_packets");
+	n_resend_requests = arv_stream_get_info_uint64_by_name (stream, "n_resend_requests");
+	n_resent_packets = arv_stream_get_info_uint64_by_name (stream, "n_resent_packets");
+	n_transferred_bytes = arv_stream_get_info_uint64_by_name (stream, "n_transferred_bytes");
+
+	printf ("%2u thread(s), resend %-6s: %8.1f fps %10.1f MB/s  failures = %" G_GUINT64_FORMAT
+		"  missing packets = %" G_GUINT64_FORMAT "  resend requests = %" G_GUINT64_FORMAT
+		"  resent packets = %" G_GUINT64_FORMAT "\n",
+		n_threads,
+		packet_resend == ARV_GV_STREAM_PACKET_RESEND_NEVER ? "never" : "always",
+		(double) n_completed_buffers * G_USEC_PER_SEC / (double) elapsed_time,
+		(double) n_transferred_bytes / (double) elapsed_time,
+		n_failures, n_missing_packets, n_resend_requests, n_resent_packets);
+
+	g_object_unref (stream);
+}
+
+int
+main (int argc, char **argv)
+{
+	ArvGvFakeCamera *simulator;
+	ArvCamera *camera;
+	GOptionContext *context;
+	GError *error = NULL;
+	int i;
+
+	context = g_option_context_new (NULL);
+	g_option_context_set_summary (context, "GigE Vision stream receiver benchmark.");
+	g_option_context_add_main_entries (context, arv_option_entries, NULL);
+
+	if (!g_option_context_parse (context, &argc, &argv, &error)) {
+		g_option_context_free (context);
+		printf ("Option parsing failed: %s\n", error->message);
+		g_error_free (error);
+		return EXIT_FAILURE;
+	}
+
+	g_option_context_free (context);
+
+	arv_debug_enable (arv_option_debug_domains);
+
+	simulator = arv_gv_fake_camera_new ("127.0.0.1", "GVBenchmark");
+	if (!ARV_IS_GV_FAKE_CAMERA (simulator)) {
+		printf ("Failed to start the fake camera\n");
+		return EXIT_FAILURE;
+	}
+
+	g_object_set (simulator,
+		      "gvsp-high-rate", arv_option_high_rate,
+		      "gvsp-lost-ratio", arv_option_lost_ratio / 1000.0,
+		      "gvsp-burst-length", MAX (arv_option_burst_length, 1),
+		      "gvsp-reorder-ratio", arv_option_reorder_ratio / 1000.0,
+		      "random-seed", (guint) arv_option_seed,
+		      NULL);
+	if (arv_option_frame_history > 0)
+		g_object_set (simulator, "frame-history", CLAMP (arv_option_frame_history, 1, 1024), NULL);
+
+	camera = arv_camera_new ("Aravis-GVBenchmark", &error);
+	if (!ARV_IS_CAMERA (camera)) {
+		printf ("Failed to open the fake camera (%s)\n", error != NULL ? error->message : "Unknown error");
+		g_clear_error (&error);
+		g_object_unref (simulator);
+		return EXIT_FAILURE;
+	}
+
+	arv_camera_set_region (camera, 0, 0, arv_option_width, arv_option_height, NULL);
+	arv_camera_gv_set_packet_size (camera, arv_option_packet_size, NULL);
+	arv_camera_set_frame_rate (camera, arv_option_frame_rate, NULL);
+
+	printf ("Image size     = %dx%d\n", arv_option_width, arv_option_height);
+	printf ("Packet size    = %u\n", arv_camera_gv_get_packet_size (camera, NULL));
+	printf ("Frame rate     = %g fps\n", arv_camera_get_frame_rate (camera, NULL));
+	printf ("Zero copy      = %s\n", arv_option_zero_copy ? "yes" : "no");
+	printf ("High rate      = %s\n", arv_option_high_rate ? "yes" : "no");
+	printf ("Lost ratio     = %g per thousand (burst of %d)\n", arv_option_lost_ratio,
+		MAX (arv_option_burst_length, 1));
+	printf ("Reorder ratio  = %g per thousand\n", arv_option_reorder_ratio);
+
+	for (i = 1; i <= arv_option_max_threads; i++) {
+		if (arv_option_compare_resend)
+			run (camera, i, ARV_GV_STREAM_PACKET_RESEND_NEVER);
+		run (camera, i, ARV_GV_STREAM_PACKET_RESEND_ALWAYS);
+	}
+
+	g_object_unref (camera);
+	g_object_unref (simulator);
+
+	arv_shutdown ();
+
+	return EXIT_SUCCESS;
+}
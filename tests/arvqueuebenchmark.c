@@ -0,0 +1,180 @@
+/* SPDX-License-Identifier:Unlicense */
+
+/* Compare the buffer queue round trip throughput of GAsyncQueue and ArvQueue, using the same pattern as ArvStream: a
+ * receiving thread pops buffers from an input queue and pushes them to an output queue, while the application thread
+ * pops them from the output queue and pushes them back to the input queue. */
+
+#include <arv.h>
+#include "../src/arvqueueprivate.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static int arv_option_n_buffers = 16;
+static int arv_option_n_iterations = 1000000;
+static int arv_option_n_consumers = 1;
+
+static const GOptionEntry arv_option_entries[] =
+{
+	{
+		"n-buffers",				'b', 0, G_OPTION_ARG_INT,
+		&arv_option_n_buffers,			"Number of buffers in flight", NULL
+	},
+	{
+		"n-iterations",				'n', 0, G_OPTION_ARG_INT,
+		&arv_option_n_iterations,		"Number of buffer round trips", NULL
+	},
+	{
+		"n-consumers",				'c', 0, G_OPTION_ARG_INT,
+		&arv_option_n_consumers,		"Number of application threads", NULL
+	},
+	{ NULL }
+};
+
+typedef struct {
+	gpointer (*new) (void);
+	void (*free) (gpointer queue);
+	void (*push) (gpointer queue, gpointer data);
+	gpointer (*timeout_pop) (gpointer queue, guint64 timeout_us);
+} QueueInterface;
+
+typedef struct {
+	const QueueInterface *interface;
+	gpointer input_queue;
+	gpointer output_queue;
+	gint n_remaining_iterations;
+	gboolean cancel;
+} BenchmarkData;
+
+static gpointer
+async_queue_timeout_pop (gpointer queue, guint64 timeout_us)
+{
+	return g_async_queue_timeout_pop (queue, timeout_us);
+}
+
+static const QueueInterface async_queue_interface = {
+	(gpointer (*) (void)) g_async_queue_new,
+	(void (*) (gpointer)) g_async_queue_unref,
+	(void (*) (gpointer, gpointer)) g_async_queue_push,
+	async_queue_timeout_pop
+};
+
+static const QueueInterface arv_queue_interface = {
+	(gpointer (*) (void)) arv_queue_new,
+	(void (*) (gpointer)) arv_queue_free,
+	(void (*) (gpointer, gpointer)) arv_queue_push,
+	(gpointer (*) (gpointer, guint64)) arv_queue_timeout_pop
+};
+
+static gpointer
+stream_thread (gpointer user_data)
+{
+	BenchmarkData *data = user_data;
+
+	while (!g_atomic_int_get (&data->cancel)) {
+		gpointer buffer;
+
+		buffer = data->interface->timeout_pop (data->input_queue, 1000);
+		if (buffer != NULL)
+			data->interface->push (data->output_queue, buffer);
+	}
+
+	return NULL;
+}
+
+static gpointer
+consumer_thread (gpointer user_data)
+{
+	BenchmarkData *data = user_data;
+
+	while (g_atomic_int_add (&data->n_remaining_iterations, -1) > 0) {
+		gpointer buffer;
+
+		do {
+			buffer = data->interface->timeout_pop (data->output_queue, 100000);
+		} while (buffer == NULL);
+
+		data->interface->push (data->input_queue, buffer);
+	}
+
+	return NULL;
+}
+
+static void
+run (const char *name, const QueueInterface *interface)
+{
+	BenchmarkData data;
+	GThread *stream;
+	GThread **consumers;
+	gint64 start_time;
+	gint64 elapsed_time;
+	int i;
+
+	data.interface = interface;
+	data.input_queue = interface->new ();
+	data.output_queue = interface->new ();
+	data.n_remaining_iterations = arv_option_n_iterations;
+	data.cancel = FALSE;
+
+	for (i = 0; i < arv_option_n_buffers; i++)
+		interface->push (data.input_queue, GINT_TO_POINTER (i + 1));
+
+	start_time = g_get_monotonic_time ();
+
+	stream = g_thread_new ("stream", stream_thread, &data);
+	consumers = g_new (GThread *, arv_option_n_consumers);
+	for (i = 0; i < arv_option_n_consumers; i++)
+		consumers[i] = g_thread_new ("consumer", consumer_thread, &data);
+
+	for (i = 0; i < arv_option_n_consumers; i++)
+		g_thread_join (consumers[i]);
+
+	elapsed_time = g_get_monotonic_time () - start_time;
+
+	g_atomic_int_set (&data.cancel, TRUE);
+	g_thread_join (stream);
+	g_free (consumers);
+
+	while (interface->timeout_pop (data.input_queue, 0) != NULL);
+	while (interface->timeout_pop (data.output_queue, 0) != NULL);
+
+	interface->free (data.input_queue);
+	interface->free (data.output_queue);
+
+	printf ("%-12s %10.0f round trips/s %8.1f ns/round trip\n", name,
+		(double) arv_option_n_iterations * G_USEC_PER_SEC / (double) elapsed_time,
+		(double) elapsed_time * 1000.0 / (double) arv_option_n_iterations);
+}
+
+int
+main (int argc, char **argv)
+{
+	GOptionContext *context;
+	GError *error = NULL;
+
+	context = g_option_context_new (NULL);
+	g_option_context_set_summary (context, "Buffer queue benchmark.");
+	g_option_context_add_main_entries (context, arv_option_entries, NULL);
+
+	if (!g_option_context_parse (context, &argc, &argv, &error)) {
+		g_option_context_free (context);
+		printf ("Option parsing failed: %s\n", error->message);
+		g_error_free (error);
+		return EXIT_FAILURE;
+	}
+
+	g_option_context_free (context);
+
+	if (arv_option_n_buffers < 1 || arv_option_n_consumers < 1) {
+		printf ("Invalid number of buffers or consumers\n");
+		return EXIT_FAILURE;
+	}
+
+	printf ("Buffers      = %d\n", arv_option_n_buffers);
+	printf ("Round trips  = %d\n", arv_option_n_iterations);
+	printf ("Consumers    = %d\n", arv_option_n_consumers);
+
+	run ("GAsyncQueue", &async_queue_interface);
+	run ("ArvQueue", &arv_queue_interface);
+
+	return EXIT_SUCCESS;
+}
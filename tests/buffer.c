@@ -2,6 +2,9 @@
 
 #include <glib.h>
 #include <arv.h>
+#include <string.h>
+#include <arvbufferprivate.h>
+#include <arvgendcprivate.h>
 
 static void
 simple_buffer_test (void)
@@ -115,6 +118,91 @@ allocate (void)
 	g_object_unref (buffer);
 }
 
+static void
+gendc_test (void)
+{
+	ArvGenDCContainerHeader *container;
+	ArvGenDCComponentHeader *component;
+	ArvGenDCPartHeader *part;
+	ArvBuffer *buffer;
+	guint8 *data;
+	guint64 offset;
+	size_t size;
+	size_t descriptor_size;
+
+	/* Container header with two components, the first one being invalid */
+	descriptor_size = sizeof (ArvGenDCContainerHeader) + 2 * sizeof (guint64) +
+		2 * (sizeof (ArvGenDCComponentHeader) + sizeof (guint64)) + sizeof (ArvGenDCPartHeader);
+
+	buffer = arv_buffer_new_allocate (descriptor_size + 64 * 48);
+	data = (guint8 *) arv_buffer_get_data (buffer, NULL);
+	memset (data, 0, descriptor_size);
+
+	container = (ArvGenDCContainerHeader *) data;
+	container->signature = GUINT32_TO_LE (ARV_GENDC_SIGNATURE);
+	container->descriptorsize = GUINT32_TO_LE (descriptor_size);
+	container->component_count = GUINT32_TO_LE (2);
+	container->dataoffset = GUINT64_TO_LE (descriptor_size);
+	container->datasize = GUINT64_TO_LE (64 * 48);
+
+	offset = sizeof (ArvGenDCContainerHeader) + 2 * sizeof (guint64);
+	component = (ArvGenDCComponentHeader *) (data + offset);
+	component->flags = GUINT16_TO_LE (1);
+	component->type_id = GUINT64_TO_LE (ARV_GENDC_COMPONENT_TYPE_INTENSITY);
+	component->part_count = GUINT16_TO_LE (1);
+	offset = GUINT64_TO_LE (offset);
+	memcpy (data + sizeof (ArvGenDCContainerHeader), &offset, sizeof (guint64));
+
+	offset = sizeof (ArvGenDCContainerHeader) + 2 * sizeof (guint64) +
+		sizeof (ArvGenDCComponentHeader) + sizeof (guint64);
+	component = (ArvGenDCComponentHeader *) (data + offset);
+	component->type_id = GUINT64_TO_LE (ARV_GENDC_COMPONENT_TYPE_INTENSITY);
+	component->format = GUINT32_TO_LE (ARV_PIXEL_FORMAT_MONO_8);
+	component->part_count = GUINT16_TO_LE (1);
+	offset = GUINT64_TO_LE (offset);
+	memcpy (data + sizeof (ArvGenDCContainerHeader) + sizeof (guint64), &offset, sizeof (guint64));
+
+	offset = descriptor_size - sizeof (ArvGenDCPartHeader);
+	part = (ArvGenDCPartHeader *) (data + offset);
+	part->dataoffset = GUINT64_TO_LE (descriptor_size);
+	part->datasize = GUINT64_TO_LE (64 * 48);
+	part->dimension_x = GUINT32_TO_LE (64);
+	part->dimension_y = GUINT32_TO_LE (48);
+	offset = GUINT64_TO_LE (offset);
+	memcpy ((guint8 *) component + sizeof (ArvGenDCComponentHeader), &offset, sizeof (guint64));
+
+	/* Incomplete descriptor */
+	g_assert_false (arv_buffer_update_gendc_infos (buffer, descriptor_size - 1));
+	g_assert_false (arv_buffer_has_gendc (buffer));
+
+	g_assert_true (arv_buffer_update_gendc_infos (buffer, descriptor_size));
+
+	buffer->priv->payload_type = ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER;
+	buffer->priv->status = ARV_BUFFER_STATUS_SUCCESS;
+	buffer->priv->received_size = descriptor_size + 64 * 48;
+
+	g_assert_true (arv_buffer_has_gendc (buffer));
+	g_assert (arv_buffer_get_gendc_descriptor (buffer, &size) == data);
+	g_assert_cmpint (size, ==, descriptor_size);
+	g_assert (arv_buffer_get_gendc_data (buffer, &size) == data + descriptor_size);
+	g_assert_cmpint (size, ==, 64 * 48);
+
+	g_assert_cmpint (arv_buffer_get_n_parts (buffer), ==, 1);
+	g_assert_cmpint (arv_buffer_get_part_component_id (buffer, 0), ==, 1);
+	g_assert_cmpint (arv_buffer_get_image_width (buffer), ==, 64);
+	g_assert_cmpint (arv_buffer_get_image_height (buffer), ==, 48);
+	g_assert_cmpint (arv_buffer_get_image_pixel_format (buffer), ==, ARV_PIXEL_FORMAT_MONO_8);
+	g_assert (arv_buffer_get_image_data (buffer, &size) == data + descriptor_size);
+	g_assert_cmpint (size, ==, 64 * 48);
+
+	/* Invalid signature */
+	container->signature = 0;
+	g_assert_false (arv_buffer_update_gendc_infos (buffer, descriptor_size));
+	g_assert_false (arv_buffer_has_gendc (buffer));
+
+	g_object_unref (buffer);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -127,6 +215,7 @@ main (int argc, char *argv[])
 	g_test_add_func ("/buffer/full-buffer", full_buffer_test);
 	g_test_add_func ("/buffer/timestamp", timestamp);
 	g_test_add_func ("/buffer/allocate", allocate);
+	g_test_add_func ("/buffer/gendc", gendc_test);
 
 	result = g_test_run();
 
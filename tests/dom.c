@@ -1,6 +1,7 @@
 /* SPDX-License-Identifier:Unlicense */
 
 #include <arv.h>
+#include <string.h>
 
 static void
 child_list_test (void)
@@ -34,6 +35,49 @@ child_list_test (void)
         g_object_unref (device);
 }
 
+static const char inline_text_xml[] =
+"<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+"<RegisterDescription ModelName=\"Test\" VendorName=\"Aravis\">\n"
+"  <Integer Name=\"Integer\">\n"
+"    <Value>1&#50;34</Value>\n"
+"  </Integer>\n"
+"</RegisterDescription>";
+
+static void
+inline_text_test (void)
+{
+	ArvGc *genicam;
+	ArvGcNode *node;
+	ArvDomNode *property_node;
+	GError *error = NULL;
+
+	genicam = arv_gc_new (NULL, inline_text_xml, strlen (inline_text_xml));
+	g_assert (ARV_IS_GC (genicam));
+
+	node = arv_gc_get_node (genicam, "Integer");
+	g_assert (ARV_IS_GC_INTEGER_NODE (node));
+
+	/* The whitespaces are dropped, and the property text is not stored in text nodes */
+	property_node = arv_dom_node_get_first_child (ARV_DOM_NODE (node));
+	g_assert (ARV_IS_GC_PROPERTY_NODE (property_node));
+	g_assert (arv_dom_node_get_next_sibling (property_node) == NULL);
+	g_assert (arv_dom_node_get_first_child (property_node) == NULL);
+
+	g_assert_cmpstr (arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (property_node), NULL), ==, "1234");
+	g_assert_cmpint (arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error), ==, 1234);
+	g_assert (error == NULL);
+
+	arv_gc_integer_set_value (ARV_GC_INTEGER (node), 42, &error);
+	g_assert (error == NULL);
+	g_assert_cmpstr (arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (property_node), NULL), ==, "42");
+
+	/* Text nodes added using the DOM API are still taken into account */
+	arv_dom_node_append_child (property_node, arv_dom_text_new ("0"));
+	g_assert_cmpstr (arv_gc_property_node_get_string (ARV_GC_PROPERTY_NODE (property_node), NULL), ==, "420");
+
+	g_object_unref (genicam);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -44,6 +88,7 @@ main (int argc, char *argv[])
 	arv_set_fake_camera_genicam_filename (GENICAM_FILENAME);
 
 	g_test_add_func ("/dom/child-list", child_list_test);
+	g_test_add_func ("/dom/inline-text", inline_text_test);
 
 	result = g_test_run();
 
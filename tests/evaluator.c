@@ -4,6 +4,8 @@
 #include <arv.h>
 #include <math.h>
 
+#include <arvevaluatorprivate.h>
+
 typedef struct {
 	const char *test_name;
 	const char *expression;
@@ -330,6 +332,84 @@ error_test (void)
 	g_object_unref (evaluator);
 }
 
+static void
+constant_folding_test (void)
+{
+	ArvEvaluator *evaluator;
+	GError *error = NULL;
+	gint64 v_int64;
+	double v_double;
+
+	/* Constant parts are folded separately for integer and floating point evaluations */
+	evaluator = arv_evaluator_new ("10/4*X + (2+3)*TEN");
+	arv_evaluator_set_constant (evaluator, "TEN", "10");
+	arv_evaluator_set_int64_variable (evaluator, "X", 2);
+
+	v_int64 = arv_evaluator_evaluate_as_int64 (evaluator, &error);
+	g_assert_cmpint (v_int64, ==, 54);
+	g_assert (error == NULL);
+
+	v_double = arv_evaluator_evaluate_as_double (evaluator, &error);
+	g_assert_cmpfloat (v_double, ==, 55.0);
+	g_assert (error == NULL);
+
+	arv_evaluator_set_int64_variable (evaluator, "X", 4);
+	v_int64 = arv_evaluator_evaluate_as_int64 (evaluator, &error);
+	g_assert_cmpint (v_int64, ==, 58);
+	g_assert (error == NULL);
+
+	/* Errors in constant parts are still reported at evaluation */
+	arv_evaluator_set_expression (evaluator, "X + 1/0");
+	arv_evaluator_evaluate_as_int64 (evaluator, &error);
+	g_assert (error != NULL);
+	g_clear_error (&error);
+
+	g_object_unref (evaluator);
+}
+
+static void
+variable_slot_test (void)
+{
+	ArvEvaluator *evaluator;
+	GError *error = NULL;
+	gint64 v_int64;
+	double v_double;
+	guint slot_a;
+	guint slot_b;
+
+	evaluator = arv_evaluator_new ("A*10+B");
+
+	slot_a = arv_evaluator_get_variable_slot (evaluator, "A");
+	slot_b = arv_evaluator_get_variable_slot (evaluator, "B");
+	g_assert_cmpuint (slot_a, !=, slot_b);
+	g_assert_cmpuint (arv_evaluator_get_variable_slot (evaluator, "A"), ==, slot_a);
+
+	arv_evaluator_evaluate_as_int64 (evaluator, &error);
+	g_assert (error != NULL);
+	g_clear_error (&error);
+
+	arv_evaluator_set_int64_variable_by_slot (evaluator, slot_a, 3);
+	arv_evaluator_set_int64_variable_by_slot (evaluator, slot_b, 4);
+	v_int64 = arv_evaluator_evaluate_as_int64 (evaluator, &error);
+	g_assert_cmpint (v_int64, ==, 34);
+	g_assert (error == NULL);
+
+	arv_evaluator_set_double_variable_by_slot (evaluator, slot_b, 0.5);
+	v_double = arv_evaluator_evaluate_as_double (evaluator, &error);
+	g_assert_cmpfloat (v_double, ==, 30.5);
+	g_assert (error == NULL);
+
+	/* Slots stay valid across expression changes, and are shared with the named accessors */
+	arv_evaluator_set_expression (evaluator, "B-A");
+	arv_evaluator_set_int64_variable (evaluator, "A", 1);
+	arv_evaluator_set_int64_variable_by_slot (evaluator, slot_b, 8);
+	v_int64 = arv_evaluator_evaluate_as_int64 (evaluator, &error);
+	g_assert_cmpint (v_int64, ==, 7);
+	g_assert (error == NULL);
+
+	g_object_unref (evaluator);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -350,6 +430,8 @@ main (int argc, char *argv[])
 	g_test_add_func ("/evaluator/constant", constant_test);
 	g_test_add_func ("/evaluator/empty", empty_test);
 	g_test_add_func ("/evaluator/error", error_test);
+	g_test_add_func ("/evaluator/constant-folding", constant_folding_test);
+	g_test_add_func ("/evaluator/variable-slot", variable_slot_test);
 
 	result = g_test_run();
 
@@ -2,6 +2,7 @@
 
 #include <glib.h>
 #include <arv.h>
+#include <string.h>
 
 static void
 discovery_test (void)
@@ -744,6 +745,396 @@ set_features_from_string_test (void)
 	g_object_unref (device);
 }
 
+/* A and B are contiguous, C is adjacent to B, D is separated by unused addresses */
+
+static const char prefetch_xml[] =
+"<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+"<RegisterDescription ModelName=\"Prefetch\" VendorName=\"Aravis\">\n"
+"  <Category Name=\"Root\">\n"
+"    <pFeature>A</pFeature>\n"
+"    <pFeature>B</pFeature>\n"
+"    <pFeature>C</pFeature>\n"
+"    <pFeature>D</pFeature>\n"
+"  </Category>\n"
+"  <IntReg Name=\"A\"><Address>0x8000</Address><Length>4</Length><AccessMode>RW</AccessMode>"
+"<pPort>Device</pPort><Endianess>BigEndian</Endianess></IntReg>\n"
+"  <IntReg Name=\"B\"><Address>0x8004</Address><Length>2</Length><AccessMode>RW</AccessMode>"
+"<pPort>Device</pPort><Endianess>BigEndian</Endianess></IntReg>\n"
+"  <IntReg Name=\"C\"><Address>0x8006</Address><Length>2</Length><AccessMode>RW</AccessMode>"
+"<pPort>Device</pPort><Endianess>BigEndian</Endianess></IntReg>\n"
+"  <IntReg Name=\"D\"><Address>0x8020</Address><Length>4</Length><AccessMode>RW</AccessMode>"
+"<pPort>Device</pPort><Endianess>BigEndian</Endianess></IntReg>\n"
+"  <Port Name=\"Device\" NameSpace=\"Standard\"/>\n"
+"</RegisterDescription>";
+
+static void
+prefetch_test (void)
+{
+	ArvDevice *device;
+	ArvFakeCamera *camera;
+	ArvGc *genicam;
+	GError *error = NULL;
+	gboolean success;
+	guint64 n_memory_reads;
+	guint64 n_register_reads;
+	guint64 n_reads;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_ENABLE);
+
+	success = arv_device_prefetch_features (device, (const char *[]) {"Root", NULL}, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	/* Change the registers behind the back of the Genicam tree, the prefetched values are still returned */
+	camera = arv_fake_device_get_fake_camera (ARV_FAKE_DEVICE (device));
+	arv_fake_camera_write_register (camera, ARV_FAKE_CAMERA_REGISTER_WIDTH, 320);
+	arv_fake_camera_write_register (camera, ARV_FAKE_CAMERA_REGISTER_HEIGHT, 240);
+
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), &n_memory_reads, &n_register_reads, NULL, NULL);
+
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), ==,
+			 ARV_FAKE_CAMERA_WIDTH_DEFAULT);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Height", NULL), ==,
+			 ARV_FAKE_CAMERA_HEIGHT_DEFAULT);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "BinningHorizontal", NULL), ==,
+			 ARV_FAKE_CAMERA_BINNING_HORIZONTAL_DEFAULT);
+
+	/* The prefetched values don't require any device access */
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), &n_reads, NULL, NULL, NULL);
+	g_assert_cmpint (n_reads, ==, n_memory_reads);
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), NULL, &n_reads, NULL, NULL);
+	g_assert_cmpint (n_reads, ==, n_register_reads);
+
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_DISABLE);
+
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), ==, 320);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Height", NULL), ==, 240);
+
+	/* Only the adjacent registers are merged in a single read */
+	arv_fake_camera_write_register (camera, 0x8000, 0x01020304);
+	arv_fake_camera_write_register (camera, 0x8004, 0x05060708);
+	arv_fake_camera_write_register (camera, 0x8020, 0x0a0b0c0d);
+
+	genicam = arv_gc_new (device, prefetch_xml, strlen (prefetch_xml));
+	g_assert (ARV_IS_GC (genicam));
+	arv_gc_set_register_cache_policy (genicam, ARV_REGISTER_CACHE_POLICY_ENABLE);
+
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), &n_memory_reads, NULL, NULL, NULL);
+
+	success = arv_gc_prefetch_features (genicam, (const char *[]) {"Root", NULL}, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), &n_reads, NULL, NULL, NULL);
+	g_assert_cmpint (n_reads - n_memory_reads, ==, 2);
+
+	g_assert_cmpint (arv_gc_integer_get_value (ARV_GC_INTEGER (arv_gc_get_node (genicam, "A")), NULL),
+			 ==, 0x01020304);
+	g_assert_cmpint (arv_gc_integer_get_value (ARV_GC_INTEGER (arv_gc_get_node (genicam, "B")), NULL),
+			 ==, 0x0506);
+	g_assert_cmpint (arv_gc_integer_get_value (ARV_GC_INTEGER (arv_gc_get_node (genicam, "C")), NULL),
+			 ==, 0x0708);
+	g_assert_cmpint (arv_gc_integer_get_value (ARV_GC_INTEGER (arv_gc_get_node (genicam, "D")), NULL),
+			 ==, 0x0a0b0c0d);
+
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), &n_reads, NULL, NULL, NULL);
+	g_assert_cmpint (n_reads - n_memory_reads, ==, 2);
+
+	g_object_unref (genicam);
+	g_object_unref (device);
+}
+
+/* A and B are contiguous, but too large to be sent in a single memory write. C straddles their boundary. */
+
+static const char transaction_xml[] =
+"<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+"<RegisterDescription ModelName=\"Transaction\" VendorName=\"Aravis\">\n"
+"  <Register Name=\"A\"><Address>0x8000</Address><Length>800</Length><AccessMode>RW</AccessMode>"
+"<pPort>Device</pPort></Register>\n"
+"  <Register Name=\"B\"><Address>0x8320</Address><Length>800</Length><AccessMode>RW</AccessMode>"
+"<pPort>Device</pPort></Register>\n"
+"  <Register Name=\"C\"><Address>0x8318</Address><Length>16</Length><AccessMode>RW</AccessMode>"
+"<pPort>Device</pPort></Register>\n"
+"  <Port Name=\"Device\" NameSpace=\"Standard\"/>\n"
+"</RegisterDescription>";
+
+static void
+transaction_test (void)
+{
+	ArvDevice *device;
+	ArvFakeCamera *camera;
+	ArvGc *genicam;
+	GError *error = NULL;
+	gboolean success;
+	guint32 value;
+	guint64 n_memory_writes;
+	guint64 n_register_writes;
+	guint64 n_writes;
+	guint8 data[800];
+	guint8 memory[0x640];
+	guint i;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	camera = arv_fake_device_get_fake_camera (ARV_FAKE_DEVICE (device));
+
+	success = arv_device_begin_transaction (device, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	success = arv_device_begin_transaction (device, &error);
+	g_assert (!success);
+	g_assert_error (error, ARV_GC_ERROR, ARV_GC_ERROR_TRANSACTION);
+	g_clear_error (&error);
+
+	arv_device_set_integer_feature_value (device, "Width", 256, &error);
+	g_assert (error == NULL);
+	arv_device_set_integer_feature_value (device, "Height", 128, &error);
+	g_assert (error == NULL);
+
+	/* The pending values are returned, but the device is left untouched until the commit */
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), ==, 256);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Height", NULL), ==, 128);
+	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_WIDTH, &value);
+	g_assert_cmpint (value, ==, ARV_FAKE_CAMERA_WIDTH_DEFAULT);
+	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_HEIGHT, &value);
+	g_assert_cmpint (value, ==, ARV_FAKE_CAMERA_HEIGHT_DEFAULT);
+
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), NULL, NULL,
+					       &n_memory_writes, &n_register_writes);
+
+	success = arv_device_commit_transaction (device, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	/* The adjacent Width and Height registers are sent in a single memory write */
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), NULL, NULL, &n_writes, NULL);
+	g_assert_cmpint (n_writes - n_memory_writes, ==, 1);
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), NULL, NULL, NULL, &n_writes);
+	g_assert_cmpint (n_writes - n_register_writes, ==, 0);
+
+	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_WIDTH, &value);
+	g_assert_cmpint (value, ==, 256);
+	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_HEIGHT, &value);
+	g_assert_cmpint (value, ==, 128);
+
+	success = arv_device_commit_transaction (device, &error);
+	g_assert (!success);
+	g_assert_error (error, ARV_GC_ERROR, ARV_GC_ERROR_TRANSACTION);
+	g_clear_error (&error);
+
+	/* Abort, with the register cache enabled */
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_ENABLE);
+
+	success = arv_device_begin_transaction (device, &error);
+	g_assert (success);
+	arv_device_set_integer_feature_value (device, "Width", 512, &error);
+	g_assert (error == NULL);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), ==, 512);
+	arv_device_abort_transaction (device);
+
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), ==, 256);
+	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_WIDTH, &value);
+	g_assert_cmpint (value, ==, 256);
+
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_DISABLE);
+
+	/* Failed commit, the writes are applied up to the faulty register */
+	success = arv_device_begin_transaction (device, &error);
+	g_assert (success);
+	success = arv_device_set_features_from_string (device, "Width=512 R[0x10000]=1 Height=512", &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	success = arv_device_commit_transaction (device, &error);
+	g_assert (!success);
+	g_assert (error != NULL);
+	g_assert (strstr (error->message, "applied: Width,") != NULL);
+	g_assert (strstr (error->message, "not applied: Height") != NULL);
+	g_clear_error (&error);
+
+	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_WIDTH, &value);
+	g_assert_cmpint (value, ==, 512);
+	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_HEIGHT, &value);
+	g_assert_cmpint (value, ==, 128);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Height", NULL), ==, 128);
+
+	/* Contiguous writes split in several memory writes, the last staged value wins */
+	genicam = arv_gc_new (device, transaction_xml, strlen (transaction_xml));
+	g_assert (ARV_IS_GC (genicam));
+
+	success = arv_gc_begin_transaction (genicam, &error);
+	g_assert (success);
+
+	memset (data, 0xaa, sizeof (data));
+	arv_gc_register_set (ARV_GC_REGISTER (arv_gc_get_node (genicam, "A")), data, 800, &error);
+	g_assert (error == NULL);
+	memset (data, 0x11, sizeof (data));
+	arv_gc_register_set (ARV_GC_REGISTER (arv_gc_get_node (genicam, "C")), data, 16, &error);
+	g_assert (error == NULL);
+	memset (data, 0xbb, sizeof (data));
+	arv_gc_register_set (ARV_GC_REGISTER (arv_gc_get_node (genicam, "B")), data, 800, &error);
+	g_assert (error == NULL);
+	memset (data, 0xcc, sizeof (data));
+	arv_gc_register_set (ARV_GC_REGISTER (arv_gc_get_node (genicam, "C")), data, 16, &error);
+	g_assert (error == NULL);
+
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), NULL, NULL,
+					       &n_memory_writes, &n_register_writes);
+
+	success = arv_gc_commit_transaction (genicam, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), NULL, NULL, &n_writes, NULL);
+	g_assert_cmpint (n_writes - n_memory_writes, ==, 2);
+	arv_fake_device_get_access_statistics (ARV_FAKE_DEVICE (device), NULL, NULL, NULL, &n_writes);
+	g_assert_cmpint (n_writes - n_register_writes, ==, 0);
+
+	success = arv_fake_camera_read_memory (camera, 0x8000, sizeof (memory), memory);
+	g_assert (success);
+	for (i = 0; i < sizeof (memory); i++)
+		g_assert_cmpint (memory[i], ==, i < 0x318 ? 0xaa : i < 0x328 ? 0xcc : 0xbb);
+
+	g_object_unref (genicam);
+	g_object_unref (device);
+}
+
+typedef struct {
+	GMainLoop *main_loop;
+	guint n_width_changes;
+	guint n_height_changes;
+} PollingData;
+
+static void
+polling_width_changed_cb (ArvDevice *device, const char *feature, PollingData *data)
+{
+	g_assert_cmpstr (feature, ==, "Width");
+
+	data->n_width_changes++;
+	g_main_loop_quit (data->main_loop);
+}
+
+static void
+polling_height_changed_cb (ArvDevice *device, const char *feature, PollingData *data)
+{
+	data->n_height_changes++;
+}
+
+static gboolean
+polling_timeout_cb (gpointer user_data)
+{
+	g_assert_not_reached ();
+
+	return G_SOURCE_REMOVE;
+}
+
+static void
+polling_test (void)
+{
+	ArvDevice *device;
+	ArvFakeCamera *camera;
+	PollingData data = {0};
+	GError *error = NULL;
+	gboolean success;
+	guint timeout_id;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_ENABLE);
+
+	success = arv_device_add_polled_feature (device, "NotAFeature", 10, &error);
+	g_assert (!success);
+	g_assert (error != NULL);
+	g_clear_error (&error);
+
+	success = arv_device_add_polled_feature (device, "Width", 10, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+	success = arv_device_add_polled_feature (device, "Height", 10, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	data.main_loop = g_main_loop_new (NULL, FALSE);
+	g_signal_connect (device, "feature-changed::Width", G_CALLBACK (polling_width_changed_cb), &data);
+	g_signal_connect (device, "feature-changed::Height", G_CALLBACK (polling_height_changed_cb), &data);
+
+	success = arv_device_start_polling (device, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	/* Change the register behind the back of the Genicam tree */
+	camera = arv_fake_device_get_fake_camera (ARV_FAKE_DEVICE (device));
+	arv_fake_camera_write_register (camera, ARV_FAKE_CAMERA_REGISTER_WIDTH, 320);
+
+	timeout_id = g_timeout_add_seconds (10, polling_timeout_cb, NULL);
+	g_main_loop_run (data.main_loop);
+	g_source_remove (timeout_id);
+
+	arv_device_stop_polling (device);
+
+	g_assert_cmpint (data.n_width_changes, ==, 1);
+	g_assert_cmpint (data.n_height_changes, ==, 0);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), ==, 320);
+
+	/* Stopping twice is harmless */
+	arv_device_stop_polling (device);
+
+	g_main_loop_unref (data.main_loop);
+	g_object_unref (device);
+}
+
+static void
+open_devices_test (void)
+{
+	const char *device_ids[] = {"Fake_1", "Fake_1", "Fake_1", "Fake_1",
+				    "Fake_1", "Fake_1", "Fake_1", "Fake_1", NULL};
+	GPtrArray *devices;
+	GPtrArray *cameras;
+	GError *error = NULL;
+	guint i;
+
+	devices = arv_open_devices (device_ids, &error);
+	g_assert (devices != NULL);
+	g_assert (error == NULL);
+	g_assert_cmpint (devices->len, ==, G_N_ELEMENTS (device_ids) - 1);
+
+	for (i = 0; i < devices->len; i++) {
+		ArvDevice *device = g_ptr_array_index (devices, i);
+
+		g_assert (ARV_IS_FAKE_DEVICE (device));
+		g_assert (ARV_IS_GC (arv_device_get_genicam (device)));
+		g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), ==,
+				 ARV_FAKE_CAMERA_WIDTH_DEFAULT);
+		if (i > 0)
+			g_assert (device != g_ptr_array_index (devices, i - 1));
+	}
+
+	g_ptr_array_unref (devices);
+
+	cameras = arv_camera_new_multiple (device_ids, &error);
+	g_assert (cameras != NULL);
+	g_assert (error == NULL);
+	g_assert_cmpint (cameras->len, ==, G_N_ELEMENTS (device_ids) - 1);
+
+	for (i = 0; i < cameras->len; i++) {
+		gint width;
+
+		arv_camera_get_region (g_ptr_array_index (cameras, i), NULL, NULL, &width, NULL, NULL);
+		g_assert_cmpint (width, ==, ARV_FAKE_CAMERA_WIDTH_DEFAULT);
+	}
+
+	g_ptr_array_unref (cameras);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -767,6 +1158,10 @@ main (int argc, char *argv[])
 	g_test_add_func ("/fake/camera-device", camera_device_test);
 	g_test_add_func ("/fake/camera-trigger-selector", camera_trigger_selector_test);
 	g_test_add_func ("/fake/set-features-from-string", set_features_from_string_test);
+	g_test_add_func ("/fake/prefetch", prefetch_test);
+	g_test_add_func ("/fake/transaction", transaction_test);
+	g_test_add_func ("/fake/polling", polling_test);
+	g_test_add_func ("/fake/open-devices", open_devices_test);
 
 	result = g_test_run();
 
@@ -2,7 +2,10 @@
 
 #include <glib.h>
 #include <arv.h>
+#include <string.h>
+#include "../src/arvgvcpprivate.h"
 
+static ArvGvFakeCamera *simulator = NULL;
 static ArvCamera *camera = NULL;
 
 static void
@@ -111,6 +114,203 @@ register_test (void)
 	g_assert_cmpint (int_value, ==, 321);
 }
 
+static guint32 async_addresses[] = {
+	ARV_FAKE_CAMERA_REGISTER_WIDTH,
+	ARV_FAKE_CAMERA_REGISTER_HEIGHT,
+	ARV_FAKE_CAMERA_REGISTER_BINNING_HORIZONTAL,
+	ARV_FAKE_CAMERA_REGISTER_BINNING_VERTICAL,
+	ARV_FAKE_CAMERA_REGISTER_PIXEL_FORMAT,
+	ARV_FAKE_CAMERA_REGISTER_TEST
+};
+
+typedef struct {
+	guint n_pending;
+	gboolean success;
+} AsyncData;
+
+typedef struct {
+	AsyncData *data;
+	guint32 value;
+} AsyncRead;
+
+static void
+async_read_register_cb (GObject *source_object, GAsyncResult *result, gpointer user_data)
+{
+	AsyncRead *read = user_data;
+	GError *error = NULL;
+
+	if (!arv_device_read_register_finish (ARV_DEVICE (source_object), result, &read->value, &error)) {
+		read->data->success = FALSE;
+		g_clear_error (&error);
+	}
+
+	read->data->n_pending--;
+}
+
+static void
+async_read_memory_cb (GObject *source_object, GAsyncResult *result, gpointer user_data)
+{
+	AsyncData *data = user_data;
+	GError *error = NULL;
+
+	if (!arv_device_read_memory_finish (ARV_DEVICE (source_object), result, &error)) {
+		data->success = FALSE;
+		g_clear_error (&error);
+	}
+
+	data->n_pending--;
+}
+
+static void
+async_write_memory_cb (GObject *source_object, GAsyncResult *result, gpointer user_data)
+{
+	AsyncData *data = user_data;
+	GError *error = NULL;
+
+	if (!arv_device_write_memory_finish (ARV_DEVICE (source_object), result, &error)) {
+		data->success = FALSE;
+		g_clear_error (&error);
+	}
+
+	data->n_pending--;
+}
+
+/* Unused area of the fake camera memory */
+#define ASYNC_WRITE_ADDRESS	0xe000
+
+static void
+async_register_test (void)
+{
+	ArvDevice *device;
+	AsyncData data = {0, TRUE};
+	AsyncRead reads[G_N_ELEMENTS (async_addresses)];
+	guint8 sync_memory[2048];
+	guint8 async_memory[2048];
+	guint i;
+
+	device = arv_camera_get_device (camera);
+	g_assert (ARV_IS_GV_DEVICE (device));
+
+	/* Command pipelining is opt-in */
+	g_object_set (device, "gvcp-window", 4, NULL);
+
+	/* All the reads are in flight at the same time */
+	for (i = 0; i < G_N_ELEMENTS (async_addresses); i++) {
+		reads[i].data = &data;
+		reads[i].value = 0;
+		data.n_pending++;
+		arv_device_read_register_async (device, async_addresses[i], NULL, async_read_register_cb, &reads[i]);
+	}
+
+	data.n_pending++;
+	arv_device_read_memory_async (device, 0, sizeof (async_memory), async_memory, NULL,
+				      async_read_memory_cb, &data);
+
+	while (data.n_pending > 0)
+		g_main_context_iteration (NULL, TRUE);
+
+	g_assert (data.success);
+
+	for (i = 0; i < G_N_ELEMENTS (async_addresses); i++) {
+		guint32 value;
+
+		g_assert (arv_device_read_register (device, async_addresses[i], &value, NULL));
+		g_assert_cmpint (value, ==, reads[i].value);
+	}
+
+	g_assert (arv_device_read_memory (device, 0, sizeof (sync_memory), sync_memory, NULL));
+	g_assert (memcmp (sync_memory, async_memory, sizeof (sync_memory)) == 0);
+
+	/* Multiple block write */
+	for (i = 0; i < sizeof (async_memory); i++)
+		async_memory[i] = i % 251;
+
+	data.n_pending = 1;
+	arv_device_write_memory_async (device, ASYNC_WRITE_ADDRESS, sizeof (async_memory), async_memory, NULL,
+				       async_write_memory_cb, &data);
+
+	while (data.n_pending > 0)
+		g_main_context_iteration (NULL, TRUE);
+
+	g_assert (data.success);
+
+	g_assert (arv_device_read_memory (device, ASYNC_WRITE_ADDRESS, sizeof (sync_memory), sync_memory, NULL));
+	g_assert (memcmp (sync_memory, async_memory, sizeof (sync_memory)) == 0);
+
+	g_object_set (device, "gvcp-window", 1, NULL);
+}
+
+static void
+multiple_registers_test (void)
+{
+	ArvDevice *device;
+	GError *error = NULL;
+	const char *features[] = {"Width", "Height", "PixelFormat", "TestRegister", NULL};
+	guint64 addresses[300];
+	guint32 values[300];
+	guint64 write_addresses[2] = {ARV_FAKE_CAMERA_REGISTER_WIDTH, ARV_FAKE_CAMERA_REGISTER_HEIGHT};
+	guint32 write_values[2] = {512, 256};
+	guint64 n_commands, n_registers;
+	guint64 n_commands_before, n_registers_before;
+	guint64 n_extra_commands;
+	guint i;
+
+	device = arv_camera_get_device (camera);
+	g_assert (ARV_IS_GV_DEVICE (device));
+
+	/* More registers than a single command can carry */
+	for (i = 0; i < G_N_ELEMENTS (addresses); i++)
+		addresses[i] = async_addresses[i % G_N_ELEMENTS (async_addresses)];
+
+	arv_gv_fake_camera_get_control_statistics (simulator, &n_commands_before, &n_registers_before, NULL, NULL);
+
+	g_assert (arv_device_read_registers (device, addresses, values, G_N_ELEMENTS (addresses), &error));
+	g_assert_no_error (error);
+
+	arv_gv_fake_camera_get_control_statistics (simulator, &n_commands, &n_registers, NULL, NULL);
+
+	/* The heartbeat may have sent single register reads in the meantime */
+	g_assert_cmpint (n_commands - n_commands_before, >=,
+			 (G_N_ELEMENTS (addresses) + ARV_GVCP_N_READ_REGISTERS_MAX - 1) / ARV_GVCP_N_READ_REGISTERS_MAX);
+	n_extra_commands = n_commands - n_commands_before -
+		(G_N_ELEMENTS (addresses) + ARV_GVCP_N_READ_REGISTERS_MAX - 1) / ARV_GVCP_N_READ_REGISTERS_MAX;
+	g_assert_cmpint (n_registers - n_registers_before, ==, G_N_ELEMENTS (addresses) + n_extra_commands);
+
+	for (i = 0; i < G_N_ELEMENTS (addresses); i++) {
+		guint32 value;
+
+		g_assert (arv_device_read_register (device, addresses[i], &value, NULL));
+		g_assert_cmpint (value, ==, values[i]);
+	}
+
+	arv_gv_fake_camera_get_control_statistics (simulator, NULL, NULL, &n_commands_before, &n_registers_before);
+
+	g_assert (arv_device_write_registers (device, write_addresses, write_values, 2, &error));
+	g_assert_no_error (error);
+
+	/* Both registers in a single command */
+	arv_gv_fake_camera_get_control_statistics (simulator, NULL, NULL, &n_commands, &n_registers);
+	g_assert_cmpint (n_commands - n_commands_before, ==, 1);
+	g_assert_cmpint (n_registers - n_registers_before, ==, 2);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), ==, 512);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Height", NULL), ==, 256);
+
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_ENABLE);
+
+	g_assert (arv_device_prefetch_features (device, features, &error));
+	g_assert_no_error (error);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), ==, 512);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Height", NULL), ==, 256);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "PixelFormat", NULL), ==,
+			 ARV_FAKE_CAMERA_PIXEL_FORMAT_DEFAULT);
+
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_DEFAULT);
+
+	write_values[0] = 1024;
+	write_values[1] = 1024;
+	g_assert (arv_device_write_registers (device, write_addresses, write_values, 2, NULL));
+}
+
 static void
 acquisition_test (void)
 {
@@ -206,6 +406,393 @@ stream_test (void)
 	g_usleep (2000000);
 }
 
+/* Each 32 bit word of the image is set to its index plus one, so that a misplaced or missing payload packet shows up
+ * in the received data */
+
+static void
+index_pattern_cb (ArvBuffer *buffer, void *fill_pattern_data,
+		  guint32 exposure_time_us, guint32 gain, ArvPixelFormat pixel_format)
+{
+	guint32 *data;
+	size_t size;
+	size_t i;
+
+	g_assert_cmpint (pixel_format, ==, ARV_PIXEL_FORMAT_MONO_8);
+
+	/* The received size is only set by the fill pattern */
+	data = (guint32 *) arv_buffer_get_data (buffer, NULL);
+	size = arv_buffer_get_image_width (buffer) * arv_buffer_get_image_height (buffer);
+
+	for (i = 0; i < size / sizeof (guint32); i++)
+		data[i] = i + 1;
+}
+
+static gboolean
+has_index_pattern (const guint32 *data, size_t size)
+{
+	size_t i;
+
+	for (i = 0; i < size / sizeof (guint32); i++)
+		if (data[i] != i + 1)
+			return FALSE;
+
+	return TRUE;
+}
+
+static unsigned
+acquire_index_pattern (gboolean zero_copy)
+{
+	ArvStream *stream;
+	GError *error = NULL;
+	size_t payload;
+	unsigned n_completed_buffers = 0;
+	unsigned i;
+
+	stream = arv_camera_create_stream (camera, NULL, NULL, NULL, &error);
+	g_assert (ARV_IS_STREAM (stream));
+	g_assert (error == NULL);
+
+	g_object_set (stream, "zero-copy", zero_copy, NULL);
+
+	payload = arv_camera_get_payload (camera, NULL);
+
+	for (i = 0; i < 5; i++)
+		arv_stream_push_buffer (stream, arv_buffer_new (payload, NULL));
+
+	arv_camera_start_acquisition (camera, NULL);
+
+	for (i = 0; i < 10; i++) {
+		ArvBuffer *buffer;
+
+		buffer = arv_stream_timeout_pop_buffer (stream, 1000000);
+		g_assert (ARV_IS_BUFFER (buffer));
+
+		if (arv_buffer_get_status (buffer) == ARV_BUFFER_STATUS_SUCCESS) {
+			const guint32 *data;
+			size_t size;
+
+			data = arv_buffer_get_image_data (buffer, &size);
+			g_assert_cmpint (size, ==, payload);
+			g_assert (has_index_pattern (data, size));
+
+			n_completed_buffers++;
+		}
+
+		/* Stale data from a previous frame would otherwise pass the check */
+		memset ((void *) arv_buffer_get_data (buffer, NULL), 0, payload);
+
+		arv_stream_push_buffer (stream, buffer);
+	}
+
+	arv_camera_stop_acquisition (camera, NULL);
+
+	g_clear_object (&stream);
+
+	return n_completed_buffers;
+}
+
+static void
+zero_copy_test (void)
+{
+	ArvFakeCamera *fake_camera;
+        const char *ignore_buffer;
+	unsigned n_copy_buffers;
+	unsigned n_zero_copy_buffers;
+
+        ignore_buffer = g_getenv("ARV_TEST_IGNORE_BUFFER");
+
+	fake_camera = arv_gv_fake_camera_get_fake_camera (simulator);
+	arv_fake_camera_set_fill_pattern (fake_camera, index_pattern_cb, NULL, NULL);
+
+	n_copy_buffers = acquire_index_pattern (FALSE);
+	n_zero_copy_buffers = acquire_index_pattern (TRUE);
+
+	arv_fake_camera_set_fill_pattern (fake_camera, NULL, NULL, NULL);
+
+	if (ignore_buffer == NULL) {
+		g_assert_cmpint (n_copy_buffers, >, 0);
+		g_assert_cmpint (n_zero_copy_buffers, >, 0);
+	}
+}
+
+/* Acquires a few frames using the GenDC, H264 or all-in transfer modes of the fake camera, and returns the number of
+ * buffers with the expected status. The content of the successfully completed ones is checked. */
+
+static unsigned
+acquire_payload_type (ArvBufferPayloadType payload_type, gboolean all_in, ArvBufferStatus expected_status)
+{
+	ArvStream *stream;
+	GError *error = NULL;
+	size_t payload;
+	unsigned n_expected_buffers = 0;
+	unsigned i;
+
+	g_object_set (simulator, "gvsp-payload-type", payload_type, "gvsp-all-in", all_in, NULL);
+
+	stream = arv_camera_create_stream (camera, NULL, NULL, NULL, &error);
+	g_assert (ARV_IS_STREAM (stream));
+	g_assert (error == NULL);
+
+	payload = arv_camera_get_payload (camera, NULL);
+
+	/* Room for the GenDC descriptor */
+	for (i = 0; i < 5; i++)
+		arv_stream_push_buffer (stream, arv_buffer_new (payload + 4096, NULL));
+
+	arv_camera_start_acquisition (camera, NULL);
+
+	for (i = 0; i < 5; i++) {
+		ArvBuffer *buffer;
+
+		buffer = arv_stream_timeout_pop_buffer (stream, 1000000);
+		g_assert (ARV_IS_BUFFER (buffer));
+
+		if (arv_buffer_get_status (buffer) == ARV_BUFFER_STATUS_SUCCESS) {
+			const guint32 *data;
+			size_t size;
+
+			g_assert_cmpint (expected_status, ==, ARV_BUFFER_STATUS_SUCCESS);
+			g_assert_cmpint (arv_buffer_get_payload_type (buffer), ==, payload_type);
+			g_assert_cmpint (arv_buffer_get_n_parts (buffer), ==, 1);
+
+			if (payload_type == ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER) {
+				g_assert (arv_buffer_has_gendc (buffer));
+				g_assert_cmpint (arv_buffer_get_image_pixel_format (buffer), ==,
+						 ARV_PIXEL_FORMAT_MONO_8);
+			}
+
+			if (payload_type != ARV_BUFFER_PAYLOAD_TYPE_H264)
+				g_assert_cmpint (arv_buffer_get_image_width (buffer) *
+						 arv_buffer_get_image_height (buffer), ==, payload);
+
+			data = arv_buffer_get_part_data (buffer, 0, &size);
+			g_assert_cmpint (size, ==, payload);
+			g_assert (has_index_pattern (data, size));
+		}
+
+		if (arv_buffer_get_status (buffer) == expected_status)
+			n_expected_buffers++;
+
+		memset ((void *) arv_buffer_get_data (buffer, NULL), 0, payload + 4096);
+
+		arv_stream_push_buffer (stream, buffer);
+	}
+
+	arv_camera_stop_acquisition (camera, NULL);
+
+	g_clear_object (&stream);
+
+	g_object_set (simulator,
+		      "gvsp-payload-type", ARV_BUFFER_PAYLOAD_TYPE_IMAGE,
+		      "gvsp-all-in", FALSE,
+		      NULL);
+
+	return n_expected_buffers;
+}
+
+static void
+payload_types_test (void)
+{
+	ArvFakeCamera *fake_camera;
+        const char *ignore_buffer;
+	unsigned n_gendc_buffers;
+	unsigned n_h264_buffers;
+	unsigned n_all_in_buffers;
+	unsigned n_multipart_buffers;
+	gint x, y, width, height;
+
+        ignore_buffer = g_getenv("ARV_TEST_IGNORE_BUFFER");
+
+	fake_camera = arv_gv_fake_camera_get_fake_camera (simulator);
+	arv_fake_camera_set_fill_pattern (fake_camera, index_pattern_cb, NULL, NULL);
+
+	n_gendc_buffers = acquire_payload_type (ARV_BUFFER_PAYLOAD_TYPE_GENDC_CONTAINER, FALSE,
+						ARV_BUFFER_STATUS_SUCCESS);
+	n_h264_buffers = acquire_payload_type (ARV_BUFFER_PAYLOAD_TYPE_H264, FALSE, ARV_BUFFER_STATUS_SUCCESS);
+
+	/* A single packet image */
+	arv_camera_get_region (camera, &x, &y, &width, &height, NULL);
+	arv_camera_set_region (camera, 0, 0, 32, 16, NULL);
+	n_all_in_buffers = acquire_payload_type (ARV_BUFFER_PAYLOAD_TYPE_IMAGE, TRUE, ARV_BUFFER_STATUS_SUCCESS);
+	/* Multipart all-in packets are not supported, the error must not be overwritten on frame completion */
+	n_multipart_buffers = acquire_payload_type (ARV_BUFFER_PAYLOAD_TYPE_MULTIPART, TRUE,
+						    ARV_BUFFER_STATUS_PAYLOAD_NOT_SUPPORTED);
+	arv_camera_set_region (camera, x, y, width, height, NULL);
+
+	arv_fake_camera_set_fill_pattern (fake_camera, NULL, NULL, NULL);
+
+	if (ignore_buffer == NULL) {
+		g_assert_cmpint (n_gendc_buffers, >, 0);
+		g_assert_cmpint (n_h264_buffers, >, 0);
+		g_assert_cmpint (n_all_in_buffers, >, 0);
+		g_assert_cmpint (n_multipart_buffers, >, 0);
+	}
+}
+
+static void
+packet_resend_test (void)
+{
+	ArvStream *stream;
+	GError *error = NULL;
+	size_t payload;
+	unsigned n_completed_buffers = 0;
+	unsigned i;
+
+	g_object_set (simulator,
+		      "gvsp-lost-ratio", 0.01,
+		      "gvsp-burst-length", 3,
+		      "gvsp-reorder-ratio", 0.01,
+		      "random-seed", 1234,
+		      NULL);
+
+	stream = arv_camera_create_stream (camera, NULL, NULL, NULL, &error);
+	g_assert (ARV_IS_STREAM (stream));
+	g_assert (error == NULL);
+
+	payload = arv_camera_get_payload (camera, NULL);
+
+	for (i = 0; i < 5; i++)
+		arv_stream_push_buffer (stream, arv_buffer_new (payload, NULL));
+
+	arv_camera_start_acquisition (camera, NULL);
+
+	for (i = 0; i < 10; i++) {
+		ArvBuffer *buffer;
+
+		buffer = arv_stream_timeout_pop_buffer (stream, 1000000);
+		g_assert (ARV_IS_BUFFER (buffer));
+
+		if (arv_buffer_get_status (buffer) == ARV_BUFFER_STATUS_SUCCESS)
+			n_completed_buffers++;
+
+		arv_stream_push_buffer (stream, buffer);
+	}
+
+	arv_camera_stop_acquisition (camera, NULL);
+
+	g_object_set (simulator,
+		      "gvsp-lost-ratio", 0.0,
+		      "gvsp-reorder-ratio", 0.0,
+		      "random-seed", 0,
+		      NULL);
+
+	g_assert_cmpint (n_completed_buffers, >, 0);
+	g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "n_resent_packets"), >, 0);
+
+	g_clear_object (&stream);
+}
+
+static void
+high_rate_test (void)
+{
+	ArvStream *stream;
+	GError *error = NULL;
+	size_t payload;
+	guint64 n_frames = 0;
+	unsigned n_completed_buffers = 0;
+	unsigned i;
+
+	g_object_set (simulator, "gvsp-high-rate", TRUE, NULL);
+
+	stream = arv_camera_create_stream (camera, NULL, NULL, NULL, &error);
+	g_assert (ARV_IS_STREAM (stream));
+	g_assert (error == NULL);
+
+	payload = arv_camera_get_payload (camera, NULL);
+
+	for (i = 0; i < 5; i++)
+		arv_stream_push_buffer (stream, arv_buffer_new (payload, NULL));
+
+	arv_camera_start_acquisition (camera, NULL);
+
+	for (i = 0; i < 20; i++) {
+		ArvBuffer *buffer;
+
+		buffer = arv_stream_timeout_pop_buffer (stream, 1000000);
+		g_assert (ARV_IS_BUFFER (buffer));
+
+		if (arv_buffer_get_status (buffer) == ARV_BUFFER_STATUS_SUCCESS)
+			n_completed_buffers++;
+
+		arv_stream_push_buffer (stream, buffer);
+	}
+
+	arv_camera_stop_acquisition (camera, NULL);
+
+	/* Wait for the fake camera to notice the acquisition stop */
+	g_usleep (200000);
+
+	arv_gv_fake_camera_get_stream_statistics (simulator, &n_frames, NULL, NULL, NULL, NULL);
+
+	g_object_set (simulator, "gvsp-high-rate", FALSE, NULL);
+
+	g_assert_cmpint (n_completed_buffers, >, 0);
+	g_assert_cmpint (n_frames, >=, n_completed_buffers);
+
+	g_clear_object (&stream);
+}
+
+static void
+frame_id_wrap_test (void)
+{
+	ArvStream *stream;
+	GError *error = NULL;
+	size_t payload;
+        const char *ignore_buffer;
+	gboolean before_wrap = FALSE;
+	gboolean after_wrap = FALSE;
+	unsigned n_completed_buffers = 0;
+	unsigned i;
+
+        ignore_buffer = g_getenv("ARV_TEST_IGNORE_BUFFER");
+
+	arv_fake_camera_set_frame_id (arv_gv_fake_camera_get_fake_camera (simulator), 65530);
+
+	stream = arv_camera_create_stream (camera, NULL, NULL, NULL, &error);
+	g_assert (ARV_IS_STREAM (stream));
+	g_assert (error == NULL);
+
+	g_object_set (stream, "receive-threads", 2, NULL);
+
+	payload = arv_camera_get_payload (camera, NULL);
+
+	for (i = 0; i < 10; i++)
+		arv_stream_push_buffer (stream, arv_buffer_new (payload, NULL));
+
+	arv_camera_start_acquisition (camera, NULL);
+
+	for (i = 0; i < 12; i++) {
+		ArvBuffer *buffer;
+
+		buffer = arv_stream_timeout_pop_buffer (stream, 1000000);
+		g_assert (ARV_IS_BUFFER (buffer));
+
+		if (arv_buffer_get_status (buffer) == ARV_BUFFER_STATUS_SUCCESS) {
+			guint64 frame_id = arv_buffer_get_frame_id (buffer);
+
+			g_assert_cmpint (frame_id, !=, 0);
+			if (frame_id > 65530)
+				before_wrap = TRUE;
+			else if (frame_id < 10)
+				after_wrap = TRUE;
+			n_completed_buffers++;
+		}
+
+		arv_stream_push_buffer (stream, buffer);
+	}
+
+	arv_camera_stop_acquisition (camera, NULL);
+
+	if (ignore_buffer == NULL) {
+		g_assert_cmpint (n_completed_buffers, ==, 12);
+		g_assert (before_wrap);
+		g_assert (after_wrap);
+		g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "n_missing_frames"), ==, 0);
+	}
+
+	g_clear_object (&stream);
+}
+
 #define N_BUFFERS	5
 
 static struct {
@@ -267,7 +854,6 @@ dynamic_roi_test (void)
 int
 main (int argc, char *argv[])
 {
-	ArvGvFakeCamera *simulator;
 	int result;
 
 	g_test_init (&argc, &argv, NULL);
@@ -284,8 +870,15 @@ main (int argc, char *argv[])
 
 	g_test_add_func ("/fakegv/discovery", discovery_test);
 	g_test_add_func ("/fakegv/device_registers", register_test);
+	g_test_add_func ("/fakegv/device_async_registers", async_register_test);
+	g_test_add_func ("/fakegv/device_multiple_registers", multiple_registers_test);
 	g_test_add_func ("/fakegv/acquisition", acquisition_test);
 	g_test_add_func ("/fakegv/stream", stream_test);
+	g_test_add_func ("/fakegv/zero_copy", zero_copy_test);
+	g_test_add_func ("/fakegv/payload_types", payload_types_test);
+	g_test_add_func ("/fakegv/packet_resend", packet_resend_test);
+	g_test_add_func ("/fakegv/high_rate", high_rate_test);
+	g_test_add_func ("/fakegv/frame_id_wrap", frame_id_wrap_test);
 	g_test_add_func ("/fakegv/dynamic_roi", dynamic_roi_test);
 
 	result = g_test_run();
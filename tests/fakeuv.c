@@ -0,0 +1,362 @@
+/* SPDX-License-Identifier:Unlicense */
+
+#include <glib.h>
+#include <arv.h>
+#include <string.h>
+#include "../src/arvuvfaketransportprivate.h"
+
+#define N_BUFFERS	5
+
+/* Default number of submitted transfers of an untuned stream */
+#define N_SUBMITS	8
+
+static ArvUvFakeTransport *transport = NULL;
+static ArvDevice *device = NULL;
+static ArvCamera *camera = NULL;
+
+static void
+register_test (void)
+{
+	GError *error = NULL;
+	const char *string;
+	gint64 int_value;
+
+	g_assert (ARV_IS_UV_DEVICE (arv_camera_get_device (camera)));
+
+	string = arv_device_get_string_feature_value (device, "DeviceVendorName", &error);
+	g_assert_no_error (error);
+	g_assert_cmpstr (string, ==, "Aravis");
+
+	int_value = arv_device_get_integer_feature_value (device, "Width", &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (int_value, ==, ARV_FAKE_CAMERA_WIDTH_DEFAULT);
+
+	arv_device_set_integer_feature_value (device, "Width", 1024, &error);
+	g_assert_no_error (error);
+	int_value = arv_device_get_integer_feature_value (device, "Width", &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (int_value, ==, 1024);
+
+	arv_device_set_integer_feature_value (device, "TestRegister", 0x12345678, &error);
+	g_assert_no_error (error);
+	int_value = arv_device_get_integer_feature_value (device, "TestRegister", &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (int_value, ==, 0x12345678);
+
+	arv_device_set_integer_feature_value (device, "Width", ARV_FAKE_CAMERA_WIDTH_DEFAULT, &error);
+	g_assert_no_error (error);
+}
+
+/* Acquires @n_frames buffers, and returns the number of successfully completed ones. If @stream_out is not NULL, the
+ * stream is returned instead of being destroyed, for the reading of its statistics. */
+
+static guint
+acquire (ArvUvUsbMode usb_mode, guint n_frames, guint64 *elapsed_time_us, ArvStream **stream_out)
+{
+	ArvStream *stream;
+	GError *error = NULL;
+	gint64 start_time;
+	size_t payload;
+	guint n_successes = 0;
+	guint i;
+
+	arv_camera_uv_set_usb_mode (camera, usb_mode);
+	arv_camera_set_acquisition_mode (camera, ARV_ACQUISITION_MODE_CONTINUOUS, &error);
+	g_assert_no_error (error);
+	arv_camera_set_frame_rate (camera, 50.0, &error);
+	g_assert_no_error (error);
+
+	stream = arv_camera_create_stream (camera, NULL, NULL, NULL, &error);
+	g_assert_no_error (error);
+	g_assert (ARV_IS_STREAM (stream));
+
+	payload = arv_camera_get_payload (camera, &error);
+	g_assert_no_error (error);
+
+	for (i = 0; i < N_BUFFERS; i++)
+		arv_stream_push_buffer (stream, arv_buffer_new (payload, NULL));
+
+	start_time = g_get_monotonic_time ();
+
+	arv_camera_start_acquisition (camera, &error);
+	g_assert_no_error (error);
+
+	for (i = 0; i < n_frames; i++) {
+		ArvBuffer *buffer;
+
+		buffer = arv_stream_timeout_pop_buffer (stream, 2 * G_USEC_PER_SEC);
+		g_assert (ARV_IS_BUFFER (buffer));
+
+		if (arv_buffer_get_status (buffer) == ARV_BUFFER_STATUS_SUCCESS) {
+			g_assert_cmpint (arv_buffer_get_image_width (buffer), ==, ARV_FAKE_CAMERA_WIDTH_DEFAULT);
+			g_assert_cmpint (arv_buffer_get_image_height (buffer), ==, ARV_FAKE_CAMERA_HEIGHT_DEFAULT);
+			n_successes++;
+		}
+
+		arv_stream_push_buffer (stream, buffer);
+	}
+
+	if (elapsed_time_us != NULL)
+		*elapsed_time_us = g_get_monotonic_time () - start_time;
+
+	arv_camera_stop_acquisition (camera, &error);
+	g_assert_no_error (error);
+
+	if (stream_out != NULL)
+		*stream_out = stream;
+	else
+		g_object_unref (stream);
+
+	return n_successes;
+}
+
+static void
+async_acquisition_test (void)
+{
+	g_assert_cmpint (acquire (ARV_UV_USB_MODE_ASYNC, 10, NULL, NULL), ==, 10);
+}
+
+static void
+sync_acquisition_test (void)
+{
+	g_assert_cmpint (acquire (ARV_UV_USB_MODE_SYNC, 10, NULL, NULL), ==, 10);
+}
+
+/* The buffers allocated by the stream keep their transfer contexts from one frame to the next, and get new ones at
+ * each acquisition */
+
+static void
+stream_buffers_test (void)
+{
+	ArvStream *stream;
+	ArvBuffer *buffers[N_BUFFERS];
+	GError *error = NULL;
+	guint n_acquisitions;
+	guint i, j;
+
+	arv_camera_uv_set_usb_mode (camera, ARV_UV_USB_MODE_ASYNC);
+	arv_camera_set_acquisition_mode (camera, ARV_ACQUISITION_MODE_CONTINUOUS, &error);
+	g_assert_no_error (error);
+	arv_camera_set_frame_rate (camera, 50.0, &error);
+	g_assert_no_error (error);
+
+	stream = arv_camera_create_stream (camera, NULL, NULL, NULL, &error);
+	g_assert_no_error (error);
+	g_assert (ARV_IS_STREAM (stream));
+
+	g_assert (arv_stream_create_buffers (stream, N_BUFFERS, NULL, NULL, &error));
+	g_assert_no_error (error);
+
+	for (i = 0; i < N_BUFFERS; i++)
+		buffers[i] = NULL;
+
+	for (n_acquisitions = 0; n_acquisitions < 2; n_acquisitions++) {
+		arv_camera_start_acquisition (camera, &error);
+		g_assert_no_error (error);
+
+		for (i = 0; i < 4 * N_BUFFERS; i++) {
+			ArvBuffer *buffer;
+
+			buffer = arv_stream_timeout_pop_buffer (stream, 2 * G_USEC_PER_SEC);
+			g_assert (ARV_IS_BUFFER (buffer));
+			g_assert_cmpint (arv_buffer_get_status (buffer), ==, ARV_BUFFER_STATUS_SUCCESS);
+			g_assert_cmpint (arv_buffer_get_image_width (buffer), ==, ARV_FAKE_CAMERA_WIDTH_DEFAULT);
+			g_assert_cmpint (arv_buffer_get_image_height (buffer), ==, ARV_FAKE_CAMERA_HEIGHT_DEFAULT);
+
+			/* Only the stream buffers are cycling */
+			for (j = 0; j < N_BUFFERS && buffers[j] != NULL && buffers[j] != buffer; j++);
+			g_assert_cmpint (j, <, N_BUFFERS);
+			buffers[j] = buffer;
+
+			arv_stream_push_buffer (stream, buffer);
+		}
+
+		arv_camera_stop_acquisition (camera, &error);
+		g_assert_no_error (error);
+
+		/* Requeue the buffers aborted by the acquisition stop */
+		for (;;) {
+			ArvBuffer *buffer = arv_stream_try_pop_buffer (stream);
+
+			if (buffer == NULL)
+				break;
+			arv_stream_push_buffer (stream, buffer);
+		}
+	}
+
+	for (i = 0; i < N_BUFFERS; i++)
+		g_assert (buffers[i] != NULL);
+
+	g_object_unref (stream);
+}
+
+static void
+bandwidth_test (void)
+{
+	guint64 elapsed_time_us;
+	size_t payload;
+
+	payload = arv_camera_get_payload (camera, NULL);
+
+	/* 4 frames per second */
+	arv_uv_fake_transport_set_bandwidth (transport, payload * 4);
+	arv_uv_fake_transport_set_transfer_latency (transport, 1000);
+
+	g_assert_cmpint (acquire (ARV_UV_USB_MODE_ASYNC, 4, NULL, NULL), ==, 4);
+	g_assert_cmpint (acquire (ARV_UV_USB_MODE_SYNC, 4, &elapsed_time_us, NULL), ==, 4);
+
+	/* Only a lower bound, the test machine may be slower */
+	g_assert_cmpint (elapsed_time_us, >=, 750000);
+
+	arv_uv_fake_transport_set_bandwidth (transport, 0);
+	arv_uv_fake_transport_set_transfer_latency (transport, 0);
+}
+
+static guint64
+get_n_transfer_latencies (ArvStream *stream)
+{
+	static const char *infos[] = {
+		"n_transfer_latency_lt_125us", "n_transfer_latency_lt_250us", "n_transfer_latency_lt_500us",
+		"n_transfer_latency_lt_1ms", "n_transfer_latency_lt_2ms", "n_transfer_latency_lt_4ms",
+		"n_transfer_latency_lt_8ms", "n_transfer_latency_lt_16ms", "n_transfer_latency_ge_16ms"
+	};
+	guint64 n_latencies = 0;
+	guint i;
+
+	for (i = 0; i < G_N_ELEMENTS (infos); i++)
+		n_latencies += arv_stream_get_info_uint64_by_name (stream, infos[i]);
+
+	return n_latencies;
+}
+
+static void
+transfer_tuning_test (void)
+{
+	ArvStream *stream = NULL;
+	guint64 transfer_size;
+	guint64 tuned_transfer_size;
+	guint64 queue_depth;
+	guint64 tuned_queue_depth;
+
+	arv_uv_fake_transport_set_transfer_latency (transport, 1000);
+
+	g_assert_cmpint (acquire (ARV_UV_USB_MODE_ASYNC, 10, NULL, &stream), ==, 10);
+
+	transfer_size = arv_stream_get_info_uint64_by_name (stream, "transfer_size");
+	queue_depth = arv_stream_get_info_uint64_by_name (stream, "transfer_queue_depth");
+
+	g_assert_cmpint (queue_depth, ==, N_SUBMITS);
+	g_assert_cmpint (get_n_transfer_latencies (stream), >=, 10);
+
+	g_clear_object (&stream);
+
+	arv_uv_device_set_transfer_tuning (ARV_UV_DEVICE (device), TRUE);
+
+	/* Less than two tuning windows, the transfer size can only grow once from its tuning unit */
+	g_assert_cmpint (acquire (ARV_UV_USB_MODE_ASYNC, 10, NULL, &stream), ==, 10);
+
+	tuned_transfer_size = arv_stream_get_info_uint64_by_name (stream, "transfer_size");
+	tuned_queue_depth = arv_stream_get_info_uint64_by_name (stream, "transfer_queue_depth");
+
+	g_assert_cmpint (tuned_transfer_size, <, transfer_size);
+	g_assert_cmpint (tuned_transfer_size % (64 * 1024), ==, 0);
+	g_assert_cmpint (tuned_queue_depth, >=, 2);
+	g_assert_cmpint (tuned_queue_depth, <=, 64);
+	g_assert_cmpint (get_n_transfer_latencies (stream), >=, 10 * transfer_size / tuned_transfer_size);
+
+	g_clear_object (&stream);
+
+	arv_uv_device_set_transfer_tuning (ARV_UV_DEVICE (device), FALSE);
+	arv_uv_fake_transport_set_transfer_latency (transport, 0);
+
+	/* The default transfer settings are restored */
+	g_assert_cmpint (acquire (ARV_UV_USB_MODE_ASYNC, 5, NULL, &stream), ==, 5);
+	g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "transfer_size"), ==, transfer_size);
+	g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "transfer_queue_depth"), ==, queue_depth);
+	g_clear_object (&stream);
+}
+
+static void
+error_injection_test (void)
+{
+	guint64 n_transfer_errors = 0;
+	guint n_successes;
+
+	arv_uv_fake_transport_set_error_rate (transport, 0.2);
+
+	n_successes = acquire (ARV_UV_USB_MODE_ASYNC, 20, NULL, NULL);
+
+	arv_uv_fake_transport_set_error_rate (transport, 0.0);
+
+	arv_uv_fake_transport_get_statistics (transport, NULL, NULL, &n_transfer_errors);
+
+	g_assert_cmpint (n_transfer_errors, >, 0);
+	g_assert_cmpint (n_successes, >, 0);
+	g_assert_cmpint (n_successes, <, 20);
+
+	/* The stream is still aligned on the frame boundaries */
+	g_assert_cmpint (acquire (ARV_UV_USB_MODE_ASYNC, 5, NULL, NULL), ==, 5);
+}
+
+static void
+control_lost_cb (ArvDevice *device, gboolean *control_lost)
+{
+	*control_lost = TRUE;
+}
+
+static void
+disconnect_test (void)
+{
+	GError *error = NULL;
+	gboolean control_lost = FALSE;
+
+	g_signal_connect (device, "control-lost", G_CALLBACK (control_lost_cb), &control_lost);
+
+	arv_uv_fake_transport_disconnect (transport);
+
+	arv_device_get_integer_feature_value (device, "Width", &error);
+	g_assert (error != NULL);
+	g_clear_error (&error);
+
+	g_assert (control_lost);
+}
+
+int
+main (int argc, char *argv[])
+{
+	GError *error = NULL;
+	int result;
+
+	g_test_init (&argc, &argv, NULL);
+
+	arv_set_fake_camera_genicam_filename (GENICAM_FILENAME);
+
+	transport = arv_uv_fake_transport_new ("UVTest");
+	g_assert (transport != NULL);
+
+	device = arv_uv_device_new_with_fake_transport (transport, &error);
+	g_assert_no_error (error);
+	g_assert (ARV_IS_UV_DEVICE (device));
+
+	camera = arv_camera_new_with_device (device, &error);
+	g_assert_no_error (error);
+	g_assert (ARV_IS_CAMERA (camera));
+
+	g_test_add_func ("/fakeuv/device_registers", register_test);
+	g_test_add_func ("/fakeuv/async_acquisition", async_acquisition_test);
+	g_test_add_func ("/fakeuv/sync_acquisition", sync_acquisition_test);
+	g_test_add_func ("/fakeuv/stream_buffers", stream_buffers_test);
+	g_test_add_func ("/fakeuv/bandwidth", bandwidth_test);
+	g_test_add_func ("/fakeuv/transfer_tuning", transfer_tuning_test);
+	g_test_add_func ("/fakeuv/error_injection", error_injection_test);
+	g_test_add_func ("/fakeuv/disconnect", disconnect_test);
+
+	result = g_test_run();
+
+	g_object_unref (camera);
+	g_object_unref (device);
+
+	arv_shutdown ();
+
+	return result;
+}
@@ -532,6 +532,99 @@ enumeration_test (void)
 	g_object_unref (device);
 }
 
+static void
+enumeration_availability_test (void)
+{
+	ArvDevice *device;
+	ArvGc *genicam;
+	ArvGcNode *node;
+	ArvGcNode *not_available;
+	GError *error = NULL;
+	gint64 *values;
+	const char **strings;
+	guint n_values;
+	gboolean success;
+	int i;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+	g_assert (ARV_IS_GC (genicam));
+
+	node = arv_gc_get_node (genicam, "Enumeration");
+	g_assert (ARV_IS_GC_ENUMERATION (node));
+	not_available = arv_gc_get_node (genicam, "NotAvailable");
+	g_assert (ARV_IS_GC_INTEGER_NODE (not_available));
+
+	/* Once without, once with the memoized entry availability */
+	for (i = 0; i < 2; i++) {
+		arv_gc_set_register_cache_policy (genicam, i == 0 ?
+						  ARV_REGISTER_CACHE_POLICY_DISABLE :
+						  ARV_REGISTER_CACHE_POLICY_ENABLE);
+
+		strings = arv_gc_enumeration_dup_available_string_values (ARV_GC_ENUMERATION (node), &n_values, NULL);
+		g_assert_cmpint (n_values, ==, 2);
+		g_assert_cmpstr (strings[0], ==, "Entry0");
+		g_assert_cmpstr (strings[1], ==, "Entry1");
+		g_free (strings);
+
+		success = arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (node), "EntryNotAvailable", &error);
+		g_assert (!success);
+		g_assert_error (error, ARV_GC_ERROR, ARV_GC_ERROR_OUT_OF_RANGE);
+		g_clear_error (&error);
+
+		success = arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (node), "UnknownEntry", &error);
+		g_assert (!success);
+		g_assert_error (error, ARV_GC_ERROR, ARV_GC_ERROR_ENUM_ENTRY_NOT_FOUND);
+		g_clear_error (&error);
+
+		/* The availability change must be seen through the change count of the pIsAvailable input */
+		arv_gc_integer_set_value (ARV_GC_INTEGER (not_available), 1, &error);
+		g_assert (error == NULL);
+
+		values = arv_gc_enumeration_dup_available_int_values (ARV_GC_ENUMERATION (node), &n_values, NULL);
+		g_assert_cmpint (n_values, ==, 4);
+		g_assert_cmpint (values[0], ==, 0);
+		g_assert_cmpint (values[1], ==, 1);
+		g_assert_cmpint (values[2], ==, 2);
+		g_assert_cmpint (values[3], ==, 3);
+		g_free (values);
+
+		success = arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (node), "EntryNotAvailable", &error);
+		g_assert (success);
+		g_assert (error == NULL);
+		g_assert_cmpstr (arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), NULL), ==,
+				 "EntryNotAvailable");
+
+		success = arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), 3, &error);
+		g_assert (success);
+		g_assert (error == NULL);
+		g_assert_cmpstr (arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), NULL), ==,
+				 "EntryNotImplemented");
+
+		arv_gc_integer_set_value (ARV_GC_INTEGER (not_available), 0, &error);
+		g_assert (error == NULL);
+
+		success = arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), 2, &error);
+		g_assert (!success);
+		g_assert_error (error, ARV_GC_ERROR, ARV_GC_ERROR_OUT_OF_RANGE);
+		g_clear_error (&error);
+
+		success = arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), 1, &error);
+		g_assert (success);
+		g_assert (error == NULL);
+		g_assert_cmpstr (arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), NULL), ==, "Entry1");
+
+		success = arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), 0, &error);
+		g_assert (success);
+		g_assert (error == NULL);
+	}
+
+	g_object_unref (device);
+}
+
 static void
 swiss_knife_test (void)
 {
@@ -1422,6 +1515,102 @@ access_mode_test (void)
 	g_object_unref (device);
 }
 
+static void
+link_test (void)
+{
+	ArvDevice *device;
+	ArvGc *genicam;
+	ArvGcNode *node;
+	GError *error = NULL;
+	gint64 value;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+	g_assert (ARV_IS_GC (genicam));
+
+	node = arv_gc_get_node (genicam, "P_RWInteger");
+	g_assert (ARV_IS_GC_INTEGER_NODE (node));
+
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+	g_assert (error == NULL);
+	g_assert_cmpint (value, ==, 1);
+
+	/* Literal value update */
+	arv_gc_integer_set_value (ARV_GC_INTEGER (node), 4, &error);
+	g_assert (error == NULL);
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+	g_assert (error == NULL);
+	g_assert_cmpint (value, ==, 4);
+
+	/* Replacement of the pointed node */
+	arv_dom_document_append_from_memory (ARV_DOM_DOCUMENT (genicam), NULL,
+					     "<Integer Name=\"RWInteger\"><Value>7</Value></Integer>", -1, &error);
+	g_assert (error == NULL);
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+	g_assert (error == NULL);
+	g_assert_cmpint (value, ==, 7);
+
+	g_object_unref (device);
+}
+
+static void
+value_cache_test (void)
+{
+	ArvDevice *device;
+	ArvGc *genicam;
+	ArvGcNode *node;
+	ArvGcNode *variable;
+	GError *error = NULL;
+	guint64 n_hits;
+	guint64 n_misses;
+	gint64 value;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+	g_assert (ARV_IS_GC (genicam));
+
+	node = arv_gc_get_node (genicam, "IntSwissKnifeTestSubAndConstant");
+	g_assert (ARV_IS_GC_SWISS_KNIFE (node));
+	variable = arv_gc_get_node (genicam, "X");
+	g_assert (ARV_IS_GC_INTEGER_NODE (variable));
+
+	/* No value cache without register cache */
+	arv_gc_set_register_cache_policy (genicam, ARV_REGISTER_CACHE_POLICY_DISABLE);
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), NULL);
+	g_assert_cmpint (value, ==, 140);
+	arv_gc_feature_node_get_value_cache_statistics (ARV_GC_FEATURE_NODE (node), &n_hits, &n_misses);
+	g_assert_cmpint (n_hits, ==, 0);
+	g_assert_cmpint (n_misses, ==, 0);
+
+	arv_gc_set_register_cache_policy (genicam, ARV_REGISTER_CACHE_POLICY_ENABLE);
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), NULL);
+	g_assert_cmpint (value, ==, 140);
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), NULL);
+	g_assert_cmpint (value, ==, 140);
+	arv_gc_feature_node_get_value_cache_statistics (ARV_GC_FEATURE_NODE (node), &n_hits, &n_misses);
+	g_assert_cmpint (n_hits, ==, 1);
+	g_assert_cmpint (n_misses, ==, 1);
+
+	/* A write to an input invalidates the cached value of its dependents */
+	arv_gc_integer_set_value (ARV_GC_INTEGER (variable), 5, &error);
+	g_assert (error == NULL);
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), NULL);
+	g_assert_cmpint (value, ==, 150);
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), NULL);
+	g_assert_cmpint (value, ==, 150);
+	arv_gc_feature_node_get_value_cache_statistics (ARV_GC_FEATURE_NODE (node), &n_hits, &n_misses);
+	g_assert_cmpint (n_hits, ==, 2);
+	g_assert_cmpint (n_misses, ==, 2);
+
+	g_object_unref (device);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -1436,6 +1625,7 @@ main (int argc, char *argv[])
 	g_test_add_func ("/genicam/boolean", boolean_test);
 	g_test_add_func ("/genicam/float", float_test);
 	g_test_add_func ("/genicam/enumeration", enumeration_test);
+	g_test_add_func ("/genicam/enumeration-availability", enumeration_availability_test);
 	g_test_add_func ("/genicam/swissknife", swiss_knife_test);
 	g_test_add_func ("/genicam/converter", converter_test);
 	g_test_add_func ("/genicam/register", register_test);
@@ -1448,6 +1638,8 @@ main (int argc, char *argv[])
 	g_test_add_func ("/genicam/category", category_test);
 	g_test_add_func ("/genicam/lock", lock_test);
 	g_test_add_func ("/genicam/access-mode", access_mode_test);
+	g_test_add_func ("/genicam/link", link_test);
+	g_test_add_func ("/genicam/value-cache", value_cache_test);
 
 	result = g_test_run();
 
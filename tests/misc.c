@@ -1,10 +1,14 @@
 /* SPDX-License-Identifier:Unlicense */
 
 #include <glib.h>
+#include <glib/gstdio.h>
 #include <arv.h>
 #include <arvstr.h>
 #include <string.h>
 #include "../src/arvmiscprivate.h"
+#include "../src/arvqueueprivate.h"
+#include "../src/arvwakeupprivate.h"
+#include "../src/arvgenicamcacheprivate.h"
 
 #if !ARAVIS_CHECK_VERSION (ARAVIS_MAJOR_VERSION, ARAVIS_MINOR_VERSION, ARAVIS_MICRO_VERSION)
 #error
@@ -278,6 +282,162 @@ match_test (void)
 	}
 }
 
+#define QUEUE_TEST_N_ITEMS	5000
+#define QUEUE_TEST_N_PRODUCERS	4
+
+static gpointer
+queue_producer_thread (gpointer data)
+{
+	ArvQueue *queue = data;
+	int i;
+
+	for (i = 1; i <= QUEUE_TEST_N_ITEMS; i++)
+		arv_queue_push (queue, GINT_TO_POINTER (i));
+
+	return NULL;
+}
+
+static void
+queue_test (void)
+{
+	ArvQueue *queue;
+	GThread *threads[QUEUE_TEST_N_PRODUCERS];
+	gint64 sum = 0;
+	int i;
+
+	queue = arv_queue_new ();
+	g_assert (queue != NULL);
+
+	g_assert (arv_queue_try_pop (queue) == NULL);
+	g_assert (arv_queue_timeout_pop (queue, 1000) == NULL);
+	g_assert_cmpint (arv_queue_get_length (queue), ==, 0);
+
+	/* More items than the ring size, FIFO order must be preserved through the overflow queue */
+	for (i = 1; i <= QUEUE_TEST_N_ITEMS; i++)
+		arv_queue_push (queue, GINT_TO_POINTER (i));
+	g_assert_cmpint (arv_queue_get_length (queue), ==, QUEUE_TEST_N_ITEMS);
+
+	for (i = 1; i <= QUEUE_TEST_N_ITEMS / 2; i++)
+		g_assert_cmpint (GPOINTER_TO_INT (arv_queue_try_pop (queue)), ==, i);
+	for (i = QUEUE_TEST_N_ITEMS + 1; i <= QUEUE_TEST_N_ITEMS + 10; i++)
+		arv_queue_push (queue, GINT_TO_POINTER (i));
+	for (i = QUEUE_TEST_N_ITEMS / 2 + 1; i <= QUEUE_TEST_N_ITEMS + 10; i++)
+		g_assert_cmpint (GPOINTER_TO_INT (arv_queue_pop (queue)), ==, i);
+
+	g_assert (arv_queue_try_pop (queue) == NULL);
+	g_assert_cmpint (arv_queue_get_length (queue), ==, 0);
+
+	/* Concurrent producers, with a blocking consumer */
+	for (i = 0; i < QUEUE_TEST_N_PRODUCERS; i++)
+		threads[i] = g_thread_new ("producer", queue_producer_thread, queue);
+
+	for (i = 0; i < QUEUE_TEST_N_PRODUCERS * QUEUE_TEST_N_ITEMS; i++) {
+		gpointer data;
+
+		data = arv_queue_timeout_pop (queue, 10 * G_USEC_PER_SEC);
+		g_assert (data != NULL);
+		sum += GPOINTER_TO_INT (data);
+	}
+
+	for (i = 0; i < QUEUE_TEST_N_PRODUCERS; i++)
+		g_thread_join (threads[i]);
+
+	g_assert_cmpint (sum, ==, (gint64) QUEUE_TEST_N_PRODUCERS * QUEUE_TEST_N_ITEMS * (QUEUE_TEST_N_ITEMS + 1) / 2);
+	g_assert (arv_queue_try_pop (queue) == NULL);
+
+	arv_queue_free (queue);
+}
+
+static void
+queue_poll_test (void)
+{
+	ArvQueue *queue;
+	ArvWakeup *wakeup;
+	GPollFD poll_fd;
+
+	queue = arv_queue_new ();
+	wakeup = arv_wakeup_new ();
+	arv_wakeup_get_pollfd (wakeup, &poll_fd);
+
+	/* Timeout, without pending event */
+	g_assert (arv_queue_poll_pop (queue, &poll_fd, 1, 1000) == NULL);
+	g_assert_cmpint (poll_fd.revents, ==, 0);
+
+	/* Items are returned before the pending events */
+	arv_queue_push (queue, GINT_TO_POINTER (1));
+	arv_wakeup_signal (wakeup);
+	g_assert_cmpint (GPOINTER_TO_INT (arv_queue_poll_pop (queue, &poll_fd, 1, 10 * G_USEC_PER_SEC)), ==, 1);
+
+	/* Interruption by the additional descriptor, well before the timeout */
+	g_assert (arv_queue_poll_pop (queue, &poll_fd, 1, 10 * G_USEC_PER_SEC) == NULL);
+	g_assert_cmpint (poll_fd.revents & G_IO_IN, !=, 0);
+	arv_wakeup_acknowledge (wakeup);
+
+	g_assert (arv_queue_poll_pop (queue, &poll_fd, 1, 1000) == NULL);
+	g_assert_cmpint (poll_fd.revents, ==, 0);
+
+	arv_wakeup_free (wakeup);
+	arv_queue_free (queue);
+}
+
+static void
+genicam_cache_test (void)
+{
+	const char *xml = "<RegisterDescription/>";
+	const char *name;
+	GError *error = NULL;
+	GDir *dir;
+	char *directory;
+	char *key_a;
+	char *key_b;
+	char *key_c;
+	char *data;
+	size_t size;
+
+	directory = g_dir_make_tmp ("aravis-genicam-cache-XXXXXX", &error);
+	g_assert_no_error (error);
+
+	arv_genicam_cache_set_directory (directory);
+
+	key_a = arv_genicam_cache_compute_key ("GigEVision", "Vendor", "Model", "1.0", NULL);
+	key_b = arv_genicam_cache_compute_key ("GigEVision", "Vendor", "Model", "1.1", NULL);
+	key_c = arv_genicam_cache_compute_key ("GigEVision", "Vendor", "Model", "1.0", NULL);
+	g_assert_cmpstr (key_a, !=, key_b);
+	g_assert_cmpstr (key_a, ==, key_c);
+
+	g_assert (arv_genicam_cache_load (key_a, &size) == NULL);
+	g_assert_cmpint (size, ==, 0);
+
+	g_assert (arv_genicam_cache_save (key_a, xml, strlen (xml)));
+
+	data = arv_genicam_cache_load (key_a, &size);
+	g_assert (data != NULL);
+	g_assert_cmpint (size, ==, strlen (xml));
+	g_assert (memcmp (data, xml, size) == 0);
+	g_free (data);
+
+	g_assert (arv_genicam_cache_load (key_b, &size) == NULL);
+	g_assert (arv_genicam_cache_load (NULL, &size) == NULL);
+
+	arv_genicam_cache_set_directory (NULL);
+
+	dir = g_dir_open (directory, 0, &error);
+	g_assert_no_error (error);
+	while ((name = g_dir_read_name (dir)) != NULL) {
+		char *filename = g_build_filename (directory, name, NULL);
+
+		g_assert_cmpint (g_remove (filename), ==, 0);
+		g_free (filename);
+	}
+	g_dir_close (dir);
+	g_assert_cmpint (g_rmdir (directory), ==, 0);
+
+	g_free (key_a);
+	g_free (key_b);
+	g_free (key_c);
+	g_free (directory);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -294,6 +454,9 @@ main (int argc, char *argv[])
 	g_test_add_func ("/gstreamer/caps-string", caps_string_test);
 	g_test_add_func ("/misc/globs", glob_test);
 	g_test_add_func ("/misc/matches", match_test);
+	g_test_add_func ("/misc/queue", queue_test);
+	g_test_add_func ("/misc/queue-poll", queue_poll_test);
+	g_test_add_func ("/misc/genicam-cache", genicam_cache_test);
 
 
 	result = g_test_run();